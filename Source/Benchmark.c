@@ -0,0 +1,1011 @@
+/*=============================================================================*/
+/* Micro-benchmarks of the s_string library.
+
+   Every public function of 's_string.h' is measured for each width class of the
+   s_strings (tiny, small and large) that can hold the test data, with lengths
+   from 8 bytes to 16 MiB. The equivalent <string.h> (or libc) call, when there
+   is one, is measured with the same data as class 'libc'.
+
+   Left out are the '_a' variants, which run the same code as the plain ones with
+   another allocator, and the calls that only set up or report (s_*_allocator,
+   s_parallel_set_*, s_stats_* and s_trace_*).
+
+   The results go to 'stdout' as CSV, one line per function, class and size:
+
+	function,class,size,iterations,ns_per_op,gb_per_s,cycles_per_byte
+
+   'cycles_per_byte' is measured with the time-stamp counter where there is one
+   (and is zero elsewhere), so it counts reference cycles, not core cycles.
+
+   Usage: Benchmark [-t milliseconds] [-s max_size] [name ...]
+
+   -t sets the minimum time spent measuring each line (default 50 ms), -s the
+   largest size measured, and the names (or parts of names) select which
+   functions are measured. */
+/*=============================================================================*/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <locale.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/uio.h>
+#if			defined __x86_64__ || defined __i386__
+#include <x86intrin.h>
+#endif	/*	defined __x86_64__ || defined __i386__ */
+/*=============================================================================*/
+#include "s_string.h"
+/*=============================================================================*/
+/* The needle searched for is never in the data, so every search scans it all. */
+#define	NEEDLE			"qzxj#"
+#define	CHARSET_MISS	"#$%"
+#define	CHARSET_HIT		"abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+#define	DELIMITERS		" ,"
+/*============================================================================*/
+typedef struct
+	{
+	ssize_t		Size;		/* Number of characters of the test data. */
+	char		*Data;		/* 'Size' letters and spaces, NUL terminated. */
+	char		*Data2;		/* An identical copy of 'Data'. */
+	char		*CDst;		/* Destination for the libc calls. */
+	size_t		CDstSize;
+	s_string_t	*Str;		/* The same as 'Data', in the class being measured. */
+	s_string_t	*Str2;		/* An identical copy of 'Str'. */
+	s_string_t	*StrU;		/* 'Size' bytes of UTF-8 text with multi-byte characters. */
+	s_string_t	*StrUX;		/* The same as 'StrU', with a header extension. */
+	s_string_t	*Dst;		/* Writable destination, with room for the data plus a few characters. */
+	s_string_t	*Half[2];	/* The two halves of 'Str', for the joins. */
+	s_string_t	*Needle;
+	s_string_t	*Sep;
+	s_string_t	*Charset;
+	s_string_t	*Delims;
+	s_string_t	*IntStr;
+	s_string_t	*FltStr;
+	int			NullFd;		/* '/dev/null', for the writes. */
+	FILE		*NullFile;
+	int			FileFd;		/* A temporary file with 'Data' split in lines. */
+	FILE		*File;
+	char		Path[64];
+	s_writer_t	*Writer;
+	s_strvec_t	*Vec;		/* Scratch vector, emptied before each use. */
+	s_strvec_t	*Words;		/* The tokens of 'Str'. */
+	uint64_t	*Mask;		/* One bit for each of 'Words'. */
+	s_string_t	**Tokens;	/* The same as 'Words', as s_strings. */
+	s_string_t	**Sorted;	/* Scratch copy of 'Tokens'. */
+	ssize_t		TokenCount;
+	s_map_t		*Map;		/* The 'Tokens', each with its index. */
+	} bench_ctx_t;
+/*============================================================================*/
+#define	B_LIBC		1	/* A libc reference, measured once per size as class 'libc'. */
+#define	B_NOCLASS	2	/* Uses no s_string of the class being measured, measured once per size as class '-'. */
+#define	B_FIXED		4	/* Its cost doesn't depend on the size, measured at the smallest size only. */
+
+typedef struct
+	{
+	const char	*Name;
+	size_t		(*Function)( bench_ctx_t * restrict c );
+	int			Flags;
+	ssize_t		Bytes;		/* The bytes processed by a 'B_FIXED' function. */
+	} bench_t;
+/*============================================================================*/
+static volatile size_t	Sink;
+static ssize_t			FindAllOut[64];
+/*============================================================================*/
+static uint64_t Nanoseconds( void )
+	{
+	struct timespec	t;
+
+	clock_gettime( CLOCK_MONOTONIC, &t );
+
+	return (uint64_t)t.tv_sec * 1000000000u + t.tv_nsec;
+	}
+/*============================================================================*/
+static uint64_t Cycles( void )
+	{
+#if			defined __x86_64__ || defined __i386__
+	return __rdtsc();
+#else	/*	defined __x86_64__ || defined __i386__ */
+	return 0;
+#endif	/*	defined __x86_64__ || defined __i386__ */
+	}
+/*============================================================================*/
+/* Simple functions, whose cost is a single call. */
+#define	BENCH( name, expr )	static size_t Bench_##name( bench_ctx_t * restrict c ) { return (size_t)( expr ); }
+
+BENCH( s_isreadonly,		s_isreadonly( c->Str ))
+BENCH( s_strmaxlen,			s_strmaxlen( c->Str ))
+BENCH( s_strlen,			s_strlen( c->Str ))
+BENCH( strlen,				strlen( c->Data ))
+BENCH( s_strllen,			s_strllen( c->Str, c->Size / 2 ))
+BENCH( s_strnlen,			s_strnlen( c->Str, c->Size / 2 ))
+BENCH( strnlen,				strnlen( c->Data, c->Size ))
+BENCH( s_strchr,			s_strchr( c->Str, 0, '#' ))
+BENCH( strchr,				strchr( c->Data, '#' ) != NULL )
+BENCH( s_strrchr,			s_strrchr( c->Str, -1, '#' ))
+BENCH( strrchr,				strrchr( c->Data, '#' ) != NULL )
+BENCH( s_strichr,			s_strichr( c->Str, 0, '#' ))
+BENCH( s_strrichr,			s_strrichr( c->Str, -1, '#' ))
+BENCH( s_strstr,			s_strstr( c->Str, 0, c->Needle, 0 ))
+BENCH( s_strstr_par,		s_strstr_par( c->Str, 0, c->Needle, 0 ))
+BENCH( s_strcount_chr,		s_strcount_chr( c->Str, 0, 'e' ))
+BENCH( s_strcount,			s_strcount( c->Str, 0, c->Needle ))
+BENCH( s_findall,			s_findall( c->Str, c->Needle, FindAllOut, sizeof FindAllOut / sizeof FindAllOut[0] ))
+BENCH( s_strstr_c,			s_strstr_c( c->Str, 0, NEEDLE ))
+BENCH( c_strstr_s,			c_strstr_s( c->Data, c->Needle, 0 ))
+BENCH( strstr,				strstr( c->Data, NEEDLE ) != NULL )
+BENCH( s_stristr,			s_stristr( c->Str, 0, c->Needle, 0 ))
+BENCH( s_stristr_c,			s_stristr_c( c->Str, 0, NEEDLE ))
+BENCH( c_stristr_s,			c_stristr_s( c->Data, c->Needle, 0 ))
+BENCH( strcasestr,			strcasestr( c->Data, NEEDLE ) != NULL )
+BENCH( s_strpbrk,			s_strpbrk( c->Str, 0, c->Charset, 0 ))
+BENCH( s_strpbrk_c,			s_strpbrk_c( c->Str, 0, CHARSET_MISS ))
+BENCH( strpbrk,				strpbrk( c->Data, CHARSET_MISS ) != NULL )
+BENCH( s_strspn,			s_strspn( c->Str, 0, c->Charset, 0 ))
+BENCH( s_strspn_c,			s_strspn_c( c->Str, 0, CHARSET_HIT ))
+BENCH( strspn,				strspn( c->Data, CHARSET_HIT ))
+BENCH( s_strcspn,			s_strcspn( c->Str, 0, c->Charset, 0 ))
+BENCH( s_strcspn_c,			s_strcspn_c( c->Str, 0, CHARSET_MISS ))
+BENCH( strcspn,				strcspn( c->Data, CHARSET_MISS ))
+BENCH( s_charat,			s_charat( c->Str, c->Size / 2 ))
+BENCH( s_constcstr,			(uintptr_t)s_constcstr( c->Str, 0 ))
+BENCH( s_setcharat,			s_setcharat( c->Dst, 0, 'x', ' ' ))
+BENCH( s_strcmp,			s_strcmp( c->Str, 0, c->Str2, 0 ))
+BENCH( s_strkey,			s_strkey( c->Str ))
+BENCH( s_strkey_x,			s_strkey( c->StrUX ))
+BENCH( s_strcmp_c,			s_strcmp_c( c->Str, 0, c->Data2 ))
+BENCH( c_strcmp_s,			c_strcmp_s( c->Data, c->Str2, 0 ))
+BENCH( strcmp,				strcmp( c->Data, c->Data2 ))
+BENCH( s_stricmp,			s_stricmp( c->Str, 0, c->Str2, 0 ))
+BENCH( s_stricmp_c,			s_stricmp_c( c->Str, 0, c->Data2 ))
+BENCH( c_stricmp_s,			c_stricmp_s( c->Data, c->Str2, 0 ))
+BENCH( strcasecmp,			strcasecmp( c->Data, c->Data2 ))
+BENCH( s_strncmp,			s_strncmp( c->Str, 0, c->Str2, 0, c->Size ))
+BENCH( s_strncmp_c,			s_strncmp_c( c->Str, 0, c->Data2, c->Size ))
+BENCH( c_strncmp_s,			c_strncmp_s( c->Data, c->Str2, 0, c->Size ))
+BENCH( strncmp,				strncmp( c->Data, c->Data2, c->Size ))
+BENCH( s_strnicmp,			s_strnicmp( c->Str, 0, c->Str2, 0, c->Size ))
+BENCH( s_strnicmp_c,		s_strnicmp_c( c->Str, 0, c->Data2, c->Size ))
+BENCH( c_strnicmp_s,		c_strnicmp_s( c->Data, c->Str2, 0, c->Size ))
+BENCH( strncasecmp,			strncasecmp( c->Data, c->Data2, c->Size ))
+BENCH( s_view,				s_view( c->Str, 0, s_strlen( c->Str )).Len )
+BENCH( s_view_c,			s_view_c( c->Data ).Len )
+BENCH( s_parse_i64_v,		({ int64_t v; s_parse_i64_v( s_view( c->IntStr, 0, s_strlen( c->IntStr )), &v ) + v; }))
+BENCH( s_parse_i64,			({ int64_t v; s_parse_i64( c->IntStr, 0, s_strlen( c->IntStr ), &v ) + v; }))
+BENCH( strtoll,				strtoll( s_constcstr( c->IntStr, 0 ), NULL, 10 ))
+BENCH( s_parse_u64_v,		({ uint64_t v; s_parse_u64_v( s_view( c->IntStr, 1, s_strlen( c->IntStr )), &v ) + v; }))
+BENCH( s_parse_u64,			({ uint64_t v; s_parse_u64( c->IntStr, 1, s_strlen( c->IntStr ), &v ) + v; }))
+BENCH( strtoull,			strtoull( s_constcstr( c->IntStr, 1 ), NULL, 10 ))
+BENCH( s_parse_f64_v,		({ double v; s_parse_f64_v( s_view( c->FltStr, 0, s_strlen( c->FltStr )), &v ) + (size_t)v; }))
+BENCH( s_parse_f64,			({ double v; s_parse_f64( c->FltStr, 0, s_strlen( c->FltStr ), &v ) + (size_t)v; }))
+BENCH( strtod,				(size_t)strtod( s_constcstr( c->FltStr, 0 ), NULL ))
+BENCH( s_utf8_validate,		s_utf8_validate( c->StrU ))
+BENCH( s_utf8_validate_v,	s_utf8_validate_v( s_view( c->StrU, 0, s_strlen( c->StrU ))))
+BENCH( s_utf8_len,			s_utf8_len( c->StrU ))
+BENCH( s_utf8_len_v,		s_utf8_len_v( s_view( c->StrU, 0, s_strlen( c->StrU ))))
+BENCH( mbstowcs,			mbstowcs( NULL, s_constcstr( c->StrU, 0 ), 0 ))
+BENCH( s_utf8_offset,		s_utf8_offset( c->StrU, -1 ))
+BENCH( s_utf8_offset_x,		s_utf8_offset( c->StrUX, -1 ))
+BENCH( s_utf8_at,			s_utf8_at( c->StrU, -1 ))
+BENCH( s_utf8_at_x,			s_utf8_at( c->StrUX, -1 ))
+BENCH( s_write,				s_write( c->NullFd, c->Str ))
+BENCH( write,				write( c->NullFd, c->Data, c->Size ))
+BENCH( s_writev,			s_writev( c->NullFd, 2, (const s_string_t * const *)c->Half ))
+BENCH( s_writer_put,		s_writer_put( c->Writer, c->Str ))
+BENCH( s_writer_put_v,		s_writer_put_v( c->Writer, s_view( c->Str, 0, s_strlen( c->Str ))))
+BENCH( s_writer_flush,		s_writer_flush( c->Writer ))
+BENCH( fwrite,				fwrite( c->Data, 1, c->Size, c->NullFile ))
+BENCH( s_strvec_append_v,	( s_strvec_clear( c->Vec ), s_strvec_append_v( c->Vec, s_view( c->Str, 0, c->Size ))))
+BENCH( s_strvec_tok,		( s_strvec_clear( c->Vec ), s_strvec_tok( c->Vec, c->Str, c->Delims, 0 )))
+BENCH( s_strvec_find,		s_strvec_find( c->Words, c->Needle ))
+BENCH( s_strvec_eq_mask,	s_strvec_eq_mask( c->Words, c->Needle, c->Mask ))
+/*============================================================================*/
+/* Functions that change their destination, which is emptied (or filled again)
+   before each call. The libc references do the same. */
+#define	BENCH_EMPTY( name, expr )	static size_t Bench_##name( bench_ctx_t * restrict c ) { s_truncate( c->Dst, 0 ); return (size_t)( expr ); }
+#define	BENCH_CEMPTY( name, expr )	static size_t Bench_##name( bench_ctx_t * restrict c ) { c->CDst[0] = '\0'; return (size_t)( expr ); }
+#define	BENCH_FILL( name, expr )	static size_t Bench_##name( bench_ctx_t * restrict c ) { s_strcpy( c->Dst, c->Str, 0 ); return (size_t)( expr ); }
+#define	BENCH_CFILL( name, expr )	static size_t Bench_##name( bench_ctx_t * restrict c ) { memcpy( c->CDst, c->Data, c->Size + 1 ); return (size_t)( expr ); }
+
+BENCH_EMPTY(	s_appendchar,		s_appendchar( c->Dst, 'x' ))
+BENCH_EMPTY(	s_truncate,			s_truncate( c->Dst, 0 ))
+BENCH_EMPTY(	s_strcat,			s_strcat( c->Dst, c->Str, 0 ))
+BENCH_EMPTY(	s_strcat_c,			s_strcat_c( c->Dst, c->Data ))
+BENCH_EMPTY(	s_strlcat,			s_strlcat( c->Dst, c->Str, 0, c->Size ))
+BENCH_EMPTY(	s_strlcat_c,		s_strlcat_c( c->Dst, c->Data, c->Size ))
+BENCH_EMPTY(	s_strncat,			s_strncat( c->Dst, c->Str, 0, c->Size ))
+BENCH_EMPTY(	s_strncat_c,		s_strncat_c( c->Dst, c->Data, c->Size ))
+BENCH_CEMPTY(	strcat,				(uintptr_t)strcat( c->CDst, c->Data ))
+BENCH_CEMPTY(	strncat,			(uintptr_t)strncat( c->CDst, c->Data, c->Size ))
+BENCH_EMPTY(	s_strcpy,			s_strcpy( c->Dst, c->Str, 0 ))
+BENCH_EMPTY(	s_strcpy_c,			s_strcpy_c( c->Dst, c->Data ))
+BENCH_EMPTY(	s_strlcpy,			s_strlcpy( c->Dst, c->Str, 0, c->Size ))
+BENCH_EMPTY(	s_strlcpy_c,		s_strlcpy_c( c->Dst, c->Data, c->Size ))
+BENCH_CEMPTY(	strcpy,				(uintptr_t)strcpy( c->CDst, c->Data ))
+BENCH_CEMPTY(	memcpy,				(uintptr_t)memcpy( c->CDst, c->Data, c->Size + 1 ))
+BENCH_EMPTY(	s_extract_e,		s_extract_e( c->Dst, c->Str, 0, c->Size - 1 ))
+BENCH_EMPTY(	s_extract_ec,		s_extract_ec( c->Dst, c->Data, 0, c->Size - 1 ))
+BENCH_EMPTY(	s_extract_l,		s_extract_l( c->Dst, c->Str, 0, c->Size ))
+BENCH_EMPTY(	s_extract_lc,		s_extract_lc( c->Dst, c->Data, 0, c->Size ))
+BENCH_EMPTY(	s_replace_de,		s_replace_de( c->Dst, 0, c->Size - 1, c->Str, 0, ' ' ))
+BENCH_EMPTY(	s_replace_se,		s_replace_se( c->Dst, 0, c->Str, 0, c->Size - 1, ' ' ))
+BENCH_EMPTY(	s_replace_ec,		s_replace_ec( c->Dst, 0, c->Size - 1, c->Data, ' ' ))
+BENCH_EMPTY(	s_replace_l,		s_replace_l( c->Dst, 0, c->Size, c->Str, 0, ' ' ))
+BENCH_EMPTY(	s_replace_lc,		s_replace_lc( c->Dst, 0, c->Size, c->Data, ' ' ))
+BENCH_EMPTY(	s_sprintf,			s_sprintf( c->Dst, "%s", c->Data ))
+BENCH_EMPTY(	s_catprintf,		s_catprintf( c->Dst, "%s", c->Data ))
+BENCH_CEMPTY(	snprintf,			snprintf( c->CDst, c->CDstSize, "%s", c->Data ))
+BENCH_EMPTY(	s_append_i64,		s_append_i64( c->Dst, -1234567890123456789ll ))
+BENCH_EMPTY(	s_append_u64,		s_append_u64( c->Dst, 12345678901234567890ull ))
+BENCH_EMPTY(	s_append_x64,		s_append_x64( c->Dst, 0x123456789abcdefull, 0 ))
+BENCH_EMPTY(	s_append_X64,		s_append_X64( c->Dst, 0x123456789abcdefull, 0 ))
+BENCH_EMPTY(	s_append_f64,		s_append_f64( c->Dst, 3.141592653589793 ))
+BENCH_CEMPTY(	snprintf_lld,		snprintf( c->CDst, c->CDstSize, "%lld", -1234567890123456789ll ))
+BENCH_CEMPTY(	snprintf_llu,		snprintf( c->CDst, c->CDstSize, "%llu", 12345678901234567890ull ))
+BENCH_CEMPTY(	snprintf_llx,		snprintf( c->CDst, c->CDstSize, "%llx", 0x123456789abcdefull ))
+BENCH_CEMPTY(	snprintf_g,			snprintf( c->CDst, c->CDstSize, "%.17g", 3.141592653589793 ))
+BENCH_EMPTY(	s_join,				s_join( c->Dst, c->Sep, 2, (const s_string_t * const *)c->Half ))
+BENCH_EMPTY(	s_concat,			s_concat( c->Dst, 2, (const s_string_t * const *)c->Half ))
+BENCH_FILL(		s_delete_e,			s_delete_e( c->Dst, 0, 0 ))
+BENCH_FILL(		s_delete_l,			s_delete_l( c->Dst, 0, 1 ))
+BENCH_FILL(		s_insert_l,			s_insert_l( c->Dst, 0, c->Needle, 0, 1, ' ' ))
+BENCH_CFILL(	memmove,			(uintptr_t)memmove( c->CDst, c->CDst + 1, c->Size ))
+/*============================================================================*/
+/* Functions that return a new s_string, which is destroyed right away. The libc
+   references do the same. */
+#define	BENCH_NEW( name, expr )		static size_t Bench_##name( bench_ctx_t * restrict c ) { s_string_t *s = ( expr ); size_t r = s != NULL; s_free( s ); return r; }
+#define	BENCH_CNEW( name, expr )	static size_t Bench_##name( bench_ctx_t * restrict c ) { char *s = ( expr ); size_t r = s != NULL; free( s ); return r; }
+
+BENCH_NEW(		s_extract_me,		s_extract_me( c->Str, 0, c->Size - 1 ))
+BENCH_NEW(		s_extract_mec,		s_extract_mec( c->Data, 0, c->Size - 1 ))
+BENCH_NEW(		s_extract_ml,		s_extract_ml( c->Str, 0, c->Size ))
+BENCH_NEW(		s_extract_mlc,		s_extract_mlc( c->Data, 0, c->Size ))
+BENCH_NEW(		s_strdup,			s_strdup( c->Str, 0 ))
+BENCH_NEW(		s_strdup_c,			s_strdup_c( c->Data ))
+BENCH_NEW(		s_strdup_x,			s_strdup_x( c->Str, 0 ))
+BENCH_NEW(		s_strdup_xc,		s_strdup_xc( c->Data ))
+BENCH_NEW(		s_strldup,			s_strldup( c->Str, 0, c->Size ))
+BENCH_NEW(		s_strldup_c,		s_strldup_c( c->Data, c->Size ))
+BENCH_NEW(		s_strndup,			s_strndup( c->Str, 0, c->Size ))
+BENCH_NEW(		s_strndup_c,		s_strndup_c( c->Data, c->Size ))
+BENCH_CNEW(		strdup,				strdup( c->Data ))
+BENCH_CNEW(		strndup,			strndup( c->Data, c->Size ))
+BENCH_NEW(		s_join_m,			s_join_m( c->Sep, 2, (const s_string_t * const *)c->Half ))
+BENCH_NEW(		s_concat_m,			s_concat_m( 2, (const s_string_t * const *)c->Half ))
+BENCH_NEW(		s_wrap_const,		s_wrap_const( c->Data, c->Size ))
+BENCH_NEW(		s_strvec_get_m,		s_strvec_get_m( c->Words, -1 ))
+/*============================================================================*/
+static size_t Bench_s_adopt( bench_ctx_t * restrict c )
+	{
+	s_string_t	*s	= s_adopt( malloc( 64 ), 0, 63, free );
+	size_t		r	= s != NULL;
+
+	(void)c;
+	s_free( s );
+
+	return r;
+	}
+/*============================================================================*/
+static size_t Bench_s_strvec_from( bench_ctx_t * restrict c )
+	{
+	s_strvec_t	*Vec	= s_strvec_from( 2, (const s_string_t * const *)c->Half );
+	size_t		r		= Vec != NULL;
+
+	s_strvec_free( Vec );
+
+	return r;
+	}
+/*============================================================================*/
+/* The tokens are sorted again from their original order every time. */
+static size_t Bench_s_sort( bench_ctx_t * restrict c )
+	{
+	memcpy( c->Sorted, c->Tokens, c->TokenCount * sizeof c->Sorted[0] );
+
+	return s_sort( c->Sorted, c->TokenCount, 0 ) == 0;
+	}
+/*============================================================================*/
+static size_t Bench_s_map_set( bench_ctx_t * restrict c )
+	{
+	s_map_t	*Map	= s_map_new( 0, 0 );
+	ssize_t	i;
+	size_t	r		= 0;
+
+	for( i = 0; i < c->TokenCount; i++ )
+		r  += s_map_set( Map, c->Tokens[i], (void*)i );
+
+	s_map_free( Map );
+
+	return r;
+	}
+/*============================================================================*/
+static size_t Bench_s_map_get( bench_ctx_t * restrict c )
+	{
+	void	*Value;
+	ssize_t	i;
+	size_t	r	= 0;
+
+	for( i = 0; i < c->TokenCount; i++ )
+		r  += s_map_get( c->Map, c->Tokens[i], &Value );
+
+	return r;
+	}
+/*============================================================================*/
+/* The map is filled again every time, so this measures s_map_set too. */
+static size_t Bench_s_map_del( bench_ctx_t * restrict c )
+	{
+	s_map_t	*Map	= s_map_new( c->TokenCount, 0 );
+	ssize_t	i;
+	size_t	r		= 0;
+
+	for( i = 0; i < c->TokenCount; i++ )
+		s_map_set( Map, c->Tokens[i], NULL );
+
+	for( i = 0; i < c->TokenCount; i++ )
+		r  += s_map_del( Map, c->Tokens[i] );
+
+	s_map_free( Map );
+
+	return r;
+	}
+/*============================================================================*/
+static ssize_t CallVsprintf( s_string_t *dst, int cat, const char *format, ... )
+	{
+	va_list	ap;
+	ssize_t	Result;
+
+	va_start( ap, format );
+	Result	= cat ? s_vcatprintf( dst, format, ap ) : s_vsprintf( dst, format, ap );
+	va_end( ap );
+
+	return Result;
+	}
+/*============================================================================*/
+BENCH_EMPTY(	s_vsprintf,			CallVsprintf( c->Dst, 0, "%s", c->Data ))
+BENCH_EMPTY(	s_vcatprintf,		CallVsprintf( c->Dst, 1, "%s", c->Data ))
+/*============================================================================*/
+/* The tokenizers walk all the tokens of the data. */
+static size_t Bench_s_strtok( bench_ctx_t * restrict c )
+	{
+	ssize_t	Start = 0, Len, Sum = 0;
+
+	while( s_strtok( c->Str, &Start, c->Delims, 0, &Len ) >= 0 )
+		Sum	   += Len;
+
+	return Sum;
+	}
+/*============================================================================*/
+static size_t Bench_s_strtok_c( bench_ctx_t * restrict c )
+	{
+	ssize_t	Start = 0, Len, Sum = 0;
+
+	while( s_strtok_c( c->Str, &Start, DELIMITERS, &Len ) >= 0 )
+		Sum	   += Len;
+
+	return Sum;
+	}
+/*============================================================================*/
+static size_t Bench_s_strtok_s( bench_ctx_t * restrict c )
+	{
+	ssize_t	Start = 0, Sum = 0;
+
+	while( s_strtok_s( c->Dst, c->Str, &Start, c->Delims, 0 ) >= 0 )
+		Sum	   += s_strlen( c->Dst );
+
+	return Sum;
+	}
+/*============================================================================*/
+static size_t Bench_s_strtok_sc( bench_ctx_t * restrict c )
+	{
+	ssize_t	Start = 0, Sum = 0;
+
+	while( s_strtok_sc( c->Dst, c->Str, &Start, DELIMITERS ) >= 0 )
+		Sum	   += s_strlen( c->Dst );
+
+	return Sum;
+	}
+/*============================================================================*/
+static size_t Bench_s_strtok_m( bench_ctx_t * restrict c )
+	{
+	ssize_t		Start = 0, Sum = 0;
+	s_string_t	*Token;
+
+	while(( Token = s_strtok_m( c->Str, &Start, c->Delims, 0 )) != NULL )
+		{
+		Sum	   += s_strlen( Token );
+		s_free( Token );
+		}
+
+	return Sum;
+	}
+/*============================================================================*/
+static size_t Bench_s_strtok_mc( bench_ctx_t * restrict c )
+	{
+	ssize_t		Start = 0, Sum = 0;
+	s_string_t	*Token;
+
+	while(( Token = s_strtok_mc( c->Str, &Start, DELIMITERS )) != NULL )
+		{
+		Sum	   += s_strlen( Token );
+		s_free( Token );
+		}
+
+	return Sum;
+	}
+/*============================================================================*/
+/* The non-destructive libc equivalent of the tokenizers. */
+static size_t Bench_strspn_strcspn( bench_ctx_t * restrict c )
+	{
+	const char	*p = c->Data;
+	size_t		Len, Sum = 0;
+
+	while( *( p += strspn( p, DELIMITERS )) != '\0' )
+		{
+		Len		= strcspn( p, DELIMITERS );
+		Sum	   += Len;
+		p	   += Len;
+		}
+
+	return Sum;
+	}
+/*============================================================================*/
+static size_t Bench_strtok_r( bench_ctx_t * restrict c )
+	{
+	char	*Save, *Token;
+	size_t	Sum = 0;
+
+	memcpy( c->CDst, c->Data, c->Size + 1 );
+
+	for( Token = strtok_r( c->CDst, DELIMITERS, &Save ); Token != NULL; Token = strtok_r( NULL, DELIMITERS, &Save ))
+		Sum	   += strlen( Token );
+
+	return Sum;
+	}
+/*============================================================================*/
+static size_t Bench_writev( bench_ctx_t * restrict c )
+	{
+	struct iovec	v[2];
+
+	v[0].iov_base	= c->Data;
+	v[0].iov_len	= c->Size / 2;
+	v[1].iov_base	= c->Data + c->Size / 2;
+	v[1].iov_len	= c->Size - c->Size / 2;
+
+	return writev( c->NullFd, v, 2 );
+	}
+/*============================================================================*/
+static size_t Bench_s_writer_open( bench_ctx_t * restrict c )
+	{
+	return s_writer_close( s_writer_open( c->NullFd, 0 ));
+	}
+/*============================================================================*/
+/* The line readers read the whole temporary file. */
+static size_t Bench_s_getline( bench_ctx_t * restrict c )
+	{
+	s_reader_t	*Reader;
+	ssize_t		Len, Sum = 0;
+
+	lseek( c->FileFd, 0, SEEK_SET );
+	Reader	= s_reader_open( c->FileFd, 65536 );
+
+	while(( Len = s_getline( Reader, c->Dst )) >= 0 )
+		Sum	   += Len;
+
+	s_reader_close( Reader );
+
+	return Sum;
+	}
+/*============================================================================*/
+static size_t Bench_s_getline_v( bench_ctx_t * restrict c )
+	{
+	s_reader_t	*Reader;
+	s_view_t	Line;
+	ssize_t		Len, Sum = 0;
+
+	lseek( c->FileFd, 0, SEEK_SET );
+	Reader	= s_reader_open( c->FileFd, 65536 );
+
+	while(( Len = s_getline_v( Reader, &Line )) >= 0 )
+		Sum	   += Len;
+
+	s_reader_close( Reader );
+
+	return Sum;
+	}
+/*============================================================================*/
+static size_t Bench_getline( bench_ctx_t * restrict c )
+	{
+	static char		*Line		= NULL;
+	static size_t	LineSize	= 0;
+	ssize_t			Len, Sum = 0;
+
+	rewind( c->File );
+
+	while(( Len = getline( &Line, &LineSize, c->File )) >= 0 )
+		Sum	   += Len;
+
+	return Sum;
+	}
+/*============================================================================*/
+/* The whole temporary file is mapped (or read) and scanned. */
+static size_t Bench_s_mmap_file( bench_ctx_t * restrict c )
+	{
+	s_string_t	*Str	= s_mmap_file( c->Path, S_ACCESS_SEQUENTIAL );
+	ssize_t		Result	= s_strchr( Str, 0, '#' );
+
+	s_free( Str );
+
+	return Result;
+	}
+/*============================================================================*/
+static size_t Bench_s_mmap_advise( bench_ctx_t * restrict c )
+	{
+	s_string_t	*Str	= s_mmap_file( c->Path, S_ACCESS_NORMAL );
+	int			Result	= s_mmap_advise( Str, S_ACCESS_WILLNEED );
+
+	s_free( Str );
+
+	return Result;
+	}
+/*============================================================================*/
+static size_t Bench_read( bench_ctx_t * restrict c )
+	{
+	int		Fd		= open( c->Path, O_RDONLY );
+	ssize_t	Len		= read( Fd, c->CDst, c->CDstSize - 1 );
+
+	close( Fd );
+	c->CDst[Len > 0 ? Len : 0]	= '\0';
+
+	return strchr( c->CDst, '#' ) != NULL;
+	}
+/*============================================================================*/
+#define	B( name, flags )			{ #name, Bench_##name, flags, 0 }
+#define	BF( name, flags, bytes )	{ #name, Bench_##name, ( flags ) | B_FIXED, bytes }
+
+static const bench_t	Benchmarks[]	=
+	{
+	BF( s_isreadonly,		0,					1 ),
+	BF( s_strmaxlen,		0,					1 ),
+	BF( s_strlen,			0,					1 ),
+	B(	strlen,				B_LIBC ),
+	BF( s_strllen,			0,					1 ),
+	BF( s_strnlen,			0,					1 ),
+	B(	strnlen,			B_LIBC ),
+	B(	s_strchr,			0 ),
+	B(	s_strrchr,			0 ),
+	B(	s_strichr,			0 ),
+	B(	s_strrichr,			0 ),
+	B(	strchr,				B_LIBC ),
+	B(	strrchr,			B_LIBC ),
+	B(	s_strstr,			0 ),
+	B(	s_strstr_par,		0 ),
+	B(	s_strcount_chr,		0 ),
+	B(	s_strcount,			0 ),
+	B(	s_findall,			0 ),
+	B(	s_strstr_c,			0 ),
+	B(	c_strstr_s,			0 ),
+	B(	strstr,				B_LIBC ),
+	B(	s_stristr,			0 ),
+	B(	s_stristr_c,		0 ),
+	B(	c_stristr_s,		0 ),
+	B(	strcasestr,			B_LIBC ),
+	B(	s_strpbrk,			0 ),
+	B(	s_strpbrk_c,		0 ),
+	B(	strpbrk,			B_LIBC ),
+	B(	s_strspn,			0 ),
+	B(	s_strspn_c,			0 ),
+	B(	strspn,				B_LIBC ),
+	B(	s_strcspn,			0 ),
+	B(	s_strcspn_c,		0 ),
+	B(	strcspn,			B_LIBC ),
+	BF( s_charat,			0,					1 ),
+	BF( s_constcstr,		0,					1 ),
+	BF( s_setcharat,		0,					1 ),
+	BF( s_appendchar,		0,					1 ),
+	BF( s_truncate,			0,					1 ),
+	B(	s_delete_e,			0 ),
+	B(	s_delete_l,			0 ),
+	B(	s_insert_l,			0 ),
+	B(	memmove,			B_LIBC ),
+	B(	s_strcat,			0 ),
+	B(	s_strcat_c,			0 ),
+	B(	s_strlcat,			0 ),
+	B(	s_strlcat_c,		0 ),
+	B(	s_strncat,			0 ),
+	B(	s_strncat_c,		0 ),
+	B(	strcat,				B_LIBC ),
+	B(	strncat,			B_LIBC ),
+	B(	s_strcpy,			0 ),
+	B(	s_strcpy_c,			0 ),
+	B(	s_strlcpy,			0 ),
+	B(	s_strlcpy_c,		0 ),
+	B(	strcpy,				B_LIBC ),
+	B(	memcpy,				B_LIBC ),
+	B(	s_strcmp,			0 ),
+	BF( s_strkey,			0,					8 ),
+	BF( s_strkey_x,			B_NOCLASS,			8 ),
+	B(	s_strcmp_c,			0 ),
+	B(	c_strcmp_s,			0 ),
+	B(	strcmp,				B_LIBC ),
+	B(	s_stricmp,			0 ),
+	B(	s_stricmp_c,		0 ),
+	B(	c_stricmp_s,		0 ),
+	B(	strcasecmp,			B_LIBC ),
+	B(	s_strncmp,			0 ),
+	B(	s_strncmp_c,		0 ),
+	B(	c_strncmp_s,		0 ),
+	B(	strncmp,			B_LIBC ),
+	B(	s_strnicmp,			0 ),
+	B(	s_strnicmp_c,		0 ),
+	B(	c_strnicmp_s,		0 ),
+	B(	strncasecmp,		B_LIBC ),
+	B(	s_strtok,			0 ),
+	B(	s_strtok_c,			0 ),
+	B(	s_strtok_s,			0 ),
+	B(	s_strtok_sc,		0 ),
+	B(	s_strtok_m,			0 ),
+	B(	s_strtok_mc,		0 ),
+	B(	strspn_strcspn,		B_LIBC ),
+	B(	strtok_r,			B_LIBC ),
+	B(	s_extract_e,		0 ),
+	B(	s_extract_ec,		0 ),
+	B(	s_extract_l,		0 ),
+	B(	s_extract_lc,		0 ),
+	B(	s_extract_me,		0 ),
+	B(	s_extract_mec,		B_NOCLASS ),
+	B(	s_extract_ml,		0 ),
+	B(	s_extract_mlc,		B_NOCLASS ),
+	B(	s_replace_de,		0 ),
+	B(	s_replace_se,		0 ),
+	B(	s_replace_ec,		0 ),
+	B(	s_replace_l,		0 ),
+	B(	s_replace_lc,		0 ),
+	B(	s_strdup,			0 ),
+	B(	s_strdup_c,			B_NOCLASS ),
+	B(	s_strdup_x,			0 ),
+	B(	s_strdup_xc,		B_NOCLASS ),
+	B(	s_strldup,			0 ),
+	B(	s_strldup_c,		B_NOCLASS ),
+	B(	s_strndup,			0 ),
+	B(	s_strndup_c,		B_NOCLASS ),
+	B(	strdup,				B_LIBC ),
+	B(	strndup,			B_LIBC ),
+	B(	s_sprintf,			0 ),
+	B(	s_vsprintf,			0 ),
+	B(	s_catprintf,		0 ),
+	B(	s_vcatprintf,		0 ),
+	B(	snprintf,			B_LIBC ),
+	BF( s_append_i64,		0,					20 ),
+	BF( s_append_u64,		0,					20 ),
+	BF( s_append_x64,		0,					15 ),
+	BF( s_append_X64,		0,					15 ),
+	BF( s_append_f64,		0,					17 ),
+	BF( snprintf_lld,		B_LIBC,				20 ),
+	BF( snprintf_llu,		B_LIBC,				20 ),
+	BF( snprintf_llx,		B_LIBC,				15 ),
+	BF( snprintf_g,			B_LIBC,				17 ),
+	BF( s_view,				0,					1 ),
+	B(	s_view_c,			B_NOCLASS ),
+	BF( s_parse_i64,		B_NOCLASS,			20 ),
+	BF( s_parse_i64_v,		B_NOCLASS,			20 ),
+	BF( strtoll,			B_LIBC,				20 ),
+	BF( s_parse_u64,		B_NOCLASS,			19 ),
+	BF( s_parse_u64_v,		B_NOCLASS,			19 ),
+	BF( strtoull,			B_LIBC,				19 ),
+	BF( s_parse_f64,		B_NOCLASS,			22 ),
+	BF( s_parse_f64_v,		B_NOCLASS,			22 ),
+	BF( strtod,				B_LIBC,				22 ),
+	B(	s_join,				0 ),
+	B(	s_concat,			0 ),
+	B(	s_join_m,			0 ),
+	B(	s_concat_m,			0 ),
+	B(	s_utf8_validate,	0 ),
+	B(	s_utf8_validate_v,	0 ),
+	B(	s_utf8_len,			0 ),
+	B(	s_utf8_len_v,		0 ),
+	B(	mbstowcs,			B_LIBC ),
+	B(	s_utf8_offset,		0 ),
+	B(	s_utf8_offset_x,	B_NOCLASS ),
+	B(	s_utf8_at,			0 ),
+	B(	s_utf8_at_x,		B_NOCLASS ),
+	B(	s_getline,			0 ),
+	B(	s_getline_v,		B_NOCLASS ),
+	B(	getline,			B_LIBC ),
+	B(	s_mmap_file,		B_NOCLASS ),
+	B(	s_mmap_advise,		B_NOCLASS ),
+	B(	read,				B_LIBC ),
+	BF( s_adopt,			B_NOCLASS,			1 ),
+	B(	s_wrap_const,		B_NOCLASS ),
+	B(	s_write,			0 ),
+	B(	s_writev,			0 ),
+	B(	write,				B_LIBC ),
+	B(	writev,				B_LIBC ),
+	BF( s_writer_open,		B_NOCLASS,			1 ),
+	B(	s_writer_put,		0 ),
+	B(	s_writer_put_v,		0 ),
+	BF( s_writer_flush,		B_NOCLASS,			1 ),
+	B(	fwrite,				B_LIBC ),
+	B(	s_strvec_append_v,	0 ),
+	B(	s_strvec_tok,		0 ),
+	B(	s_strvec_from,		0 ),
+	BF( s_strvec_get_m,		0,					1 ),
+	B(	s_strvec_find,		0 ),
+	B(	s_strvec_eq_mask,	0 ),
+	B(	s_sort,				B_NOCLASS ),
+	B(	s_map_set,			B_NOCLASS ),
+	B(	s_map_get,			B_NOCLASS ),
+	B(	s_map_del,			B_NOCLASS ),
+	};
+/*============================================================================*/
+/* The width classes of the s_strings, by the largest length each one can hold. */
+static const struct
+	{
+	const char	*Name;
+	ssize_t		MaxLen;
+	}	Classes[]	=
+	{
+	{ "tiny",	254 },
+	{ "small",	65534 },
+	{ "large",	0 },		/* As large as needed. */
+	};
+
+static const ssize_t	Sizes[]		= { 8, 64, 512, 4096, 32768, 262144, 2097152, 16777216 };
+/*============================================================================*/
+static s_string_t *NewString( ssize_t MaxLen, const char *Src, ssize_t Len, int Extended )
+	{
+	s_string_t	*Str;
+
+	if( Extended )
+		{
+		Str	= malloc( _s_calcsize_x( MaxLen ));
+		_s_string_init_x( Str, MaxLen, 2 );
+		}
+	else
+		{
+		Str	= malloc( _s_calcsize( MaxLen ));
+		_s_string_init( Str, MaxLen, 2 );
+		}
+
+	s_strlcpy_c( Str, Src, Len );
+
+	return Str;
+	}
+/*============================================================================*/
+/* Letters in words of 1 to 12 characters, separated by spaces and commas, and
+   a new-line every 80 characters or so. */
+static void FillText( char *Dst, ssize_t Size, int Lines )
+	{
+	uint32_t	Seed	= 12345;
+	ssize_t		i, Word = 0, Column = 0;
+
+	for( i = 0; i < Size; i++ )
+		{
+		Seed	= Seed * 1103515245 + 12345;
+
+		if( Word > ( Seed >> 28 ))
+			{
+			Dst[i]	= ( Seed >> 16 ) & 1 ? ' ' : ',';
+			Word	= 0;
+			}
+		else
+			{
+			Dst[i]	= ( "abcdefghijklmnopqrstuvwxyzABCDEF" )[( Seed >> 16 ) & 31];
+			Word++;
+			}
+
+		if( Lines && ++Column >= 80 && Dst[i] == ' ' )
+			{
+			Dst[i]	= '\n';
+			Column	= 0;
+			}
+		}
+	Dst[Size]	= '\0';
+	}
+/*============================================================================*/
+/* ASCII with two, three and four byte UTF-8 sequences, cut at a character boundary. */
+static ssize_t FillUTF8( char *Dst, ssize_t Size )
+	{
+	static const char	*Pieces[]	= { "text ", "\xc3\xa9t\xc3\xa9 ", "\xe6\x97\xa5\xe6\x9c\xac ", "\xf0\x9f\x98\x80 ", "plain ascii words " };
+	ssize_t				Len = 0, i = 0, PieceLen;
+
+	while( Len + ( PieceLen = strlen( Pieces[i % 5] )) <= Size )
+		{
+		memcpy( Dst + Len, Pieces[i % 5], PieceLen );
+		Len	   += PieceLen;
+		i++;
+		}
+	while( Len < Size )
+		Dst[Len++]	= 'x';
+
+	Dst[Len]	= '\0';
+
+	return Len;
+	}
+/*============================================================================*/
+static void Measure( const bench_t *b, bench_ctx_t *c, const char *Class, uint64_t MinTime )
+	{
+	uint64_t	Iterations, i, Start, Elapsed, StartCycles, ElapsedCycles;
+	ssize_t		Bytes	= b->Flags & B_FIXED ? b->Bytes : c->Size;
+
+	/* Warm up the caches, and build whatever the library keeps between calls. */
+	Sink   += b->Function( c );
+
+	for( Iterations = 1; ; Iterations *= 2 )
+		{
+		Start		= Nanoseconds();
+		StartCycles	= Cycles();
+
+		for( i = 0; i < Iterations; i++ )
+			Sink   += b->Function( c );
+
+		ElapsedCycles	= Cycles() - StartCycles;
+		Elapsed			= Nanoseconds() - Start;
+
+		if( Elapsed >= MinTime )
+			break;
+		}
+
+	printf( "%s,%s,%zd,%llu,%.3f,%.3f,%.4f\n", b->Name, Class, c->Size, (unsigned long long)Iterations,
+			(double)Elapsed / Iterations, (double)Bytes * Iterations / Elapsed, (double)ElapsedCycles / ( (double)Bytes * Iterations ));
+	fflush( stdout );
+	}
+/*============================================================================*/
+static int Selected( const bench_t *b, int argc, char *argv[], int First )
+	{
+	int	i;
+
+	if( First >= argc )
+		return 1;
+
+	for( i = First; i < argc; i++ )
+		if( strstr( b->Name, argv[i] ) != NULL )
+			return 1;
+
+	return 0;
+	}
+/*============================================================================*/
+static void Setup( bench_ctx_t *c, ssize_t Size, ssize_t MaxLen )
+	{
+	ssize_t	Written, i;
+	char	*UTF8;
+	int		Fd;
+
+	c->Size		= Size;
+	c->Str		= NewString( MaxLen, c->Data, Size, 0 );
+	c->Str2		= NewString( MaxLen, c->Data, Size, 0 );
+	c->Dst		= NewString( MaxLen, "", 0, 0 );
+	c->Half[0]	= NewString( MaxLen, c->Data, Size / 2, 0 );
+	c->Half[1]	= NewString( MaxLen, c->Data + Size / 2, Size - Size / 2, 0 );
+
+	UTF8		= malloc( Size + 1 );
+	FillUTF8( UTF8, Size );
+	c->StrU		= NewString( MaxLen, UTF8, Size, 0 );
+	c->StrUX	= NewString( Size, UTF8, Size, 1 );
+	free( UTF8 );
+
+	c->Words	= s_strvec_new( 0, 0 );
+	s_strvec_tok( c->Words, c->Str, c->Delims, 0 );
+	c->Mask		= malloc(( s_strvec_count( c->Words ) / 64 + 1 ) * sizeof c->Mask[0] );
+
+	c->TokenCount	= s_strvec_count( c->Words );
+	c->Tokens		= malloc(( c->TokenCount + 1 ) * sizeof c->Tokens[0] );
+	c->Sorted		= malloc(( c->TokenCount + 1 ) * sizeof c->Sorted[0] );
+	c->Map			= s_map_new( c->TokenCount, 0 );
+	for( i = 0; i < c->TokenCount; i++ )
+		{
+		c->Tokens[i]	= s_strvec_get_m( c->Words, i );
+		s_map_set( c->Map, c->Tokens[i], (void*)i );
+		}
+
+	/* The temporary file for the readers has the same text, in lines. */
+	FillText( c->CDst, Size, 1 );
+	strcpy( c->Path, "/tmp/s_string_benchmark_XXXXXX" );
+	Fd			= mkstemp( c->Path );
+	Written		= write( Fd, c->CDst, Size );
+	close( Fd );
+	(void)Written;
+
+	c->FileFd	= open( c->Path, O_RDONLY );
+	c->File		= fopen( c->Path, "r" );
+	}
+/*============================================================================*/
+static void Teardown( bench_ctx_t *c )
+	{
+	s_free( c->Str );
+	s_free( c->Str2 );
+	s_free( c->Dst );
+	s_free( c->Half[0] );
+	s_free( c->Half[1] );
+	s_free( c->StrU );
+	s_free( c->StrUX );
+	s_strvec_free( c->Words );
+	free( c->Mask );
+
+	while( c->TokenCount > 0 )
+		s_free( c->Tokens[--c->TokenCount] );
+	free( c->Tokens );
+	free( c->Sorted );
+	s_map_free( c->Map );
+
+	fclose( c->File );
+	close( c->FileFd );
+	unlink( c->Path );
+	}
+/*============================================================================*/
+int main( int argc, char *argv[] )
+	{
+	bench_ctx_t	Ctx;
+	uint64_t	MinTime	= 50000000;
+	ssize_t		MaxSize	= Sizes[sizeof Sizes / sizeof Sizes[0] - 1];
+	ssize_t		MaxLen;
+	size_t		s, k, b;
+	int			First	= 1;
+
+	while( First + 1 < argc && argv[First][0] == '-' )
+		{
+		if( strcmp( argv[First], "-t" ) == 0 )
+			MinTime	= strtoull( argv[First + 1], NULL, 10 ) * 1000000;
+		else if( strcmp( argv[First], "-s" ) == 0 )
+			MaxSize	= strtoll( argv[First + 1], NULL, 10 );
+		else
+			break;
+		First  += 2;
+		}
+
+	/* 'mbstowcs' needs to know that the text is UTF-8. */
+	setlocale( LC_CTYPE, "C.UTF-8" );
+
+	memset( &Ctx, 0, sizeof Ctx );
+	Ctx.CDstSize	= MaxSize * 2 + 64;
+	Ctx.CDst		= malloc( Ctx.CDstSize );
+	Ctx.Data		= malloc( MaxSize + 1 );
+	Ctx.Data2		= malloc( MaxSize + 1 );
+	Ctx.Needle		= s_strdup_c( NEEDLE );
+	Ctx.Sep			= s_strdup_c( ", " );
+	Ctx.Charset		= s_strdup_c( CHARSET_MISS );
+	Ctx.Delims		= s_strdup_c( DELIMITERS );
+	Ctx.IntStr		= s_strdup_c( "-1234567890123456789" );
+	Ctx.FltStr		= s_strdup_c( "3.1415926535897932e-42" );
+	Ctx.NullFd		= open( "/dev/null", O_WRONLY );
+	Ctx.NullFile	= fopen( "/dev/null", "w" );
+	Ctx.Writer		= s_writer_open( Ctx.NullFd, 0 );
+	Ctx.Vec			= s_strvec_new( 0, 0 );
+
+	printf( "function,class,size,iterations,ns_per_op,gb_per_s,cycles_per_byte\n" );
+
+	for( s = 0; s < sizeof Sizes / sizeof Sizes[0] && Sizes[s] <= MaxSize; s++ )
+		{
+		/* The data, cut to this size (the tokens and the words change a bit at the end). */
+		FillText( Ctx.Data, Sizes[s], 0 );
+		memcpy( Ctx.Data2, Ctx.Data, Sizes[s] + 1 );
+
+		/* The libc references and the functions that don't depend on the class are measured only once... */
+		Setup( &Ctx, Sizes[s], Sizes[s] + 64 );
+		for( b = 0; b < sizeof Benchmarks / sizeof Benchmarks[0]; b++ )
+			if(( Benchmarks[b].Flags & ( B_LIBC | B_NOCLASS )) && ( s == 0 || !( Benchmarks[b].Flags & B_FIXED )) && Selected( &Benchmarks[b], argc, argv, First ))
+				Measure( &Benchmarks[b], &Ctx, Benchmarks[b].Flags & B_LIBC ? "libc" : "-", MinTime );
+		Teardown( &Ctx );
+
+		/* ...the rest, once for each class that can hold the data (and something more). */
+		for( k = 0; k < sizeof Classes / sizeof Classes[0]; k++ )
+			{
+			MaxLen	= Classes[k].MaxLen ? Classes[k].MaxLen : Sizes[s] + 65536;
+			if( Sizes[s] + 64 > MaxLen )
+				continue;
+
+			Setup( &Ctx, Sizes[s], MaxLen );
+			for( b = 0; b < sizeof Benchmarks / sizeof Benchmarks[0]; b++ )
+				if( !( Benchmarks[b].Flags & ( B_LIBC | B_NOCLASS )) && ( s == 0 || !( Benchmarks[b].Flags & B_FIXED )) && Selected( &Benchmarks[b], argc, argv, First ))
+					Measure( &Benchmarks[b], &Ctx, Classes[k].Name, MinTime );
+			Teardown( &Ctx );
+			}
+		}
+
+	s_writer_close( Ctx.Writer );
+	s_strvec_free( Ctx.Vec );
+
+	return 0;
+	}
+/*============================================================================*/
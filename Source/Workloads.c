@@ -0,0 +1,505 @@
+/*=============================================================================*/
+/* Workload benchmarks of the s_string library.
+
+   Each workload processes records made by a data generator, the way a real
+   program would use the library, so the costs of the calls working together
+   (copies into small buffers, searches, conversions, allocations) are measured
+   and not only the cost of each call alone:
+
+	log		Tokenizes access log lines with s_strtok_c and parses the status
+			and size fields.
+	log_m	The same, with s_strtok_mc, which allocates every token.
+	csv		Splits CSV rows at the commas (keeping the empty fields) with
+			s_strchr, copying each field with s_extract_l and parsing the
+			numeric ones.
+	header	Looks up a few HTTP headers, by name and ignoring case, with
+			s_stricmp_c.
+	path	Splits file paths in directory, name and extension, like
+			'SplitPath' in 'main.c'.
+
+   The results go to 'stdout' as CSV, one line per workload:
+
+	workload,records,repetitions,seconds,records_per_s,mb_per_s,allocs_per_record
+
+   The allocations are counted by wrapping 'malloc', 'calloc' and 'realloc',
+   so they include those made by the library and by the C library.
+
+   Usage: Workloads [-t milliseconds] [-n records] [-c columns] [-w width]
+   [-H headers] [-d depth] [-r seed] [workload ...]
+
+   -t is the minimum time spent on each workload (default 500 ms), -n the
+   number of records generated (default 100000), -c and -w the number of
+   columns and the average width of the CSV fields (default 12 and 8), -H the
+   number of headers of each request (default 16), -d the average depth of the
+   paths (default 6) and -r the seed of the generators. */
+/*=============================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+/*=============================================================================*/
+#include "s_string.h"
+/*=============================================================================*/
+#if			defined __GLIBC__
+/* Counts the allocations, handing them over to the C library. */
+extern void	*__libc_malloc( size_t Size );
+extern void	*__libc_calloc( size_t Count, size_t Size );
+extern void	*__libc_realloc( void *Ptr, size_t Size );
+
+static size_t	Allocations;
+
+void *malloc( size_t Size )
+	{
+	Allocations++;
+	return __libc_malloc( Size );
+	}
+
+void *calloc( size_t Count, size_t Size )
+	{
+	Allocations++;
+	return __libc_calloc( Count, Size );
+	}
+
+void *realloc( void *Ptr, size_t Size )
+	{
+	Allocations++;
+	return __libc_realloc( Ptr, Size );
+	}
+#else	/*	defined __GLIBC__ */
+/* There is no portable way to count them, they are reported as zero. */
+static const size_t	Allocations	= 0;
+#endif	/*	defined __GLIBC__ */
+/*=============================================================================*/
+typedef struct
+	{
+	long		Records;
+	int			Columns;
+	int			Width;
+	int			Headers;
+	int			Depth;
+	uint32_t	Seed;
+	} config_t;
+/*============================================================================*/
+/* A small and fast generator, so the data is the same on every platform. */
+static uint32_t Random( uint32_t *Seed, uint32_t Range )
+	{
+	*Seed	= *Seed * 1103515245 + 12345;
+
+	return (uint32_t)((( *Seed >> 8 ) * (uint64_t)Range ) >> 24 );
+	}
+/*============================================================================*/
+/* Appends 'Len' random characters from 'Set' to 'Dst'. */
+static void AppendRandom( s_string_t *Dst, uint32_t *Seed, const char *Set, int Len )
+	{
+	int		SetLen	= strlen( Set );
+
+	while( Len-- > 0 )
+		s_appendchar( Dst, Set[Random( Seed, SetLen )] );
+	}
+/*============================================================================*/
+/* A writable s_string in the heap for up to 'MaxLen' characters. */
+static s_string_t *NewString( ssize_t MaxLen )
+	{
+	s_string_t	*Str	= malloc( _s_calcsize( MaxLen ));
+
+	_s_string_init( Str, MaxLen, 2 );
+
+	return Str;
+	}
+/*============================================================================*/
+static const char	Lower[]		= "abcdefghijklmnopqrstuvwxyz";
+static const char	Digits[]	= "0123456789";
+/*============================================================================*/
+/* Lines in the 'combined' log format of the web servers. */
+static s_string_t *GenerateLog( const config_t *Cfg )
+	{
+	static const char	*Methods[]	= { "GET", "GET", "GET", "POST", "PUT", "HEAD" };
+	static const char	*Agents[]	= { "Mozilla/5.0 (X11; Linux x86_64; rv:109.0) Gecko/20100101 Firefox/118.0", "curl/8.4.0", "Wget/1.21.4" };
+	static const int	Statuses[]	= { 200, 200, 200, 200, 304, 301, 404, 500 };
+	s_string_t			*Log		= NewString( Cfg->Records * 256 );
+	s_string_t			*Line		= NewString( 1024 );
+	uint32_t			Seed		= Cfg->Seed;
+	long				i;
+	int					j;
+
+	for( i = 0; i < Cfg->Records; i++ )
+		{
+		s_sprintf( Line, "10.%u.%u.%u - - [10/Oct/2023:13:%02u:%02u +0000] \"%s /", Random( &Seed, 256 ), Random( &Seed, 256 ), Random( &Seed, 256 ),
+				   Random( &Seed, 60 ), Random( &Seed, 60 ), Methods[Random( &Seed, 6 )] );
+		for( j = Random( &Seed, 4 ); j >= 0; j-- )
+			{
+			AppendRandom( Line, &Seed, Lower, 3 + Random( &Seed, 8 ));
+			s_appendchar( Line, '/' );
+			}
+		s_catprintf( Line, "?id=%u HTTP/1.1\" %d %u \"-\" \"%s\"\n", Random( &Seed, 1000000 ), Statuses[Random( &Seed, 8 )],
+					 Random( &Seed, 100000 ), Agents[Random( &Seed, 3 )] );
+		s_strcat( Log, Line, 0 );
+		}
+
+	s_free( Line );
+
+	return Log;
+	}
+/*============================================================================*/
+/* Rows of 'Columns' fields: text, integers, decimals and some empty ones. */
+static s_string_t *GenerateCSV( const config_t *Cfg )
+	{
+	s_string_t	*CSV;
+	uint32_t	Seed	= Cfg->Seed;
+	long		i;
+	int			j;
+
+	CSV		= NewString( Cfg->Records * Cfg->Columns * ( Cfg->Width * 2 + 24 ));
+
+	for( i = 0; i < Cfg->Records; i++ )
+		{
+		for( j = 0; j < Cfg->Columns; j++ )
+			{
+			if( j > 0 )
+				s_appendchar( CSV, ',' );
+
+			switch( j % 4 )
+				{
+				case 0:
+					s_append_u64( CSV, Random( &Seed, 1000000000 ));
+					break;
+				case 1:
+					AppendRandom( CSV, &Seed, Lower, 1 + Random( &Seed, Cfg->Width * 2 ));
+					break;
+				case 2:
+					s_append_i64( CSV, (int64_t)Random( &Seed, 2000000 ) - 1000000 );
+					s_appendchar( CSV, '.' );
+					AppendRandom( CSV, &Seed, Digits, 2 );
+					break;
+				case 3:
+					/* One in four of these fields is empty. */
+					if( Random( &Seed, 4 ) != 0 )
+						AppendRandom( CSV, &Seed, Lower, 1 + Random( &Seed, Cfg->Width * 2 ));
+					break;
+				}
+			}
+		s_appendchar( CSV, '\n' );
+		}
+
+	return CSV;
+	}
+/*============================================================================*/
+/* Requests with 'Headers' header lines, in random order and with the names
+   in random capitalization, separated by an empty line. */
+static s_string_t *GenerateHeaders( const config_t *Cfg )
+	{
+	static const char	*Names[]	= { "Host", "User-Agent", "Accept", "Accept-Language", "Accept-Encoding", "Connection", "Cookie",
+									"Content-Type", "Content-Length", "Referer", "Cache-Control", "X-Forwarded-For", "X-Request-Id",
+									"Authorization", "If-None-Match", "Origin" };
+	s_string_t			*Requests;
+	uint32_t			Seed	= Cfg->Seed;
+	long				i;
+	int					j;
+	const char			*p;
+
+	Requests	= NewString( Cfg->Records * ( Cfg->Headers * 48 + 32 ));
+
+	for( i = 0; i < Cfg->Records; i++ )
+		{
+		s_strcat_c( Requests, "GET /index.html HTTP/1.1\n" );
+		for( j = 0; j < Cfg->Headers; j++ )
+			{
+			for( p = Names[Random( &Seed, 16 )]; *p != '\0'; p++ )
+				s_appendchar( Requests, Random( &Seed, 4 ) == 0 ? *p ^ ( *p >= 'A' ? 0x20 : 0 ) : *p );
+			s_strcat_c( Requests, ": " );
+			AppendRandom( Requests, &Seed, Lower, 4 + Random( &Seed, 32 ));
+			s_appendchar( Requests, '\n' );
+			}
+		s_appendchar( Requests, '\n' );
+		}
+
+	return Requests;
+	}
+/*============================================================================*/
+/* Absolute and relative paths, some without extension or with more than one dot. */
+static s_string_t *GeneratePaths( const config_t *Cfg )
+	{
+	static const char	*Extensions[]	= { ".c", ".h", ".txt", ".tar.gz", "", ".json" };
+	s_string_t			*Paths;
+	uint32_t			Seed	= Cfg->Seed;
+	long				i;
+	int					j;
+
+	Paths	= NewString( Cfg->Records * ( Cfg->Depth * 24 + 32 ));
+
+	for( i = 0; i < Cfg->Records; i++ )
+		{
+		if( Random( &Seed, 2 ))
+			s_appendchar( Paths, '/' );
+		for( j = Random( &Seed, Cfg->Depth * 2 ); j > 0; j-- )
+			{
+			AppendRandom( Paths, &Seed, Lower, 2 + Random( &Seed, 12 ));
+			s_appendchar( Paths, '/' );
+			}
+		AppendRandom( Paths, &Seed, Lower, 1 + Random( &Seed, 16 ));
+		s_strcat_c( Paths, Extensions[Random( &Seed, 6 )] );
+		s_appendchar( Paths, '\n' );
+		}
+
+	return Paths;
+	}
+/*============================================================================*/
+/* Returns the total of the status codes and sizes, so nothing can be skipped. */
+static int64_t RunLog( const s_string_t *Log )
+	{
+	auto_s_string(	Line, 1024 );
+	ssize_t			Start = 0, Len, LineStart, Pos, TokenLen;
+	int64_t			Value, Sum = 0;
+	int				Field;
+
+	while(( Pos = s_strtok_c( Log, &Start, "\n", &Len )) >= 0 )
+		{
+		s_extract_l( Line, Log, Pos, Len );
+
+		/* The status is the 9th field and the size the 10th. */
+		for( LineStart = 0, Field = 0; Field < 10 && ( Pos = s_strtok_c( Line, &LineStart, " ", &TokenLen )) >= 0; Field++ )
+			if( Field >= 8 && s_parse_i64( Line, Pos, TokenLen, &Value ) > 0 )
+				Sum	   += Value;
+		}
+
+	return Sum;
+	}
+/*============================================================================*/
+static int64_t RunLogAllocating( const s_string_t *Log )
+	{
+	auto_s_string(	Line, 1024 );
+	ssize_t			Start = 0, Len, LineStart, Pos;
+	s_string_t		*Token;
+	int64_t			Value, Sum = 0;
+	int				Field;
+
+	while(( Pos = s_strtok_c( Log, &Start, "\n", &Len )) >= 0 )
+		{
+		s_extract_l( Line, Log, Pos, Len );
+
+		for( LineStart = 0, Field = 0; Field < 10 && ( Token = s_strtok_mc( Line, &LineStart, " " )) != NULL; Field++ )
+			{
+			if( Field >= 8 && s_parse_i64( Token, 0, s_strlen( Token ), &Value ) > 0 )
+				Sum	   += Value;
+			s_free( Token );
+			}
+		}
+
+	return Sum;
+	}
+/*============================================================================*/
+static int64_t RunCSV( const s_string_t *CSV )
+	{
+	auto_s_string(	Row, 65534 );
+	auto_s_string(	Field, 256 );
+	ssize_t			Start = 0, Len, Pos, FieldStart, Comma;
+	int64_t			IntValue, Sum = 0;
+	double			Value;
+	int				Column;
+
+	while(( Pos = s_strtok_c( CSV, &Start, "\n", &Len )) >= 0 )
+		{
+		s_extract_l( Row, CSV, Pos, Len );
+
+		for( FieldStart = 0, Column = 0; ; FieldStart = Comma + 1, Column++ )
+			{
+			if(( Comma = s_strchr( Row, FieldStart, ',' )) < 0 )
+				Comma	= s_strlen( Row );
+
+			s_extract_l( Field, Row, FieldStart, Comma - FieldStart );
+
+			if( Column % 4 == 0 && s_parse_i64( Field, 0, s_strlen( Field ), &IntValue ) > 0 )
+				Sum	   += IntValue;
+			else if( Column % 4 == 2 && s_parse_f64( Field, 0, s_strlen( Field ), &Value ) > 0 )
+				Sum	   += (int64_t)Value;
+			else
+				Sum	   += s_strlen( Field );
+
+			if( Comma >= s_strlen( Row ))
+				break;
+			}
+		}
+
+	return Sum;
+	}
+/*============================================================================*/
+static int64_t RunHeaders( const s_string_t *Requests )
+	{
+	static const char	*Wanted[]	= { "host", "content-type", "content-length", "x-request-id", "authorization" };
+	auto_s_string(		Line, 256 );
+	auto_s_string(		Name, 64 );
+	ssize_t				Start = 0, Len, Pos, Colon;
+	int64_t				Sum = 0;
+	size_t				i;
+
+	/* The tokenizer skips the empty lines, so the request lines tell where a request begins. */
+	while(( Pos = s_strtok_c( Requests, &Start, "\n", &Len )) >= 0 )
+		{
+		s_extract_l( Line, Requests, Pos, Len );
+
+		if(( Colon = s_strchr( Line, 0, ':' )) < 0 )
+			continue;
+
+		s_extract_l( Name, Line, 0, Colon );
+
+		for( i = 0; i < sizeof Wanted / sizeof Wanted[0]; i++ )
+			if( s_stricmp_c( Name, 0, Wanted[i] ) == 0 )
+				{
+				Sum	   += ( i + 1 ) * ( Len - Colon - 2 );
+				break;
+				}
+		}
+
+	return Sum;
+	}
+/*============================================================================*/
+static void SplitPath( const s_string_t *pFullPath, s_string_t *pPath, s_string_t *pName, s_string_t *pExt )
+	{
+	ssize_t	p, q;
+
+	if(( p = s_strrchr( pFullPath, -1, '/' )) >= 0 )
+		{
+		s_extract_e( pPath, pFullPath, 0, p );
+		p++;
+		}
+	else
+		{
+		p		= 0;
+		s_strcpy_c( pPath, "" );
+		}
+
+	if(( q = s_strrchr( pFullPath, -1, '.' )) > p )
+		{
+		s_strcpy( pExt, pFullPath, q );
+		q--;
+		}
+	else
+		{
+		q		= -1;
+		s_strcpy_c( pExt, "" );
+		}
+
+	s_extract_e( pName, pFullPath, p, q );
+	}
+/*============================================================================*/
+static int64_t RunPaths( const s_string_t *Paths )
+	{
+	auto_s_string(	FullPath, 1024 );
+	auto_s_string(	Path, 1024 );
+	auto_s_string(	Name, 256 );
+	auto_s_string(	Ext, 64 );
+	ssize_t			Start = 0, Len, Pos;
+	int64_t			Sum = 0;
+
+	while(( Pos = s_strtok_c( Paths, &Start, "\n", &Len )) >= 0 )
+		{
+		s_extract_l( FullPath, Paths, Pos, Len );
+		SplitPath( FullPath, Path, Name, Ext );
+		Sum	   += s_strlen( Path ) * 3 + s_strlen( Name ) * 2 + s_strlen( Ext );
+		}
+
+	return Sum;
+	}
+/*============================================================================*/
+typedef struct
+	{
+	const char	*Name;
+	s_string_t	*(*Generate)( const config_t *Cfg );
+	int64_t		(*Run)( const s_string_t *Data );
+	} workload_t;
+
+static const workload_t	Workloads[]	=
+	{
+	{ "log",	GenerateLog,		RunLog },
+	{ "log_m",	GenerateLog,		RunLogAllocating },
+	{ "csv",	GenerateCSV,		RunCSV },
+	{ "header",	GenerateHeaders,	RunHeaders },
+	{ "path",	GeneratePaths,		RunPaths },
+	};
+/*============================================================================*/
+static uint64_t Nanoseconds( void )
+	{
+	struct timespec	t;
+
+	clock_gettime( CLOCK_MONOTONIC, &t );
+
+	return (uint64_t)t.tv_sec * 1000000000u + t.tv_nsec;
+	}
+/*============================================================================*/
+static void Measure( const workload_t *w, const config_t *Cfg, uint64_t MinTime )
+	{
+	s_string_t			*Data	= w->Generate( Cfg );
+	uint64_t			Start, Elapsed;
+	size_t				FirstAllocation;
+	long				Repetitions	= 0;
+	volatile int64_t	Sink;
+
+	/* One run to warm up the caches. */
+	Sink		= w->Run( Data );
+
+	FirstAllocation	= Allocations;
+	Start			= Nanoseconds();
+	do
+		{
+		Sink	= w->Run( Data );
+		Repetitions++;
+		}
+	while(( Elapsed = Nanoseconds() - Start ) < MinTime );
+	(void)Sink;
+
+	printf( "%s,%ld,%ld,%.6f,%.0f,%.3f,%.3f\n", w->Name, Cfg->Records, Repetitions, Elapsed / 1e9,
+			(double)Cfg->Records * Repetitions * 1e9 / Elapsed, (double)s_strlen( Data ) * Repetitions * 1e3 / Elapsed,
+			(double)( Allocations - FirstAllocation ) / ( (double)Cfg->Records * Repetitions ));
+	fflush( stdout );
+
+	s_free( Data );
+	}
+/*============================================================================*/
+int main( int argc, char *argv[] )
+	{
+	config_t	Cfg		= { 100000, 12, 8, 16, 6, 12345 };
+	uint64_t	MinTime	= 500000000;
+	size_t		w;
+	int			First	= 1, i, Selected;
+
+	while( First + 1 < argc && argv[First][0] == '-' && argv[First][1] != '\0' && argv[First][2] == '\0' )
+		{
+		long	Value	= strtol( argv[First + 1], NULL, 10 );
+
+		switch( argv[First][1] )
+			{
+			case 't': MinTime		= Value * 1000000;	break;
+			case 'n': Cfg.Records	= Value;			break;
+			case 'c': Cfg.Columns	= Value;			break;
+			case 'w': Cfg.Width		= Value;			break;
+			case 'H': Cfg.Headers	= Value;			break;
+			case 'd': Cfg.Depth		= Value;			break;
+			case 'r': Cfg.Seed		= Value;			break;
+			default:
+				fprintf( stderr, "Unknown option '%s'\n", argv[First] );
+				return 1;
+			}
+		First  += 2;
+		}
+
+	if( Cfg.Records < 1 || Cfg.Columns < 1 || Cfg.Width < 1 || Cfg.Headers < 1 || Cfg.Depth < 1 )
+		{
+		fprintf( stderr, "The number of records, columns, headers, the width and the depth must be positive\n" );
+		return 1;
+		}
+
+	printf( "workload,records,repetitions,seconds,records_per_s,mb_per_s,allocs_per_record\n" );
+
+	for( w = 0; w < sizeof Workloads / sizeof Workloads[0]; w++ )
+		{
+		for( i = First, Selected = First >= argc; i < argc; i++ )
+			Selected   |= strcmp( Workloads[w].Name, argv[i] ) == 0;
+
+		if( Selected )
+			Measure( &Workloads[w], &Cfg, MinTime );
+		}
+
+	return 0;
+	}
+/*============================================================================*/
@@ -2,6 +2,11 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <locale.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
 /*=============================================================================*/
 #include "s_string.h"
 /*=============================================================================*/
@@ -103,7 +108,7 @@ static void Test_s_delete_e( void )
 /*============================================================================*/
 static_const_s_string_tiny_c(	TestStr1,  64, "Parameter=Value, Parameter2 = Value2; Parameter3 = Value3;" );
 static const char				TestDelimC[]	= " =,;";
-static_const_s_string_tiny_c(	TestDelim1, 4, TestDelimC );
+static_const_s_string_tiny_c(	TestDelim1, 4, " =,;" );
 /*============================================================================*/
 static void Test_s_strtok( void )
 	{
@@ -173,7 +178,7 @@ static void Test_s_strtok_m( void )
 	for( p = 0; ( t = s_strtok_m( TestStr1, &p, TestDelim1, 0 )) != NULL; )
 		{
 		printf( "T: %s\tD: \'%c\'\n", s_constcstr( t, 0 ), s_charat( TestStr1, p ));
-		free( t );
+		s_free( t );
 		}
 	}
 /*============================================================================*/
@@ -187,7 +192,7 @@ static void Test_s_strtok_mc( void )
 	for( p = 0; ( t = s_strtok_mc( TestStr1, &p, TestDelimC )) != NULL; )
 		{
 		printf( "T: %s\tD: \'%c\'\n", s_constcstr( t, 0 ), s_charat( TestStr1, p ));
-		free( t );
+		s_free( t );
 		}
 	}
 /*============================================================================*/
@@ -240,6 +245,1445 @@ static void Test_s_replace_de( void )
 #endif
 	}
 /*============================================================================*/
+/* The checks of the functions below. A failed check prints its expression and
+   line, and is counted in 'Failures'. */
+static int	Failures	= 0;
+
+#define	CHECK( e )	Check(( e ) != 0, #e, __LINE__ )
+
+static void Check( int Ok, const char *Expression, int Line )
+	{
+	if( !Ok )
+		{
+		printf( "  FAILED (line %d): %s\n", Line, Expression );
+		Failures++;
+		}
+	}
+/*============================================================================*/
+static void Test_s_sprintf( void )
+	{
+	static const char	*IntFormats[]	= { "%d", "%5d|", "%-5d|", "%05d", "%+d", "% d", "%x", "%#x", "%X", "%#o", "%u", "%.3d", "%*d" };
+	static const int	Ints[]			= { 0, 7, -42, 123456, 2147483647, -2147483647 - 1 };
+	static const char	*StrFormats[]	= { "%s", "%10s|", "%-10s|", "%.3s", "%10.2s|", "[%c]" };
+	static const char	*Strs[]			= { "", "a", "hello", "hello world" };
+	auto_s_string(		Dst, 128 );
+	auto_s_string(		Small, 8 );
+	char				Expected[128];
+	size_t				i, j;
+
+	printf( "\ns_sprintf\n" );
+
+	for( i = 0; i < sizeof IntFormats / sizeof IntFormats[0]; i++ )
+		for( j = 0; j < sizeof Ints / sizeof Ints[0]; j++ )
+			{
+			if( strstr( IntFormats[i], "*" ) != NULL )
+				{
+				snprintf( Expected, sizeof Expected, IntFormats[i], 8, Ints[j] );
+				s_sprintf( Dst, IntFormats[i], 8, Ints[j] );
+				}
+			else
+				{
+				snprintf( Expected, sizeof Expected, IntFormats[i], Ints[j] );
+				s_sprintf( Dst, IntFormats[i], Ints[j] );
+				}
+			CHECK( strcmp( s_constcstr( Dst, 0 ), Expected ) == 0 );
+			}
+
+	for( i = 0; i < sizeof StrFormats / sizeof StrFormats[0]; i++ )
+		for( j = 0; j < sizeof Strs / sizeof Strs[0]; j++ )
+			{
+			if( strstr( StrFormats[i], "%c" ) != NULL )
+				{
+				snprintf( Expected, sizeof Expected, StrFormats[i], Strs[j][0] != '\0' ? Strs[j][0] : 'z' );
+				s_sprintf( Dst, StrFormats[i], Strs[j][0] != '\0' ? Strs[j][0] : 'z' );
+				}
+			else
+				{
+				snprintf( Expected, sizeof Expected, StrFormats[i], Strs[j] );
+				s_sprintf( Dst, StrFormats[i], Strs[j] );
+				}
+			CHECK( strcmp( s_constcstr( Dst, 0 ), Expected ) == 0 );
+			}
+
+	snprintf( Expected, sizeof Expected, "%lld %llx %ld %hhd %.2f %e %g %%", -1234567890123ll, 0xdeadbeefcafeull, -5l, (char)300, 3.14159, 1e-10, 0.0001 );
+	s_sprintf( Dst, "%lld %llx %ld %hhd %.2f %e %g %%", -1234567890123ll, 0xdeadbeefcafeull, -5l, (char)300, 3.14159, 1e-10, 0.0001 );
+	CHECK( strcmp( s_constcstr( Dst, 0 ), Expected ) == 0 );
+
+	/* The result is truncated to the maximum length of the destination. */
+	s_sprintf( Small, "%s-%d", "abcdef", 12345 );
+	CHECK( strcmp( s_constcstr( Small, 0 ), "abcdef-1" ) == 0 );
+
+	s_strcpy_c( Dst, "x=" );
+	CHECK( s_catprintf( Dst, "%d,%s", 5, "y" ) == 5 );
+	CHECK( strcmp( s_constcstr( Dst, 0 ), "x=5,y" ) == 0 );
+	}
+/*============================================================================*/
+static void Test_s_append_num( void )
+	{
+	static const int64_t	Ints[]		= { 0, 1, -1, 9, 10, 99, 100, -12345, 1234567890123ll, INT64_MAX, INT64_MIN };
+	static const double		Doubles[]	= { 0.1, 1234.5, 1e16, 1e15, 1e-4, 1e-5, 5e-324, -2.5, 1.0 / 3.0 };
+	static const char		*Texts[]	= { "0.1", "1234.5", "1e+16", "1000000000000000", "0.0001", "1e-05", "5e-324", "-2.5", "0.3333333333333333" };
+	auto_s_string(			Dst, 32 );
+	auto_s_string(			Small, 4 );
+	char					Expected[32];
+	size_t					i;
+
+	printf( "\ns_append_i64 / u64 / x64 / X64 / f64\n" );
+
+	for( i = 0; i < sizeof Ints / sizeof Ints[0]; i++ )
+		{
+		s_strcpy_c( Dst, "=" );
+		snprintf( Expected, sizeof Expected, "=%lld", (long long)Ints[i] );
+		CHECK( s_append_i64( Dst, Ints[i] ) == (ssize_t)strlen( Expected ) && strcmp( s_constcstr( Dst, 0 ), Expected ) == 0 );
+
+		s_strcpy_c( Dst, "" );
+		snprintf( Expected, sizeof Expected, "%llu", (unsigned long long)Ints[i] );
+		CHECK( s_append_u64( Dst, Ints[i] ) > 0 && strcmp( s_constcstr( Dst, 0 ), Expected ) == 0 );
+
+		s_strcpy_c( Dst, "" );
+		snprintf( Expected, sizeof Expected, "%04llx", (unsigned long long)Ints[i] );
+		CHECK( s_append_x64( Dst, Ints[i], 4 ) > 0 && strcmp( s_constcstr( Dst, 0 ), Expected ) == 0 );
+
+		s_strcpy_c( Dst, "" );
+		snprintf( Expected, sizeof Expected, "%llX", (unsigned long long)Ints[i] );
+		CHECK( s_append_X64( Dst, Ints[i], 0 ) > 0 && strcmp( s_constcstr( Dst, 0 ), Expected ) == 0 );
+		}
+
+	for( i = 0; i < sizeof Doubles / sizeof Doubles[0]; i++ )
+		{
+		s_strcpy_c( Dst, "" );
+		CHECK( s_append_f64( Dst, Doubles[i] ) > 0 && strcmp( s_constcstr( Dst, 0 ), Texts[i] ) == 0 );
+		}
+
+	s_strcpy_c( Dst, "" );
+	s_append_f64( Dst, -1.0 / 0.0 );
+	s_append_f64( Dst, 0.0 / 0.0 );
+	CHECK( strcmp( s_constcstr( Dst, 0 ), "-infnan" ) == 0 );
+
+	/* A number that doesn't fit is not appended at all. */
+	s_strcpy_c( Small, "ab" );
+	CHECK( s_append_i64( Small, 123 ) < 0 && s_append_f64( Small, 0.25 ) < 0 );
+	CHECK( s_append_u64( Small, 12 ) == 4 && strcmp( s_constcstr( Small, 0 ), "ab12" ) == 0 );
+	}
+/*============================================================================*/
+static void Test_s_parse( void )
+	{
+	static const double	Values[]	=
+		{
+		0.0, -0.0, 0.1, 1.0 / 3.0, 1e23, 5e-324, 2.2250738585072014e-308, 2.2250738585072009e-308,
+		1.7976931348623157e308, 123456.789, 1e16, 9007199254740993.0, 1e-5, 0.3, 100.0
+		};
+	static const char	*Texts[]	=
+		{
+		"9007199254740993", "2.2250738585072011e-308", "1e-400", "0.1e+1", "-12.5e-3x", "123456789012345678901234567890",
+		"4.9406564584124654e-324", "2.4703282292062328e-324", "1.00000000000000011102230246251565404236316680908203125", "inf", ".e1"
+		};
+	static const char	*Locales[]	= { "de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "pt_BR.UTF-8" };
+	auto_s_string_c(	Str, 64, "  -9223372036854775808 18446744073709551616" );
+	auto_s_string(		Dst, 64 );
+	uint64_t			Random	= 0x9e3779b97f4a7c15ull, Bits, Back;
+	double				Value, Parsed, Expected;
+	int64_t				I64		= 0;
+	uint64_t			U64		= 0;
+	char				*End;
+	ssize_t				Len;
+	size_t				i;
+
+	printf( "\ns_parse_i64 / u64 / f64\n" );
+
+	CHECK( s_parse_i64( Str, 2, 20, &I64 ) == 20 && I64 == INT64_MIN );
+	CHECK( s_parse_i64( Str, 2, 19, &I64 ) == 19 && I64 == -922337203685477580ll );
+	CHECK( s_parse_u64( Str, -20, 20, &U64 ) == -1 && U64 == UINT64_MAX );
+	CHECK( s_parse_u64( Str, -20, 19, &U64 ) == 19 && U64 == 1844674407370955161ull );
+	CHECK( s_parse_i64_v( s_view_c( "+42abc" ), &I64 ) == 3 && I64 == 42 );
+	CHECK( s_parse_i64_v( s_view_c( " 1" ), &I64 ) == 0 && s_parse_u64_v( s_view_c( "-1" ), &U64 ) == 0 );
+
+	/* The shortest representation must convert back to the same double. */
+	for( i = 0; i < sizeof Values / sizeof Values[0] + 10000; i++ )
+		{
+		if( i < sizeof Values / sizeof Values[0] )
+			Value	= Values[i];
+		else
+			{
+			Random ^= Random << 13;
+			Random ^= Random >> 7;
+			Random ^= Random << 17;
+			/* NaN and infinities are not numbers that round trip. */
+			if(( Random >> 52 & 0x7ff ) == 0x7ff )
+				continue;
+			memcpy( &Value, &Random, sizeof Value );
+			}
+
+		s_strcpy_c( Dst, "" );
+		Len		= s_append_f64( Dst, Value );
+		Parsed	= -1.0;
+		CHECK( Len > 0 && s_parse_f64( Dst, 0, Len, &Parsed ) == Len );
+		memcpy( &Bits, &Value, sizeof Bits );
+		memcpy( &Back, &Parsed, sizeof Back );
+		CHECK( Back == Bits );
+		}
+
+	/* The parser must agree with strtod, and stop where it stops. */
+	for( i = 0; i < sizeof Texts / sizeof Texts[0]; i++ )
+		{
+		Expected	= strtod( Texts[i], &End );
+		/* 'Parsed' is left unchanged when there is no number. */
+		Parsed		= 0.0;
+		CHECK( s_parse_f64_v( s_view_c( Texts[i] ), &Parsed ) == End - Texts[i] );
+		CHECK( memcmp( &Parsed, &Expected, sizeof Parsed ) == 0 );
+		}
+
+	/* A view is never read past its end. */
+	CHECK( s_parse_f64_v( (s_view_t){ "1.25e3", 4 }, &Parsed ) == 4 && Parsed == 1.25 );
+	CHECK( s_parse_f64_v( (s_view_t){ "1.25e3", 5 }, &Parsed ) == 4 && Parsed == 1.25 );
+
+	/* The numbers with more than 19 digits don't depend on the decimal point of
+	   the locale. The check is skipped if none of these locales is installed. */
+	for( i = 0; i < sizeof Locales / sizeof Locales[0]; i++ )
+		if( setlocale( LC_NUMERIC, Locales[i] ) != NULL )
+			{
+			CHECK( s_parse_f64_v( s_view_c( "1.234567890123456789012345" ), &Parsed ) == 26 && Parsed == 1.234567890123456789 );
+			setlocale( LC_NUMERIC, "C" );
+			break;
+			}
+	}
+/*============================================================================*/
+static void Test_s_join( void )
+	{
+	static const uint8_t	NotString[8]	= { 0xff, 0x10, 0x00 };
+	s_string_t				*A		= s_strdup_c( "alpha" );
+	s_string_t				*B		= s_strdup_c( "beta" );
+	s_string_t				*Sep	= s_strdup_c( ", " );
+	const s_string_t		*Parts[4];
+	auto_s_string_c(		Dst, 20, "[" );
+	s_string_t				*Str;
+
+	printf( "\ns_join / s_concat\n" );
+
+	Parts[0]	= A;
+	Parts[1]	= NULL;
+	Parts[2]	= B;
+	Parts[3]	= TestDelim1;
+
+	/* NULL parts are empty strings, but still get their separators. */
+	CHECK( s_join( Dst, Sep, 3, Parts ) == 14 && strcmp( s_constcstr( Dst, 0 ), "[alpha, , beta" ) == 0 );
+	CHECK( s_concat( Dst, 1, Parts + 3 ) == 18 && strcmp( s_constcstr( Dst, 0 ), "[alpha, , beta =,;" ) == 0 );
+	CHECK( s_concat( Dst, 0, NULL ) == 18 );
+
+	/* If everything doesn't fit nothing is appended. */
+	CHECK( s_concat( Dst, 1, Parts ) < 0 && s_strlen( Dst ) == 18 );
+
+	/* Neither read-only nor invalid destinations are written. */
+	CHECK( s_concat( (s_string_t*)TestDelim1, 1, Parts ) < 0 && s_strlen( TestDelim1 ) == 4 );
+	CHECK( s_concat( (s_string_t*)NotString, 1, Parts ) < 0 && s_join( NULL, Sep, 1, Parts ) < 0 );
+
+	if(( Str = s_join_m( Sep, 4, Parts )) != NULL )
+		{
+		CHECK( s_strlen( Str ) == 19 && s_strmaxlen( Str ) == 19 && strcmp( s_constcstr( Str, 0 ), "alpha, , beta,  =,;" ) == 0 );
+		s_free( Str );
+		}
+	else
+		CHECK( Str != NULL );
+
+	if(( Str = s_concat_m( 0, NULL )) != NULL )
+		{
+		CHECK( s_strlen( Str ) == 0 );
+		s_free( Str );
+		}
+	else
+		CHECK( Str != NULL );
+
+	s_free( A );
+	s_free( B );
+	s_free( Sep );
+	}
+/*============================================================================*/
+static void Test_s_utf8_validate( void )
+	{
+	static const char	*Invalid[]	=
+		{
+		"\xc0\xaf", "\xe0\x80\xaf", "\xed\xa0\x80", "\xf4\x90\x80\x80", "\xe2\x82", "\x80", "abc\xff", "\xf8\x88\x80\x80\x80"
+		};
+	auto_s_string_xc(	Ext, 700, "h\xc3\xa9llo" );
+	char				Long[600];
+	size_t				i;
+
+	printf( "\ns_utf8_validate / s_utf8_len\n" );
+
+	CHECK( s_utf8_len_v( s_view_c( "h\xc3\xa9llo \xe2\x82\xac \xf0\x9f\x98\x80" )) == 9 );
+	CHECK( s_utf8_validate_v( s_view_c( "" )) && s_utf8_len_v( s_view_c( "" )) == 0 );
+
+	for( i = 0; i < sizeof Invalid / sizeof Invalid[0]; i++ )
+		{
+		CHECK( !s_utf8_validate_v( s_view_c( Invalid[i] )));
+		CHECK( s_utf8_len_v( s_view_c( Invalid[i] )) == -1 );
+		}
+
+	/* An invalid byte after a long valid run, to go through the SIMD path. */
+	memset( Long, 'a', sizeof Long - 1 );
+	Long[sizeof Long - 1]	= '\0';
+	CHECK( s_utf8_validate_v( s_view_c( Long )));
+	Long[500]	= '\xc3';
+	CHECK( !s_utf8_validate_v( s_view_c( Long )) && s_utf8_len_v( s_view_c( Long )) == -1 );
+	CHECK( s_utf8_len_v( (s_view_t){ Long, 500 } ) == 500 );
+
+	/* The length cached in the header extension follows the changes. */
+	CHECK( s_utf8_len( Ext ) == 5 && s_utf8_validate( Ext ));
+	CHECK( s_utf8_len( Ext ) == 5 );
+	s_strcat_c( Ext, "\xe2\x82" );
+	CHECK( s_utf8_len( Ext ) == -1 && !s_utf8_validate( Ext ));
+	s_appendchar( Ext, '\xac' );
+	CHECK( s_utf8_len( Ext ) == 6 && s_utf8_validate( Ext ));
+	s_strcpy_c( Ext, Long );
+	CHECK( s_utf8_len( Ext ) == -1 );
+	s_truncate( Ext, 500 );
+	CHECK( s_utf8_len( Ext ) == 500 );
+
+	/* Strings without an extension are checked every time. */
+	CHECK( s_utf8_len( TestStr1 ) == 58 && s_utf8_len( NULL ) == 0 );
+	}
+/*============================================================================*/
+/* Looks up every code point of the string 'Arg' ('a' followed by U+00E9s),
+   from several threads at once on a newly changed string. */
+static void *Utf8OffsetThread( void *Arg )
+	{
+	const s_string_t	*Str	= Arg;
+	ssize_t				i, Count = s_utf8_len( Str );
+	intptr_t			Wrong	= 0;
+
+	for( i = Count - 1; i >= 1; i -= 7 )
+		Wrong  += s_utf8_offset( Str, i ) != 2 * i - 1 || s_utf8_at( Str, i ) != 0xe9;
+
+	return (void*)Wrong;
+	}
+/*============================================================================*/
+static void Test_s_utf8_offset( void )
+	{
+	s_string_t	*Str;
+	pthread_t	Threads[4];
+	void		*Wrong;
+	char		Long[600];
+	size_t		i, Round;
+
+	printf( "\ns_utf8_offset / s_utf8_at\n" );
+
+	CHECK( s_utf8_offset( TestStr1, 10 ) == 10 && s_utf8_at( TestStr1, -1 ) == ';' );
+
+	/* 'a' followed by 299 U+00E9, long enough to have a code point index. */
+	Long[0]	= 'a';
+	for( i = 0; i < 299; i++ )
+		{
+		Long[1 + 2 * i]	= '\xc3';
+		Long[2 + 2 * i]	= '\xa9';
+		}
+	Long[1 + 2 * 299]	= '\0';
+
+	if(( Str = s_strdup_xc( Long )) == NULL )
+		{
+		CHECK( Str != NULL );
+		return;
+		}
+
+	CHECK( s_utf8_len( Str ) == 300 );
+	CHECK( s_utf8_offset( Str, 0 ) == 0 && s_utf8_offset( Str, 1 ) == 1 );
+	CHECK( s_utf8_offset( Str, 200 ) == 399 );
+	CHECK( s_utf8_offset( Str, -1 ) == 597 );
+	CHECK( s_utf8_offset( Str, 300 ) == 599 && s_utf8_offset( Str, 301 ) == -1 && s_utf8_offset( Str, -301 ) == -1 );
+	CHECK( s_utf8_at( Str, 0 ) == 'a' && s_utf8_at( Str, 150 ) == 0xe9 && s_utf8_at( Str, 300 ) == -1 );
+
+	/* The index is built by whichever thread gets there first. */
+	for( Round = 0; Round < 20; Round++ )
+		{
+		s_setcharat( Str, 0, 'a', ' ' );
+		for( i = 0; i < sizeof Threads / sizeof Threads[0]; i++ )
+			CHECK( pthread_create( &Threads[i], NULL, Utf8OffsetThread, Str ) == 0 );
+		for( i = 0; i < sizeof Threads / sizeof Threads[0]; i++ )
+			CHECK( pthread_join( Threads[i], &Wrong ) == 0 && Wrong == NULL );
+		}
+
+	/* A change invalidates the cached length and index. */
+	s_setcharat( Str, 0, '\xff', ' ' );
+	CHECK( s_utf8_len( Str ) == -1 && s_utf8_offset( Str, 1 ) == -1 && s_utf8_at( Str, 1 ) == -1 );
+	s_setcharat( Str, 0, 'b', ' ' );
+	s_delete_l( Str, 1, 100 );
+	CHECK( s_utf8_len( Str ) == 250 && s_utf8_offset( Str, 249 ) == 497 );
+
+	s_free( Str );
+	}
+/*============================================================================*/
+static void Test_s_getline( void )
+	{
+	FILE				*File	= tmpfile();
+	s_reader_t			*Reader;
+	s_view_t			View;
+	auto_s_string(		Line, 32 );
+	char				Long[100];
+
+	printf( "\ns_getline\n" );
+
+	if( File == NULL )
+		{
+		CHECK( File != NULL );
+		return;
+		}
+
+	memset( Long, 'x', sizeof Long );
+	fputs( "short\n", File );
+	fwrite( Long, 1, sizeof Long, File );
+	fputs( "\n\nlast", File );
+	fflush( File );
+	rewind( File );
+
+	/* A 16 byte buffer, smaller than the long line. */
+	if(( Reader = s_reader_open( fileno( File ), 16 )) != NULL )
+		{
+		/* Without a place to put it, the line is not consumed. */
+		CHECK( s_getline( Reader, NULL ) == -2 && s_getline( Reader, (s_string_t*)TestStr1 ) == -2 );
+		CHECK( s_getline( Reader, Line ) == 5 && strcmp( s_constcstr( Line, 0 ), "short" ) == 0 );
+		/* Only the beginning of the long line fits in 'Line'. */
+		CHECK( s_getline( Reader, Line ) == 100 && s_strlen( Line ) == 32 && s_constcstr( Line, 0 )[31] == 'x' );
+		CHECK( s_getline_v( Reader, &View ) == 0 );
+		CHECK( s_getline_v( Reader, &View ) == 4 && memcmp( View.Ptr, "last", 4 ) == 0 );
+		CHECK( s_getline_v( Reader, &View ) == -1 && s_getline( Reader, Line ) == -1 );
+		s_reader_close( Reader );
+		}
+	else
+		CHECK( Reader != NULL );
+
+	fclose( File );
+	}
+/*============================================================================*/
+static void Test_s_mmap_file( void )
+	{
+	char		Path[]	= "/tmp/s_string_XXXXXX";
+	char		Page[4096];
+	s_string_t	*Str;
+	int			Fd;
+
+	printf( "\ns_mmap_file\n" );
+
+	CHECK( s_mmap_file( "/nonexistent/file", S_ACCESS_NORMAL ) == NULL && s_mmap_file( "/tmp", S_ACCESS_NORMAL ) == NULL );
+
+	if(( Fd = mkstemp( Path )) < 0 )
+		{
+		CHECK( Fd >= 0 );
+		return;
+		}
+
+	/* An empty file is an empty string. */
+	if(( Str = s_mmap_file( Path, S_ACCESS_NORMAL )) != NULL )
+		{
+		CHECK( s_strlen( Str ) == 0 && *s_constcstr( Str, 0 ) == '\0' );
+		s_free( Str );
+		}
+	else
+		CHECK( Str != NULL );
+
+	/* A file of exactly one page still gets its NUL terminator. */
+	memset( Page, 'p', sizeof Page );
+	Page[0]	= 'P';
+	CHECK( write( Fd, Page, sizeof Page ) == sizeof Page );
+	close( Fd );
+
+	if(( Str = s_mmap_file( Path, S_ACCESS_SEQUENTIAL )) != NULL )
+		{
+		CHECK( s_strlen( Str ) == 4096 && s_constcstr( Str, 0 )[4096] == '\0' );
+		CHECK( s_strchr( Str, 0, 'P' ) == 0 && s_strrchr( Str, -1, 'p' ) == 4095 && s_strchr( Str, 1, 'P' ) < 0 );
+		CHECK( s_isreadonly( Str ) && s_strcat_c( Str, "x" ) < 0 && s_setcharat( Str, 0, 'x', ' ' ) < 0 );
+		CHECK( s_mmap_advise( Str, S_ACCESS_RANDOM ) == 0 && s_mmap_advise( Str, 99 ) < 0 );
+		s_free( Str );
+		}
+	else
+		CHECK( Str != NULL );
+
+	CHECK( s_mmap_advise( TestStr1, S_ACCESS_RANDOM ) < 0 );
+
+	unlink( Path );
+	}
+/*============================================================================*/
+/* An allocator that counts what it allocates, over the C library. */
+static size_t	CountedBytes, CountedBlocks;
+static int		AdoptFreed;
+
+static void *CountingAlloc( void *Context, size_t Size )
+	{
+	(void)Context;
+	CountedBytes   += Size;
+	CountedBlocks++;
+	return malloc( Size );
+	}
+
+static void *CountingRealloc( void *Context, void *Ptr, size_t Size )
+	{
+	(void)Context;
+	CountedBytes   += Size;
+	return realloc( Ptr, Size );
+	}
+
+static void CountingFree( void *Context, void *Ptr )
+	{
+	(void)Context;
+	CountedBlocks--;
+	free( Ptr );
+	}
+
+static const s_allocator_t	CountingAllocator	= { CountingAlloc, CountingRealloc, CountingFree, NULL };
+/*============================================================================*/
+static void AdoptFree( void *Ptr )
+	{
+	AdoptFreed++;
+	free( Ptr );
+	}
+/*============================================================================*/
+static void Test_s_adopt( void )
+	{
+	static char			Fixed[]	= "fixed";
+	const s_allocator_t	*Previous;
+	s_string_t			*Str;
+	char				*Buffer, *Big;
+	size_t				i, Len	= 1 << 20;
+
+	printf( "\ns_adopt / s_wrap_const\n" );
+
+	CHECK( s_adopt( NULL, 0, 8, free ) == NULL && s_adopt( Fixed, 6, 6, NULL ) == NULL );
+
+	/* The buffer becomes the s_string, which can grow up to cap - 1. */
+	if(( Buffer = malloc( 16 )) != NULL && ( Str = s_adopt( Buffer, 0, 16, AdoptFree )) != NULL )
+		{
+		CHECK( s_strmaxlen( Str ) == 15 && s_strcpy_c( Str, "adopted" ) == 7 && Buffer[7] == '\0' );
+		CHECK( s_strcat_c( Str, "-buffer!" ) == 15 && strcmp( Buffer, "adopted-buffer!" ) == 0 );
+		CHECK( s_appendchar( Str, 'x' ) < 0 );
+		s_free( Str );
+		CHECK( AdoptFreed == 1 );
+		}
+	else
+		CHECK( Buffer != NULL );
+
+	/* A slice that is not NUL terminated is refused. */
+	CHECK( s_wrap_const( Fixed, 3 ) == NULL && s_wrap_const( NULL, 0 ) == NULL );
+
+	if(( Big = malloc( Len + 1 )) == NULL )
+		{
+		CHECK( Big != NULL );
+		return;
+		}
+
+	for( i = 0; i < Len; i += 2 )
+		{
+		Big[i]		= '\xc2';
+		Big[i + 1]	= '\xb5';
+		}
+	Big[Len]	= '\0';
+
+	/* Wrapping allocates only the header, whatever the size of the buffer;
+	   the code point index comes when it is first needed. */
+	Previous		= s_set_thread_allocator( &CountingAllocator );
+	CountedBytes	= 0;
+	CountedBlocks	= 0;
+
+	if(( Str = s_wrap_const( Big, Len )) != NULL )
+		{
+		CHECK( CountedBlocks == 1 && CountedBytes < 128 );
+		CHECK( s_strlen( Str ) == (ssize_t)Len && s_isreadonly( Str ) && s_strcat_c( Str, "x" ) < 0 );
+		CHECK( s_utf8_len( Str ) == (ssize_t)Len / 2 && CountedBlocks == 1 );
+		CHECK( s_utf8_offset( Str, 100000 ) == 200000 && s_utf8_at( Str, -1 ) == 0xb5 && CountedBlocks == 2 );
+		CHECK( s_strcmp_c( Str, 0, Big ) == 0 );
+		s_free( Str );
+		CHECK( CountedBlocks == 0 );
+		}
+	else
+		CHECK( Str != NULL );
+
+	s_set_thread_allocator( Previous );
+
+	free( Big );
+	}
+/*============================================================================*/
+/* Reads from 'Fd' whatever is there, up to 'Size' - 1 bytes, as a C-string. */
+static ssize_t ReadAvailable( int Fd, char *Buffer, size_t Size )
+	{
+	ssize_t	Total	= 0, Read;
+
+	while( (size_t)Total < Size - 1 && ( Read = read( Fd, Buffer + Total, Size - 1 - Total )) > 0 )
+		Total  += Read;
+
+	Buffer[Total]	= '\0';
+
+	return Total;
+	}
+/*============================================================================*/
+static void Test_s_writer( void )
+	{
+	static char			Filler[4096];
+	static char			Received[1 << 17];
+	const s_string_t	*Strs[3];
+	s_string_t			*Hello	= s_strdup_c( "hello" );
+	s_string_t			*Long	= s_strdup_c( "0123456789abcdefghij" );
+	s_writer_t			*Writer;
+	int					Pipe[2];
+
+	printf( "\ns_write / s_writev / s_writer\n" );
+
+	signal( SIGPIPE, SIG_IGN );
+
+	if( Hello == NULL || Long == NULL || pipe( Pipe ) != 0 )
+		{
+		CHECK( Hello != NULL && Long != NULL && !"pipe" );
+		s_free( Hello );
+		s_free( Long );
+		return;
+		}
+
+	/* Both ends never block, so a full pipe makes the writes fail with EAGAIN. */
+	fcntl( Pipe[0], F_SETFL, O_NONBLOCK );
+	fcntl( Pipe[1], F_SETFL, O_NONBLOCK );
+
+	Strs[0]	= Hello;
+	Strs[1]	= NULL;
+	Strs[2]	= Long;
+	CHECK( s_write( Pipe[1], Hello ) == 5 && s_writev( Pipe[1], 3, Strs ) == 25 );
+	CHECK( ReadAvailable( Pipe[0], Received, sizeof Received ) == 30 && strcmp( Received, "hellohello0123456789abcdefghij" ) == 0 );
+
+	if(( Writer = s_writer_open( Pipe[1], 16 )) == NULL )
+		CHECK( Writer != NULL );
+	else
+		{
+		CHECK( s_writer_put( Writer, Hello ) == 5 && s_writer_put_v( Writer, s_view_c( "," )) == 1 );
+		CHECK( ReadAvailable( Pipe[0], Received, sizeof Received ) == 0 );
+
+		/* The pipe is filled up... */
+		memset( Filler, '.', sizeof Filler );
+		while( write( Pipe[1], Filler, sizeof Filler ) > 0 )
+			;
+		while( write( Pipe[1], Filler, 1 ) > 0 )
+			;
+
+		/* ...so nothing can be written, but nothing buffered is lost. */
+		CHECK( s_writer_put( Writer, Long ) < 0 && s_writer_flush( Writer ) < 0 );
+
+		ReadAvailable( Pipe[0], Received, sizeof Received );
+		CHECK( s_writer_put( Writer, Long ) == 20 );
+		CHECK( ReadAvailable( Pipe[0], Received, sizeof Received ) == 26 && strcmp( Received, "hello,0123456789abcdefghij" ) == 0 );
+
+		CHECK( s_writer_put( Writer, Hello ) == 5 && s_writer_flush( Writer ) == 5 && s_writer_flush( Writer ) == 0 );
+		CHECK( ReadAvailable( Pipe[0], Received, sizeof Received ) == 5 );
+
+		/* With the other end closed the buffer can't be written, but it is kept. */
+		CHECK( s_writer_put( Writer, Hello ) == 5 );
+		close( Pipe[0] );
+		CHECK( s_writer_flush( Writer ) < 0 && s_writer_flush( Writer ) < 0 );
+		CHECK( s_writer_close( Writer ) < 0 );
+		}
+
+	close( Pipe[1] );
+
+	s_free( Hello );
+	s_free( Long );
+	}
+/*============================================================================*/
+/* The linker defines these symbols: zero-filled objects lie between
+'__bss_start' and '_end', initialized ones before '_edata'. */
+extern char	__bss_start[], _edata[], _end[];
+
+static_s_string_small_c( TestStatic, 100, "static" );
+static_s_string_large( TestStaticBig, 1000000 );
+global_s_string_small( TestGlobal, 1000 );
+
+static int InBss( const void *p )
+	{
+	return (const char*)p >= __bss_start && (const char*)p < _end;
+	}
+
+static void Test_static_s_string( void )
+	{
+	static_s_string_tiny( Local, 20 );
+
+	printf( "\nstatic and global s_strings\n" );
+
+	CHECK( InBss( TestStaticBig ) && InBss( TestGlobal ) && InBss( Local ));
+	CHECK( !InBss( TestStatic ) && (const char*)TestStatic < _edata );
+
+	CHECK( s_strlen( TestStatic ) == 6 && s_strmaxlen( TestStatic ) == 100 );
+	CHECK( s_strcat_c( TestStatic, "!" ) == 7 && strcmp( s_constcstr( TestStatic, 0 ), "static!" ) == 0 );
+	CHECK( s_strlen( TestStr1 ) == 58 && s_isreadonly( TestStr1 ));
+
+	CHECK( s_strlen( TestStaticBig ) == 0 && s_strmaxlen( TestStaticBig ) == 1000000 && !s_isreadonly( TestStaticBig ));
+	CHECK( s_strlen( TestGlobal ) == 0 && s_strmaxlen( TestGlobal ) == 1000 );
+	CHECK( s_strlen( Local ) == 0 && s_strmaxlen( Local ) == 20 );
+	CHECK( s_strcpy_c( TestStaticBig, "big" ) == 3 && strcmp( s_constcstr( TestStaticBig, 0 ), "big" ) == 0 );
+	CHECK( s_strcpy_c( Local, "local" ) == 5 && strcmp( s_constcstr( Local, 0 ), "local" ) == 0 );
+	}
+/*============================================================================*/
+static_lazy_s_string_small( TestLazy, 1000 );
+static_lazy_s_string_large( TestLazyBig, 100000 );
+
+static void *LazyThread( void *Arg )
+	{
+	(void)Arg;
+	return s_lazy( TestLazyBig );
+	}
+
+static void Test_s_lazy( void )
+	{
+	pthread_t	Threads[4];
+	void		*Results[4];
+	int			i;
+
+	printf( "\nlazy s_strings\n" );
+
+	CHECK( _TestLazy_lazy.Guard == 0 && InBss( &_TestLazy_lazy ));
+	CHECK( s_strlen( s_lazy( TestLazy )) == 0 && s_strmaxlen( s_lazy( TestLazy )) == 1000 );
+	CHECK( _TestLazy_lazy.Guard == 2 );
+	CHECK( s_strcpy_c( s_lazy( TestLazy ), "lazy" ) == 4 && strcmp( s_constcstr( s_lazy( TestLazy ), 0 ), "lazy" ) == 0 );
+
+	for( i = 0; i < 4; i++ )
+		pthread_create( &Threads[i], NULL, LazyThread, NULL );
+	for( i = 0; i < 4; i++ )
+		pthread_join( Threads[i], &Results[i] );
+	for( i = 0; i < 4; i++ )
+		CHECK( Results[i] == s_lazy( TestLazyBig ));
+	CHECK( s_strmaxlen( s_lazy( TestLazyBig )) == 100000 && !s_isreadonly( s_lazy( TestLazyBig )));
+	}
+/*============================================================================*/
+static const s_stats_t *FindStats( const s_stats_t *Stats, size_t Count, const char *Name )
+	{
+	size_t	i;
+
+	for( i = 0; i < Count; i++ )
+		if( strcmp( Stats[i].Name, Name ) == 0 )
+			return &Stats[i];
+
+	return NULL;
+	}
+
+static void *StatsThread( void *Arg )
+	{
+	int	i;
+
+	for( i = 0; i < 100; i++ )
+		s_strchr( TestStr1, 0, '=' );
+
+	return Arg;
+	}
+
+static void Test_s_stats( void )
+	{
+	static_s_string_tiny( StatsDst, 8 );
+	static s_stats_t	Stats[256];
+	const s_stats_t		*Copy, *Chr;
+	pthread_t			Threads[4];
+	size_t				Count;
+	int					i;
+
+	printf( "\ns_stats\n" );
+
+	s_stats_reset();
+	s_strcpy_c( StatsDst, "0123456789" );
+	s_strcpy_c( StatsDst, "0123" );
+	for( i = 0; i < 4; i++ )
+		pthread_create( &Threads[i], NULL, StatsThread, NULL );
+	for( i = 0; i < 4; i++ )
+		pthread_join( Threads[i], NULL );
+
+	/* Without 'S_STRING_STATS' the library counts nothing. */
+	if(( Count = s_stats_snapshot( NULL, 0 )) == 0 )
+		{
+		CHECK( s_stats_snapshot( Stats, 256 ) == 0 );
+		return;
+		}
+
+	CHECK( Count <= 256 && s_stats_snapshot( Stats, 256 ) == Count );
+	Copy	= FindStats( Stats, Count, "s_strcpy_c" );
+	Chr		= FindStats( Stats, Count, "s_strchr" );
+	CHECK( Copy != NULL && Copy->Calls == 2 && Copy->Bytes == 12 && Copy->Truncations == 1 && Copy->Allocations == 0 );
+	CHECK( Chr != NULL && Chr->Calls == 400 );
+
+	/* The blocks of the ended threads are taken again, and their counts kept. */
+	pthread_create( &Threads[0], NULL, StatsThread, NULL );
+	pthread_join( Threads[0], NULL );
+	s_stats_snapshot( Stats, 256 );
+	CHECK( Chr != NULL && Chr->Calls == 500 );
+
+	s_stats_reset();
+	s_stats_snapshot( Stats, 256 );
+	CHECK( Copy != NULL && Copy->Calls == 0 && Chr->Calls == 0 );
+	CHECK( s_stats_snapshot( Stats, 1 ) == Count && strcmp( Stats[0].Name, "s_charat" ) == 0 );
+	}
+/*============================================================================*/
+static void *FreeThread( void *Arg )
+	{
+	s_free( Arg );
+	return NULL;
+	}
+
+static void *DupThread( void *Arg )
+	{
+	return s_strdup_c( Arg );
+	}
+
+static void Test_s_allocator( void )
+	{
+	const s_string_t	*Parts[3];
+	s_string_t			*Strs[10], *Libc;
+	ssize_t				Start = 0;
+	pthread_t			Thread;
+	void				*Result;
+	size_t				i;
+
+	printf( "\ns_set_allocator / _a variants\n" );
+
+	CountedBytes	= 0;
+	CountedBlocks	= 0;
+
+	CHECK( s_set_allocator( NULL ) == NULL && s_set_thread_allocator( NULL ) == NULL && s_get_allocator() != NULL );
+
+	/* Every '_a' variant allocates a single block with the allocator given... */
+	Libc		= s_strdup_c( "alpha,beta" );
+	Parts[0]	= Libc;
+	Parts[1]	= TestDelim1;
+	Parts[2]	= Libc;
+	Strs[0]		= s_join_ma( TestDelim1, 3, Parts, &CountingAllocator );
+	Strs[1]		= s_concat_ma( 2, Parts, &CountingAllocator );
+	Strs[2]		= s_strdup_a( Libc, 6, &CountingAllocator );
+	Strs[3]		= s_strdup_xca( "\xc2\xb5s", &CountingAllocator );
+	Strs[4]		= s_strldup_a( Libc, 0, 5, &CountingAllocator );
+	Strs[5]		= s_strndup_ca( "n", 40, &CountingAllocator );
+	Strs[6]		= s_extract_mea( Libc, 0, 4, &CountingAllocator );
+	Strs[7]		= s_extract_mlca( "extract", 2, 3, &CountingAllocator );
+	Strs[8]		= s_strtok_mca( Libc, &Start, ",", &CountingAllocator );
+	Strs[9]		= s_strtok_mca( Libc, &Start, ",", &CountingAllocator );
+	CHECK( CountedBlocks == 10 );
+
+	CHECK( Strs[0] != NULL && strcmp( s_constcstr( Strs[0], 0 ), "alpha,beta =,; =,; =,;alpha,beta" ) == 0 );
+	CHECK( Strs[1] != NULL && strcmp( s_constcstr( Strs[1], 0 ), "alpha,beta =,;" ) == 0 );
+	CHECK( Strs[2] != NULL && strcmp( s_constcstr( Strs[2], 0 ), "beta" ) == 0 );
+	CHECK( Strs[3] != NULL && s_utf8_len( Strs[3] ) == 2 && s_strlen( Strs[3] ) == 3 );
+	CHECK( Strs[4] != NULL && strcmp( s_constcstr( Strs[4], 0 ), "alpha" ) == 0 );
+	CHECK( Strs[5] != NULL && s_strmaxlen( Strs[5] ) == 40 && s_strcat_c( Strs[5], "ew" ) == 3 );
+	CHECK( Strs[6] != NULL && Strs[7] != NULL );
+	CHECK( Strs[8] != NULL && Strs[9] != NULL && s_strcmp_c( Strs[8], 0, "alpha" ) == 0 && s_strcmp_c( Strs[9], 0, "beta" ) == 0 );
+
+	/* ...and they go back to it, with 's_free' or with the wrong allocator. */
+	for( i = 0; i < 9; i++ )
+		s_free( Strs[i] );
+	s_free_a( Strs[9], s_get_allocator());
+	CHECK( CountedBlocks == 0 );
+
+	/* The allocator of the thread is remembered after it is removed... */
+	s_set_thread_allocator( &CountingAllocator );
+	CHECK( s_get_allocator() == &CountingAllocator );
+	Strs[0]	= s_strdup_c( "thread" );
+	Strs[1]	= s_wrap_const( "wrapped", 7 );
+	s_free( Libc );
+	CHECK( s_set_thread_allocator( NULL ) == &CountingAllocator && CountedBlocks == 2 );
+	s_free( Strs[0] );
+	CHECK( CountedBlocks == 1 );
+
+	/* ...and a string may be released by another thread, which has none. */
+	pthread_create( &Thread, NULL, FreeThread, Strs[1] );
+	pthread_join( Thread, NULL );
+	CHECK( CountedBlocks == 0 );
+
+	/* The global allocator is used by every thread without one of its own. */
+	CHECK( s_set_allocator( &CountingAllocator ) == NULL );
+	pthread_create( &Thread, NULL, DupThread, "global" );
+	pthread_join( Thread, &Result );
+	Strs[0]	= s_strndup_c( "global", 100 );
+	CHECK( CountedBlocks == 2 && Result != NULL && s_strcmp( Result, 0, Strs[0], 0 ) == 0 );
+	CHECK( s_set_allocator( NULL ) == &CountingAllocator );
+	s_free( Result );
+	s_free( Strs[0] );
+	CHECK( CountedBlocks == 0 );
+	}
+/*============================================================================*/
+static void *TraceThread( void *Arg )
+	{
+	int	i;
+
+	for( i = 0; i < 100; i++ )
+		s_strchr( TestStr1, 0, '=' );
+
+	return Arg;
+	}
+
+/* Writes the histograms to the file 'Fd' and reads them back into 'Buffer'. */
+static int DumpTrace( int Fd, int Format, char *Buffer, size_t Size )
+	{
+	int	Result;
+
+	if( ftruncate( Fd, 0 ) != 0 || lseek( Fd, 0, SEEK_SET ) != 0 )
+		return -1;
+
+	Result	= s_trace_dump( Fd, Format );
+	lseek( Fd, 0, SEEK_SET );
+	ReadAvailable( Fd, Buffer, Size );
+
+	return Result;
+	}
+
+static void Test_s_trace( void )
+	{
+	static char	Dump[1 << 16];
+	char		Path[]	= "/tmp/s_string_trace_XXXXXX";
+	const char	*Line;
+	pthread_t	Thread;
+	int			Fd;
+
+	printf( "\ns_trace\n" );
+
+	if(( Fd = mkstemp( Path )) < 0 )
+		{
+		CHECK( Fd >= 0 );
+		return;
+		}
+	unlink( Path );
+
+	/* Every call of a new thread is timed with a period of one. */
+	s_trace_set_period( 1 );
+	s_trace_reset();
+	pthread_create( &Thread, NULL, TraceThread, NULL );
+	pthread_join( Thread, NULL );
+
+	/* Without 'S_STRING_TRACE' there is nothing to dump. */
+	if( DumpTrace( Fd, S_TRACE_TEXT, Dump, sizeof Dump ) < 0 )
+		{
+		CHECK( Dump[0] == '\0' );
+		close( Fd );
+		s_trace_set_period( 64 );
+		return;
+		}
+
+	CHECK( strncmp( Dump, "function ", 9 ) == 0 && ( Line = strstr( Dump, "\ns_strchr " )) != NULL );
+	CHECK( Line != NULL && strncmp( Line + 17, "16-63     ", 10 ) == 0 && strtoull( Line + 26, NULL, 10 ) == 100 );
+
+	CHECK( DumpTrace( Fd, S_TRACE_JSON, Dump, sizeof Dump ) >= 0 && Dump[0] == '[' && strcmp( Dump + strlen( Dump ) - 3, "\n]\n" ) == 0 );
+	CHECK( strstr( Dump, "{\"function\":\"s_strchr\",\"size\":\"16-63\",\"samples\":100," ) != NULL );
+
+	CHECK( DumpTrace( Fd, 99, Dump, sizeof Dump ) < 0 );
+
+	s_trace_reset();
+	CHECK( DumpTrace( Fd, S_TRACE_TEXT, Dump, sizeof Dump ) >= 0 && strstr( Dump, "\ns_strchr " ) == NULL );
+
+	s_trace_set_period( 64 );
+	close( Fd );
+	}
+/*============================================================================*/
+/* 3 MB of 'n', with "needle" at 'NeedlePositions', straddling the 1 MB chunks of
+   the parallel functions. */
+static const ssize_t	NeedlePositions[]	= { 1048570, 2097151, 2500000 };
+
+static s_string_t *NewHaystack( void )
+	{
+	s_string_t	*Str;
+	char		*Text;
+	size_t		i, Len	= 3 << 20;
+
+	if(( Text = malloc( Len + 1 )) == NULL )
+		return NULL;
+
+	memset( Text, 'n', Len );
+	Text[Len]	= '\0';
+	for( i = 0; i < sizeof NeedlePositions / sizeof NeedlePositions[0]; i++ )
+		memcpy( Text + NeedlePositions[i], "needle", 6 );
+
+	Str	= s_strdup_c( Text );
+	free( Text );
+
+	return Str;
+	}
+
+static void Test_s_strstr_par( void )
+	{
+	s_string_t	*Str	= NewHaystack();
+	s_string_t	*Needle	= s_strdup_c( "needle" );
+
+	printf( "\ns_strstr_par\n" );
+
+	if( Str == NULL || Needle == NULL )
+		{
+		CHECK( Str != NULL && Needle != NULL );
+		s_free( Str );
+		s_free( Needle );
+		return;
+		}
+
+	/* Below the threshold the calling thread searches alone. */
+	CHECK( s_strstr_par( Str, 0, Needle, 0 ) == NeedlePositions[0] );
+
+	/* Even on a single processor, the work is split among 4 threads. */
+	s_parallel_set_threads( 4 );
+	s_parallel_set_threshold( 0 );
+
+	CHECK( s_strstr_par( Str, 0, Needle, 0 ) == NeedlePositions[0] );
+	CHECK( s_strstr_par( Str, NeedlePositions[0] + 1, Needle, 0 ) == NeedlePositions[1] );
+	CHECK( s_strstr_par( Str, NeedlePositions[1] + 1, Needle, 2 ) == NeedlePositions[2] );
+	CHECK( s_strstr_par( Str, NeedlePositions[2] + 1, Needle, 0 ) == -1 );
+	CHECK( s_strstr_par( Str, -6, Needle, 3 ) == -1 && s_strstr_par( Str, NeedlePositions[0], Needle, 1 ) == NeedlePositions[0] );
+	CHECK( s_strstr_par( Str, 0, Needle, 0 ) == s_strstr( Str, 0, Needle, 0 ));
+	CHECK( s_strstr_par( NULL, 0, Needle, 0 ) == -1 && s_strstr_par( Str, 0, NULL, 0 ) == -1 );
+
+	s_parallel_set_threads( 0 );
+	s_parallel_set_threshold( 1 << 20 );
+
+	s_free( Str );
+	s_free( Needle );
+	}
+/*============================================================================*/
+static void Test_s_findall( void )
+	{
+	s_string_t	*Str	= s_strdup_c( "aaaaa banana bananas" );
+	s_string_t	*Needle	= s_strdup_c( "ana" );
+	s_string_t	*Pair	= s_strdup_c( "aa" );
+	s_string_t	*Empty	= s_strdup_x( NULL, 0 );
+	s_string_t	*Big	= NewHaystack();
+	ssize_t		Found[4];
+
+	printf( "\ns_strcount / s_findall\n" );
+
+	/* The occurrences don't overlap. */
+	CHECK( s_strcount( Str, 0, Pair ) == 2 && s_strcount( Str, 1, Pair ) == 2 && s_strcount( Str, 2, Pair ) == 1 );
+	CHECK( s_strcount( Str, 0, Needle ) == 2 && s_strcount( Str, -8, Needle ) == 1 );
+	CHECK( s_findall( Str, Needle, Found, 4 ) == 2 && Found[0] == 7 && Found[1] == 14 );
+	CHECK( s_findall( Str, Pair, Found, 1 ) == 2 && Found[0] == 0 && s_findall( Str, Pair, NULL, 0 ) == 2 );
+
+	CHECK( s_strcount_chr( Str, 0, 'a' ) == 11 && s_strcount_chr( Str, 6, 'a' ) == 6 && s_strcount_chr( Str, 0, 'z' ) == 0 );
+	CHECK( s_strcount_chr( NULL, 0, 'a' ) == -1 && s_strcount_chr( Str, 100, 'a' ) == -1 );
+
+	/* An empty needle is never found. */
+	CHECK( s_strcount( Str, 0, Empty ) == 0 && s_findall( Str, Empty, Found, 4 ) == 0 );
+	CHECK( s_strcount( Str, 0, NULL ) <= 0 && s_findall( NULL, Needle, Found, 4 ) <= 0 );
+
+	/* The long strings are split among the threads of the pool. */
+	s_parallel_set_threads( 4 );
+	s_parallel_set_threshold( 0 );
+
+	if( Big != NULL )
+		{
+		s_strcpy_c( Needle, "needle" );
+		CHECK( s_strcount( Big, 0, Needle ) == 3 && s_strcount( Big, NeedlePositions[1], Needle ) == 2 );
+		CHECK( s_strcount_chr( Big, 0, 'e' ) == 9 && s_strcount_chr( Big, 0, 'n' ) == ( 3 << 20 ) - 15 );
+		CHECK( s_findall( Big, Needle, Found, 2 ) == 3 && Found[0] == NeedlePositions[0] && Found[1] == NeedlePositions[1] );
+		}
+	else
+		CHECK( Big != NULL );
+
+	s_parallel_set_threads( 0 );
+	s_parallel_set_threshold( 1 << 20 );
+
+	s_free( Str );
+	s_free( Needle );
+	s_free( Pair );
+	s_free( Empty );
+	s_free( Big );
+	}
+/*============================================================================*/
+static int ViewIs( s_view_t View, const char *Str )
+	{
+	return View.Ptr != NULL && View.Len == (ssize_t)strlen( Str ) && memcmp( View.Ptr, Str, View.Len ) == 0;
+	}
+
+static void Test_s_strvec( void )
+	{
+	s_strvec_t			*Vec	= s_strvec_new( 2, 8 );
+	s_strvec_t			*From;
+	s_string_t			*Str	= s_strdup_c( "one" );
+	s_string_t			*Copy;
+	const s_string_t	*Parts[3];
+	char				Text[32];
+	size_t				i;
+
+	printf( "\ns_strvec\n" );
+
+	if( Vec == NULL )
+		{
+		CHECK( Vec != NULL );
+		s_free( Str );
+		return;
+		}
+
+	CHECK( s_strvec_count( Vec ) == 0 && s_strvec_at( Vec, 0 ).Ptr == NULL );
+	CHECK( s_strvec_append( Vec, Str ) == 0 && s_strvec_append_c( Vec, "" ) == 1 && s_strvec_append_v( Vec, s_view_c( "three" )) == 2 );
+	CHECK( s_strvec_append_c( Vec, NULL ) < 0 && s_strvec_append_c( NULL, "x" ) < 0 );
+	CHECK( s_strvec_count( Vec ) == 3 && ViewIs( s_strvec_at( Vec, 0 ), "one" ) && ViewIs( s_strvec_at( Vec, -1 ), "three" ));
+	CHECK( s_strvec_at( Vec, 1 ).Ptr != NULL && s_strvec_at( Vec, 1 ).Len == 0 && s_strvec_at( Vec, -4 ).Ptr == NULL );
+
+	/* Both arrays grow well past their initial capacity. */
+	for( i = 3; i < 1000; i++ )
+		{
+		snprintf( Text, sizeof Text, "string number %u", (unsigned)i );
+		CHECK( s_strvec_append_c( Vec, Text ) == (ssize_t)i );
+		}
+	CHECK( s_strvec_count( Vec ) == 1000 && ViewIs( s_strvec_at( Vec, 999 ), "string number 999" ) && ViewIs( s_strvec_at( Vec, 0 ), "one" ));
+
+	/* A copy as an s_string, even of an empty element. */
+	CHECK(( Copy = s_strvec_get_m( Vec, 500 )) != NULL && s_strcmp_c( Copy, 0, "string number 500" ) == 0 );
+	s_free( Copy );
+	CHECK(( Copy = s_strvec_get_m( Vec, 1 )) != NULL && s_strlen( Copy ) == 0 );
+	s_free( Copy );
+	CHECK( s_strvec_get_m( Vec, 1000 ) == NULL );
+
+	/* All the tokens, as 's_strtok' finds them. */
+	s_strvec_clear( Vec );
+	CHECK( s_strvec_count( Vec ) == 0 );
+	CHECK( s_strvec_tok( Vec, TestStr1, TestDelim1, 0 ) == 6 && s_strvec_count( Vec ) == 6 );
+	CHECK( ViewIs( s_strvec_at( Vec, 0 ), "Parameter" ) && ViewIs( s_strvec_at( Vec, 3 ), "Value2" ) && ViewIs( s_strvec_at( Vec, 5 ), "Value3" ));
+	CHECK( s_strvec_tok_c( Vec, TestStr1, ";" ) == 2 && s_strvec_count( Vec ) == 8 && ViewIs( s_strvec_at( Vec, 7 ), " Parameter3 = Value3" ));
+
+	/* NULL parts are empty strings. */
+	Parts[0]	= Str;
+	Parts[1]	= NULL;
+	Parts[2]	= TestStr1;
+	if(( From = s_strvec_from( 3, Parts )) != NULL )
+		{
+		CHECK( s_strvec_count( From ) == 3 && ViewIs( s_strvec_at( From, 0 ), "one" ) && s_strvec_at( From, 1 ).Len == 0 );
+		CHECK( ViewIs( s_strvec_at( From, 2 ), s_constcstr( TestStr1, 0 )));
+		s_strvec_free( From );
+		}
+	else
+		CHECK( From != NULL );
+
+	s_strvec_free( Vec );
+	s_strvec_free( NULL );
+	s_free( Str );
+	}
+/*============================================================================*/
+static void Test_s_strvec_find( void )
+	{
+	s_strvec_t	*Vec	= s_strvec_new( 0, 0 );
+	s_string_t	*Key	= s_strdup_c( "longkey-3" );
+	uint64_t	Mask[3];
+	char		Text[16];
+	size_t		i;
+
+	printf( "\ns_strvec_find / s_strvec_eq_mask\n" );
+
+	if( Vec == NULL || Key == NULL )
+		{
+		CHECK( Vec != NULL && Key != NULL );
+		s_strvec_free( Vec );
+		s_free( Key );
+		return;
+		}
+
+	CHECK( s_strvec_find_v( Vec, s_view_c( "key" )) == -1 && s_strvec_eq_mask_v( Vec, s_view_c( "key" ), Mask ) == 0 );
+
+	/* 150 strings, the keys repeat every 7, with lengths around 8. */
+	for( i = 0; i < 150; i++ )
+		{
+		snprintf( Text, sizeof Text, i % 2 ? "key%u" : "longkey-%u", (unsigned)( i % 7 ));
+		CHECK( s_strvec_append_c( Vec, Text ) == (ssize_t)i );
+		}
+
+	/* The same prefix or the same length is not enough. */
+	CHECK( s_strvec_find( Vec, Key ) == 10 && s_strvec_find_v( Vec, s_view_c( "longkey-3" )) == 10 );
+	CHECK( s_strvec_find_v( Vec, s_view_c( "longkey-" )) == -1 && s_strvec_find_v( Vec, s_view_c( "longkey-9" )) == -1 );
+	CHECK( s_strvec_find_v( Vec, s_view_c( "key" )) == -1 && s_strvec_find_v( Vec, s_view_c( "key1" )) == 1 );
+	CHECK( s_strvec_find( NULL, Key ) == -1 && s_strvec_find( Vec, NULL ) == -1 );
+
+	/* "key5" is at the odd positions 5 + 14 k, in the three words of the mask. */
+	memset( Mask, 0xff, sizeof Mask );
+	CHECK( s_strvec_eq_mask_v( Vec, s_view_c( "key5" ), Mask ) == 11 );
+	for( i = 0; i < 150; i++ )
+		CHECK((( Mask[i / 64] >> ( i % 64 )) & 1 ) == ( i % 14 == 5 ));
+
+	CHECK( s_strvec_eq_mask( Vec, Key, Mask ) == 10 && Mask[0] == ( 1ull << 10 | 1ull << 24 | 1ull << 38 | 1ull << 52 ));
+	CHECK( s_strvec_eq_mask_v( Vec, s_view_c( "nothing" ), Mask ) == 0 && Mask[0] == 0 && Mask[1] == 0 && ( Mask[2] & 0x3fffff ) == 0 );
+
+	s_strvec_clear( Vec );
+	CHECK( s_strvec_count( Vec ) == 0 && s_strvec_find_v( Vec, s_view_c( "key5" )) == -1 );
+
+	s_strvec_free( Vec );
+	s_free( Key );
+	}
+/*============================================================================*/
+typedef struct
+	{
+	s_string_t	*Str;
+	size_t		Index;
+	} sort_ref_t;
+
+static int	SortRefFlags;
+
+/* The order of 's_sort' for ASCII strings, with the original position last. */
+static int SortRefCmp( const void *a, const void *b )
+	{
+	const sort_ref_t	*RefA	= a, *RefB	= b;
+	const char			*StrA	= s_constcstr( RefA->Str, 0 ), *StrB	= s_constcstr( RefB->Str, 0 );
+	size_t				LenA	= s_strlen( RefA->Str ), LenB	= s_strlen( RefB->Str ), i;
+	int					CharA, CharB;
+
+	for( i = 0; i < LenA && i < LenB; i++ )
+		{
+		CharA	= (unsigned char)StrA[i];
+		CharB	= (unsigned char)StrB[i];
+
+		if( SortRefFlags & S_SORT_ICASE )
+			{
+			CharA	= CharA >= 'a' && CharA <= 'z' ? CharA - 'a' + 'A' : CharA;
+			CharB	= CharB >= 'a' && CharB <= 'z' ? CharB - 'a' + 'A' : CharB;
+			}
+
+		if( CharA != CharB )
+			return CharA - CharB;
+		}
+
+	if( LenA != LenB )
+		return LenA < LenB ? -1 : +1;
+
+	return ( RefA->Index > RefB->Index ) - ( RefA->Index < RefB->Index );
+	}
+/*============================================================================*/
+#define	SORT_STRINGS	20000
+
+/* Sorts 'Strs' with 's_sort' and 'qsort', and checks they agree. */
+static void CheckSort( s_string_t *Strs[], size_t n, int Flags )
+	{
+	s_string_t	**Sorted	= malloc( n * sizeof Sorted[0] );
+	sort_ref_t	*Ref		= malloc( n * sizeof Ref[0] );
+	size_t		i;
+
+	if( Sorted == NULL || Ref == NULL )
+		{
+		CHECK( Sorted != NULL && Ref != NULL );
+		free( Sorted );
+		free( Ref );
+		return;
+		}
+
+	for( i = 0; i < n; i++ )
+		{
+		Ref[i].Str		= Sorted[i]	= Strs[i];
+		Ref[i].Index	= i;
+		}
+
+	SortRefFlags	= Flags;
+	qsort( Ref, n, sizeof Ref[0], SortRefCmp );
+
+	CHECK( s_sort( Sorted, n, Flags ) == 0 );
+
+	/* Without S_SORT_STABLE only the strings that are equal may be swapped. */
+	for( i = 0; i < n; i++ )
+		{
+		sort_ref_t	Got	= { Sorted[i], 0 }, Expected	= { Ref[i].Str, 0 };
+
+		if( Flags & S_SORT_STABLE ? Sorted[i] != Ref[i].Str : SortRefCmp( &Got, &Expected ) != 0 )
+			break;
+		}
+	CHECK( i == n );
+
+	free( Sorted );
+	free( Ref );
+	}
+/*============================================================================*/
+static void Test_s_sort( void )
+	{
+	static const char	*Words[]	= { "pear", "Apple", "apple", "fig", "", "figs", "APPLE", "\xe9t\xe9", "banana", "apple" };
+	s_string_t			*Strs[200];
+	s_string_t			*Sorted[200];
+	s_string_t			**Many;
+	char				Text[64];
+	size_t				i, n	= sizeof Words / sizeof Words[0];
+
+	printf( "\ns_sort\n" );
+
+	for( i = 0; i < n; i++ )
+		Strs[i]	= s_strdup_xc( Words[i] );
+
+	memcpy( Sorted, Strs, n * sizeof Strs[0] );
+	CHECK( s_sort( Sorted, n, 0 ) == 0 );
+	/* The empty string first, then memcmp order, the prefixes first. */
+	CHECK( Sorted[0] == Strs[4] && Sorted[1] == Strs[6] && Sorted[2] == Strs[1] );
+	CHECK( strcmp( s_constcstr( Sorted[5], 0 ), "banana" ) == 0 && Sorted[6] == Strs[3] );
+	CHECK( Sorted[n - 1] == Strs[7] );
+
+	/* The three spellings of "apple" are equal, and keep their order. */
+	memcpy( Sorted, Strs, n * sizeof Strs[0] );
+	CHECK( s_sort( Sorted, n, S_SORT_ICASE | S_SORT_STABLE ) == 0 );
+	CHECK( Sorted[1] == Strs[1] && Sorted[2] == Strs[2] && Sorted[3] == Strs[6] && Sorted[4] == Strs[9] );
+
+	CHECK( s_sort( NULL, 0, 0 ) == 0 && s_sort( NULL, 2, 0 ) == -1 );
+
+	for( i = 0; i < n; i++ )
+		s_free( Strs[i] );
+
+	/* More than 16 strings with the same first 8 characters, which need the
+	   quicksort and then the comparisons after the prefix. */
+	for( i = 0; i < 200; i++ )
+		{
+		snprintf( Text, sizeof Text, "prefix--%03u-%u", (unsigned)(( i * 37 ) % 100 ), (unsigned)i );
+		Strs[i]	= s_strdup_c( Text );
+		}
+
+	memcpy( Sorted, Strs, sizeof Strs );
+	CHECK( s_sort( Sorted, 200, S_SORT_STABLE ) == 0 );
+	for( i = 1; i < 200; i++ )
+		CHECK( strcmp( s_constcstr( Sorted[i - 1], 0 ), s_constcstr( Sorted[i], 0 )) < 0 );
+
+	for( i = 0; i < 200; i++ )
+		s_free( Strs[i] );
+
+	/* Enough strings for the radix passes, most of them with a long common
+	   prefix, so the bucket of their first character is split again after it,
+	   some in upper case and some repeated. */
+	if(( Many = malloc( SORT_STRINGS * sizeof Many[0] )) == NULL )
+		{
+		CHECK( Many != NULL );
+		return;
+		}
+
+	for( i = 0; i < SORT_STRINGS; i++ )
+		{
+		if( i % 10 == 0 )
+			snprintf( Text, sizeof Text, "%u", (unsigned)(( i * 7919 ) % 1000 ));
+		else if( i % 10 == 1 )
+			snprintf( Text, sizeof Text, "a/long/common/prefix/" );
+		else
+			snprintf( Text, sizeof Text, i % 3 == 0 ? "A/LONG/COMMON/PREFIX/%u" : "a/long/common/prefix/%u", (unsigned)(( i * 7919 ) % 5000 ));
+
+		Many[i]	= s_strdup_c( Text );
+		}
+
+	s_parallel_set_threads( 4 );
+	s_parallel_set_threshold( 0 );
+
+	CheckSort( Many, SORT_STRINGS, 0 );
+	CheckSort( Many, SORT_STRINGS, S_SORT_STABLE );
+	CheckSort( Many, SORT_STRINGS, S_SORT_ICASE | S_SORT_STABLE );
+
+	s_parallel_set_threads( 0 );
+	s_parallel_set_threshold( 1 << 20 );
+
+	/* The same on the calling thread alone. */
+	CheckSort( Many, SORT_STRINGS, S_SORT_ICASE | S_SORT_STABLE );
+
+	for( i = 0; i < SORT_STRINGS; i++ )
+		s_free( Many[i] );
+	free( Many );
+	}
+/*============================================================================*/
+static void Test_s_strkey( void )
+	{
+	s_string_t	*Plain	= s_strdup_c( "abcdefghij" );
+	s_string_t	*Ext	= s_strdup_xc( "abcdefghij" );
+	s_string_t	*Short	= s_strdup_xc( "ab--------" );
+	s_string_t	*High	= s_strdup_xc( "\xe9t\xe9" );
+	s_string_t	*Empty	= s_strdup_x( NULL, 0 );
+
+	printf( "\ns_strkey\n" );
+
+	/* The first 8 characters, big-endian, padded with zeros. */
+	CHECK( s_strkey( Plain ) == 0x6162636465666768ull && s_strkey( Ext ) == s_strkey( Plain ));
+	CHECK( s_strkey( Short ) == 0x61622d2d2d2d2d2dull );
+	CHECK( s_truncate( Short, 2 ) >= 0 && s_strkey( Short ) == 0x6162000000000000ull );
+	CHECK( s_strkey( Empty ) == 0 && s_strkey( NULL ) == 0 );
+
+	/* The keys are in memcmp order, the characters above 0x7f last. */
+	CHECK( s_strkey( Short ) < s_strkey( Ext ) && s_strkey( Ext ) < s_strkey( High ));
+
+	/* The cached key follows the changes of the string. */
+	CHECK( s_setcharat( Ext, 1, 'z', ' ' ) >= 0 && s_strkey( Ext ) == 0x617a636465666768ull );
+	CHECK( s_truncate( Ext, 1 ) >= 0 && s_strkey( Ext ) == 0x6100000000000000ull );
+	CHECK( s_strcat_c( Short, "cdefghij" ) >= 0 && s_strkey( Short ) == s_strkey( Plain ));
+
+	/* s_strcmp compares the keys first when both strings have one, and then
+	   the rest of the characters, with the same result as without them. */
+	s_strcpy_c( Plain, "a" );
+	CHECK( s_strcmp( Short, 0, Ext, 0 ) == s_strcmp( Short, 0, Plain, 0 ) && s_strcmp( Ext, 0, Short, 0 ) == s_strcmp( Plain, 0, Short, 0 ));
+	CHECK( s_strcmp( Short, 0, Ext, 0 ) != 0 );
+	s_strcpy_c( Ext, "abcdefghiz" );
+	s_strcpy_c( Plain, "abcdefghiz" );
+	CHECK( s_strcmp( Short, 0, Ext, 0 ) == s_strcmp( Short, 0, Plain, 0 ) && s_strcmp( Short, 0, Ext, 0 ) != 0 );
+	s_strcpy_c( Ext, "abcdefghij" );
+	CHECK( s_strcmp( Short, 0, Ext, 0 ) == 0 && s_strcmp( Short, 2, Ext, 2 ) == 0 );
+	CHECK( s_strcmp( High, 0, Ext, 0 ) == s_strcmp( High, 0, Plain, 0 ));
+
+	s_free( Plain );
+	s_free( Ext );
+	s_free( Short );
+	s_free( High );
+	s_free( Empty );
+	}
+/*============================================================================*/
+static void Test_s_map( void )
+	{
+	s_map_t		*Map	= s_map_new( 0, 0 );
+	s_map_t		*IMap	= s_map_new( 0, S_MAP_ICASE );
+	s_string_t	*Key	= s_strdup_c( "Key-7" );
+	s_view_t	View;
+	void		*Value;
+	char		Text[16];
+	ssize_t		Pos, Count;
+	intptr_t	i;
+
+	printf( "\ns_map\n" );
+
+	if( Map == NULL || IMap == NULL || Key == NULL )
+		{
+		CHECK( Map != NULL && IMap != NULL && Key != NULL );
+		s_map_free( Map );
+		s_map_free( IMap );
+		s_free( Key );
+		return;
+		}
+
+	/* 1000 keys grow the map from 16 slots several times. */
+	for( i = 0; i < 1000; i++ )
+		{
+		snprintf( Text, sizeof Text, "Key-%d", (int)i );
+		CHECK( s_map_set_c( Map, Text, (void*)i ) == 1 );
+		}
+	CHECK( s_map_set( Map, Key, (void*)(intptr_t)-7 ) == 0 );
+	CHECK( s_map_count( Map ) == 1000 );
+
+	/* Deleting every other key leaves deleted slots, which the lookups go past. */
+	for( i = 0; i < 1000; i += 2 )
+		{
+		snprintf( Text, sizeof Text, "Key-%d", (int)i );
+		CHECK( s_map_del_c( Map, Text ) == 1 );
+		}
+	CHECK( s_map_del_c( Map, "Key-0" ) == 0 && s_map_count( Map ) == 500 );
+
+	for( i = 0; i < 1000; i++ )
+		{
+		snprintf( Text, sizeof Text, "Key-%d", (int)i );
+		Value	= NULL;
+		CHECK( s_map_get_v( Map, s_view_c( Text ), &Value ) == ( i % 2 ));
+		if( i % 2 )
+			CHECK( (intptr_t)Value == ( i == 7 ? -7 : i ));
+		}
+	CHECK( s_map_get_c( Map, "key-7", NULL ) == 0 );
+
+	/* The deleted slots are reused or cleaned when the map rehashes. */
+	for( i = 0; i < 1000; i += 2 )
+		{
+		snprintf( Text, sizeof Text, "Key-%d", (int)i );
+		CHECK( s_map_set_c( Map, Text, (void*)i ) == 1 );
+		}
+
+	for( Pos = 0, Count = 0; ( Pos = s_map_next( Map, Pos, &View, &Value )) > 0; Count++ )
+		CHECK( View.Len >= 5 && memcmp( View.Ptr, "Key-", 4 ) == 0 );
+	CHECK( Count == 1000 );
+
+	CHECK( s_map_set_c( IMap, "Content-Length", (void*)1 ) == 1 );
+	CHECK( s_map_set_c( IMap, "CONTENT-length", (void*)2 ) == 0 );
+	CHECK( s_map_get_c( IMap, "content-LENGTH", &Value ) == 1 && (intptr_t)Value == 2 );
+	CHECK( s_map_get_c( IMap, "content-lengt", NULL ) == 0 );
+	CHECK( s_map_get( IMap, Key, NULL ) == 0 && s_map_count( IMap ) == 1 );
+
+	/* The empty key is a key like the others. */
+	CHECK( s_map_set_c( IMap, "", (void*)3 ) == 1 && s_map_get_v( IMap, s_view_c( "" ), &Value ) == 1 && (intptr_t)Value == 3 );
+	CHECK( s_map_del_c( IMap, "" ) == 1 && s_map_count( IMap ) == 1 );
+
+	CHECK( s_map_new( SIZE_MAX, 0 ) == NULL && s_map_new( SIZE_MAX / 2, 0 ) == NULL );
+	CHECK( s_map_set_c( NULL, "a", NULL ) < 0 && s_map_get_c( NULL, "a", NULL ) < 0 && s_map_del_c( NULL, "a" ) < 0 );
+	CHECK( s_map_set_c( Map, NULL, NULL ) < 0 && s_map_count( NULL ) < 0 && s_map_next( NULL, 0, NULL, NULL ) == -1 );
+
+	s_map_free( Map );
+	s_map_free( IMap );
+	s_map_free( NULL );
+	s_free( Key );
+	}
+/*============================================================================*/
 int main( int ArgC, char *ArgV[] )
 	{
 	auto_s_string(	Argi, 256 );
@@ -270,6 +1714,36 @@ int main( int ArgC, char *ArgV[] )
 	Test_s_strtok_mc();
 #endif
 
+	/* "-t" runs the checks and exits with 1 if any of them failed. */
+	if( ArgC > 1 && strcmp( ArgV[1], "-t" ) == 0 )
+		{
+		Test_s_sprintf();
+		Test_s_append_num();
+		Test_s_parse();
+		Test_s_join();
+		Test_s_utf8_validate();
+		Test_s_utf8_offset();
+		Test_s_getline();
+		Test_s_mmap_file();
+		Test_s_adopt();
+		Test_s_writer();
+		Test_static_s_string();
+		Test_s_lazy();
+		Test_s_stats();
+		Test_s_allocator();
+		Test_s_trace();
+		Test_s_strstr_par();
+		Test_s_findall();
+		Test_s_strvec();
+		Test_s_strvec_find();
+		Test_s_sort();
+		Test_s_strkey();
+		Test_s_map();
+
+		printf( "\n%d check(s) failed\n", Failures );
+		return Failures != 0;
+		}
+
 	Test_s_replace_de();
 
 	return 0;
@@ -23,9 +23,29 @@
  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 /*============================================================================*/
+#define _GNU_SOURCE
 #include <string.h>
 #include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <wchar.h>
 #include <ctype.h>
+#include <locale.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <sched.h>
+#include <pthread.h>
+#if			defined S_STRING_TRACE
+#include <time.h>
+#endif	/*	defined S_STRING_TRACE */
+#if			defined __x86_64__ || defined __i386__
+#include <immintrin.h>
+#endif	/*	defined __x86_64__ || defined __i386__ */
 
 #include "s_string.h"
 /*============================================================================*/
@@ -42,899 +62,1524 @@ typedef struct s_string
 	uint8_t			PayLoad[];
 	} s_string_t;
 /*============================================================================*/
-int	s_isreadonly( const s_string_t * restrict str )
+/* The header extension of the s_strings created with 'Sizes' equal to 2. It
+   comes right after the 'maximum length' and 'used length' counters, packed
+   (not aligned), and caches information about the contents of the string. Any
+   change to the string invalidates the cache. It is followed by room for
+   'IndexCap' 32-bit code point checkpoints and then by the characters, unless
+   'Data' is not NULL, in which case the characters are somewhere else and the
+   checkpoints are in 'Index'. */
+typedef struct __attribute__((packed)) s_string_ext
 	{
-	if( str == NULL )
-		return -1;		/* -1 is also 'true', but if needed it can be differentiated from a true 'true'.
-						   That is, if -1 is returned, it is read-only because it in reality doesn't exist. */
+	int64_t			CodePoints;		/* Number of UTF-8 code points or UTF8_INVALID, if 'Valid' has EXT_CODEPOINTS. */
+	uint8_t			Valid;			/* Which of the cached values are up to date, 'EXT_xxx' flags. */
+	uint32_t		IndexCap;		/* Room for checkpoints reserved at creation (fixed). */
+	uint32_t		*Index;			/* The checkpoints if 'Data' is not NULL, allocated when first needed. */
+	char			*Data;			/* The characters, if they are not right after the header. */
+	uint8_t			DataArea;		/* The memory area of 'Data', one of the 'AREA_xxx' values. */
+	void			(*FreeFn)( void * );	/* Releases 'Data' when the string is freed, if not NULL. */
+	uint64_t		Key;			/* The first 8 characters, see 'Prefix8'. */
+	uint8_t			KeyLen;			/* Number of characters in 'Key' (up to 8) or KEY_UNKNOWN. */
+	} s_string_ext_t;
+
+/* The memory areas of the characters of the s_strings with indirect payload.
+   They continue the values of the 'Area' field of the descriptor, which has
+   no room for more. */
+#define	AREA_MAPPED		4	/* A memory mapped file. */
+#define	AREA_ADOPTED	5	/* A writable buffer owned by the string. */
+#define	AREA_CONST		6	/* A read-only buffer owned by somebody else. */
+
+#define	UTF8_INVALID	-2	/* The string is not valid UTF-8. */
+
+/* The flags of the 'Valid' field of the header extension. The cached values
+   are filled even for 'const' strings, so they are written before the flag is
+   set (with release semantics) and read after it is tested (with acquire). */
+#define	EXT_CODEPOINTS	0x01	/* 'CodePoints' is up to date. */
+#define	EXT_INDEX		0x02	/* The code point index is built. */
+
+/* Checkpoint 'k' of the code point index holds the byte offset of code point
+   'k * UTF8_INDEX_STEP'. Only strings of at least UTF8_INDEX_MIN characters
+   get an index, a shorter string is faster to scan than to index. */
+#define	UTF8_INDEX_STEP	64
+#define	UTF8_INDEX_MIN	256
+
+#define	KEY_UNKNOWN		0xff	/* The contents changed since the last time the key was loaded. */
+/*============================================================================*/
+/* Returns the value of the 'Bits' field (log2 of the width of the counters)
+   for a string capable of holding up to 'len' characters. */
+static int CounterBits( ssize_t len )
+	{
+	if( len < ( (ssize_t)1 <<  8 ) - 1 )
+		return 0;
+	else if( len < ( (ssize_t)1 << 16 ) - 1 )
+		return 1;
+	else if( len < ( (ssize_t)1 << 32 ) - 1 )
+		return 2;
+	else
+		return 3;
+	}
+/*============================================================================*/
+/* Returns the number of code point checkpoints reserved for a string of up to
+   'len' characters (which has at most 'len' code points). */
+static uint32_t IndexCapacity( ssize_t len )
+	{
+	if( len < UTF8_INDEX_MIN || len > UINT32_MAX )
+		return 0;
 
-	/* The 'must be zero' field in this first implementation MUST BE ZERO. */
-	if( str->MustBeZero != 0 )
-		return -1;
+	return len / UTF8_INDEX_STEP + 1;
+	}
+/*============================================================================*/
+/* Returns the offset of the header extension inside 'PayLoad'. */
+static inline size_t ExtOffset( const s_string_t * restrict str )
+	{
+	/* If the 'area' field is 3 (heap, recording its allocator) we have a 'size_t'
+	   word before the 'maximum length'. */
+	return ( str->Area == 3 ? sizeof( size_t ) : 0 ) + 2 * ( 1 << str->Bits );
+	}
+/*============================================================================*/
+/* Returns a pointer to the header extension of 'str' or NULL if it doesn't have one. */
+static inline s_string_ext_t *GetExt( const s_string_t * restrict str )
+	{
+	if( str == NULL || str->MustBeZero != 0 || str->Sizes != 2 )
+		return NULL;
 
-	return !str->Writable;
+	return (s_string_ext_t*)&str->PayLoad[ExtOffset( str )];
 	}
 /*============================================================================*/
-ssize_t s_strmaxlen( const s_string_t * restrict str )
+/* Returns the offset of the first character of the string inside 'PayLoad'. */
+static inline size_t DataOffset( const s_string_t * restrict str )
 	{
-	size_t	Offset;
+	s_string_ext_t	*Ext	= GetExt( str );
 
-	if( str == NULL )
-		return 0;
+	/* 'Sizes' equal to 0 means that there is only the 'maximum length' counter,
+	   2 means that there is a header extension (and the code point index, if
+	   the characters are not somewhere else) after the two counters. */
+	if( Ext != NULL )
+		return ExtOffset( str ) + sizeof( s_string_ext_t ) + ( Ext->Data == NULL ? Ext->IndexCap * sizeof( uint32_t ) : 0 );
 
-	/* The 'must be zero' field in this first implementation MUST BE ZERO. */
-	if( str->MustBeZero != 0 )
-		return 0;
+	return ( str->Area == 3 ? sizeof( size_t ) : 0 ) + ( str->Sizes == 0 ? 1 : 2 ) * ( 1 << str->Bits );
+	}
+/*============================================================================*/
+/* Returns a pointer to the first character of the string. */
+static inline char *DataPtr( const s_string_t * restrict str )
+	{
+	s_string_ext_t	*Ext	= GetExt( str );
 
-	/* If the 'area' field is 3 (heap with references counter) we have a 'size_t' counter before the 'maximum length'. */
-	Offset	= str->Area == 3 ? sizeof( size_t ) : 0;
+	if( Ext != NULL && Ext->Data != NULL )
+		return Ext->Data;
 
-	switch( str->Bits )
+	return (char*)&str->PayLoad[DataOffset( str )];
+	}
+/*============================================================================*/
+/* Invalidates the information cached in the header extension of 'str', if
+   any. Called whenever the string is going to be changed. */
+static inline void InvalidateExt( const s_string_t * restrict str )
+	{
+	s_string_ext_t	*Ext;
+
+	if(( Ext = GetExt( str )) != NULL )
 		{
-		case 0:
-			return  (unsigned int)str->PayLoad[Offset+0] << 0;
-		case 1:
-			return (( (size_t)str->PayLoad[Offset+0] <<  0 ) | ( (size_t)str->PayLoad[Offset+1] <<  8 ));
-		case 2:
-			return (( (size_t)str->PayLoad[Offset+0] <<  0 ) | ( (size_t)str->PayLoad[Offset+1] <<  8 ) |
-					( (size_t)str->PayLoad[Offset+2] << 16 ) | ( (size_t)str->PayLoad[Offset+3] << 24 ));
-		case 3:
-			return (( (size_t)str->PayLoad[Offset+0] <<  0 ) | ( (size_t)str->PayLoad[Offset+1] <<  8 ) |
-					( (size_t)str->PayLoad[Offset+2] << 16 ) | ( (size_t)str->PayLoad[Offset+3] << 24 ) |
-					( (size_t)str->PayLoad[Offset+4] << 32 ) | ( (size_t)str->PayLoad[Offset+5] << 40 ) |
-					( (size_t)str->PayLoad[Offset+6] << 48 ) | ( (size_t)str->PayLoad[Offset+7] << 56 ));
+		Ext->Valid		= 0;
+		Ext->KeyLen		= KEY_UNKNOWN;
 		}
+	}
+/*============================================================================*/
+/* Returns the first 8 characters of the 'Len' at 'Ptr' (padded with zeros) as
+   a big-endian integer, so comparing the prefixes of two strings as integers
+   is the same as comparing their first 8 characters as unsigned chars (as
+   memcmp, unlike 's_strcmp', which compares them as 'char'). */
+static inline uint64_t Prefix8( const char * restrict Ptr, size_t Len )
+	{
+	uint64_t	Prefix	= 0;
 
-	/* Should never reach here... */
-	return 0;
+	memcpy( &Prefix, Ptr, Len < 8 ? Len : 8 );
+
+#if			__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	Prefix	= __builtin_bswap64( Prefix );
+#endif	/*	__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ */
+
+	return Prefix;
 	}
 /*============================================================================*/
-static int SetMaxLen( s_string_t * restrict str, size_t MaxLength )
+/* Returns the first 8 characters of 'str' as 'Prefix8' does, and sets '*Len'
+   to how many of them there are. The key is cached in the header extension of
+   the strings that have one, so it is loaded from the characters only once
+   after each change. Concurrent readers may both fill the cache, but they
+   write the same value. */
+static inline uint64_t StrKey( const s_string_t * restrict str, size_t * restrict Len )
 	{
-	size_t	Offset;
+	s_string_ext_t	*Ext	= GetExt( str );
+	uint64_t		Key		= 0;
+	uint8_t			KeyLen;
 
-	if( str == NULL )
-		/* ...return an error result. */
-		return -1;
+	if( Ext != NULL && ( KeyLen = __atomic_load_n( &Ext->KeyLen, __ATOMIC_ACQUIRE )) != KEY_UNKNOWN )
+		{
+		*Len	= KeyLen;
+		return Ext->Key;
+		}
 
-	/* The 'must be zero' field in this first implementation MUST BE ZERO... */
-	if( str->MustBeZero != 0 )
-		/* ...return an error result. */
-		return -1;
+	if(( *Len = s_strlen( str )) > 8 )
+		*Len	= 8;
 
-	/* If the 'area' field is 3 (heap with references counter) we have a 'size_t' counter before the 'maximum length'. */
-	Offset	= str->Area == 3 ? sizeof( size_t ) : 0;
+	if( *Len > 0 )
+		Key	= Prefix8( DataPtr( str ), *Len );
 
-	switch( str->Bits )
+	if( Ext != NULL )
 		{
-		case 0:
-			str->PayLoad[Offset+0]	= (uint8_t)( MaxLength >>  0 );
-			return MaxLength;
-		case 1:
-			str->PayLoad[Offset+0]	= (uint8_t)( MaxLength >>  0 );
-			str->PayLoad[Offset+1]	= (uint8_t)( MaxLength >>  8 );
-			return MaxLength;
-		case 2:
-			str->PayLoad[Offset+0]	= (uint8_t)( MaxLength >>  0 );
-			str->PayLoad[Offset+1]	= (uint8_t)( MaxLength >>  8 );
-			str->PayLoad[Offset+2]	= (uint8_t)( MaxLength >> 16 );
-			str->PayLoad[Offset+3]	= (uint8_t)( MaxLength >> 24 );
-			return MaxLength;
-		case 3:
-			str->PayLoad[Offset+0]	= (uint8_t)( MaxLength >>  0 );
-			str->PayLoad[Offset+1]	= (uint8_t)( MaxLength >>  8 );
-			str->PayLoad[Offset+2]	= (uint8_t)( MaxLength >> 16 );
-			str->PayLoad[Offset+3]	= (uint8_t)( MaxLength >> 24 );
-			str->PayLoad[Offset+4]	= (uint8_t)( MaxLength >> 32 );
-			str->PayLoad[Offset+5]	= (uint8_t)( MaxLength >> 40 );
-			str->PayLoad[Offset+6]	= (uint8_t)( MaxLength >> 48 );
-			str->PayLoad[Offset+7]	= (uint8_t)( MaxLength >> 56 );
-			return MaxLength;
+		Ext->Key	= Key;
+		__atomic_store_n( &Ext->KeyLen, *Len, __ATOMIC_RELEASE );
 		}
 
-	/* Should never reach here... */
-	return 0;
+	return Key;
 	}
 /*============================================================================*/
-ssize_t s_strlen( const s_string_t * restrict str )
+/* The per-thread blocks of the instrumentation below. A thread only updates its
+   own block, so there is no contention. The blocks are never freed, when a
+   thread ends its block is released and taken by the next new thread, with its
+   contents preserved. They are only ever added to the head of the list, so it
+   can be walked while other threads add theirs. */
+#if			defined S_STRING_STATS || defined S_STRING_TRACE
+
+typedef struct thread_block
 	{
-	size_t	Offset;
-
-	if( str == NULL )
-		return 0;
+	struct thread_block	*Next;
+	int					InUse;
+	} thread_block_t;
 
-	/* The 'must be zero' field in this first implementation MUST BE ZERO. */
-	if( str->MustBeZero != 0 )
-		return 0;
+typedef struct
+	{
+	thread_block_t	*Blocks;
+	pthread_once_t	Once;	/* Creates 'Key', and whatever else the users of the blocks need. */
+	pthread_key_t	Key;	/* Releases the block of a thread when it ends. */
+	} block_registry_t;
+/*============================================================================*/
+static void ReleaseBlock( void *Block )
+	{
+	__atomic_store_n( &( (thread_block_t*)Block )->InUse, 0, __ATOMIC_RELEASE );
+	}
+/*============================================================================*/
+static inline thread_block_t *FirstBlock( block_registry_t *Registry )
+	{
+	return __atomic_load_n( &Registry->Blocks, __ATOMIC_ACQUIRE );
+	}
+/*============================================================================*/
+/* Gives the calling thread a block of 'Size' bytes, which starts with a
+   'thread_block_t', from 'Registry'. 'Init' is called before the first one. */
+static __attribute__((noinline,cold)) void *AcquireBlock( block_registry_t *Registry, size_t Size, void (*Init)( void ))
+	{
+	thread_block_t	*Block;
+	int				Free;
 
-	if( str->Sizes == 0 )
-		return s_strmaxlen( str );
+	pthread_once( &Registry->Once, Init );
 
-	/* If the 'area' field is 3 (heap with references counter) we have a 'size_t'
-	   counter, besides the 'maximum length' before 'used length'. */
-	Offset	= ( str->Area == 3 ? sizeof( size_t ) : 0 ) + ( 1 << str->Bits );
+	/* Take the block of a thread that has ended... */
+	for( Block = FirstBlock( Registry ); Block != NULL; Block = Block->Next )
+		{
+		Free	= 0;
+		if( __atomic_compare_exchange_n( &Block->InUse, &Free, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED ))
+			break;
+		}
 
-	switch( str->Bits )
+	/* ...or create a new one. */
+	if( Block == NULL )
 		{
-		case 0:
-			return ( (size_t)str->PayLoad[Offset+0] <<  0 );
-		case 1:
-			return ( (size_t)str->PayLoad[Offset+0] <<  0 ) | ( (size_t)str->PayLoad[Offset+1] <<  8 );
-		case 2:
-			return ( (size_t)str->PayLoad[Offset+0] <<  0 ) | ( (size_t)str->PayLoad[Offset+1] <<  8 ) |
-				   ( (size_t)str->PayLoad[Offset+2] << 16 ) | ( (size_t)str->PayLoad[Offset+3] << 24 );
-		case 3:
-			return ( (size_t)str->PayLoad[Offset+0] <<  0 ) | ( (size_t)str->PayLoad[Offset+1] <<  8 ) |
-				   ( (size_t)str->PayLoad[Offset+2] << 16 ) | ( (size_t)str->PayLoad[Offset+3] << 24 ) |
-				   ( (size_t)str->PayLoad[Offset+4] << 32 ) | ( (size_t)str->PayLoad[Offset+5] << 40 ) |
-				   ( (size_t)str->PayLoad[Offset+6] << 48 ) | ( (size_t)str->PayLoad[Offset+7] << 56 );
+		if(( Block = calloc( 1, Size )) == NULL )
+			return NULL;
+
+		Block->InUse	= 1;
+		Block->Next		= __atomic_load_n( &Registry->Blocks, __ATOMIC_RELAXED );
+		while( !__atomic_compare_exchange_n( &Registry->Blocks, &Block->Next, Block, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED ))
+			;
 		}
 
-	/* Should never reach here... */
-	return 0;
+	pthread_setspecific( Registry->Key, Block );
+
+	return Block;
 	}
+
+#endif	/*	defined S_STRING_STATS || defined S_STRING_TRACE */
 /*============================================================================*/
-ssize_t s_strllen( const s_string_t * restrict str, ssize_t len )
+/* Instrumentation. When the library is compiled with 'S_STRING_STATS' defined,
+   every public function (except the trivial ones, like 's_strlen', that the
+   library calls all the time) counts its calls, the characters it copies or
+   examines, how many times the result was truncated to fit the destination and
+   how many allocations it made. Otherwise the macros expand to nothing. */
+#if			defined S_STRING_STATS
+
+#define	STATS_FUNCTIONS	\
+	F( s_charat ) \
+	F( s_setcharat ) \
+	F( s_appendchar ) \
+	F( s_delete_e ) \
+	F( s_delete_l ) \
+	F( s_truncate ) \
+	F( s_strcat ) \
+	F( s_strcat_c ) \
+	F( s_strlcat ) \
+	F( s_strlcat_c ) \
+	F( s_strncat ) \
+	F( s_strncat_c ) \
+	F( s_strcpy ) \
+	F( s_strcpy_c ) \
+	F( s_strlcpy ) \
+	F( s_strlcpy_c ) \
+	F( s_strcmp ) \
+	F( s_strcmp_c ) \
+	F( c_strcmp_s ) \
+	F( s_stricmp ) \
+	F( s_stricmp_c ) \
+	F( c_stricmp_s ) \
+	F( s_strncmp ) \
+	F( s_strncmp_c ) \
+	F( c_strncmp_s ) \
+	F( s_strnicmp ) \
+	F( s_strnicmp_c ) \
+	F( c_strnicmp_s ) \
+	F( s_strchr ) \
+	F( s_strrchr ) \
+	F( s_strichr ) \
+	F( s_strrichr ) \
+	F( s_strstr ) \
+	F( s_strstr_c ) \
+	F( c_strstr_s ) \
+	F( s_strstr_par ) \
+	F( s_strcount_chr ) \
+	F( s_strcount ) \
+	F( s_findall ) \
+	F( s_stristr ) \
+	F( s_stristr_c ) \
+	F( c_stristr_s ) \
+	F( s_strpbrk ) \
+	F( s_strpbrk_c ) \
+	F( s_join ) \
+	F( s_concat ) \
+	F( s_join_m ) \
+	F( s_join_ma ) \
+	F( s_concat_m ) \
+	F( s_concat_ma ) \
+	F( s_strdup ) \
+	F( s_strdup_a ) \
+	F( s_strdup_c ) \
+	F( s_strdup_ca ) \
+	F( s_strdup_x ) \
+	F( s_strdup_xa ) \
+	F( s_strdup_xc ) \
+	F( s_strdup_xca ) \
+	F( s_strldup ) \
+	F( s_strldup_a ) \
+	F( s_strldup_c ) \
+	F( s_strldup_ca ) \
+	F( s_strndup ) \
+	F( s_strndup_a ) \
+	F( s_strndup_c ) \
+	F( s_strndup_ca ) \
+	F( s_strtok ) \
+	F( s_strtok_c ) \
+	F( s_strtok_s ) \
+	F( s_strtok_sc ) \
+	F( s_strtok_m ) \
+	F( s_strtok_ma ) \
+	F( s_strtok_mc ) \
+	F( s_strtok_mca ) \
+	F( s_strspn ) \
+	F( s_strspn_c ) \
+	F( s_strcspn ) \
+	F( s_strcspn_c ) \
+	F( s_extract_me ) \
+	F( s_extract_mea ) \
+	F( s_extract_mec ) \
+	F( s_extract_meca ) \
+	F( s_extract_ml ) \
+	F( s_extract_mla ) \
+	F( s_extract_mlc ) \
+	F( s_extract_mlca ) \
+	F( s_extract_e ) \
+	F( s_extract_ec ) \
+	F( s_extract_l ) \
+	F( s_extract_lc ) \
+	F( s_replace_de ) \
+	F( s_replace_se ) \
+	F( s_replace_ec ) \
+	F( s_replace_l ) \
+	F( s_replace_lc ) \
+	F( s_insert_l ) \
+	F( s_append_u64 ) \
+	F( s_append_i64 ) \
+	F( s_append_x64 ) \
+	F( s_append_X64 ) \
+	F( s_append_f64 ) \
+	F( s_view_c ) \
+	F( s_parse_u64_v ) \
+	F( s_parse_i64_v ) \
+	F( s_parse_f64_v ) \
+	F( s_parse_u64 ) \
+	F( s_parse_i64 ) \
+	F( s_parse_f64 ) \
+	F( s_utf8_validate_v ) \
+	F( s_utf8_validate ) \
+	F( s_utf8_len_v ) \
+	F( s_utf8_len ) \
+	F( s_utf8_offset ) \
+	F( s_utf8_at ) \
+	F( s_reader_open ) \
+	F( s_reader_close ) \
+	F( s_getline_v ) \
+	F( s_getline ) \
+	F( s_mmap_file ) \
+	F( s_mmap_advise ) \
+	F( s_adopt ) \
+	F( s_wrap_const ) \
+	F( s_free ) \
+	F( s_free_a ) \
+	F( s_write ) \
+	F( s_writev ) \
+	F( s_writer_open ) \
+	F( s_writer_flush ) \
+	F( s_writer_put_v ) \
+	F( s_writer_put ) \
+	F( s_writer_close ) \
+	F( s_vsprintf ) \
+	F( s_sprintf ) \
+	F( s_vcatprintf ) \
+	F( s_catprintf ) \
+	F( s_strvec_new ) \
+	F( s_strvec_free ) \
+	F( s_strvec_clear ) \
+	F( s_strvec_append_v ) \
+	F( s_strvec_append ) \
+	F( s_strvec_append_c ) \
+	F( s_strvec_tok ) \
+	F( s_strvec_tok_c ) \
+	F( s_strvec_from ) \
+	F( s_strvec_get_m ) \
+	F( s_strvec_find_v ) \
+	F( s_strvec_find ) \
+	F( s_strvec_eq_mask_v ) \
+	F( s_strvec_eq_mask ) \
+	F( s_sort ) \
+	F( s_map_new ) \
+	F( s_map_free ) \
+	F( s_map_set_v ) \
+	F( s_map_set ) \
+	F( s_map_set_c ) \
+	F( s_map_get_v ) \
+	F( s_map_get ) \
+	F( s_map_get_c ) \
+	F( s_map_del_v ) \
+	F( s_map_del ) \
+	F( s_map_del_c )
+
+enum
 	{
-	return ssmin( ssmax( 0, len ), s_strlen( str ));
+#define	F( name )	STATS_##name,
+	STATS_FUNCTIONS
+#undef	F
+	STATS_COUNT
+	};
+
+static const char	*const StatsNames[STATS_COUNT]	=
+	{
+#define	F( name )	#name,
+	STATS_FUNCTIONS
+#undef	F
+	};
+
+enum { COUNTER_CALLS, COUNTER_BYTES, COUNTER_TRUNCATIONS, COUNTER_ALLOCATIONS, COUNTER_COUNT };
+
+/* The counters of a thread, taken on its first counted call. */
+typedef struct
+	{
+	thread_block_t	Header;
+	uint64_t		Counters[STATS_COUNT][COUNTER_COUNT];
+	} stats_block_t;
+
+static block_registry_t			StatsRegistry	= { NULL, PTHREAD_ONCE_INIT };
+static __thread stats_block_t	*ThreadStats;
+/*============================================================================*/
+static void InitStats( void )
+	{
+	pthread_key_create( &StatsRegistry.Key, ReleaseBlock );
 	}
 /*============================================================================*/
-ssize_t s_strnlen( const s_string_t * restrict str, ssize_t len )
-	{
-	return ssmax( len, s_strlen( str ));
-	}
-/*============================================================================*/
-static int SetUsedLen( s_string_t * restrict str, size_t NewLength )
+static inline void StatsAdd( int Function, int Counter, uint64_t Value )
 	{
-	size_t	Offset;
+	stats_block_t	*Block	= ThreadStats;
+	uint64_t		*Ptr;
 
-	if( str == NULL )
-		/* ...return an error result. */
-		return -1;
+	if( __builtin_expect( Block == NULL, 0 ) && ( Block = ThreadStats = AcquireBlock( &StatsRegistry, sizeof *Block, InitStats )) == NULL )
+		return;
 
-	/* The 'must be zero' field in this first implementation MUST BE ZERO... */
-	if( str->MustBeZero != 0 )
-		/* ...return an error result. */
-		return -1;
+	/* Only this thread writes the counter, but 's_stats_snapshot' may be reading it. */
+	Ptr		= &Block->Counters[Function][Counter];
+	__atomic_store_n( Ptr, __atomic_load_n( Ptr, __ATOMIC_RELAXED ) + Value, __ATOMIC_RELAXED );
+	}
+/*============================================================================*/
+#define	STATS_CALL( name )					StatsAdd( STATS_##name, COUNTER_CALLS, 1 )
+#define	STATS_BYTES( name, bytes )			StatsAdd( STATS_##name, COUNTER_BYTES, ( bytes ))
+#define	STATS_COPY( name, copied, wanted )	do { ssize_t _Copied = ( copied ); StatsAdd( STATS_##name, COUNTER_BYTES, _Copied ); \
+												 if( _Copied < ( wanted )) StatsAdd( STATS_##name, COUNTER_TRUNCATIONS, 1 ); } while( 0 )
+#define	STATS_ALLOC( name )					StatsAdd( STATS_##name, COUNTER_ALLOCATIONS, 1 )
 
-	if( str->Writable == 0 )
-		return -1;
+#else	/*	defined S_STRING_STATS */
 
-	/* There is no 'used length', we have only the 'maximum length', which cannot be changed... */
-	if( str->Sizes == 0 )
-		/* ...return an error result. */
-		return -1;
+#define	STATS_CALL( name )					((void)0)
+#define	STATS_BYTES( name, bytes )			((void)0)
+#define	STATS_COPY( name, copied, wanted )	((void)0)
+#define	STATS_ALLOC( name )					((void)0)
 
-	if( NewLength > s_strmaxlen( str ))
-		return -1;
+#endif	/*	defined S_STRING_STATS */
+/*============================================================================*/
+/* Latency tracing. When the library is compiled with 'S_STRING_TRACE' defined,
+   one of every 'TracePeriod' calls (per thread) to the search, comparison,
+   tokenizing and copy functions is timed, and the time is added to a
+   log-linear histogram of its function and of the size class of its input.
+   Otherwise the macros expand to nothing. */
+#if			defined S_STRING_TRACE
+
+#define	TRACE_FUNCTIONS	\
+	F( s_strcat ) \
+	F( s_strcat_c ) \
+	F( s_strlcat ) \
+	F( s_strlcat_c ) \
+	F( s_strncat ) \
+	F( s_strncat_c ) \
+	F( s_strcpy ) \
+	F( s_strcpy_c ) \
+	F( s_strlcpy ) \
+	F( s_strlcpy_c ) \
+	F( s_strcmp ) \
+	F( s_strcmp_c ) \
+	F( c_strcmp_s ) \
+	F( s_stricmp ) \
+	F( s_stricmp_c ) \
+	F( c_stricmp_s ) \
+	F( s_strncmp ) \
+	F( s_strncmp_c ) \
+	F( c_strncmp_s ) \
+	F( s_strnicmp ) \
+	F( s_strnicmp_c ) \
+	F( c_strnicmp_s ) \
+	F( s_strchr ) \
+	F( s_strrchr ) \
+	F( s_strichr ) \
+	F( s_strrichr ) \
+	F( s_strstr ) \
+	F( s_strstr_c ) \
+	F( c_strstr_s ) \
+	F( s_strstr_par ) \
+	F( s_strcount_chr ) \
+	F( s_strcount ) \
+	F( s_findall ) \
+	F( s_stristr ) \
+	F( s_stristr_c ) \
+	F( c_stristr_s ) \
+	F( s_strpbrk ) \
+	F( s_strpbrk_c ) \
+	F( s_strtok ) \
+	F( s_strtok_c ) \
+	F( s_strtok_s ) \
+	F( s_strtok_sc ) \
+	F( s_strtok_m ) \
+	F( s_strtok_mc ) \
+	F( s_strvec_find_v ) \
+	F( s_strvec_eq_mask_v ) \
+	F( s_map_set_v ) \
+	F( s_map_get_v )
+
+enum
+	{
+#define	F( name )	TRACE_##name,
+	TRACE_FUNCTIONS
+#undef	F
+	TRACE_COUNT
+	};
 
-	/* If the 'area' field is 3 (heap with references counter) we have a 'size_t'
-	   counter, besides the 'maximum length', before 'used length'. */
-	Offset	= ( str->Area == 3 ? sizeof( size_t ) : 0 ) + ( 1 << str->Bits );
+static const char	*const TraceNames[TRACE_COUNT]	=
+	{
+#define	F( name )	#name,
+	TRACE_FUNCTIONS
+#undef	F
+	};
+
+#if			!defined S_TRACE_PERIOD
+#define	S_TRACE_PERIOD	64
+#endif	/*	!defined S_TRACE_PERIOD */
+
+/* The sizes of the inputs are grouped by powers of 4: 0-15, 16-63, 64-255...
+   up to 65536 and above. */
+#define	TRACE_CLASSES		8
+/* Each power of two of the times is split in 'TRACE_SUB_BUCKETS' buckets, so
+   the error of a percentile is below 25%. Times of 2^TRACE_OCTAVES ticks or
+   more go to the last bucket. */
+#define	TRACE_SUB_BUCKETS	4
+#define	TRACE_OCTAVES		36
+#define	TRACE_BUCKETS		( TRACE_OCTAVES * TRACE_SUB_BUCKETS )
+
+/* The histograms of a thread, taken on its first sampled call. */
+typedef struct
+	{
+	thread_block_t	Header;
+	uint32_t		Buckets[TRACE_COUNT][TRACE_CLASSES][TRACE_BUCKETS];
+	} trace_block_t;
 
-	switch( str->Bits )
-		{
-		case 0:
-			str->PayLoad[Offset+0]	= (uint8_t)( NewLength >>  0 );
-			return NewLength;
-		case 1:
-			str->PayLoad[Offset+0]	= (uint8_t)( NewLength >>  0 );
-			str->PayLoad[Offset+1]	= (uint8_t)( NewLength >>  8 );
-			return NewLength;
-		case 2:
-			str->PayLoad[Offset+0]	= (uint8_t)( NewLength >>  0 );
-			str->PayLoad[Offset+1]	= (uint8_t)( NewLength >>  8 );
-			str->PayLoad[Offset+2]	= (uint8_t)( NewLength >> 16 );
-			str->PayLoad[Offset+3]	= (uint8_t)( NewLength >> 24 );
-			return NewLength;
-		case 3:
-			str->PayLoad[Offset+0]	= (uint8_t)( NewLength >>  0 );
-			str->PayLoad[Offset+1]	= (uint8_t)( NewLength >>  8 );
-			str->PayLoad[Offset+2]	= (uint8_t)( NewLength >> 16 );
-			str->PayLoad[Offset+3]	= (uint8_t)( NewLength >> 24 );
-			str->PayLoad[Offset+4]	= (uint8_t)( NewLength >> 32 );
-			str->PayLoad[Offset+5]	= (uint8_t)( NewLength >> 40 );
-			str->PayLoad[Offset+6]	= (uint8_t)( NewLength >> 48 );
-			str->PayLoad[Offset+7]	= (uint8_t)( NewLength >> 56 );
-			return NewLength;
-		}
+typedef struct
+	{
+	int			Function;
+	int			Class;
+	uint64_t	Start;		/* Zero if the call is not being timed. */
+	} trace_scope_t;
+
+static block_registry_t			TraceRegistry	= { NULL, PTHREAD_ONCE_INIT };
+static __thread trace_block_t	*ThreadTrace;
+static __thread int				TraceCountdown;
+static int						TracePeriod	= S_TRACE_PERIOD;
+/* The time when tracing started, in ticks and in nanoseconds, to convert
+   from one unit to the other. */
+static uint64_t					TraceOriginTicks, TraceOriginNs;
+/*============================================================================*/
+static uint64_t TraceNs( void )
+	{
+	struct timespec	Ts;
 
-	/* Should never reach here... */
-	return 0;
+	clock_gettime( CLOCK_MONOTONIC, &Ts );
+
+	return (uint64_t)Ts.tv_sec * 1000000000u + Ts.tv_nsec;
 	}
 /*============================================================================*/
-static char *s_cstr( s_string_t * restrict str )
+/* Returns the current time in ticks: cycles of the time stamp counter where
+   there is one, otherwise nanoseconds. */
+static inline uint64_t TraceTicks( void )
 	{
-	size_t	NumCounters;
-	size_t	Offset;
+#if			defined __x86_64__ || defined __i386__
+	return __rdtsc();
+#else	/*	defined __x86_64__ || defined __i386__ */
+	return TraceNs();
+#endif	/*	defined __x86_64__ || defined __i386__ */
+	}
+/*============================================================================*/
+static void InitTrace( void )
+	{
+	pthread_key_create( &TraceRegistry.Key, ReleaseBlock );
 
-	if( str == NULL )
-		return NULL;
+	TraceOriginNs		= TraceNs();
+	TraceOriginTicks	= TraceTicks();
+	}
+/*============================================================================*/
+/* Returns the size class of an input of 'Size' characters. */
+static inline int TraceClass( size_t Size )
+	{
+	int	Class;
 
-	if( str->MustBeZero != 0 )
-		return NULL;
+	if( Size < 16 )
+		return 0;
 
-	NumCounters	= 1 + str->Sizes;
-	Offset		= ( str->Area == 3 ? sizeof( size_t ) : 0 ) + NumCounters * ( 1 << str->Bits );
+	Class	= ( 63 - __builtin_clzll( Size )) / 2 - 1;
 
-	return (char*)&str->PayLoad[Offset];
+	return Class < TRACE_CLASSES ? Class : TRACE_CLASSES - 1;
 	}
 /*============================================================================*/
-const char *s_constcstr( const s_string_t * restrict str, ssize_t start )
+/* Returns the bucket of the histograms where a time of 'Ticks' goes. The
+   first 'TRACE_SUB_BUCKETS' buckets hold one value each, then each power of
+   two is split in 'TRACE_SUB_BUCKETS' equal parts. */
+static inline int TraceBucket( uint64_t Ticks )
 	{
-	static const char	EmptyString[] = "";
-	size_t				NumCounters;
-	ssize_t				Offset;
-	ssize_t				UsedLen;
-
-	if( str == NULL || str->MustBeZero != 0 )
-		return EmptyString;
+	int	Log2, Bucket;
 
-	UsedLen	= s_strlen( str );
-
-	if( start < -UsedLen || start >= UsedLen )
-		return EmptyString;
-
-	if( start < 0 )
-		start  += UsedLen;
+	if( Ticks < TRACE_SUB_BUCKETS )
+		return Ticks;
 
-	NumCounters	= 1 + str->Sizes;
-	Offset		= ( str->Area == 3 ? sizeof( size_t ) : 0 ) + NumCounters * ( 1 << str->Bits );
+	Log2	= 63 - __builtin_clzll( Ticks );
+	Bucket	= ( Log2 - 1 ) * TRACE_SUB_BUCKETS + (int)(( Ticks >> ( Log2 - 2 )) & ( TRACE_SUB_BUCKETS - 1 ));
 
-	return (const char*)&str->PayLoad[Offset + start];
+	return Bucket < TRACE_BUCKETS ? Bucket : TRACE_BUCKETS - 1;
 	}
 /*============================================================================*/
-int s_charat( const s_string_t * restrict str, ssize_t index )
+/* Returns the first time (in ticks) that goes after the bucket 'Bucket'. */
+static uint64_t TraceBucketEnd( int Bucket )
 	{
-	const char	*Ptr;
+	int	Log2;
 
-	Ptr = s_constcstr( str, index );
+	if( Bucket < TRACE_SUB_BUCKETS )
+		return Bucket + 1;
 
-	return (int)*Ptr;
+	Log2	= Bucket / TRACE_SUB_BUCKETS + 1;
+
+	return (uint64_t)( TRACE_SUB_BUCKETS + Bucket % TRACE_SUB_BUCKETS + 1 ) << ( Log2 - 2 );
 	}
 /*============================================================================*/
-ssize_t s_setcharat( s_string_t * restrict dst, ssize_t index, int value, int filler )
+/* Decides whether the current call is timed. */
+static inline int TraceSample( void )
 	{
-	ssize_t	UsedLen;
-	char	*Ptr;
-
-	if( dst == NULL || dst->Writable == 0 )
-		return -1;
+	int	Period;
 
-	/* We can change a character beyond the current used length, as long as it
-	   is not beyond the maximum length. */
-	if( index >= s_strmaxlen( dst ))
-		return -1;
+	if( __builtin_expect( --TraceCountdown > 0, 1 ))
+		return 0;
 
-	UsedLen = s_strlen( dst );
+	/* While tracing is disabled the period is checked again every so often. */
+	Period			= __atomic_load_n( &TracePeriod, __ATOMIC_RELAXED );
+	TraceCountdown	= Period > 0 ? Period : 65536;
 
-	/* We can have a negative index for indexing from the end of the string (-1 is
-	   the last character), but the index cannot be beyond the current used length. */
-	if( index < -UsedLen )
-		return -1;
-
-	/* 'index' is negative... */
-	if( index < 0 )
-		/* ...we must revert it, counting from the end to point to the real index. */
-		index  += UsedLen;
+	return Period > 0;
+	}
+/*============================================================================*/
+/* Called when a traced function returns, records the time of the call if it
+   was timed. */
+static inline void TraceEnd( trace_scope_t *Scope )
+	{
+	trace_block_t	*Block;
+	uint32_t		*Ptr;
+	uint64_t		Ticks;
 
-	if(( Ptr = s_cstr( dst )) == NULL )
-		return -1;
-
-	/* The character being changed is more than one position beyond the end of the string... */
-	if( index > UsedLen )
-		{
-		/* ...but 'filer' is zero... */
-		if( filler == 0 )
-			/* ...so the operation will be ignored. */
-			return -1;
-		/* ...and 'filler' is not zero... */
-		else
-			/* ...so we will fill the empty space with 'filler'. */
-			memset( &Ptr[UsedLen], filler, index - UsedLen );
-		}
+	if( __builtin_expect( Scope->Start == 0, 1 ))
+		return;
 
-	Ptr[index]	= (uint8_t)value;
+	Ticks	= TraceTicks() - Scope->Start;
 
-	if( index >= UsedLen )
-		{
-		UsedLen = index + 1;
-		SetUsedLen( dst, UsedLen );
-		Ptr[UsedLen]	= '\0';
-		}
+	if(( Block = ThreadTrace ) == NULL && ( Block = ThreadTrace = AcquireBlock( &TraceRegistry, sizeof *Block, InitTrace )) == NULL )
+		return;
 
-	return UsedLen;
+	Ptr		= &Block->Buckets[Scope->Function][Scope->Class][TraceBucket( Ticks )];
+	__atomic_store_n( Ptr, __atomic_load_n( Ptr, __ATOMIC_RELAXED ) + 1, __ATOMIC_RELAXED );
 	}
 /*============================================================================*/
-ssize_t s_appendchar( s_string_t * restrict dst, int value )
+static inline size_t TraceCLen( const char *Str )
 	{
-	ssize_t	UsedLen;
-	char	*Ptr;
+	return Str != NULL ? strlen( Str ) : 0;
+	}
+/*============================================================================*/
+/* Must be placed after the declarations of a function. 'size' is the length
+   of its input, evaluated only for the timed calls, before the clock starts. */
+#define	TRACE_CALL( name, size )	trace_scope_t _Trace __attribute__((cleanup( TraceEnd )))	= { TRACE_##name, 0, 0 }; \
+									if( __builtin_expect( TraceSample(), 0 )) \
+										{ \
+										_Trace.Class	= TraceClass( size ); \
+										_Trace.Start	= TraceTicks(); \
+										}
 
-	if( dst == NULL || dst->Writable == 0 )
-		return -1;
+#else	/*	defined S_STRING_TRACE */
 
-	UsedLen = s_strlen( dst );
+#define	TRACE_CALL( name, size )	((void)0)
 
-	/* We cannot grow the string beyond its maximum length. */
-	if( UsedLen >= s_strmaxlen( dst ))
-		return -1;
+#endif	/*	defined S_STRING_TRACE */
+/*============================================================================*/
+/* Everything the library creates in the heap is allocated through an
+   s_allocator_t: the one passed to the '_a' functions or, if it is NULL, the
+   one of the calling thread or, if it has none, the global one. The default is
+   the C library. The blocks of statistics are the only exception, they outlive
+   any allocator that could be installed. */
+static void *LibcAlloc( void *Context, size_t Size )
+	{
+	(void)Context;
 
-	if(( Ptr = s_cstr( dst )) == NULL )
-		return -1;
+	return malloc( Size );
+	}
+/*============================================================================*/
+static void *LibcRealloc( void *Context, void *Ptr, size_t Size )
+	{
+	(void)Context;
 
-	Ptr[UsedLen]		= (uint8_t)value;
+	return realloc( Ptr, Size );
+	}
+/*============================================================================*/
+static void LibcFree( void *Context, void *Ptr )
+	{
+	(void)Context;
 
-	SetUsedLen( dst, UsedLen + 1 );
-	Ptr[UsedLen + 1]	= '\0';
+	free( Ptr );
+	}
+/*============================================================================*/
+static const s_allocator_t			LibcAllocator	= { LibcAlloc, LibcRealloc, LibcFree, NULL };
 
-	return UsedLen + 1;
+static const s_allocator_t			*GlobalAllocator= &LibcAllocator;
+static __thread const s_allocator_t	*ThreadAllocator;
+/*============================================================================*/
+/* Returns the allocator to be used when the caller passed 'Alloc'. */
+static inline const s_allocator_t *GetAllocator( const s_allocator_t *Alloc )
+	{
+	if( Alloc != NULL )
+		return Alloc;
+
+	if( ThreadAllocator != NULL )
+		return ThreadAllocator;
+
+	return __atomic_load_n( &GlobalAllocator, __ATOMIC_ACQUIRE );
 	}
-/*=========================================================================*//**
-s_delete_e Tested OK!!!
-*//*==========================================================================*/
-ssize_t s_delete_e( s_string_t * restrict dst, ssize_t start, ssize_t end )
-	{
-	ssize_t	UsedLen;
-	char	*Ptr;
-
-	/* Either the s_string is invalid or it cannot be changed... */
-	if( dst == NULL || dst->MustBeZero != 0 || dst->Writable == 0 )
-		/* ...that's an error. */
-		return -1;
-
-	UsedLen = s_strlen( dst );
-
-	/* Either the portion to remove begins after the end of the string or
-	   it ends before the beginning of the string... */
-	if( start >= UsedLen || end < -UsedLen )
-		/* ...the string won't be changed. */
-		return 0;
-
-	/* The portion to remove begins before the beginning of the string... */
-	if( start < -UsedLen )
-		/* ...let's adjust the beginning. */
-		start	= 0;
-	/* 'start' is negative... */
-	else if( start < 0 )
-		/* ...let's normalize it counting from the end of the string. */
-		start  += UsedLen;
-
-	/* The portion to remove ends after the end of the string... */
-	if( end >= UsedLen )
-		/* ...let's adjust the end. */
-		end		= UsedLen - 1;
-	/* 'end' is negative... */
-	else if( end < 0 )
-		/* ...let's normalize it counting from the end of the string. */
-		end	   += UsedLen;
-
-	/* The portion to remove ends before its beginning... */
-	if( end < start )
-		/* ..the string  won't be changed. */
-		return 0;
-
-	/* Get the pointer to the storage area. But is is invalid... */
-	if(( Ptr = s_cstr( dst )) == NULL )
-		/* ...there's nothing we can do, it is an error. */
-		return -1;
-
-	/* Move the remaining of the string after the portion to be removed
-	   to be right at the beginning of the portion to be removed. */
-	memmove( &Ptr[start], &Ptr[end + 1], UsedLen - end - 1 );
-
-	/* Adjust the resulting used length of the string. */
-	UsedLen		   -= end - start + 1;
-
-	/* Terminates the string at its new end. */
-	Ptr[UsedLen]	= '\0';
-
-	/* Update the used length of the string. */
-	SetUsedLen( dst, UsedLen );
-
-	/* Return how many characters were effectively removed. */
-	return end - start + 1;
-	}
-/*=========================================================================*//**
-s_delete_l Tested OK!!!
-*//*==========================================================================*/
-ssize_t s_delete_l( s_string_t * restrict dst, ssize_t start, ssize_t len )
-	{
-	ssize_t	UsedLen;
-	char	*Ptr;
-
-	/* Either the s_string is invalid or it cannot be changed... */
-	if( dst == NULL || dst->MustBeZero != 0 || dst->Writable == 0 )
-		/* ...that's an error. */
-		return -1;
-
-	UsedLen = s_strlen( dst );
-
-	/* Either the portion to remove begins after the end of the string or
-	   its length is zero... */
-	if( start >= UsedLen || len <= 0 )
-		return 0;
-
-	/* The portion to remove begins before the beginning of the string... */
-	if( start < -UsedLen )
-		{
-		/* ...let's adjust the length... */
-		if(( len += start + UsedLen ) <= 0 )
-			return 0;
-		/* ...and the beginning. */
-		start	= 0;
-		}
-	/* 'start' is negative... */
-	else if( start < 0 )
-		/* ...let's normalize it counting from the end of the string. */
-		start  += UsedLen;
-
-	if( start + len > UsedLen || start + len < 0 ) /* start + len < 0 could happen due to overflow. */
-		len	= UsedLen - start;
-
-	/* Get the pointer to the storage area. But is is invalid... */
-	if(( Ptr = s_cstr( dst )) == NULL )
-		/* ...there's nothing we can do, it is an error. */
-		return -1;
-
-	memmove( &Ptr[start], &Ptr[start+len], UsedLen - start - len );
-
-	/* Adjust the resulting used length of the string. */
-	UsedLen	   -= len;
-
-	/* Terminates the string at its new end. */
-	Ptr[UsedLen]	= '\0';
-
-	/* Update the used length of the string. */
-	SetUsedLen( dst, UsedLen );
-
-	/* Return how many characters were effectively removed. */
-	return len;
-	}
 /*============================================================================*/
-ssize_t s_truncate( s_string_t * restrict dst, ssize_t len )
+static inline void *Allocate( const s_allocator_t *Alloc, size_t Size )
 	{
-	ssize_t	UsedLen;
-	char	*Ptr;
+	Alloc	= GetAllocator( Alloc );
 
-	if( dst == NULL || dst->MustBeZero != 0 || dst->Writable == 0 )
-		return -1;
+	return Alloc->Alloc( Alloc->Context, Size );
+	}
+/*============================================================================*/
+static inline void Release( const s_allocator_t *Alloc, void *Ptr )
+	{
+	if( Ptr == NULL )
+		return;
 
-	UsedLen = s_strlen( dst );
+	Alloc	= GetAllocator( Alloc );
 
-	/* The new length is longer than the current length... */
-	if( len >= UsedLen )
-		/* ...nothing to be done. */
-		return UsedLen;
-
-	if( len < -UsedLen )
-		len		= 0;
-	else if( len < 0 )
-		len	   += UsedLen;
+	Alloc->Free( Alloc->Context, Ptr );
+	}
+/*============================================================================*/
+/* Allocates with 'Alloc' a heap s_string of 'Size' bytes (as returned by
+   '_s_calcsize' or '_s_calcsize_x'), and returns in '*Area' the value for its
+   'Area' field. The strings of the C library allocator are in area 2, like the
+   ones the program allocates by itself. The rest are in area 3, with their
+   allocator in the word before the counters, so that 's_free' can release them
+   with it whatever allocator is in use by then. */
+static s_string_t *AllocateString( const s_allocator_t *Alloc, size_t Size, int *Area )
+	{
+	s_string_t	*Str;
 
-	if(( Ptr = s_cstr( dst )) == NULL )
-		return -1;
+	Alloc	= GetAllocator( Alloc );
+	*Area	= Alloc == &LibcAllocator ? 2 : 3;
 
-	Ptr[len]	= '\0';
+	if( *Area == 3 )
+		Size   += sizeof( size_t );
 
-	SetUsedLen( dst, len );
+	if(( Str = Alloc->Alloc( Alloc->Context, Size )) != NULL && *Area == 3 )
+		memcpy( Str->PayLoad, &Alloc, sizeof Alloc );
 
-	return len;
+	return Str;
 	}
 /*============================================================================*/
-int s_strcat( s_string_t * restrict dst, const s_string_t * restrict src, ssize_t sstart )
+/* Returns the allocator that created the heap s_string 'Str'. The strings in
+   area 2 don't record it, for them it is 'Alloc' or, if it is NULL, the C
+   library. */
+static const s_allocator_t *StringAllocator( const s_string_t *Str, const s_allocator_t *Alloc )
 	{
-	ssize_t		DstMaxLen, DstUsedLen;
-	ssize_t		SrcUsedLen;
-	char		*DstPtr;
-	const char	*SrcPtr;
-	ssize_t		BytesToCopy;
+	if( Str->Area == 3 )
+		memcpy( &Alloc, Str->PayLoad, sizeof Alloc );
 
-	/* The destination is a null pointer... */
-	if( dst == NULL )
-		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
-		return 0;
+	return Alloc != NULL ? Alloc : &LibcAllocator;
+	}
+/*============================================================================*/
+/* The pool of threads shared by all the parallel functions. It is started the
+   first time some work is big enough to be split. A job is a number of tasks,
+   numbered from zero, that are spread in equal ranges among the threads (the
+   calling one included). When a thread runs out of tasks it steals half of
+   the remaining tasks of another one, so a slow or late thread doesn't delay
+   the whole job. Only one job runs at a time; a job started while another is
+   running (or from inside a task) runs entirely on its calling thread. */
+#define	PARALLEL_MAX_THREADS	64
+#define	PARALLEL_THRESHOLD		( 1 << 20 )
+
+typedef void ( *parallel_fn_t )( void *Arg, size_t Task );
+
+typedef struct
+	{
+	parallel_fn_t	Fn;
+	void			*Arg;
+	int				Participants;
+	/* The tasks not yet taken from each thread: the first one in the low 32
+	   bits and the end of the range in the high 32 bits, so both are changed
+	   at once. Each range in its own cache line. */
+	struct
+		{
+		uint64_t	Range;
+		char		Pad[64 - sizeof( uint64_t )];
+		}			Slots[PARALLEL_MAX_THREADS];
+	} parallel_job_t;
 
-	if( dst->Writable == 0 )
-		return -1;
+static struct
+	{
+	pthread_mutex_t	Lock;
+	pthread_cond_t	Wake;		/* Signalled when a job starts. */
+	pthread_cond_t	Done;		/* Signalled when the last worker leaves a job. */
+	pthread_mutex_t	JobLock;	/* Held by the thread that runs the current job. */
+	parallel_job_t	*Job;
+	unsigned		Generation;	/* Incremented for each job. */
+	int				Started;	/* Number of worker threads created. */
+	int				Active;		/* Number of workers inside the current job. */
+	int				Threads;	/* Threads to use, including the calling one, or 0 if not decided yet. */
+	size_t			Threshold;	/* Size of the data below which there is no parallelism. */
+	} Pool	= { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_MUTEX_INITIALIZER, NULL, 0, 0, 0, 0, PARALLEL_THRESHOLD };
+/*============================================================================*/
+static inline uint64_t PackRange( uint64_t First, uint64_t End )
+	{
+	return First | End << 32;
+	}
+/*============================================================================*/
+/* Takes the first task of the range 'Range'. Returns zero if it is empty. */
+static int TakeTask( uint64_t *Range, size_t *Task )
+	{
+	uint64_t	Value	= __atomic_load_n( Range, __ATOMIC_ACQUIRE );
+	uint64_t	First, End;
 
-	DstUsedLen	= s_strlen( dst );
+	do
+		{
+		First	= Value & 0xffffffff;
+		End		= Value >> 32;
 
-	/* The source is a null pointer... */
-	if( src == NULL )
-		/* ...so the destination string will not be modified. */
-		return DstUsedLen;
+		if( First >= End )
+			return 0;
+		}
+	while( !__atomic_compare_exchange_n( Range, &Value, PackRange( First + 1, End ), 1, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ));
 
-	SrcUsedLen	= s_strlen( src );
+	*Task	= First;
 
-	/* The source string is empty... */
-	if( SrcUsedLen == 0 || sstart < -SrcUsedLen || sstart >= SrcUsedLen )
-		/* ...so again the destination string will not be modified. */
-		return DstUsedLen;
-
-	if( sstart < 0 )
-		sstart += SrcUsedLen;
-
-	DstMaxLen	= s_strmaxlen( dst );
-
-	DstPtr		= s_cstr( dst );
-	SrcPtr		= s_constcstr( src, sstart );
+	return 1;
+	}
+/*============================================================================*/
+/* Moves to the (empty) range of 'Slot' the last half of the tasks of another
+   thread. Returns zero if there are no tasks left anywhere. */
+static int StealTasks( parallel_job_t *Job, int Slot )
+	{
+	uint64_t	Value, First, End, Middle;
+	int			i, Victim;
 
-	/* Calculate how many bytes will be copied. */
-	BytesToCopy	= ssmin( DstMaxLen - DstUsedLen, SrcUsedLen - sstart );
+	for( i = 1; i < Job->Participants; i++ )
+		{
+		Victim	= ( Slot + i ) % Job->Participants;
+		Value	= __atomic_load_n( &Job->Slots[Victim].Range, __ATOMIC_ACQUIRE );
 
-	memcpy( DstPtr + DstUsedLen, SrcPtr, BytesToCopy );
+		for( ;; )
+			{
+			First	= Value & 0xffffffff;
+			End		= Value >> 32;
 
-	DstUsedLen += BytesToCopy;
+			if( First >= End )
+				break;
 
-	/* Terminate the new resulting string. */
-	DstPtr[DstUsedLen]	= '\0';
+			/* The victim keeps the first half, the one it would run first. */
+			Middle	= First + ( End - First ) / 2;
 
-	/* Update the new length of the string. */
-	SetUsedLen( dst, DstUsedLen );
+			if( __atomic_compare_exchange_n( &Job->Slots[Victim].Range, &Value, PackRange( First, Middle ), 1, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ))
+				{
+				/* Nobody changes an empty range, so this thread's can be just written. */
+				__atomic_store_n( &Job->Slots[Slot].Range, PackRange( Middle, End ), __ATOMIC_RELEASE );
+				return 1;
+				}
+			}
+		}
 
-	return DstUsedLen;
+	return 0;
 	}
 /*============================================================================*/
-int s_strcat_c( s_string_t * restrict dst, const char * restrict src )
+static void RunTasks( parallel_job_t *Job, int Slot )
 	{
-	ssize_t		DstMaxLen, DstUsedLen;
-	ssize_t		SrcUsedLen;
-	char		*DstPtr;
-	ssize_t		BytesToCopy;
-
-	/* The destination is a null pointer... */
-	if( dst == NULL )
-		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
-		return 0;
+	size_t	Task;
 
-	if( dst->Writable == 0 )
-		return -1;
-
-	DstUsedLen	= s_strlen( dst );
+	do
+		while( TakeTask( &Job->Slots[Slot].Range, &Task ))
+			Job->Fn( Job->Arg, Task );
+	while( StealTasks( Job, Slot ));
+	}
+/*============================================================================*/
+static void *ParallelWorker( void *Arg )
+	{
+	int				Slot	= (int)(intptr_t)Arg;
+	unsigned		Seen;
+	parallel_job_t	*Job;
 
-	/* The source is a null pointer or it is an empty string... */
-	if( src == NULL || ( SrcUsedLen	= strlen( src )) == 0 )
-		/* ...so the destination string will not be modified. */
-		return DstUsedLen;
+	pthread_mutex_lock( &Pool.Lock );
 
-	DstMaxLen	= s_strmaxlen( dst );
+	for( Seen = Pool.Generation; ; Seen = Pool.Generation )
+		{
+		while( Pool.Generation == Seen )
+			pthread_cond_wait( &Pool.Wake, &Pool.Lock );
 
-	DstPtr		= s_cstr( dst );
+		/* The job may have finished already, or not need this thread. */
+		if(( Job = Pool.Job ) == NULL || Slot >= Job->Participants )
+			continue;
 
-	/* Calculate how many bytes will be copied. */
-	BytesToCopy	= ssmin( DstMaxLen - DstUsedLen, SrcUsedLen );
+		Pool.Active++;
+		pthread_mutex_unlock( &Pool.Lock );
 
-	memcpy( DstPtr + DstUsedLen, src, BytesToCopy );
+		RunTasks( Job, Slot );
 
-	DstUsedLen += BytesToCopy;
+		pthread_mutex_lock( &Pool.Lock );
+		if( --Pool.Active == 0 )
+			pthread_cond_signal( &Pool.Done );
+		}
 
-	/* Terminate the new resulting string. */
-	DstPtr[DstUsedLen]	= '\0';
+	return NULL;
+	}
+/*============================================================================*/
+/* Returns the number of threads to use, including the calling one. */
+static int ParallelThreads( void )
+	{
+	int	Threads	= __atomic_load_n( &Pool.Threads, __ATOMIC_RELAXED );
 
-	/* Update the new length of the string. */
-	SetUsedLen( dst, DstUsedLen );
+	if( Threads == 0 )
+		{
+		Threads	= ssmax( 1, ssmin( sysconf( _SC_NPROCESSORS_ONLN ), PARALLEL_MAX_THREADS ));
+		__atomic_store_n( &Pool.Threads, Threads, __ATOMIC_RELAXED );
+		}
 
-	return DstUsedLen;
+	return Threads;
 	}
 /*============================================================================*/
-int s_strlcat( s_string_t * restrict dst, const s_string_t * restrict src, ssize_t srcstart, ssize_t len )
+/* Calls 'Fn( Arg, Task )' for every 'Task' from 0 to 'Count' - 1 (less than
+   2^32), in any order and on up to 'MaxThreads' threads (0 for the size of the
+   pool), if 'Bytes' (the size of the data) is not below the threshold. Returns
+   when all the tasks are done. */
+static void ParallelFor( size_t Count, size_t Bytes, int MaxThreads, parallel_fn_t Fn, void *Arg )
 	{
-	ssize_t		ResultLen, DstUsedLen;
-	ssize_t		SrcUsedLen;
-	char		*DstPtr;
-	const char	*SrcPtr;
-	ssize_t		BytesToCopy;
+	parallel_job_t	Job;
+	size_t			Task;
+	int				Threads	= ParallelThreads(), i;
 
-	/* The destination is a null pointer... */
-	if( dst == NULL )
-		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
-		return 0;
+	if( MaxThreads > 0 && MaxThreads < Threads )
+		Threads	= MaxThreads;
 
-	if( dst->Writable == 0 )
-		return -1;
+	if( (size_t)Threads > Count )
+		Threads	= Count;
 
-	DstUsedLen	= s_strlen( dst );
+	if( Threads <= 1 || Bytes < __atomic_load_n( &Pool.Threshold, __ATOMIC_RELAXED ) || pthread_mutex_trylock( &Pool.JobLock ) != 0 )
+		{
+		for( Task = 0; Task < Count; Task++ )
+			Fn( Arg, Task );
+		return;
+		}
 
-	/* 'len' is shorter than the current destination length... */
-	if( len <= DstUsedLen )
-		/* ...there is nothing to be done. */
-		return DstUsedLen;
+	Job.Fn				= Fn;
+	Job.Arg				= Arg;
+	Job.Participants	= Threads;
 
-	/* The source is a null pointer... */
-	if( src == NULL )
-		/* ...so the destination string will not be modified. */
-		return DstUsedLen;
+	for( i = 0; i < Threads; i++ )
+		Job.Slots[i].Range	= PackRange( Count * i / Threads, Count * ( i + 1 ) / Threads );
 
-	if(( SrcUsedLen = s_strlen( src )) == 0 || srcstart >= SrcUsedLen )
-		return DstUsedLen;
-
-	if( srcstart < -SrcUsedLen )
-		return -1;
-
-	if( srcstart < 0 )
-		srcstart+= SrcUsedLen;
+	pthread_mutex_lock( &Pool.Lock );
 
-	ResultLen	= ssmin( len, s_strmaxlen( dst ));
+	/* The workers are created the first time they are needed. If some
+	   cannot be created, their tasks are stolen by the others. */
+	while( Pool.Started < Threads - 1 )
+		{
+		pthread_attr_t	Attr;
+		pthread_t		Thread;
+		int				Error;
 
-	DstPtr		= s_cstr( dst );
-	SrcPtr		= s_constcstr( src, srcstart );
+		pthread_attr_init( &Attr );
+		pthread_attr_setdetachstate( &Attr, PTHREAD_CREATE_DETACHED );
+		Error	= pthread_create( &Thread, &Attr, ParallelWorker, (void*)(intptr_t)( Pool.Started + 1 ));
+		pthread_attr_destroy( &Attr );
 
-	/* Calculate how many bytes will be copied. */
-	BytesToCopy	= ssmin( ResultLen - DstUsedLen, SrcUsedLen - srcstart );
+		if( Error != 0 )
+			break;
 
-	memcpy( DstPtr + DstUsedLen, SrcPtr, BytesToCopy );
+		Pool.Started++;
+		}
 
-	DstUsedLen += BytesToCopy;
+	Pool.Job	= &Job;
+	Pool.Generation++;
+	pthread_cond_broadcast( &Pool.Wake );
 
-	/* Terminate the new resulting string. */
-	DstPtr[DstUsedLen]	= '\0';
+	pthread_mutex_unlock( &Pool.Lock );
 
-	/* Update the new length of the string. */
-	SetUsedLen( dst, DstUsedLen );
+	RunTasks( &Job, 0 );
 
-	return DstUsedLen;
+	/* All the tasks have been taken, wait for the workers still running one. */
+	pthread_mutex_lock( &Pool.Lock );
+
+	Pool.Job	= NULL;
+	while( Pool.Active > 0 )
+		pthread_cond_wait( &Pool.Done, &Pool.Lock );
+
+	pthread_mutex_unlock( &Pool.Lock );
+
+	pthread_mutex_unlock( &Pool.JobLock );
 	}
 /*============================================================================*/
-int s_strlcat_c( s_string_t * restrict dst, const char * restrict src, ssize_t len )
+int	s_isreadonly( const s_string_t * restrict str )
 	{
-	ssize_t		ResultLen, DstUsedLen;
-	ssize_t		SrcUsedLen;
-	char		*DstPtr;
-	ssize_t		BytesToCopy;
-
-	/* The destination is a null pointer... */
-	if( dst == NULL )
-		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
-		return 0;
+	if( str == NULL )
+		return -1;		/* -1 is also 'true', but if needed it can be differentiated from a true 'true'.
+						   That is, if -1 is returned, it is read-only because it in reality doesn't exist. */
 
-	if( dst->Writable == 0 )
+	/* The 'must be zero' field in this first implementation MUST BE ZERO. */
+	if( str->MustBeZero != 0 )
 		return -1;
 
-	DstUsedLen	= s_strlen( dst );
-
-	/* 'len' is shorter than the current destination length... */
-	if( len <= DstUsedLen )
-		/* ...there is nothing to be done. */
-		return DstUsedLen;
-
-	/* The source is a null pointer... */
-	if( src == NULL )
-		/* ...so the destination string will not be modified. */
-		return DstUsedLen;
+	return !str->Writable;
+	}
+/*============================================================================*/
+ssize_t s_strmaxlen( const s_string_t * restrict str )
+	{
+	size_t	Offset;
 
-	SrcUsedLen	= strlen( src );
+	if( str == NULL )
+		return 0;
 
-	/* The source string is empty... */
-	if( SrcUsedLen == 0 )
-		/* ...so again the destination string will not be modified. */
-		return DstUsedLen;
+	/* The 'must be zero' field in this first implementation MUST BE ZERO. */
+	if( str->MustBeZero != 0 )
+		return 0;
 
-	ResultLen	= ssmin( len, s_strmaxlen( dst ));
+	/* If the 'area' field is 3 (heap, recording its allocator) we have a 'size_t' word before the 'maximum length'. */
+	Offset	= str->Area == 3 ? sizeof( size_t ) : 0;
 
-	DstPtr		= s_cstr( dst );
+	switch( str->Bits )
+		{
+		case 0:
+			return  (unsigned int)str->PayLoad[Offset+0] << 0;
+		case 1:
+			return (( (size_t)str->PayLoad[Offset+0] <<  0 ) | ( (size_t)str->PayLoad[Offset+1] <<  8 ));
+		case 2:
+			return (( (size_t)str->PayLoad[Offset+0] <<  0 ) | ( (size_t)str->PayLoad[Offset+1] <<  8 ) |
+					( (size_t)str->PayLoad[Offset+2] << 16 ) | ( (size_t)str->PayLoad[Offset+3] << 24 ));
+		case 3:
+			return (( (size_t)str->PayLoad[Offset+0] <<  0 ) | ( (size_t)str->PayLoad[Offset+1] <<  8 ) |
+					( (size_t)str->PayLoad[Offset+2] << 16 ) | ( (size_t)str->PayLoad[Offset+3] << 24 ) |
+					( (size_t)str->PayLoad[Offset+4] << 32 ) | ( (size_t)str->PayLoad[Offset+5] << 40 ) |
+					( (size_t)str->PayLoad[Offset+6] << 48 ) | ( (size_t)str->PayLoad[Offset+7] << 56 ));
+		}
 
-	/* Calculate how many bytes will be copied. */
-	BytesToCopy	= ssmin( ResultLen - DstUsedLen, SrcUsedLen );
+	/* Should never reach here... */
+	return 0;
+	}
+/*============================================================================*/
+static int SetMaxLen( s_string_t * restrict str, size_t MaxLength )
+	{
+	size_t	Offset;
 
-	memcpy( DstPtr + DstUsedLen, src, BytesToCopy );
+	if( str == NULL )
+		/* ...return an error result. */
+		return -1;
 
-	DstUsedLen += BytesToCopy;
+	/* The 'must be zero' field in this first implementation MUST BE ZERO... */
+	if( str->MustBeZero != 0 )
+		/* ...return an error result. */
+		return -1;
 
-	/* Terminate the new resulting string. */
-	DstPtr[DstUsedLen]	= '\0';
+	/* If the 'area' field is 3 (heap, recording its allocator) we have a 'size_t' word before the 'maximum length'. */
+	Offset	= str->Area == 3 ? sizeof( size_t ) : 0;
 
-	/* Update the new length of the string. */
-	SetUsedLen( dst, DstUsedLen );
+	switch( str->Bits )
+		{
+		case 0:
+			str->PayLoad[Offset+0]	= (uint8_t)( MaxLength >>  0 );
+			return MaxLength;
+		case 1:
+			str->PayLoad[Offset+0]	= (uint8_t)( MaxLength >>  0 );
+			str->PayLoad[Offset+1]	= (uint8_t)( MaxLength >>  8 );
+			return MaxLength;
+		case 2:
+			str->PayLoad[Offset+0]	= (uint8_t)( MaxLength >>  0 );
+			str->PayLoad[Offset+1]	= (uint8_t)( MaxLength >>  8 );
+			str->PayLoad[Offset+2]	= (uint8_t)( MaxLength >> 16 );
+			str->PayLoad[Offset+3]	= (uint8_t)( MaxLength >> 24 );
+			return MaxLength;
+		case 3:
+			str->PayLoad[Offset+0]	= (uint8_t)( MaxLength >>  0 );
+			str->PayLoad[Offset+1]	= (uint8_t)( MaxLength >>  8 );
+			str->PayLoad[Offset+2]	= (uint8_t)( MaxLength >> 16 );
+			str->PayLoad[Offset+3]	= (uint8_t)( MaxLength >> 24 );
+			str->PayLoad[Offset+4]	= (uint8_t)( MaxLength >> 32 );
+			str->PayLoad[Offset+5]	= (uint8_t)( MaxLength >> 40 );
+			str->PayLoad[Offset+6]	= (uint8_t)( MaxLength >> 48 );
+			str->PayLoad[Offset+7]	= (uint8_t)( MaxLength >> 56 );
+			return MaxLength;
+		}
 
-	return DstUsedLen;
+	/* Should never reach here... */
+	return 0;
 	}
 /*============================================================================*/
-int s_strncat( s_string_t * restrict dst, const s_string_t * restrict src, ssize_t srcstart, ssize_t len )
+ssize_t s_strlen( const s_string_t * restrict str )
 	{
-	ssize_t		DstMaxLen, DstUsedLen;
-	ssize_t		SrcUsedLen;
-	char		*DstPtr;
-	const char	*SrcPtr;
-	ssize_t		BytesToCopy;
+	size_t	Offset;
 
-	/* The destination is a null pointer... */
-	if( dst == NULL )
-		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
+	if( str == NULL )
 		return 0;
 
-	if( dst->Writable == 0 )
-		return -1;
+	/* The 'must be zero' field in this first implementation MUST BE ZERO. */
+	if( str->MustBeZero != 0 )
+		return 0;
 
-	DstUsedLen	= s_strlen( dst );
+	if( str->Sizes == 0 )
+		return s_strmaxlen( str );
 
-	/* The number of bytes to copy is zero... */
-	if( len <= 0 )
-		/* ...the destination will not be modified. */
-		return DstUsedLen;
+	/* If the 'area' field is 3 (heap, recording its allocator) we have a 'size_t'
+	   word, besides the 'maximum length' before 'used length'. */
+	Offset	= ( str->Area == 3 ? sizeof( size_t ) : 0 ) + ( 1 << str->Bits );
 
-	/* The source is a null pointer or it is an empty string... */
-	if( src == NULL || ( SrcUsedLen	= s_strlen( src )) == 0 )
-		/* ...so the destination string will not be modified too. */
-		return DstUsedLen;
+	switch( str->Bits )
+		{
+		case 0:
+			return ( (size_t)str->PayLoad[Offset+0] <<  0 );
+		case 1:
+			return ( (size_t)str->PayLoad[Offset+0] <<  0 ) | ( (size_t)str->PayLoad[Offset+1] <<  8 );
+		case 2:
+			return ( (size_t)str->PayLoad[Offset+0] <<  0 ) | ( (size_t)str->PayLoad[Offset+1] <<  8 ) |
+				   ( (size_t)str->PayLoad[Offset+2] << 16 ) | ( (size_t)str->PayLoad[Offset+3] << 24 );
+		case 3:
+			return ( (size_t)str->PayLoad[Offset+0] <<  0 ) | ( (size_t)str->PayLoad[Offset+1] <<  8 ) |
+				   ( (size_t)str->PayLoad[Offset+2] << 16 ) | ( (size_t)str->PayLoad[Offset+3] << 24 ) |
+				   ( (size_t)str->PayLoad[Offset+4] << 32 ) | ( (size_t)str->PayLoad[Offset+5] << 40 ) |
+				   ( (size_t)str->PayLoad[Offset+6] << 48 ) | ( (size_t)str->PayLoad[Offset+7] << 56 );
+		}
 
-	if( srcstart >= SrcUsedLen )
-		return DstUsedLen;
-
-	if( srcstart < -SrcUsedLen )
-		return -1;
-
-	if( srcstart < 0 )
-		srcstart+= SrcUsedLen;
-
-	DstMaxLen	= s_strmaxlen( dst );
+	/* Should never reach here... */
+	return 0;
+	}
+/*============================================================================*/
+ssize_t s_strllen( const s_string_t * restrict str, ssize_t len )
+	{
+	return ssmin( ssmax( 0, len ), s_strlen( str ));
+	}
+/*============================================================================*/
+ssize_t s_strnlen( const s_string_t * restrict str, ssize_t len )
+	{
+	return ssmax( len, s_strlen( str ));
+	}
+/*============================================================================*/
+static int SetUsedLen( s_string_t * restrict str, size_t NewLength )
+	{
+	size_t	Offset;
 
-	DstPtr		= s_cstr( dst );
-	SrcPtr		= s_constcstr( src, srcstart );
+	if( str == NULL )
+		/* ...return an error result. */
+		return -1;
 
-	/* Calculate how many bytes will be copied. */
-	BytesToCopy	= ssmin( DstMaxLen - DstUsedLen, ssmin( SrcUsedLen - srcstart, len ));
+	/* The 'must be zero' field in this first implementation MUST BE ZERO... */
+	if( str->MustBeZero != 0 )
+		/* ...return an error result. */
+		return -1;
 
-	memcpy( DstPtr + DstUsedLen, SrcPtr, BytesToCopy );
+	if( str->Writable == 0 )
+		return -1;
 
-	DstUsedLen += BytesToCopy;
+	/* There is no 'used length', we have only the 'maximum length', which cannot be changed... */
+	if( str->Sizes == 0 )
+		/* ...return an error result. */
+		return -1;
 
-	/* Terminate the new resulting string. */
-	DstPtr[DstUsedLen]	= '\0';
+	if( NewLength > s_strmaxlen( str ))
+		return -1;
 
-	/* Update the new length of the string. */
-	SetUsedLen( dst, DstUsedLen );
+	/* The length is going to change, so the cached information is not valid anymore. */
+	InvalidateExt( str );
 
-	return DstUsedLen;
+	/* If the 'area' field is 3 (heap, recording its allocator) we have a 'size_t'
+	   word, besides the 'maximum length', before 'used length'. */
+	Offset	= ( str->Area == 3 ? sizeof( size_t ) : 0 ) + ( 1 << str->Bits );
+
+	switch( str->Bits )
+		{
+		case 0:
+			str->PayLoad[Offset+0]	= (uint8_t)( NewLength >>  0 );
+			return NewLength;
+		case 1:
+			str->PayLoad[Offset+0]	= (uint8_t)( NewLength >>  0 );
+			str->PayLoad[Offset+1]	= (uint8_t)( NewLength >>  8 );
+			return NewLength;
+		case 2:
+			str->PayLoad[Offset+0]	= (uint8_t)( NewLength >>  0 );
+			str->PayLoad[Offset+1]	= (uint8_t)( NewLength >>  8 );
+			str->PayLoad[Offset+2]	= (uint8_t)( NewLength >> 16 );
+			str->PayLoad[Offset+3]	= (uint8_t)( NewLength >> 24 );
+			return NewLength;
+		case 3:
+			str->PayLoad[Offset+0]	= (uint8_t)( NewLength >>  0 );
+			str->PayLoad[Offset+1]	= (uint8_t)( NewLength >>  8 );
+			str->PayLoad[Offset+2]	= (uint8_t)( NewLength >> 16 );
+			str->PayLoad[Offset+3]	= (uint8_t)( NewLength >> 24 );
+			str->PayLoad[Offset+4]	= (uint8_t)( NewLength >> 32 );
+			str->PayLoad[Offset+5]	= (uint8_t)( NewLength >> 40 );
+			str->PayLoad[Offset+6]	= (uint8_t)( NewLength >> 48 );
+			str->PayLoad[Offset+7]	= (uint8_t)( NewLength >> 56 );
+			return NewLength;
+		}
+
+	/* Should never reach here... */
+	return 0;
 	}
 /*============================================================================*/
-int s_strncat_c( s_string_t * restrict dst, const char * restrict src, ssize_t len )
+static char *s_cstr( s_string_t * restrict str )
 	{
-	ssize_t		DstMaxLen, DstUsedLen;
-	ssize_t		SrcUsedLen;
-	char		*DstPtr;
-	ssize_t		BytesToCopy;
-
-	/* The destination is a null pointer... */
-	if( dst == NULL )
-		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
-		return 0;
-
-	if( dst->Writable == 0 )
-		return -1;
-
-	DstUsedLen	= s_strlen( dst );
-
-	/* The number of bytes to copy is zero... */
-	if( len <= 0 )
-		/* ...the destination will not be modified. */
-		return DstUsedLen;
+	if( str == NULL )
+		return NULL;
 
-	/* The source is a null pointer or it is an empty string... */
-	if( src == NULL || ( SrcUsedLen	= strlen( src )) == 0 )
-		/* ...so the destination string will not be modified too. */
-		return DstUsedLen;
+	if( str->MustBeZero != 0 )
+		return NULL;
 
-	DstMaxLen	= s_strmaxlen( dst );
+	/* The caller is going to change the string, so the cached information is not valid anymore. */
+	InvalidateExt( str );
 
-	DstPtr		= s_cstr( dst );
+	return DataPtr( str );
+	}
+/*============================================================================*/
+const char *s_constcstr( const s_string_t * restrict str, ssize_t start )
+	{
+	static const char	EmptyString[] = "";
+	ssize_t				UsedLen;
 
-	/* Calculate how many bytes will be copied. */
-	BytesToCopy	= ssmin( DstMaxLen - DstUsedLen, ssmin( SrcUsedLen, len ));
+	if( str == NULL || str->MustBeZero != 0 )
+		return EmptyString;
 
-	memcpy( DstPtr + DstUsedLen, src, BytesToCopy );
+	UsedLen	= s_strlen( str );
+
+	if( start < -UsedLen || start >= UsedLen )
+		return EmptyString;
+
+	if( start < 0 )
+		start  += UsedLen;
 
-	DstUsedLen += BytesToCopy;
+	return DataPtr( str ) + start;
+	}
+/*============================================================================*/
+int s_charat( const s_string_t * restrict str, ssize_t index )
+	{
+	const char	*Ptr;
 
-	/* Terminate the new resulting string. */
-	DstPtr[DstUsedLen]	= '\0';
+	STATS_CALL( s_charat );
 
-	/* Update the new length of the string. */
-	SetUsedLen( dst, DstUsedLen );
+	Ptr = s_constcstr( str, index );
 
-	return DstUsedLen;
+	return (int)*Ptr;
 	}
 /*============================================================================*/
-int s_strcpy( s_string_t * restrict dst, const s_string_t * restrict src, ssize_t srcstart )
+ssize_t s_setcharat( s_string_t * restrict dst, ssize_t index, int value, int filler )
 	{
-	ssize_t		DstMaxLen;
-	ssize_t		SrcUsedLen;
-	char		*DstPtr;
-	const char	*SrcPtr;
-	ssize_t		BytesToCopy;
+	ssize_t	UsedLen;
+	char	*Ptr;
 
-	/* The destination is a null pointer... */
-	if( dst == NULL )
-		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
-		return 0;
+	STATS_CALL( s_setcharat );
 
-	if( dst->Writable == 0 )
+	if( dst == NULL || dst->Writable == 0 )
 		return -1;
 
-	DstPtr		= s_cstr( dst );
+	/* We can change a character beyond the current used length, as long as it
+	   is not beyond the maximum length. */
+	if( index >= s_strmaxlen( dst ))
+		return -1;
 
-	/* The source is a null pointer or it is an empty string... */
-	if( src == NULL || ( SrcUsedLen	= s_strlen( src )) == 0 || srcstart >= SrcUsedLen )
-		/* ...so the destination string will be emptied. */
-		{
-		DstPtr[0]	= '\0';
-		SetUsedLen( dst, 0 );
-		return 0;
-		}
+	UsedLen = s_strlen( dst );
 
-	if( srcstart < -SrcUsedLen )
-		return -1;
-
-	if( srcstart < 0 )
-		srcstart+= SrcUsedLen;
-
-	DstMaxLen	= s_strmaxlen( dst );
-	SrcPtr		= s_constcstr( src, srcstart );
+	/* We can have a negative index for indexing from the end of the string (-1 is
+	   the last character), but the index cannot be beyond the current used length. */
+	if( index < -UsedLen )
+		return -1;
 
-	/* Calculate how many bytes will be copied. */
-	BytesToCopy	= ssmin( DstMaxLen, SrcUsedLen - srcstart );
+	/* 'index' is negative... */
+	if( index < 0 )
+		/* ...we must revert it, counting from the end to point to the real index. */
+		index  += UsedLen;
 
-	memcpy( DstPtr, SrcPtr, BytesToCopy );
+	if(( Ptr = s_cstr( dst )) == NULL )
+		return -1;
+
+	/* The character being changed is more than one position beyond the end of the string... */
+	if( index > UsedLen )
+		{
+		/* ...but 'filer' is zero... */
+		if( filler == 0 )
+			/* ...so the operation will be ignored. */
+			return -1;
+		/* ...and 'filler' is not zero... */
+		else
+			/* ...so we will fill the empty space with 'filler'. */
+			memset( &Ptr[UsedLen], filler, index - UsedLen );
+		}
 
-	/* Terminate the new resulting string. */
-	DstPtr[BytesToCopy]	= '\0';
+	Ptr[index]	= (uint8_t)value;
 
-	/* Update the new length of the string. */
-	SetUsedLen( dst, BytesToCopy );
+	if( index >= UsedLen )
+		{
+		UsedLen = index + 1;
+		SetUsedLen( dst, UsedLen );
+		Ptr[UsedLen]	= '\0';
+		}
 
-	return BytesToCopy;
+	return UsedLen;
 	}
 /*============================================================================*/
-int s_strcpy_c( s_string_t * restrict dst, const char * restrict src )
+ssize_t s_appendchar( s_string_t * restrict dst, int value )
 	{
-	ssize_t		DstMaxLen;
-	ssize_t		SrcUsedLen;
-	char		*DstPtr;
-	ssize_t		BytesToCopy;
+	ssize_t	UsedLen;
+	char	*Ptr;
 
-	/* The destination is a null pointer... */
-	if( dst == NULL )
-		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
-		return 0;
+	STATS_CALL( s_appendchar );
 
-	if( dst->Writable == 0 )
+	if( dst == NULL || dst->Writable == 0 )
 		return -1;
 
-	DstPtr		= s_cstr( dst );
+	UsedLen = s_strlen( dst );
 
-	/* The source is a null pointer or it is an empty string... */
-	if( src == NULL || ( SrcUsedLen	= strlen( src )) == 0 )
-		/* ...so the destination string will be emptied. */
-		{
-		DstPtr[0]	= '\0';
-		SetUsedLen( dst, 0 );
-		return 0;
-		}
+	/* We cannot grow the string beyond its maximum length. */
+	if( UsedLen >= s_strmaxlen( dst ))
+		return -1;
 
-	DstMaxLen	= s_strmaxlen( dst );
+	if(( Ptr = s_cstr( dst )) == NULL )
+		return -1;
 
-	/* Calculate how many bytes will be copied. */
-	BytesToCopy	= ssmin( DstMaxLen, SrcUsedLen );
+	Ptr[UsedLen]		= (uint8_t)value;
 
-	memcpy( DstPtr, src, BytesToCopy );
+	SetUsedLen( dst, UsedLen + 1 );
+	Ptr[UsedLen + 1]	= '\0';
 
-	/* Terminate the new resulting string. */
-	DstPtr[BytesToCopy]	= '\0';
+	return UsedLen + 1;
+	}
+/*=========================================================================*//**
+s_delete_e Tested OK!!!
+*//*==========================================================================*/
+ssize_t s_delete_e( s_string_t * restrict dst, ssize_t start, ssize_t end )
+	{
+	ssize_t	UsedLen;
+	char	*Ptr;
 
-	/* Update the new length of the string. */
-	SetUsedLen( dst, BytesToCopy );
+	STATS_CALL( s_delete_e );
+
+	/* Either the s_string is invalid or it cannot be changed... */
+	if( dst == NULL || dst->MustBeZero != 0 || dst->Writable == 0 )
+		/* ...that's an error. */
+		return -1;
+
+	UsedLen = s_strlen( dst );
+
+	/* Either the portion to remove begins after the end of the string or
+	   it ends before the beginning of the string... */
+	if( start >= UsedLen || end < -UsedLen )
+		/* ...the string won't be changed. */
+		return 0;
+
+	/* The portion to remove begins before the beginning of the string... */
+	if( start < -UsedLen )
+		/* ...let's adjust the beginning. */
+		start	= 0;
+	/* 'start' is negative... */
+	else if( start < 0 )
+		/* ...let's normalize it counting from the end of the string. */
+		start  += UsedLen;
+
+	/* The portion to remove ends after the end of the string... */
+	if( end >= UsedLen )
+		/* ...let's adjust the end. */
+		end		= UsedLen - 1;
+	/* 'end' is negative... */
+	else if( end < 0 )
+		/* ...let's normalize it counting from the end of the string. */
+		end	   += UsedLen;
+
+	/* The portion to remove ends before its beginning... */
+	if( end < start )
+		/* ..the string  won't be changed. */
+		return 0;
+
+	/* Get the pointer to the storage area. But is is invalid... */
+	if(( Ptr = s_cstr( dst )) == NULL )
+		/* ...there's nothing we can do, it is an error. */
+		return -1;
+
+	/* Move the remaining of the string after the portion to be removed
+	   to be right at the beginning of the portion to be removed. */
+	memmove( &Ptr[start], &Ptr[end + 1], UsedLen - end - 1 );
+
+	/* Adjust the resulting used length of the string. */
+	UsedLen		   -= end - start + 1;
+
+	/* Terminates the string at its new end. */
+	Ptr[UsedLen]	= '\0';
+
+	/* Update the used length of the string. */
+	SetUsedLen( dst, UsedLen );
+
+	/* Return how many characters were effectively removed. */
+	return end - start + 1;
+	}
+/*=========================================================================*//**
+s_delete_l Tested OK!!!
+*//*==========================================================================*/
+ssize_t s_delete_l( s_string_t * restrict dst, ssize_t start, ssize_t len )
+	{
+	ssize_t	UsedLen;
+	char	*Ptr;
+
+	STATS_CALL( s_delete_l );
 
-	return BytesToCopy;
+	/* Either the s_string is invalid or it cannot be changed... */
+	if( dst == NULL || dst->MustBeZero != 0 || dst->Writable == 0 )
+		/* ...that's an error. */
+		return -1;
+
+	UsedLen = s_strlen( dst );
+
+	/* Either the portion to remove begins after the end of the string or
+	   its length is zero... */
+	if( start >= UsedLen || len <= 0 )
+		return 0;
+
+	/* The portion to remove begins before the beginning of the string... */
+	if( start < -UsedLen )
+		{
+		/* ...let's adjust the length... */
+		if(( len += start + UsedLen ) <= 0 )
+			return 0;
+		/* ...and the beginning. */
+		start	= 0;
+		}
+	/* 'start' is negative... */
+	else if( start < 0 )
+		/* ...let's normalize it counting from the end of the string. */
+		start  += UsedLen;
+
+	if( start + len > UsedLen || start + len < 0 ) /* start + len < 0 could happen due to overflow. */
+		len	= UsedLen - start;
+
+	/* Get the pointer to the storage area. But is is invalid... */
+	if(( Ptr = s_cstr( dst )) == NULL )
+		/* ...there's nothing we can do, it is an error. */
+		return -1;
+
+	memmove( &Ptr[start], &Ptr[start+len], UsedLen - start - len );
+
+	/* Adjust the resulting used length of the string. */
+	UsedLen	   -= len;
+
+	/* Terminates the string at its new end. */
+	Ptr[UsedLen]	= '\0';
+
+	/* Update the used length of the string. */
+	SetUsedLen( dst, UsedLen );
+
+	/* Return how many characters were effectively removed. */
+	return len;
+	}
+/*============================================================================*/
+ssize_t s_truncate( s_string_t * restrict dst, ssize_t len )
+	{
+	ssize_t	UsedLen;
+	char	*Ptr;
+
+	STATS_CALL( s_truncate );
+
+	if( dst == NULL || dst->MustBeZero != 0 || dst->Writable == 0 )
+		return -1;
+
+	UsedLen = s_strlen( dst );
+
+	/* The new length is longer than the current length... */
+	if( len >= UsedLen )
+		/* ...nothing to be done. */
+		return UsedLen;
+
+	if( len < -UsedLen )
+		len		= 0;
+	else if( len < 0 )
+		len	   += UsedLen;
+
+	if(( Ptr = s_cstr( dst )) == NULL )
+		return -1;
+
+	Ptr[len]	= '\0';
+
+	SetUsedLen( dst, len );
+
+	return len;
 	}
 /*============================================================================*/
-int s_strlcpy( s_string_t * restrict dst, const s_string_t * restrict src, ssize_t srcstart, ssize_t len )
+int s_strcat( s_string_t * restrict dst, const s_string_t * restrict src, ssize_t sstart )
 	{
-	ssize_t		DstMaxLen;
+	ssize_t		DstMaxLen, DstUsedLen;
 	ssize_t		SrcUsedLen;
 	char		*DstPtr;
 	const char	*SrcPtr;
 	ssize_t		BytesToCopy;
 
+	STATS_CALL( s_strcat );
+	TRACE_CALL( s_strcat, s_strlen( src ) );
+
 	/* The destination is a null pointer... */
 	if( dst == NULL )
 		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
@@ -943,47 +1588,55 @@ int s_strlcpy( s_string_t * restrict dst, const s_string_t * restrict src, ssize
 	if( dst->Writable == 0 )
 		return -1;
 
-	DstPtr		= s_cstr( dst );
+	DstUsedLen	= s_strlen( dst );
 
-	/* The source is a null pointer or it is an empty string... */
-	if( len <= 0 || src == NULL || ( SrcUsedLen	= s_strlen( src )) == 0 || srcstart >= SrcUsedLen )
-		/* ...so the destination string will be emptied. */
-		{
-		DstPtr[0]	= '\0';
-		SetUsedLen( dst, 0 );
-		return 0;
-		}
+	/* The source is a null pointer... */
+	if( src == NULL )
+		/* ...so the destination string will not be modified. */
+		return DstUsedLen;
 
-	if( srcstart < -SrcUsedLen )
-		return -1;
-
-	if( srcstart < 0 )
-		srcstart+= SrcUsedLen;
+	SrcUsedLen	= s_strlen( src );
+
+	/* The source string is empty... */
+	if( SrcUsedLen == 0 || sstart < -SrcUsedLen || sstart >= SrcUsedLen )
+		/* ...so again the destination string will not be modified. */
+		return DstUsedLen;
 
+	if( sstart < 0 )
+		sstart += SrcUsedLen;
+
 	DstMaxLen	= s_strmaxlen( dst );
-	SrcPtr		= s_constcstr( src, srcstart );
+
+	DstPtr		= s_cstr( dst );
+	SrcPtr		= s_constcstr( src, sstart );
 
 	/* Calculate how many bytes will be copied. */
-	BytesToCopy	= ssmin( len, ssmin( DstMaxLen, SrcUsedLen - srcstart ));
+	BytesToCopy	= ssmin( DstMaxLen - DstUsedLen, SrcUsedLen - sstart );
+	STATS_COPY( s_strcat, BytesToCopy, SrcUsedLen - sstart );
 
-	memcpy( DstPtr, SrcPtr, BytesToCopy );
+	memcpy( DstPtr + DstUsedLen, SrcPtr, BytesToCopy );
+
+	DstUsedLen += BytesToCopy;
 
 	/* Terminate the new resulting string. */
-	DstPtr[BytesToCopy]	= '\0';
+	DstPtr[DstUsedLen]	= '\0';
 
 	/* Update the new length of the string. */
-	SetUsedLen( dst, BytesToCopy );
+	SetUsedLen( dst, DstUsedLen );
 
-	return BytesToCopy;
+	return DstUsedLen;
 	}
 /*============================================================================*/
-int s_strlcpy_c( s_string_t * restrict dst, const char * restrict src, ssize_t len )
+int s_strcat_c( s_string_t * restrict dst, const char * restrict src )
 	{
-	ssize_t		DstMaxLen;
+	ssize_t		DstMaxLen, DstUsedLen;
 	ssize_t		SrcUsedLen;
 	char		*DstPtr;
 	ssize_t		BytesToCopy;
 
+	STATS_CALL( s_strcat_c );
+	TRACE_CALL( s_strcat_c, TraceCLen( src ) );
+
 	/* The destination is a null pointer... */
 	if( dst == NULL )
 		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
@@ -992,383 +1645,502 @@ int s_strlcpy_c( s_string_t * restrict dst, const char * restrict src, ssize_t l
 	if( dst->Writable == 0 )
 		return -1;
 
-	DstPtr		= s_cstr( dst );
+	DstUsedLen	= s_strlen( dst );
 
 	/* The source is a null pointer or it is an empty string... */
-	if( len <= 0 || src == NULL || ( SrcUsedLen	= strlen( src )) == 0 )
-		/* ...so the destination string will be emptied. */
-		{
-		DstPtr[0]	= '\0';
-		SetUsedLen( dst, 0 );
-		return 0;
-		}
+	if( src == NULL || ( SrcUsedLen	= strlen( src )) == 0 )
+		/* ...so the destination string will not be modified. */
+		return DstUsedLen;
 
 	DstMaxLen	= s_strmaxlen( dst );
 
+	DstPtr		= s_cstr( dst );
+
 	/* Calculate how many bytes will be copied. */
-	BytesToCopy	= ssmin( len, ssmin( DstMaxLen, SrcUsedLen ));
+	BytesToCopy	= ssmin( DstMaxLen - DstUsedLen, SrcUsedLen );
+	STATS_COPY( s_strcat_c, BytesToCopy, SrcUsedLen );
 
-	memcpy( DstPtr, src, BytesToCopy );
+	memcpy( DstPtr + DstUsedLen, src, BytesToCopy );
+
+	DstUsedLen += BytesToCopy;
 
 	/* Terminate the new resulting string. */
-	DstPtr[BytesToCopy]	= '\0';
+	DstPtr[DstUsedLen]	= '\0';
 
 	/* Update the new length of the string. */
-	SetUsedLen( dst, BytesToCopy );
+	SetUsedLen( dst, DstUsedLen );
 
-	return BytesToCopy;
-	}
-/*============================================================================*/
-/*  Deprecated. In the C library implementation it is less safe than strlcpy. In
-	our implementation both would be equivalent.
-
-int s_strncpy( s_string_t * restrict dst, const s_string_t * restrict src, size_t len )
-	{
-	return 0;
+	return DstUsedLen;
 	}
-*/
 /*============================================================================*/
-int s_strcmp( const s_string_t * restrict dst, ssize_t dststart, const s_string_t * restrict src, ssize_t srcstart )
+int s_strlcat( s_string_t * restrict dst, const s_string_t * restrict src, ssize_t srcstart, ssize_t len )
 	{
-	const char	*DstPtr;
+	ssize_t		ResultLen, DstUsedLen;
+	ssize_t		SrcUsedLen;
+	char		*DstPtr;
 	const char	*SrcPtr;
-	ssize_t		Index;
-	ssize_t		Len;
-	ssize_t		DstLen, SrcLen;
+	ssize_t		BytesToCopy;
 
-#if 0
-	/* Both dst and src are null pointers... */
-	if( dst == NULL && src == NULL )
-		/* ...so both are equal. */
-		return 0;
-	/* dst is a null pointer...*/
+	STATS_CALL( s_strlcat );
+	TRACE_CALL( s_strlcat, s_strlen( src ) );
+
+	/* The destination is a null pointer... */
 	if( dst == NULL )
-		/* ...so it is smaller than src. */
+		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
+		return 0;
+
+	if( dst->Writable == 0 )
 		return -1;
-	/* src is a null pointer...*/
+
+	DstUsedLen	= s_strlen( dst );
+
+	/* 'len' is shorter than the current destination length... */
+	if( len <= DstUsedLen )
+		/* ...there is nothing to be done. */
+		return DstUsedLen;
+
+	/* The source is a null pointer... */
 	if( src == NULL )
-		/* ...so dst is bigger than src. */
-		return +1;
-#else
-	DstLen		= s_strlen( dst );
-	SrcLen		= s_strlen( src );
+		/* ...so the destination string will not be modified. */
+		return DstUsedLen;
+
+	if(( SrcUsedLen = s_strlen( src )) == 0 || srcstart >= SrcUsedLen )
+		return DstUsedLen;
 
-	/* Both 'src' and 'dst' are either NULL pointers or empty strings... */
-	if( DstLen == 0 && SrcLen == 0 )
-		/* ...so they are equal. */
-		return 0;
-	if( DstLen == 0 )
+	if( srcstart < -SrcUsedLen )
 		return -1;
-	if( SrcLen == 0 )
-		return +1;
-#endif
-
-	if( dststart < -DstLen || dststart >= DstLen )
-		dststart	= DstLen;
-	else if( dststart < 0 )
-		dststart   += DstLen;
 
-	if( srcstart < -SrcLen || srcstart >= SrcLen )
-		srcstart	= SrcLen;
-	else if( srcstart < 0 )
-		srcstart   += SrcLen;
+	if( srcstart < 0 )
+		srcstart+= SrcUsedLen;
 
-	Len			= ssmin( SrcLen - srcstart, DstLen - dststart ) + 1;
+	ResultLen	= ssmin( len, s_strmaxlen( dst ));
 
+	DstPtr		= s_cstr( dst );
 	SrcPtr		= s_constcstr( src, srcstart );
-	DstPtr		= s_constcstr( dst, dststart );
 
-	for( Index = 0; Index < Len; Index++ )
-		if( SrcPtr[Index] != DstPtr[Index] )
-			return (int)( SrcPtr[Index] - DstPtr[Index] );
+	/* Calculate how many bytes will be copied. */
+	BytesToCopy	= ssmin( ResultLen - DstUsedLen, SrcUsedLen - srcstart );
+	STATS_COPY( s_strlcat, BytesToCopy, ssmin( len - DstUsedLen, SrcUsedLen - srcstart ) );
 
-	return 0;
+	memcpy( DstPtr + DstUsedLen, SrcPtr, BytesToCopy );
+
+	DstUsedLen += BytesToCopy;
+
+	/* Terminate the new resulting string. */
+	DstPtr[DstUsedLen]	= '\0';
+
+	/* Update the new length of the string. */
+	SetUsedLen( dst, DstUsedLen );
+
+	return DstUsedLen;
 	}
 /*============================================================================*/
-int s_strcmp_c( const s_string_t * restrict dst, ssize_t dststart, const char * restrict src )
+int s_strlcat_c( s_string_t * restrict dst, const char * restrict src, ssize_t len )
 	{
-	const char	*DstPtr;
-	ssize_t		Index;
-	ssize_t		Len;
-	ssize_t		SrcLen, DstLen;
+	ssize_t		ResultLen, DstUsedLen;
+	ssize_t		SrcUsedLen;
+	char		*DstPtr;
+	ssize_t		BytesToCopy;
 
-#if 0
-	/* Both dst and src are null pointers... */
-	if( dst == NULL && src == NULL )
-		/* ...so both are equal. */
-		return 0;
-	/* dst is a null pointer...*/
-	if( dst == NULL )
-		/* ...so it is smaller than src. */
-		return -1;
-	/* src is a null pointer...*/
-	if( src == NULL )
-		/* ...so dst is bigger than src. */
-		return +1;
-#else
-	DstLen		= s_strlen( dst );
-	SrcLen		= strlen( src );
-
-	/* Both 'src' and 'dst' are either NULL pointers or empty strings... */
-	if( DstLen == 0 && SrcLen == 0 )
-		/* ...so they are equal. */
-		return 0;
-	if( DstLen == 0 )
-		return -1;
-	if( SrcLen == 0 )
-		return +1;
-#endif
-
-	if( dststart < -DstLen || dststart >= DstLen )
-		dststart	= DstLen;
-	else if( dststart < 0 )
-		dststart   += DstLen;
+	STATS_CALL( s_strlcat_c );
+	TRACE_CALL( s_strlcat_c, TraceCLen( src ) );
 
-	Len			= ssmin( SrcLen, DstLen - dststart ) + 1;
+	/* The destination is a null pointer... */
+	if( dst == NULL )
+		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
+		return 0;
 
-	DstPtr		= s_constcstr( dst, dststart );
+	if( dst->Writable == 0 )
+		return -1;
 
-	for( Index = 0; Index < Len; Index++ )
-		if( src[Index] != DstPtr[Index] )
-			return (int)( src[Index] - DstPtr[Index] );
+	DstUsedLen	= s_strlen( dst );
 
-	return 0;
+	/* 'len' is shorter than the current destination length... */
+	if( len <= DstUsedLen )
+		/* ...there is nothing to be done. */
+		return DstUsedLen;
+
+	/* The source is a null pointer... */
+	if( src == NULL )
+		/* ...so the destination string will not be modified. */
+		return DstUsedLen;
+
+	SrcUsedLen	= strlen( src );
+
+	/* The source string is empty... */
+	if( SrcUsedLen == 0 )
+		/* ...so again the destination string will not be modified. */
+		return DstUsedLen;
+
+	ResultLen	= ssmin( len, s_strmaxlen( dst ));
+
+	DstPtr		= s_cstr( dst );
+
+	/* Calculate how many bytes will be copied. */
+	BytesToCopy	= ssmin( ResultLen - DstUsedLen, SrcUsedLen );
+	STATS_COPY( s_strlcat_c, BytesToCopy, ssmin( len - DstUsedLen, SrcUsedLen ) );
+
+	memcpy( DstPtr + DstUsedLen, src, BytesToCopy );
+
+	DstUsedLen += BytesToCopy;
+
+	/* Terminate the new resulting string. */
+	DstPtr[DstUsedLen]	= '\0';
+
+	/* Update the new length of the string. */
+	SetUsedLen( dst, DstUsedLen );
+
+	return DstUsedLen;
 	}
 /*============================================================================*/
-int c_strcmp_s( const char * restrict dst, const s_string_t * restrict src, ssize_t srcstart )
+int s_strncat( s_string_t * restrict dst, const s_string_t * restrict src, ssize_t srcstart, ssize_t len )
 	{
+	ssize_t		DstMaxLen, DstUsedLen;
+	ssize_t		SrcUsedLen;
+	char		*DstPtr;
 	const char	*SrcPtr;
-	ssize_t		Index;
-	ssize_t		Len;
-	ssize_t		SrcLen, DstLen;
+	ssize_t		BytesToCopy;
 
-#if 0
-	/* Both dst and src are null pointers... */
-	if( dst == NULL && src == NULL )
-		/* ...so both are equal. */
-		return 0;
-	/* dst is a null pointer...*/
-	if( dst == NULL )
-		/* ...so it is smaller than src. */
-		return -1;
-	/* src is a null pointer...*/
-	if( src == NULL )
-		/* ...so dst is bigger than src. */
-		return +1;
-#else
-	DstLen		= strlen( dst );
-	SrcLen		= s_strlen( src );
+	STATS_CALL( s_strncat );
+	TRACE_CALL( s_strncat, s_strlen( src ) );
+
+	/* The destination is a null pointer... */
+	if( dst == NULL )
+		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
+		return 0;
+
+	if( dst->Writable == 0 )
+		return -1;
+
+	DstUsedLen	= s_strlen( dst );
+
+	/* The number of bytes to copy is zero... */
+	if( len <= 0 )
+		/* ...the destination will not be modified. */
+		return DstUsedLen;
+
+	/* The source is a null pointer or it is an empty string... */
+	if( src == NULL || ( SrcUsedLen	= s_strlen( src )) == 0 )
+		/* ...so the destination string will not be modified too. */
+		return DstUsedLen;
+
+	if( srcstart >= SrcUsedLen )
+		return DstUsedLen;
 
-	/* Both 'src' and 'dst' are either NULL pointers or empty strings... */
-	if( DstLen == 0 && SrcLen == 0 )
-		/* ...so they are equal. */
-		return 0;
-	if( DstLen == 0 )
+	if( srcstart < -SrcUsedLen )
 		return -1;
-	if( SrcLen == 0 )
-		return +1;
-#endif
-
-	if( srcstart < -SrcLen || srcstart >= SrcLen )
-		srcstart	= SrcLen;
-	else if( srcstart < 0 )
-		srcstart   += SrcLen;
 
-	Len			= ssmin( SrcLen - srcstart, DstLen ) + 1;
+	if( srcstart < 0 )
+		srcstart+= SrcUsedLen;
+
+	DstMaxLen	= s_strmaxlen( dst );
 
+	DstPtr		= s_cstr( dst );
 	SrcPtr		= s_constcstr( src, srcstart );
 
-	for( Index = 0; Index < Len; Index++ )
-		if( SrcPtr[Index] != dst[Index] )
-			return (int)( SrcPtr[Index] - dst[Index] );
+	/* Calculate how many bytes will be copied. */
+	BytesToCopy	= ssmin( DstMaxLen - DstUsedLen, ssmin( SrcUsedLen - srcstart, len ));
+	STATS_COPY( s_strncat, BytesToCopy, ssmin( SrcUsedLen - srcstart, len ) );
 
-	return 0;
-	}
-/*============================================================================*/
-int s_stricmp( const s_string_t * restrict dst, ssize_t dststart, const s_string_t * restrict src, ssize_t srcstart )
-	{
-	const char	*DstPtr;
-	const char	*SrcPtr;
-	ssize_t		Index;
-	ssize_t		Len;
-	ssize_t		DstLen, SrcLen;
+	memcpy( DstPtr + DstUsedLen, SrcPtr, BytesToCopy );
 
-#if 0
-	/* Both dst and src are null pointers... */
-	if( dst == NULL && src == NULL )
-		/* ...so both are equal. */
-		return 0;
-	/* dst is a null pointer...*/
-	if( dst == NULL )
-		/* ...so it is smaller than src. */
-		return -1;
-	/* src is a null pointer...*/
-	if( src == NULL )
-		/* ...so dst is bigger than src. */
-		return +1;
-#else
-	DstLen		= s_strlen( dst );
-	SrcLen		= s_strlen( src );
-
-	/* Both 'src' and 'dst' are either NULL pointers or empty strings... */
-	if( DstLen == 0 && SrcLen == 0 )
-		/* ...so they are equal. */
-		return 0;
-	if( DstLen == 0 )
-		return -1;
-	if( SrcLen == 0 )
-		return +1;
-#endif
+	DstUsedLen += BytesToCopy;
 
-	if( dststart < -DstLen || dststart >= DstLen )
-		dststart	= DstLen;
-	else if( dststart < 0 )
-		dststart   += DstLen;
-
-	if( srcstart < -SrcLen || srcstart >= SrcLen )
-		srcstart	= SrcLen;
-	else if( srcstart < 0 )
-		srcstart   += SrcLen;
-
-	Len			= ssmin( SrcLen - srcstart, DstLen - dststart ) + 1;
-
-	SrcPtr		= s_constcstr( src, srcstart );
-	DstPtr		= s_constcstr( dst, dststart );
+	/* Terminate the new resulting string. */
+	DstPtr[DstUsedLen]	= '\0';
 
-	for( Index = 0; Index < Len; Index++ )
-		if( toupper( SrcPtr[Index] ) != toupper( DstPtr[Index] ))
-			return (int)( toupper( SrcPtr[Index] ) - toupper( DstPtr[Index] ));
+	/* Update the new length of the string. */
+	SetUsedLen( dst, DstUsedLen );
 
-	return 0;
+	return DstUsedLen;
 	}
-/*============================================================================*/
-int s_stricmp_c( const s_string_t * restrict dst, ssize_t dststart, const char * restrict src )
+/*============================================================================*/
+int s_strncat_c( s_string_t * restrict dst, const char * restrict src, ssize_t len )
 	{
-	const char	*DstPtr;
-	ssize_t		Index;
-	ssize_t		Len;
-	ssize_t		SrcLen, DstLen;
+	ssize_t		DstMaxLen, DstUsedLen;
+	ssize_t		SrcUsedLen;
+	char		*DstPtr;
+	ssize_t		BytesToCopy;
 
-#if 0
-	/* Both dst and src are null pointers... */
-	if( dst == NULL && src == NULL )
-		/* ...so both are equal. */
-		return 0;
-	/* dst is a null pointer...*/
-	if( dst == NULL )
-		/* ...so it is smaller than src. */
-		return -1;
-	/* src is a null pointer...*/
-	if( src == NULL )
-		/* ...so dst is bigger than src. */
-		return +1;
-#else
-	DstLen		= s_strlen( dst );
-	SrcLen		= strlen( src );
-
-	/* Both 'src' and 'dst' are either NULL pointers or empty strings... */
-	if( DstLen == 0 && SrcLen == 0 )
-		/* ...so they are equal. */
-		return 0;
-	if( DstLen == 0 )
-		return -1;
-	if( SrcLen == 0 )
-		return +1;
-#endif
-
-	if( dststart < -DstLen || dststart >= DstLen )
-		dststart	= DstLen;
-	else if( dststart < 0 )
-		dststart   += DstLen;
-
-	Len			= ssmin( SrcLen, DstLen - dststart ) + 1;
-
-	DstPtr		= s_constcstr( dst, dststart );
-
-	for( Index = 0; Index < Len; Index++ )
-		if( toupper( src[Index] ) != toupper( DstPtr[Index] ))
-			return (int)( toupper( src[Index] ) - toupper( DstPtr[Index] ));
+	STATS_CALL( s_strncat_c );
+	TRACE_CALL( s_strncat_c, TraceCLen( src ) );
 
-	return 0;
+	/* The destination is a null pointer... */
+	if( dst == NULL )
+		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
+		return 0;
+
+	if( dst->Writable == 0 )
+		return -1;
+
+	DstUsedLen	= s_strlen( dst );
+
+	/* The number of bytes to copy is zero... */
+	if( len <= 0 )
+		/* ...the destination will not be modified. */
+		return DstUsedLen;
+
+	/* The source is a null pointer or it is an empty string... */
+	if( src == NULL || ( SrcUsedLen	= strlen( src )) == 0 )
+		/* ...so the destination string will not be modified too. */
+		return DstUsedLen;
+
+	DstMaxLen	= s_strmaxlen( dst );
+
+	DstPtr		= s_cstr( dst );
+
+	/* Calculate how many bytes will be copied. */
+	BytesToCopy	= ssmin( DstMaxLen - DstUsedLen, ssmin( SrcUsedLen, len ));
+	STATS_COPY( s_strncat_c, BytesToCopy, ssmin( SrcUsedLen, len ) );
+
+	memcpy( DstPtr + DstUsedLen, src, BytesToCopy );
+
+	DstUsedLen += BytesToCopy;
+
+	/* Terminate the new resulting string. */
+	DstPtr[DstUsedLen]	= '\0';
+
+	/* Update the new length of the string. */
+	SetUsedLen( dst, DstUsedLen );
+
+	return DstUsedLen;
 	}
 /*============================================================================*/
-int c_stricmp_s( const char * restrict dst, const s_string_t * restrict src, ssize_t srcstart )
+int s_strcpy( s_string_t * restrict dst, const s_string_t * restrict src, ssize_t srcstart )
 	{
+	ssize_t		DstMaxLen;
+	ssize_t		SrcUsedLen;
+	char		*DstPtr;
 	const char	*SrcPtr;
-	ssize_t		Index;
-	ssize_t		Len;
-	ssize_t		SrcLen, DstLen;
+	ssize_t		BytesToCopy;
 
-#if 0
-	/* Both dst and src are null pointers... */
-	if( dst == NULL && src == NULL )
-		/* ...so both are equal. */
-		return 0;
-	/* dst is a null pointer...*/
-	if( dst == NULL )
-		/* ...so it is smaller than src. */
-		return -1;
-	/* src is a null pointer...*/
-	if( src == NULL )
-		/* ...so dst is bigger than src. */
-		return +1;
-#else
-	DstLen		= strlen( dst );
-	SrcLen		= s_strlen( src );
-
-	/* Both 'src' and 'dst' are either NULL pointers or empty strings... */
-	if( DstLen == 0 && SrcLen == 0 )
-		/* ...so they are equal. */
-		return 0;
-	if( DstLen == 0 )
-		return -1;
-	if( SrcLen == 0 )
-		return +1;
-#endif
+	STATS_CALL( s_strcpy );
+	TRACE_CALL( s_strcpy, s_strlen( src ) );
 
-	if( srcstart < -SrcLen || srcstart >= SrcLen )
-		srcstart	= SrcLen;
-	else if( srcstart < 0 )
-		srcstart   += SrcLen;
-
-	Len			= ssmin( SrcLen - srcstart, DstLen ) + 1;
+	/* The destination is a null pointer... */
+	if( dst == NULL )
+		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
+		return 0;
+
+	if( dst->Writable == 0 )
+		return -1;
+
+	DstPtr		= s_cstr( dst );
+
+	/* The source is a null pointer or it is an empty string... */
+	if( src == NULL || ( SrcUsedLen	= s_strlen( src )) == 0 || srcstart >= SrcUsedLen )
+		/* ...so the destination string will be emptied. */
+		{
+		DstPtr[0]	= '\0';
+		SetUsedLen( dst, 0 );
+		return 0;
+		}
+
+	if( srcstart < -SrcUsedLen )
+		return -1;
 
-	SrcPtr		= s_constcstr( src, srcstart );
+	if( srcstart < 0 )
+		srcstart+= SrcUsedLen;
 
-	for( Index = 0; Index < Len; Index++ )
-		if( toupper( SrcPtr[Index] ) != toupper( dst[Index] ))
-			return (int)( toupper( SrcPtr[Index] ) - toupper( dst[Index] ));
+	DstMaxLen	= s_strmaxlen( dst );
+	SrcPtr		= s_constcstr( src, srcstart );
 
-	return 0;
+	/* Calculate how many bytes will be copied. */
+	BytesToCopy	= ssmin( DstMaxLen, SrcUsedLen - srcstart );
+	STATS_COPY( s_strcpy, BytesToCopy, SrcUsedLen - srcstart );
+
+	memcpy( DstPtr, SrcPtr, BytesToCopy );
+
+	/* Terminate the new resulting string. */
+	DstPtr[BytesToCopy]	= '\0';
+
+	/* Update the new length of the string. */
+	SetUsedLen( dst, BytesToCopy );
+
+	return BytesToCopy;
 	}
 /*============================================================================*/
-int s_strncmp( const s_string_t * restrict dst, ssize_t dststart, const s_string_t * restrict src, ssize_t srcstart, ssize_t len )
+int s_strcpy_c( s_string_t * restrict dst, const char * restrict src )
 	{
-	const char	*DstPtr;
-	const char	*SrcPtr;
-	ssize_t		Index;
-	ssize_t		Len;
-	ssize_t		DstLen, SrcLen;
+	ssize_t		DstMaxLen;
+	ssize_t		SrcUsedLen;
+	char		*DstPtr;
+	ssize_t		BytesToCopy;
 
-	/* We are comparing zero bytes... */
-	if( len <= 0 )
-		/* ...two empty strings will be always equal. */
-		return 0;
-
-#if 0
-	/* Both dst and src are null pointers... */
-	if( dst == NULL && src == NULL )
-		/* ...so both are equal. */
-		return 0;
-	/* dst is a null pointer...*/
-	if( dst == NULL )
-		/* ...so it is smaller than src. */
+	STATS_CALL( s_strcpy_c );
+	TRACE_CALL( s_strcpy_c, TraceCLen( src ) );
+
+	/* The destination is a null pointer... */
+	if( dst == NULL )
+		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
+		return 0;
+
+	if( dst->Writable == 0 )
+		return -1;
+
+	DstPtr		= s_cstr( dst );
+
+	/* The source is a null pointer or it is an empty string... */
+	if( src == NULL || ( SrcUsedLen	= strlen( src )) == 0 )
+		/* ...so the destination string will be emptied. */
+		{
+		DstPtr[0]	= '\0';
+		SetUsedLen( dst, 0 );
+		return 0;
+		}
+
+	DstMaxLen	= s_strmaxlen( dst );
+
+	/* Calculate how many bytes will be copied. */
+	BytesToCopy	= ssmin( DstMaxLen, SrcUsedLen );
+	STATS_COPY( s_strcpy_c, BytesToCopy, SrcUsedLen );
+
+	memcpy( DstPtr, src, BytesToCopy );
+
+	/* Terminate the new resulting string. */
+	DstPtr[BytesToCopy]	= '\0';
+
+	/* Update the new length of the string. */
+	SetUsedLen( dst, BytesToCopy );
+
+	return BytesToCopy;
+	}
+/*============================================================================*/
+int s_strlcpy( s_string_t * restrict dst, const s_string_t * restrict src, ssize_t srcstart, ssize_t len )
+	{
+	ssize_t		DstMaxLen;
+	ssize_t		SrcUsedLen;
+	char		*DstPtr;
+	const char	*SrcPtr;
+	ssize_t		BytesToCopy;
+
+	STATS_CALL( s_strlcpy );
+	TRACE_CALL( s_strlcpy, s_strlen( src ) );
+
+	/* The destination is a null pointer... */
+	if( dst == NULL )
+		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
+		return 0;
+
+	if( dst->Writable == 0 )
+		return -1;
+
+	DstPtr		= s_cstr( dst );
+
+	/* The source is a null pointer or it is an empty string... */
+	if( len <= 0 || src == NULL || ( SrcUsedLen	= s_strlen( src )) == 0 || srcstart >= SrcUsedLen )
+		/* ...so the destination string will be emptied. */
+		{
+		DstPtr[0]	= '\0';
+		SetUsedLen( dst, 0 );
+		return 0;
+		}
+
+	if( srcstart < -SrcUsedLen )
 		return -1;
-	/* src is a null pointer...*/
-	if( src == NULL )
-		/* ...so dst is bigger than src. */
+
+	if( srcstart < 0 )
+		srcstart+= SrcUsedLen;
+
+	DstMaxLen	= s_strmaxlen( dst );
+	SrcPtr		= s_constcstr( src, srcstart );
+
+	/* Calculate how many bytes will be copied. */
+	BytesToCopy	= ssmin( len, ssmin( DstMaxLen, SrcUsedLen - srcstart ));
+	STATS_COPY( s_strlcpy, BytesToCopy, ssmin( len, SrcUsedLen - srcstart ) );
+
+	memcpy( DstPtr, SrcPtr, BytesToCopy );
+
+	/* Terminate the new resulting string. */
+	DstPtr[BytesToCopy]	= '\0';
+
+	/* Update the new length of the string. */
+	SetUsedLen( dst, BytesToCopy );
+
+	return BytesToCopy;
+	}
+/*============================================================================*/
+int s_strlcpy_c( s_string_t * restrict dst, const char * restrict src, ssize_t len )
+	{
+	ssize_t		DstMaxLen;
+	ssize_t		SrcUsedLen;
+	char		*DstPtr;
+	ssize_t		BytesToCopy;
+
+	STATS_CALL( s_strlcpy_c );
+	TRACE_CALL( s_strlcpy_c, TraceCLen( src ) );
+
+	/* The destination is a null pointer... */
+	if( dst == NULL )
+		/* ...let's return zero, as an inexistent string cannot have a size other than zero. */
+		return 0;
+
+	if( dst->Writable == 0 )
+		return -1;
+
+	DstPtr		= s_cstr( dst );
+
+	/* The source is a null pointer or it is an empty string... */
+	if( len <= 0 || src == NULL || ( SrcUsedLen	= strlen( src )) == 0 )
+		/* ...so the destination string will be emptied. */
+		{
+		DstPtr[0]	= '\0';
+		SetUsedLen( dst, 0 );
+		return 0;
+		}
+
+	DstMaxLen	= s_strmaxlen( dst );
+
+	/* Calculate how many bytes will be copied. */
+	BytesToCopy	= ssmin( len, ssmin( DstMaxLen, SrcUsedLen ));
+	STATS_COPY( s_strlcpy_c, BytesToCopy, ssmin( len, SrcUsedLen ) );
+
+	memcpy( DstPtr, src, BytesToCopy );
+
+	/* Terminate the new resulting string. */
+	DstPtr[BytesToCopy]	= '\0';
+
+	/* Update the new length of the string. */
+	SetUsedLen( dst, BytesToCopy );
+
+	return BytesToCopy;
+	}
+/*============================================================================*/
+/*  Deprecated. In the C library implementation it is less safe than strlcpy. In
+	our implementation both would be equivalent.
+
+int s_strncpy( s_string_t * restrict dst, const s_string_t * restrict src, size_t len )
+	{
+	return 0;
+	}
+*/
+/*============================================================================*/
+int s_strcmp( const s_string_t * restrict dst, ssize_t dststart, const s_string_t * restrict src, ssize_t srcstart )
+	{
+	const char	*DstPtr;
+	const char	*SrcPtr;
+	ssize_t		Index;
+	ssize_t		Len;
+	ssize_t		DstLen, SrcLen;
+	ssize_t		First	= 0;
+
+	STATS_CALL( s_strcmp );
+	TRACE_CALL( s_strcmp, s_strlen( dst ) );
+
+#if 0
+	/* Both dst and src are null pointers... */
+	if( dst == NULL && src == NULL )
+		/* ...so both are equal. */
+		return 0;
+	/* dst is a null pointer...*/
+	if( dst == NULL )
+		/* ...so it is smaller than src. */
+		return -1;
+	/* src is a null pointer...*/
+	if( src == NULL )
+		/* ...so dst is bigger than src. */
 		return +1;
-#else
+#else
 	DstLen		= s_strlen( dst );
 	SrcLen		= s_strlen( src );
 
@@ -1391,31 +2163,55 @@ int s_strncmp( const s_string_t * restrict dst, ssize_t dststart, const s_string
 		srcstart	= SrcLen;
 	else if( srcstart < 0 )
 		srcstart   += SrcLen;
-
-	Len			= ssmin( len, ssmin( SrcLen - srcstart, DstLen - dststart ) + 1 );
-
-	SrcPtr		= s_constcstr( src, srcstart );
-	DstPtr		= s_constcstr( dst, dststart );
 
-	for( Index = 0; Index < Len; Index++ )
+	Len			= ssmin( SrcLen - srcstart, DstLen - dststart ) + 1;
+
+	/* If both strings cache their keys, the first difference within their
+	   first 8 characters is found without reading the characters. The zeros
+	   that pad the shorter key stand for its terminating NUL. */
+	if( dststart == 0 && srcstart == 0 && GetExt( dst ) != NULL && GetExt( src ) != NULL )
+		{
+		size_t		KeyLen;
+		uint64_t	DstKey	= StrKey( dst, &KeyLen );
+		uint64_t	SrcKey	= StrKey( src, &KeyLen );
+
+		if( DstKey != SrcKey && ( Index = __builtin_clzll( DstKey ^ SrcKey ) / 8 ) < Len )
+			return (int)( (char)( SrcKey >> ( 56 - 8 * Index )) - (char)( DstKey >> ( 56 - 8 * Index )));
+
+		if( Len <= 8 )
+			return 0;
+
+		/* The first 8 characters are equal. */
+		First	= 8;
+		}
+
+	SrcPtr		= s_constcstr( src, srcstart );
+	DstPtr		= s_constcstr( dst, dststart );
+
+	for( Index = First; Index < Len; Index++ )
 		if( SrcPtr[Index] != DstPtr[Index] )
 			return (int)( SrcPtr[Index] - DstPtr[Index] );
 
 	return 0;
 	}
-/*============================================================================*/
-int s_strncmp_c( const s_string_t * restrict dst, ssize_t dststart, const char * restrict src, ssize_t len )
+/*============================================================================*/
+uint64_t s_strkey( const s_string_t *str )
+	{
+	size_t	Len;
+
+	return StrKey( str, &Len );
+	}
+/*============================================================================*/
+int s_strcmp_c( const s_string_t * restrict dst, ssize_t dststart, const char * restrict src )
 	{
 	const char	*DstPtr;
 	ssize_t		Index;
 	ssize_t		Len;
-	ssize_t		SrcLen, DstLen;
+	ssize_t		SrcLen, DstLen;
+
+	STATS_CALL( s_strcmp_c );
+	TRACE_CALL( s_strcmp_c, s_strlen( dst ) );
 
-	/* We are comparing zero bytes... */
-	if( len <= 0 )
-		/* ...two empty strings will be always equal. */
-		return 0;
-
 #if 0
 	/* Both dst and src are null pointers... */
 	if( dst == NULL && src == NULL )
@@ -1447,10 +2243,10 @@ int s_strncmp_c( const s_string_t * restrict dst, ssize_t dststart, const char *
 		dststart	= DstLen;
 	else if( dststart < 0 )
 		dststart   += DstLen;
-
-	Len			= ssmin( len, ssmin( SrcLen, DstLen - dststart ) + 1 );
-
-	DstPtr		= s_constcstr( dst, dststart );
+
+	Len			= ssmin( SrcLen, DstLen - dststart ) + 1;
+
+	DstPtr		= s_constcstr( dst, dststart );
 
 	for( Index = 0; Index < Len; Index++ )
 		if( src[Index] != DstPtr[Index] )
@@ -1458,19 +2254,17 @@ int s_strncmp_c( const s_string_t * restrict dst, ssize_t dststart, const char *
 
 	return 0;
 	}
-/*============================================================================*/
-int c_strncmp_s( const char * restrict dst, const s_string_t * restrict src, ssize_t srcstart, ssize_t len )
+/*============================================================================*/
+int c_strcmp_s( const char * restrict dst, const s_string_t * restrict src, ssize_t srcstart )
 	{
 	const char	*SrcPtr;
 	ssize_t		Index;
-	ssize_t		Len;
-	ssize_t		SrcLen, DstLen;
+	ssize_t		Len;
+	ssize_t		SrcLen, DstLen;
+
+	STATS_CALL( c_strcmp_s );
+	TRACE_CALL( c_strcmp_s, s_strlen( src ) );
 
-	/* We are comparing zero bytes... */
-	if( len <= 0 )
-		/* ...two empty strings will be always equal. */
-		return 0;
-
 #if 0
 	/* Both dst and src are null pointers... */
 	if( dst == NULL && src == NULL )
@@ -1497,15 +2291,15 @@ int c_strncmp_s( const char * restrict dst, const s_string_t * restrict src, ssi
 	if( SrcLen == 0 )
 		return +1;
 #endif
-
+
 	if( srcstart < -SrcLen || srcstart >= SrcLen )
 		srcstart	= SrcLen;
 	else if( srcstart < 0 )
 		srcstart   += SrcLen;
 
-	Len			= ssmin( len, ssmin( SrcLen - srcstart, DstLen ) + 1 );
-
-	SrcPtr		= s_constcstr( src, srcstart );
+	Len			= ssmin( SrcLen - srcstart, DstLen ) + 1;
+
+	SrcPtr		= s_constcstr( src, srcstart );
 
 	for( Index = 0; Index < Len; Index++ )
 		if( SrcPtr[Index] != dst[Index] )
@@ -1514,7 +2308,7 @@ int c_strncmp_s( const char * restrict dst, const s_string_t * restrict src, ssi
 	return 0;
 	}
 /*============================================================================*/
-int s_strnicmp( const s_string_t * restrict dst, ssize_t dststart, const s_string_t * restrict src, ssize_t srcstart, ssize_t len )
+int s_stricmp( const s_string_t * restrict dst, ssize_t dststart, const s_string_t * restrict src, ssize_t srcstart )
 	{
 	const char	*DstPtr;
 	const char	*SrcPtr;
@@ -1522,11 +2316,9 @@ int s_strnicmp( const s_string_t * restrict dst, ssize_t dststart, const s_strin
 	ssize_t		Len;
 	ssize_t		DstLen, SrcLen;
 
-	/* We are comparing zero bytes... */
-	if( len <= 0 )
-		/* ...two empty strings will be always equal. */
-		return 0;
-
+	STATS_CALL( s_stricmp );
+	TRACE_CALL( s_stricmp, s_strlen( dst ) );
+
 #if 0
 	/* Both dst and src are null pointers... */
 	if( dst == NULL && src == NULL )
@@ -1553,7 +2345,7 @@ int s_strnicmp( const s_string_t * restrict dst, ssize_t dststart, const s_strin
 	if( SrcLen == 0 )
 		return +1;
 #endif
-
+
 	if( dststart < -DstLen || dststart >= DstLen )
 		dststart	= DstLen;
 	else if( dststart < 0 )
@@ -1564,7 +2356,7 @@ int s_strnicmp( const s_string_t * restrict dst, ssize_t dststart, const s_strin
 	else if( srcstart < 0 )
 		srcstart   += SrcLen;
 
-	Len			= ssmin( len, ssmin( SrcLen - srcstart, DstLen - dststart ) + 1 );
+	Len			= ssmin( SrcLen - srcstart, DstLen - dststart ) + 1;
 
 	SrcPtr		= s_constcstr( src, srcstart );
 	DstPtr		= s_constcstr( dst, dststart );
@@ -1575,19 +2367,17 @@ int s_strnicmp( const s_string_t * restrict dst, ssize_t dststart, const s_strin
 
 	return 0;
 	}
-/*============================================================================*/
-int s_strnicmp_c( const s_string_t * restrict dst, ssize_t dststart, const char * restrict src, ssize_t len )
+/*============================================================================*/
+int s_stricmp_c( const s_string_t * restrict dst, ssize_t dststart, const char * restrict src )
 	{
 	const char	*DstPtr;
 	ssize_t		Index;
 	ssize_t		Len;
 	ssize_t		SrcLen, DstLen;
 
-	/* We are comparing zero bytes... */
-	if( len <= 0 )
-		/* ...two empty strings will be always equal. */
-		return 0;
-
+	STATS_CALL( s_stricmp_c );
+	TRACE_CALL( s_stricmp_c, s_strlen( dst ) );
+
 #if 0
 	/* Both dst and src are null pointers... */
 	if( dst == NULL && src == NULL )
@@ -1620,10 +2410,10 @@ int s_strnicmp_c( const s_string_t * restrict dst, ssize_t dststart, const char
 	else if( dststart < 0 )
 		dststart   += DstLen;
 
-	Len			= ssmin( len, ssmin( SrcLen, DstLen - dststart ) + 1 );
+	Len			= ssmin( SrcLen, DstLen - dststart ) + 1;
 
 	DstPtr		= s_constcstr( dst, dststart );
-
+
 	for( Index = 0; Index < Len; Index++ )
 		if( toupper( src[Index] ) != toupper( DstPtr[Index] ))
 			return (int)( toupper( src[Index] ) - toupper( DstPtr[Index] ));
@@ -1631,18 +2421,16 @@ int s_strnicmp_c( const s_string_t * restrict dst, ssize_t dststart, const char
 	return 0;
 	}
 /*============================================================================*/
-int c_strnicmp_s( const char * restrict dst, const s_string_t * restrict src, ssize_t srcstart, ssize_t len )
+int c_stricmp_s( const char * restrict dst, const s_string_t * restrict src, ssize_t srcstart )
 	{
 	const char	*SrcPtr;
 	ssize_t		Index;
 	ssize_t		Len;
 	ssize_t		SrcLen, DstLen;
 
-	/* We are comparing zero bytes... */
-	if( len <= 0 )
-		/* ...two empty strings will be always equal. */
-		return 0;
-
+	STATS_CALL( c_stricmp_s );
+	TRACE_CALL( c_stricmp_s, s_strlen( src ) );
+
 #if 0
 	/* Both dst and src are null pointers... */
 	if( dst == NULL && src == NULL )
@@ -1669,330 +2457,537 @@ int c_strnicmp_s( const char * restrict dst, const s_string_t * restrict src, ss
 	if( SrcLen == 0 )
 		return +1;
 #endif
-
+
 	if( srcstart < -SrcLen || srcstart >= SrcLen )
 		srcstart	= SrcLen;
 	else if( srcstart < 0 )
 		srcstart   += SrcLen;
 
-	Len			= ssmin( len, ssmin( SrcLen - srcstart, DstLen ) + 1 );
+	Len			= ssmin( SrcLen - srcstart, DstLen ) + 1;
 
 	SrcPtr		= s_constcstr( src, srcstart );
-
+
 	for( Index = 0; Index < Len; Index++ )
 		if( toupper( SrcPtr[Index] ) != toupper( dst[Index] ))
 			return (int)( toupper( SrcPtr[Index] ) - toupper( dst[Index] ));
 
 	return 0;
 	}
-/*=========================================================================*//**
-s_strchr Tested OK!!!
-*//*==========================================================================*/
-ssize_t s_strchr( const s_string_t * restrict str, ssize_t start, int c )
+/*============================================================================*/
+int s_strncmp( const s_string_t * restrict dst, ssize_t dststart, const s_string_t * restrict src, ssize_t srcstart, ssize_t len )
 	{
-	ssize_t		StrLen;
-	const char	*Ptr;
+	const char	*DstPtr;
+	const char	*SrcPtr;
 	ssize_t		Index;
+	ssize_t		Len;
+	ssize_t		DstLen, SrcLen;
 
-	/* str is a null pointer... */
-	if( str == NULL )
-		/* ...nothing can be found there, let's return a 'not found' result. */
-		return -1;
-
-	StrLen	= s_strlen( str );
-
-	if( start < -StrLen || start >= StrLen )
-		return -1;
-
-	if( start < 0 )
-		start  += StrLen;
+	STATS_CALL( s_strncmp );
+	TRACE_CALL( s_strncmp, len );
 
-	Ptr		= s_constcstr( str, 0 );
+	/* We are comparing zero bytes... */
+	if( len <= 0 )
+		/* ...two empty strings will be always equal. */
+		return 0;
+
+#if 0
+	/* Both dst and src are null pointers... */
+	if( dst == NULL && src == NULL )
+		/* ...so both are equal. */
+		return 0;
+	/* dst is a null pointer...*/
+	if( dst == NULL )
+		/* ...so it is smaller than src. */
+		return -1;
+	/* src is a null pointer...*/
+	if( src == NULL )
+		/* ...so dst is bigger than src. */
+		return +1;
+#else
+	DstLen		= s_strlen( dst );
+	SrcLen		= s_strlen( src );
+
+	/* Both 'src' and 'dst' are either NULL pointers or empty strings... */
+	if( DstLen == 0 && SrcLen == 0 )
+		/* ...so they are equal. */
+		return 0;
+	if( DstLen == 0 )
+		return -1;
+	if( SrcLen == 0 )
+		return +1;
+#endif
+
+	if( dststart < -DstLen || dststart >= DstLen )
+		dststart	= DstLen;
+	else if( dststart < 0 )
+		dststart   += DstLen;
+
+	if( srcstart < -SrcLen || srcstart >= SrcLen )
+		srcstart	= SrcLen;
+	else if( srcstart < 0 )
+		srcstart   += SrcLen;
+
+	Len			= ssmin( len, ssmin( SrcLen - srcstart, DstLen - dststart ) + 1 );
+
+	SrcPtr		= s_constcstr( src, srcstart );
+	DstPtr		= s_constcstr( dst, dststart );
 
-	/* Search for the character in the string. */
-	for( Index = start; Index < StrLen && Ptr[Index] != c; Index++ )
-		{}
+	for( Index = 0; Index < Len; Index++ )
+		if( SrcPtr[Index] != DstPtr[Index] )
+			return (int)( SrcPtr[Index] - DstPtr[Index] );
 
-	/* If the character was found, return its index in the string, otherwise return a 'not found' result. */
-	return ( Index >= 0 && Index < StrLen ) ? Index : -1;
+	return 0;
 	}
-/*=========================================================================*//**
-s_strrchr Tested OK!!!
-*//*==========================================================================*/
-ssize_t s_strrchr( const s_string_t * restrict str, ssize_t start, int c )
+/*============================================================================*/
+int s_strncmp_c( const s_string_t * restrict dst, ssize_t dststart, const char * restrict src, ssize_t len )
 	{
-	ssize_t		StrLen;
-	const char	*Ptr;
+	const char	*DstPtr;
 	ssize_t		Index;
+	ssize_t		Len;
+	ssize_t		SrcLen, DstLen;
 
-	/* str is a null pointer... */
-	if( str == NULL )
-		/* ...nothing can be found there, let's return a 'not found' result. */
-		return -1;
-
-	StrLen	= s_strlen( str );
-
-	if( start < -StrLen || start >= StrLen )
-		return -1;
-
-	if( start < 0 )
-		start  += StrLen;
+	STATS_CALL( s_strncmp_c );
+	TRACE_CALL( s_strncmp_c, len );
 
-	Ptr		= s_constcstr( str, 0 );
+	/* We are comparing zero bytes... */
+	if( len <= 0 )
+		/* ...two empty strings will be always equal. */
+		return 0;
+
+#if 0
+	/* Both dst and src are null pointers... */
+	if( dst == NULL && src == NULL )
+		/* ...so both are equal. */
+		return 0;
+	/* dst is a null pointer...*/
+	if( dst == NULL )
+		/* ...so it is smaller than src. */
+		return -1;
+	/* src is a null pointer...*/
+	if( src == NULL )
+		/* ...so dst is bigger than src. */
+		return +1;
+#else
+	DstLen		= s_strlen( dst );
+	SrcLen		= strlen( src );
+
+	/* Both 'src' and 'dst' are either NULL pointers or empty strings... */
+	if( DstLen == 0 && SrcLen == 0 )
+		/* ...so they are equal. */
+		return 0;
+	if( DstLen == 0 )
+		return -1;
+	if( SrcLen == 0 )
+		return +1;
+#endif
+
+	if( dststart < -DstLen || dststart >= DstLen )
+		dststart	= DstLen;
+	else if( dststart < 0 )
+		dststart   += DstLen;
+
+	Len			= ssmin( len, ssmin( SrcLen, DstLen - dststart ) + 1 );
+
+	DstPtr		= s_constcstr( dst, dststart );
 
-	/* Search for the character in the string. */
-	for( Index = start; Index >= 0 && Ptr[Index] != c; Index-- )
-		{}
+	for( Index = 0; Index < Len; Index++ )
+		if( src[Index] != DstPtr[Index] )
+			return (int)( src[Index] - DstPtr[Index] );
 
-	/* If the character was found, return its index in the string, otherwise return a 'not found' result. */
-	return ( Index >= 0 && Index < StrLen ) ? Index : -1;
+	return 0;
 	}
-/*============================================================================*/
-ssize_t s_strichr( const s_string_t * restrict str, ssize_t start, int c )
+/*============================================================================*/
+int c_strncmp_s( const char * restrict dst, const s_string_t * restrict src, ssize_t srcstart, ssize_t len )
 	{
-	ssize_t		StrLen;
-	const char	*Ptr;
+	const char	*SrcPtr;
 	ssize_t		Index;
+	ssize_t		Len;
+	ssize_t		SrcLen, DstLen;
 
-	/* str is a null pointer... */
-	if( str == NULL )
-		/* ...nothing can be found there, let's return a 'not found' result. */
-		return -1;
-
-	StrLen	= s_strlen( str );
-
-	if( start < -StrLen || start >= StrLen )
-		return -1;
-
-	if( start < 0 )
-		start  += StrLen;
+	STATS_CALL( c_strncmp_s );
+	TRACE_CALL( c_strncmp_s, len );
 
-	Ptr		= s_constcstr( str, 0 );
-	c		= toupper( c );
+	/* We are comparing zero bytes... */
+	if( len <= 0 )
+		/* ...two empty strings will be always equal. */
+		return 0;
+
+#if 0
+	/* Both dst and src are null pointers... */
+	if( dst == NULL && src == NULL )
+		/* ...so both are equal. */
+		return 0;
+	/* dst is a null pointer...*/
+	if( dst == NULL )
+		/* ...so it is smaller than src. */
+		return -1;
+	/* src is a null pointer...*/
+	if( src == NULL )
+		/* ...so dst is bigger than src. */
+		return +1;
+#else
+	DstLen		= strlen( dst );
+	SrcLen		= s_strlen( src );
+
+	/* Both 'src' and 'dst' are either NULL pointers or empty strings... */
+	if( DstLen == 0 && SrcLen == 0 )
+		/* ...so they are equal. */
+		return 0;
+	if( DstLen == 0 )
+		return -1;
+	if( SrcLen == 0 )
+		return +1;
+#endif
+
+	if( srcstart < -SrcLen || srcstart >= SrcLen )
+		srcstart	= SrcLen;
+	else if( srcstart < 0 )
+		srcstart   += SrcLen;
+
+	Len			= ssmin( len, ssmin( SrcLen - srcstart, DstLen ) + 1 );
+
+	SrcPtr		= s_constcstr( src, srcstart );
 
-	/* Search for the character in the string. */
-	for( Index = start; Index < StrLen && toupper( Ptr[Index] ) != c; Index++ )
-		{}
+	for( Index = 0; Index < Len; Index++ )
+		if( SrcPtr[Index] != dst[Index] )
+			return (int)( SrcPtr[Index] - dst[Index] );
 
-	/* If the character was found, return its index in the string, otherwise return a 'not found' result. */
-	return ( Index >= 0 && Index < StrLen ) ? Index : -1;
+	return 0;
 	}
-/*============================================================================*/
-ssize_t s_strrichr( const s_string_t * restrict str, ssize_t start, int c )
+/*============================================================================*/
+int s_strnicmp( const s_string_t * restrict dst, ssize_t dststart, const s_string_t * restrict src, ssize_t srcstart, ssize_t len )
 	{
-	ssize_t		StrLen;
-	const char	*Ptr;
+	const char	*DstPtr;
+	const char	*SrcPtr;
 	ssize_t		Index;
+	ssize_t		Len;
+	ssize_t		DstLen, SrcLen;
 
-	/* str is a null pointer... */
-	if( str == NULL )
-		/* ...nothing can be found there, let's return a 'not found' result. */
-		return -1;
-
-	StrLen	= s_strlen( str );
+	STATS_CALL( s_strnicmp );
+	TRACE_CALL( s_strnicmp, len );
 
-	if( start < -StrLen || start >= StrLen )
-		return -1;
-
-	if( start < 0 )
-		start  += StrLen;
-
-	Ptr		= s_constcstr( str, 0 );
-	c		= toupper( c );
-
-	/* Search for the character in the string. */
-	for( Index = start; Index >= 0 && toupper( Ptr[Index] ) != c; Index-- )
-		{}
-
-	/* If the character was found, return its index in the string, otherwise return a 'not found' result. */
-	return ( Index >= 0 && Index < StrLen ) ? Index : -1;
-	}
-/*============================================================================*/
-ssize_t s_strstr( const s_string_t * restrict str, ssize_t start, const s_string_t * restrict src, ssize_t srcstart )
-	{
-	ssize_t		StrLen, SrcLen;
-	ssize_t		Index;
-	const char	*StrPtr, *SrcPtr;
-
-	/* At least one of the strings is a NULL pointer... */
-	if( str == NULL || src == NULL )
-		/* ...no search is possible. */
-		return -1;
-
-	/* 'src' is an empty string... */
-	if(( SrcLen = s_strlen( src )) == 0 )
-		/* ...it will never be found inside 'str'. */
-		return -1;
+	/* We are comparing zero bytes... */
+	if( len <= 0 )
+		/* ...two empty strings will be always equal. */
+		return 0;
 
-	/* 'srcstart' points outside of the string 'source'... */
-	if( srcstart < -SrcLen || srcstart > SrcLen )
-		/* ...nothing to be searched. */
+#if 0
+	/* Both dst and src are null pointers... */
+	if( dst == NULL && src == NULL )
+		/* ...so both are equal. */
+		return 0;
+	/* dst is a null pointer...*/
+	if( dst == NULL )
+		/* ...so it is smaller than src. */
 		return -1;
+	/* src is a null pointer...*/
+	if( src == NULL )
+		/* ...so dst is bigger than src. */
+		return +1;
+#else
+	DstLen		= s_strlen( dst );
+	SrcLen		= s_strlen( src );
 
-	/* 'srcstart' is negative... */
-	if( srcstart < 0 )
-		/* ...let's normalize it counting from the end. */
-		srcstart+= SrcLen;
-
-	/* Calculate the effective length of the string to be searched. */
-	SrcLen -= srcstart;
-
-	/* 'str' is an empty string... */
-	if(( StrLen = s_strlen( str )) == 0 )
-		/* ...nothing can be found inside it. */
+	/* Both 'src' and 'dst' are either NULL pointers or empty strings... */
+	if( DstLen == 0 && SrcLen == 0 )
+		/* ...so they are equal. */
+		return 0;
+	if( DstLen == 0 )
 		return -1;
+	if( SrcLen == 0 )
+		return +1;
+#endif
 
-	/* 'start' points outside of the string 'str'... */
-	if( start < -StrLen || start > StrLen )
-		/* ...there's nothing to search in. */
-		return -1;
-
-	/* 'start' is negative... */
-	if( start < 0 )
-		/* ...let's normalize it counting from the end. */
-		start+= StrLen;
+	if( dststart < -DstLen || dststart >= DstLen )
+		dststart	= DstLen;
+	else if( dststart < 0 )
+		dststart   += DstLen;
 
-	/* Calculate the effective length of the string to be searched in. */
-	StrLen -= start;
+	if( srcstart < -SrcLen || srcstart >= SrcLen )
+		srcstart	= SrcLen;
+	else if( srcstart < 0 )
+		srcstart   += SrcLen;
 
-	/* The string to be searched is longer than the string to search in... */
-	if(  SrcLen > StrLen )
-		/* ...it will never be found. */
-		return -1;
-
-	StrPtr	= s_constcstr( str, start );
-	SrcPtr	= s_constcstr( src, srcstart );
+	Len			= ssmin( len, ssmin( SrcLen - srcstart, DstLen - dststart ) + 1 );
+
+	SrcPtr		= s_constcstr( src, srcstart );
+	DstPtr		= s_constcstr( dst, dststart );
 
-	for( Index = 0; Index <= StrLen - SrcLen ; Index++ )
-		{
-		size_t	j;
-		for( j = 0; j < SrcLen && StrPtr[Index+j] == SrcPtr[j] ; j++ )
-			{}
-		if( j == SrcLen )
-			return Index + start;
-		}
+	for( Index = 0; Index < Len; Index++ )
+		if( toupper( SrcPtr[Index] ) != toupper( DstPtr[Index] ))
+			return (int)( toupper( SrcPtr[Index] ) - toupper( DstPtr[Index] ));
 
-	return -1;
+	return 0;
 	}
-/*============================================================================*/
-ssize_t s_strstr_c( const s_string_t * restrict str, ssize_t start, const char * restrict src )
+/*============================================================================*/
+int s_strnicmp_c( const s_string_t * restrict dst, ssize_t dststart, const char * restrict src, ssize_t len )
 	{
-	ssize_t		StrLen, SrcLen;
+	const char	*DstPtr;
 	ssize_t		Index;
-	const char	*StrPtr;
+	ssize_t		Len;
+	ssize_t		SrcLen, DstLen;
 
-	/* At least one of the strings is a NULL pointer... */
-	if( str == NULL || src == NULL )
-		/* ...no search is possible. */
-		return -1;
-
-	/* If 'src' is an empty string it will not be found inside 'str'... */
-	if(( SrcLen = strlen( src )) == 0 )
-		return -1;
+	STATS_CALL( s_strnicmp_c );
+	TRACE_CALL( s_strnicmp_c, len );
+
+	/* We are comparing zero bytes... */
+	if( len <= 0 )
+		/* ...two empty strings will be always equal. */
+		return 0;
 
-	/* 'str' is an empty string... */
-	if(( StrLen = s_strlen( str )) == 0 )
-		/* ...nothing can be found inside it. */
+#if 0
+	/* Both dst and src are null pointers... */
+	if( dst == NULL && src == NULL )
+		/* ...so both are equal. */
+		return 0;
+	/* dst is a null pointer...*/
+	if( dst == NULL )
+		/* ...so it is smaller than src. */
 		return -1;
+	/* src is a null pointer...*/
+	if( src == NULL )
+		/* ...so dst is bigger than src. */
+		return +1;
+#else
+	DstLen		= s_strlen( dst );
+	SrcLen		= strlen( src );
 
-	/* 'start' points outside of the string 'str'... */
-	if( start < -StrLen || start > StrLen )
-		/* ...there's nothing to search in. */
+	/* Both 'src' and 'dst' are either NULL pointers or empty strings... */
+	if( DstLen == 0 && SrcLen == 0 )
+		/* ...so they are equal. */
+		return 0;
+	if( DstLen == 0 )
 		return -1;
+	if( SrcLen == 0 )
+		return +1;
+#endif
 
-	/* 'start' is negative... */
-	if( start < 0 )
-		/* ...let's normalize it counting from the end. */
-		start+= StrLen;
-
-	/* Calculate the effective length of the string to be searched in. */
-	StrLen -= start;
+	if( dststart < -DstLen || dststart >= DstLen )
+		dststart	= DstLen;
+	else if( dststart < 0 )
+		dststart   += DstLen;
 
-	/* The string to be searched is longer than the string to search in... */
-	if( SrcLen > StrLen )
-		/* ...it will never be found. */
-		return -1;
+	Len			= ssmin( len, ssmin( SrcLen, DstLen - dststart ) + 1 );
 
-	StrPtr	= s_constcstr( str, start );
+	DstPtr		= s_constcstr( dst, dststart );
 
-	for( Index = 0; Index <= StrLen - SrcLen ; Index++ )
-		{
-		size_t	j;
-		for( j = 0; j < SrcLen && StrPtr[Index+j] == src[j] ; j++ )
-			{}
-		if( j == SrcLen )
-			return Index + start;
-		}
+	for( Index = 0; Index < Len; Index++ )
+		if( toupper( src[Index] ) != toupper( DstPtr[Index] ))
+			return (int)( toupper( src[Index] ) - toupper( DstPtr[Index] ));
 
-	return -1;
+	return 0;
 	}
-/*============================================================================*/
-ssize_t c_strstr_s( const char * restrict str, const s_string_t * restrict src, ssize_t srcstart )
+/*============================================================================*/
+int c_strnicmp_s( const char * restrict dst, const s_string_t * restrict src, ssize_t srcstart, ssize_t len )
 	{
-	ssize_t		StrLen, SrcLen;
-	ssize_t		Index;
 	const char	*SrcPtr;
+	ssize_t		Index;
+	ssize_t		Len;
+	ssize_t		SrcLen, DstLen;
 
-	/* At least one of the strings is a NULL pointer... */
-	if( str == NULL || src == NULL )
-		/* ...no search is possible. */
-		return -1;
+	STATS_CALL( c_strnicmp_s );
+	TRACE_CALL( c_strnicmp_s, len );
+
+	/* We are comparing zero bytes... */
+	if( len <= 0 )
+		/* ...two empty strings will be always equal. */
+		return 0;
 
-	/* 'src' is an empty string... */
-	if(( SrcLen = s_strlen( src )) == 0 )
-		/* ...it will never be found inside 'str'. */
+#if 0
+	/* Both dst and src are null pointers... */
+	if( dst == NULL && src == NULL )
+		/* ...so both are equal. */
+		return 0;
+	/* dst is a null pointer...*/
+	if( dst == NULL )
+		/* ...so it is smaller than src. */
 		return -1;
+	/* src is a null pointer...*/
+	if( src == NULL )
+		/* ...so dst is bigger than src. */
+		return +1;
+#else
+	DstLen		= strlen( dst );
+	SrcLen		= s_strlen( src );
 
-	/* 'srcstart' points outside of the string 'source'... */
-	if( srcstart < -SrcLen || srcstart > SrcLen )
-		/* ...nothing to be searched. */
+	/* Both 'src' and 'dst' are either NULL pointers or empty strings... */
+	if( DstLen == 0 && SrcLen == 0 )
+		/* ...so they are equal. */
+		return 0;
+	if( DstLen == 0 )
 		return -1;
+	if( SrcLen == 0 )
+		return +1;
+#endif
 
-	/* 'srcstart' is negative... */
-	if( srcstart < 0 )
-		/* ...let's normalize it counting from the end. */
-		srcstart+= SrcLen;
+	if( srcstart < -SrcLen || srcstart >= SrcLen )
+		srcstart	= SrcLen;
+	else if( srcstart < 0 )
+		srcstart   += SrcLen;
 
-	/* Calculate the effective length of the string to be searched. */
-	SrcLen -= srcstart;
+	Len			= ssmin( len, ssmin( SrcLen - srcstart, DstLen ) + 1 );
+
+	SrcPtr		= s_constcstr( src, srcstart );
 
-	if(( StrLen = strlen( str )) == 0 )
-		return -1;
-
-	/* The string to be searched is longer than the string to search in... */
-	if(  SrcLen > StrLen )
-		/* ...it will never be found. */
-		return -1;
-
-	SrcPtr	= s_constcstr( src, srcstart );
+	for( Index = 0; Index < Len; Index++ )
+		if( toupper( SrcPtr[Index] ) != toupper( dst[Index] ))
+			return (int)( toupper( SrcPtr[Index] ) - toupper( dst[Index] ));
 
-	for( Index = 0; Index <= StrLen - SrcLen ; Index++ )
-		{
-		size_t	j;
-		for( j = 0; j < SrcLen && str[Index+j] == SrcPtr[j] ; j++ )
-			{}
-		if( j == SrcLen )
-			return Index;
-		}
+	return 0;
+	}
+/*=========================================================================*//**
+s_strchr Tested OK!!!
+*//*==========================================================================*/
+ssize_t s_strchr( const s_string_t * restrict str, ssize_t start, int c )
+	{
+	ssize_t		StrLen;
+	const char	*Ptr;
+	ssize_t		Index;
 
-	return -1;
+	STATS_CALL( s_strchr );
+	TRACE_CALL( s_strchr, s_strlen( str ) );
+
+	/* str is a null pointer... */
+	if( str == NULL )
+		/* ...nothing can be found there, let's return a 'not found' result. */
+		return -1;
+
+	StrLen	= s_strlen( str );
+
+	if( start < -StrLen || start >= StrLen )
+		return -1;
+
+	if( start < 0 )
+		start  += StrLen;
+
+	Ptr		= s_constcstr( str, 0 );
+
+	/* Search for the character in the string. */
+	for( Index = start; Index < StrLen && Ptr[Index] != c; Index++ )
+		{}
+
+	/* If the character was found, return its index in the string, otherwise return a 'not found' result. */
+	return ( Index >= 0 && Index < StrLen ) ? Index : -1;
 	}
-/*============================================================================*/
-ssize_t s_stristr( const s_string_t * restrict str, ssize_t start, const s_string_t * restrict src, ssize_t srcstart )
+/*=========================================================================*//**
+s_strrchr Tested OK!!!
+*//*==========================================================================*/
+ssize_t s_strrchr( const s_string_t * restrict str, ssize_t start, int c )
+	{
+	ssize_t		StrLen;
+	const char	*Ptr;
+	ssize_t		Index;
+
+	STATS_CALL( s_strrchr );
+	TRACE_CALL( s_strrchr, s_strlen( str ) );
+
+	/* str is a null pointer... */
+	if( str == NULL )
+		/* ...nothing can be found there, let's return a 'not found' result. */
+		return -1;
+
+	StrLen	= s_strlen( str );
+
+	if( start < -StrLen || start >= StrLen )
+		return -1;
+
+	if( start < 0 )
+		start  += StrLen;
+
+	Ptr		= s_constcstr( str, 0 );
+
+	/* Search for the character in the string. */
+	for( Index = start; Index >= 0 && Ptr[Index] != c; Index-- )
+		{}
+
+	/* If the character was found, return its index in the string, otherwise return a 'not found' result. */
+	return ( Index >= 0 && Index < StrLen ) ? Index : -1;
+	}
+/*============================================================================*/
+ssize_t s_strichr( const s_string_t * restrict str, ssize_t start, int c )
+	{
+	ssize_t		StrLen;
+	const char	*Ptr;
+	ssize_t		Index;
+
+	STATS_CALL( s_strichr );
+	TRACE_CALL( s_strichr, s_strlen( str ) );
+
+	/* str is a null pointer... */
+	if( str == NULL )
+		/* ...nothing can be found there, let's return a 'not found' result. */
+		return -1;
+
+	StrLen	= s_strlen( str );
+
+	if( start < -StrLen || start >= StrLen )
+		return -1;
+
+	if( start < 0 )
+		start  += StrLen;
+
+	Ptr		= s_constcstr( str, 0 );
+	c		= toupper( c );
+
+	/* Search for the character in the string. */
+	for( Index = start; Index < StrLen && toupper( Ptr[Index] ) != c; Index++ )
+		{}
+
+	/* If the character was found, return its index in the string, otherwise return a 'not found' result. */
+	return ( Index >= 0 && Index < StrLen ) ? Index : -1;
+	}
+/*============================================================================*/
+ssize_t s_strrichr( const s_string_t * restrict str, ssize_t start, int c )
+	{
+	ssize_t		StrLen;
+	const char	*Ptr;
+	ssize_t		Index;
+
+	STATS_CALL( s_strrichr );
+	TRACE_CALL( s_strrichr, s_strlen( str ) );
+
+	/* str is a null pointer... */
+	if( str == NULL )
+		/* ...nothing can be found there, let's return a 'not found' result. */
+		return -1;
+
+	StrLen	= s_strlen( str );
+
+	if( start < -StrLen || start >= StrLen )
+		return -1;
+
+	if( start < 0 )
+		start  += StrLen;
+
+	Ptr		= s_constcstr( str, 0 );
+	c		= toupper( c );
+
+	/* Search for the character in the string. */
+	for( Index = start; Index >= 0 && toupper( Ptr[Index] ) != c; Index-- )
+		{}
+
+	/* If the character was found, return its index in the string, otherwise return a 'not found' result. */
+	return ( Index >= 0 && Index < StrLen ) ? Index : -1;
+	}
+/*============================================================================*/
+ssize_t s_strstr( const s_string_t * restrict str, ssize_t start, const s_string_t * restrict src, ssize_t srcstart )
 	{
 	ssize_t		StrLen, SrcLen;
 	ssize_t		Index;
 	const char	*StrPtr, *SrcPtr;
 
-	/* At least one of the strings is a NULL pointer... */
-	if( str == NULL || src == NULL )
-		/* ...no search is possible. */
-		return -1;
+	STATS_CALL( s_strstr );
+	TRACE_CALL( s_strstr, s_strlen( str ) );
 
-	/* 'src' is an empty string... */
+	/* At least one of the strings is a NULL pointer... */
+	if( str == NULL || src == NULL )
+		/* ...no search is possible. */
+		return -1;
+
+	/* 'src' is an empty string... */
 	if(( SrcLen = s_strlen( src )) == 0 )
-		/* ...it will never be found inside 'str'. */
-		return -1;
+		/* ...it will never be found inside 'str'. */
+		return -1;
 
 	/* 'srcstart' points outside of the string 'source'... */
 	if( srcstart < -SrcLen || srcstart > SrcLen )
@@ -2006,7 +3001,7 @@ ssize_t s_stristr( const s_string_t * restrict str, ssize_t start, const s_strin
 
 	/* Calculate the effective length of the string to be searched. */
 	SrcLen -= srcstart;
-
+
 	/* 'str' is an empty string... */
 	if(( StrLen = s_strlen( str )) == 0 )
 		/* ...nothing can be found inside it. */
@@ -2014,9 +3009,9 @@ ssize_t s_stristr( const s_string_t * restrict str, ssize_t start, const s_strin
 
 	/* 'start' points outside of the string 'str'... */
 	if( start < -StrLen || start > StrLen )
-		/* ...there's nothing to search in. */
+		/* ...there's nothing to search in. */
 		return -1;
-
+
 	/* 'start' is negative... */
 	if( start < 0 )
 		/* ...let's normalize it counting from the end. */
@@ -2029,36 +3024,39 @@ ssize_t s_stristr( const s_string_t * restrict str, ssize_t start, const s_strin
 	if(  SrcLen > StrLen )
 		/* ...it will never be found. */
 		return -1;
-
-	StrPtr	= s_constcstr( str, start );
-	SrcPtr	= s_constcstr( src, srcstart );
-
-	for( Index = 0; Index <= StrLen - SrcLen ; Index++ )
-		{
-		size_t	j;
-		for( j = 0; j < SrcLen && toupper( StrPtr[Index+j] ) == toupper( SrcPtr[j] ); j++ )
-			{}
-		if( j == SrcLen )
-			return Index + start;
-		}
-
-	return -1;
+
+	StrPtr	= s_constcstr( str, start );
+	SrcPtr	= s_constcstr( src, srcstart );
+
+	for( Index = 0; Index <= StrLen - SrcLen ; Index++ )
+		{
+		size_t	j;
+		for( j = 0; j < SrcLen && StrPtr[Index+j] == SrcPtr[j] ; j++ )
+			{}
+		if( j == SrcLen )
+			return Index + start;
+		}
+
+	return -1;
 	}
-/*============================================================================*/
-ssize_t s_stristr_c( const s_string_t *str, ssize_t start, const char *src )
+/*============================================================================*/
+ssize_t s_strstr_c( const s_string_t * restrict str, ssize_t start, const char * restrict src )
 	{
 	ssize_t		StrLen, SrcLen;
 	ssize_t		Index;
 	const char	*StrPtr;
 
+	STATS_CALL( s_strstr_c );
+	TRACE_CALL( s_strstr_c, s_strlen( str ) );
+
 	/* At least one of the strings is a NULL pointer... */
 	if( str == NULL || src == NULL )
 		/* ...no search is possible. */
 		return -1;
 
-	/* If 'src' is an empty string it will not be found inside 'str'... */
-	if(( SrcLen = strlen( src )) == 0 )
-		return -1;
+	/* If 'src' is an empty string it will not be found inside 'str'... */
+	if(( SrcLen = strlen( src )) == 0 )
+		return -1;
 
 	/* 'str' is an empty string... */
 	if(( StrLen = s_strlen( str )) == 0 )
@@ -2083,26 +3081,29 @@ ssize_t s_stristr_c( const s_string_t *str, ssize_t start, const char *src )
 		/* ...it will never be found. */
 		return -1;
 
-	StrPtr	= s_constcstr( str, start );
-
-	for( Index = 0; Index <= StrLen - SrcLen ; Index++ )
-		{
-		size_t	j;
-		for( j = 0; j < SrcLen && toupper( StrPtr[Index+j] ) == toupper( src[j] ); j++ )
-			{}
-		if( j == SrcLen )
-			return Index + start;
-		}
-
-	return -1;
+	StrPtr	= s_constcstr( str, start );
+
+	for( Index = 0; Index <= StrLen - SrcLen ; Index++ )
+		{
+		size_t	j;
+		for( j = 0; j < SrcLen && StrPtr[Index+j] == src[j] ; j++ )
+			{}
+		if( j == SrcLen )
+			return Index + start;
+		}
+
+	return -1;
 	}
-/*============================================================================*/
-ssize_t c_stristr_s( const char *str, const s_string_t *src, ssize_t srcstart )
+/*============================================================================*/
+ssize_t c_strstr_s( const char * restrict str, const s_string_t * restrict src, ssize_t srcstart )
 	{
 	ssize_t		StrLen, SrcLen;
 	ssize_t		Index;
 	const char	*SrcPtr;
 
+	STATS_CALL( c_strstr_s );
+	TRACE_CALL( c_strstr_s, TraceCLen( str ) );
+
 	/* At least one of the strings is a NULL pointer... */
 	if( str == NULL || src == NULL )
 		/* ...no search is possible. */
@@ -2125,8 +3126,8 @@ ssize_t c_stristr_s( const char *str, const s_string_t *src, ssize_t srcstart )
 
 	/* Calculate the effective length of the string to be searched. */
 	SrcLen -= srcstart;
-
-	if(( StrLen = strlen( str )) == 0 )
+
+	if(( StrLen = strlen( str )) == 0 )
 		return -1;
 
 	/* The string to be searched is longer than the string to search in... */
@@ -2134,1606 +3135,6804 @@ ssize_t c_stristr_s( const char *str, const s_string_t *src, ssize_t srcstart )
 		/* ...it will never be found. */
 		return -1;
 
-	SrcPtr	= s_constcstr( src, srcstart );
-
-	for( Index = 0; Index <= StrLen - SrcLen ; Index++ )
-		{
-		size_t	j;
-		for( j = 0; j < SrcLen && toupper( str[Index+j] ) == toupper( SrcPtr[j] ); j++ )
-			{}
-		if( j == SrcLen )
-			return Index;
-		}
+	SrcPtr	= s_constcstr( src, srcstart );
 
-	return -1;
+	for( Index = 0; Index <= StrLen - SrcLen ; Index++ )
+		{
+		size_t	j;
+		for( j = 0; j < SrcLen && str[Index+j] == SrcPtr[j] ; j++ )
+			{}
+		if( j == SrcLen )
+			return Index;
+		}
+
+	return -1;
 	}
 /*============================================================================*/
-ssize_t s_strpbrk( const s_string_t * restrict str, ssize_t start, const s_string_t * restrict charset, ssize_t charsetstart )
+/* A search of 's_strstr_par', shared by all its tasks. The haystack is split
+   in chunks of 'PAR_SEARCH_CHUNK' possible match positions, one per task.
+   Each chunk reads 'NeedleLen' - 1 characters beyond its last position, so a
+   match that crosses the end of a chunk is not missed. */
+typedef struct
 	{
-	ssize_t		StrLen, CharSetLen;
-	ssize_t		Index, j;
-	const char	*StrPtr, *CharSetPtr;
+	const char	*Haystack;
+	const char	*Needle;
+	size_t		NeedleLen;
+	size_t		Positions;	/* Number of possible match positions. */
+	size_t		Best;		/* The lowest match found so far, or 'Positions'. */
+	} par_search_t;
+
+#define	PAR_SEARCH_CHUNK	( 1 << 20 )
+/* How often a task checks if a lower match has been found. */
+#define	PAR_SEARCH_SLICE	( 1 << 16 )
+/*============================================================================*/
+/* Returns the first position in the 'Positions' at 'Ptr' where 'Needle'
+   begins, or NULL if there is none. */
+static const char *FindNeedle( const char *Ptr, size_t Positions, const char *Needle, size_t NeedleLen )
+	{
+	const char	*End	= Ptr + Positions;
 
-	if( str == NULL || charset == NULL )
-		return -1;
+	for( ; Ptr < End && ( Ptr = memchr( Ptr, Needle[0], End - Ptr )) != NULL; Ptr++ )
+		if( memcmp( Ptr + 1, Needle + 1, NeedleLen - 1 ) == 0 )
+			return Ptr;
 
-	/* 'charset' is an empty string... */
-	if(( CharSetLen = s_strlen( charset )) == 0 )
-		return -1;
-
-	if( charsetstart < -CharSetLen || start >= CharSetLen )
-		return -1;
-
-	if( start < 0 )
-		charsetstart  += CharSetLen;
-
-	CharSetLen -= charsetstart;
-
-	/* 'str' is an empty string... */
-	if(( StrLen = s_strlen( str )) == 0 )
-		return -1;
+	return NULL;
+	}
+/*============================================================================*/
+static void ParSearchChunk( void *Arg, size_t Chunk )
+	{
+	par_search_t	*Search	= Arg;
+	const char		*Found;
+	size_t			First, Last, Slice, Best;
 
-	if( start < -StrLen || start >= StrLen )
-		return -1;
+	First	= Chunk * PAR_SEARCH_CHUNK;
+	Last	= ssmin( First + PAR_SEARCH_CHUNK, Search->Positions );
 
-	if( start < 0 )
-		start  += StrLen;
-
-	StrLen -= start;
+	for( ; First < Last; First += Slice )
+		{
+		Slice	= ssmin( PAR_SEARCH_SLICE, Last - First );
 
-	StrPtr		= s_constcstr( str, start );
-	CharSetPtr	= s_constcstr( charset, charsetstart );
+		/* A match has already been found before this point. */
+		if( First >= __atomic_load_n( &Search->Best, __ATOMIC_RELAXED ))
+			return;
 
-	for( Index = 0; Index < StrLen; Index++ )
-		for( j = 0; j < CharSetLen; j++ )
-			if( StrPtr[Index] == CharSetPtr[j] )
-				return Index + start;
+		if(( Found = FindNeedle( Search->Haystack + First, Slice, Search->Needle, Search->NeedleLen )) != NULL )
+			{
+			size_t	Position	= Found - Search->Haystack;
 
-	return -1;
+			Best	= __atomic_load_n( &Search->Best, __ATOMIC_RELAXED );
+			while( Position < Best && !__atomic_compare_exchange_n( &Search->Best, &Best, Position, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED ))
+				;
+			return;
+			}
+		}
 	}
-/*============================================================================*/
-ssize_t s_strpbrk_c( const s_string_t * restrict str, ssize_t start, const char * restrict charset )
+/*============================================================================*/
+ssize_t s_strstr_par( const s_string_t * restrict str, ssize_t start, const s_string_t * restrict needle, int nthreads )
 	{
-	ssize_t		StrLen, CharSetLen;
-	ssize_t		Index, j;
-	const char	*StrPtr;
+	par_search_t	Search;
+	ssize_t			StrLen, NeedleLen;
 
-	if( str == NULL || charset == NULL )
+	STATS_CALL( s_strstr_par );
+	TRACE_CALL( s_strstr_par, s_strlen( str ) );
+
+	if( str == NULL || needle == NULL )
 		return -1;
 
-	/* 'charset' is an empty string... */
-	if(( CharSetLen = strlen( charset )) == 0 )
-		return -1;
-
-	/* 'str' is an empty string... */
-	if(( StrLen = s_strlen( str )) == 0 )
+	if(( NeedleLen = s_strlen( needle )) == 0 )
 		return -1;
 
-	if( start < -StrLen || start >= StrLen )
+	StrLen	= s_strlen( str );
+
+	if( start < -StrLen || start > StrLen )
 		return -1;
 
 	if( start < 0 )
-		start  += StrLen;
-
-	StrLen -= start;
-
-	StrPtr		= s_constcstr( str, start );
+		start  += StrLen;
 
-	for( Index = 0; Index < StrLen; Index++ )
-		for( j = 0; j < CharSetLen; j++ )
-			if( StrPtr[Index] == charset[j] )
-				return Index + start;
+	StrLen -= start;
 
-	return -1;
-	}
-/*============================================================================*/
-s_string_t *s_strdup( const s_string_t * restrict src, ssize_t start )
-	{
-	ssize_t		SrcLen;
-	ssize_t		Size;
-	s_string_t	*Str;
+	if( NeedleLen > StrLen )
+		return -1;
 
-	if( src == NULL )
-		return NULL;
+	Search.Haystack		= s_constcstr( str, start );
+	Search.Needle		= s_constcstr( needle, 0 );
+	Search.NeedleLen	= NeedleLen;
+	Search.Positions	= StrLen - NeedleLen + 1;
+	Search.Best			= Search.Positions;
 
-	SrcLen	= s_strlen( src );
+	ParallelFor(( Search.Positions + PAR_SEARCH_CHUNK - 1 ) / PAR_SEARCH_CHUNK, StrLen, nthreads, ParSearchChunk, &Search );
 
-	if( SrcLen == 0 )
-		return NULL;
-
-	if( start < -SrcLen || start >= SrcLen )
-		return NULL;
-
-	if( start < 0 )
-		start  += SrcLen;
-
-	SrcLen -= start;
+	if( Search.Best == Search.Positions )
+		return -1;
 
-	Size	= _s_calcsize( SrcLen );
+	return Search.Best + start;
+	}
+/*============================================================================*/
+/* Returns the number of characters 'c' in the 'Len' characters at 'Ptr'. */
+static size_t CountChar( const char * restrict Ptr, size_t Len, char c )
+	{
+	size_t	Count	= 0, i = 0;
 
-	if(( Str = malloc( Size )) == NULL )
-		return NULL;
+#if			defined __SSE2__
+	const __m128i	Char	= _mm_set1_epi8( c );
 
-	_s_string_init( Str, SrcLen, 2 );
+	for( ; Len - i >= 16; i += 16 )
+		Count  += __builtin_popcount( _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_loadu_si128( (const __m128i*)( Ptr + i )), Char )));
+#endif	/*	defined __SSE2__ */
 
-	s_strcpy( Str, src, start );
+	for( ; i < Len; i++ )
+		Count  += Ptr[i] == c;
 
-	return Str;
+	return Count;
 	}
 /*============================================================================*/
-s_string_t *s_strdup_c( const char * restrict src )
+/* Finds all the non-overlapping occurrences of 'Needle' in the 'Len'
+   characters at 'Ptr', storing the first 'Max' positions (plus 'Base') in
+   'Out'. Returns the number of occurrences. The candidates are the positions
+   where both the first and the last characters of 'Needle' match, 16 at a
+   time, and only those are compared entirely. */
+static size_t FindAll( const char * restrict Ptr, size_t Len, const char * restrict Needle, size_t NeedleLen, ssize_t Base, ssize_t * restrict Out, size_t Max )
 	{
-	ssize_t		SrcLen;
-	ssize_t		Size;
-	s_string_t	*Str;
+	size_t	Count	= 0, i = 0, Next = 0, Positions;
 
-	if( src == NULL )
-		return NULL;
+	if( NeedleLen == 0 || NeedleLen > Len )
+		return 0;
 
-	SrcLen	= strlen( src );
+	/* Only the counting of single characters is faster. */
+	if( NeedleLen == 1 && Max == 0 )
+		return CountChar( Ptr, Len, Needle[0] );
 
-	if( SrcLen == 0 )
-		return NULL;
+	Positions	= Len - NeedleLen + 1;
 
-	Size	= _s_calcsize( SrcLen );
+#if			defined __SSE2__
+	const __m128i	First	= _mm_set1_epi8( Needle[0] );
+	const __m128i	Last	= _mm_set1_epi8( Needle[NeedleLen - 1] );
 
-	Str		= malloc( Size );
+	for( ; Positions - i >= 16; i += 16 )
+		{
+		unsigned	Mask	= _mm_movemask_epi8( _mm_and_si128( _mm_cmpeq_epi8( _mm_loadu_si128( (const __m128i*)( Ptr + i )), First ),
+															_mm_cmpeq_epi8( _mm_loadu_si128( (const __m128i*)( Ptr + i + NeedleLen - 1 )), Last )));
 
-	if( Str == NULL )
-		return NULL;
+		for( ; Mask != 0; Mask &= Mask - 1 )
+			{
+			size_t	Pos	= i + __builtin_ctz( Mask );
 
-	_s_string_init( Str, SrcLen, 2 );
+			/* Skip the candidates inside the previous occurrence. */
+			if( Pos >= Next && memcmp( Ptr + Pos + 1, Needle + 1, NeedleLen - 1 ) == 0 )
+				{
+				if( Count < Max )
+					Out[Count]	= Base + Pos;
+				Count++;
+				Next	= Pos + NeedleLen;
+				}
+			}
+		}
+#endif	/*	defined __SSE2__ */
 
-	s_strcpy_c( Str, src );
+	for( i = ssmax( i, Next ); i < Positions; i++ )
+		if( Ptr[i] == Needle[0] && memcmp( Ptr + i + 1, Needle + 1, NeedleLen - 1 ) == 0 )
+			{
+			if( Count < Max )
+				Out[Count]	= Base + i;
+			Count++;
+			i	   += NeedleLen - 1;
+			}
 
-	return Str;
+	return Count;
 	}
 /*============================================================================*/
-s_string_t *s_strldup( const s_string_t * restrict src, ssize_t start, ssize_t len )
+ssize_t s_strcount_chr( const s_string_t * restrict str, ssize_t start, int c )
 	{
-	ssize_t		SrcLen;
-	ssize_t		Size;
-	s_string_t	*Str;
+	ssize_t	StrLen;
 
-	if( src == NULL || len <= 0 )
-		return NULL;
-
-	if(( SrcLen	= s_strlen( src )) == 0 )
-		return NULL;
-
-	if( start < -SrcLen || start > SrcLen )
-		return NULL;
-
-	if( start < 0 )
-		start += SrcLen;
-
-	SrcLen -= start;
-
-	SrcLen	= ssmin( len, SrcLen );
+	STATS_CALL( s_strcount_chr );
+	TRACE_CALL( s_strcount_chr, s_strlen( str ) );
 
-	Size	= _s_calcsize( SrcLen );
+	if( str == NULL )
+		return -1;
 
-	if(( Str = malloc( Size )) == NULL )
-		return NULL;
+	StrLen	= s_strlen( str );
 
-	_s_string_init( Str, SrcLen, 2 );
+	if( start < -StrLen || start > StrLen )
+		return -1;
 
-	s_strcpy( Str, src, start );
+	if( start < 0 )
+		start  += StrLen;
 
-	return Str;
+	return CountChar( s_constcstr( str, start ), StrLen - start, (char)c );
 	}
 /*============================================================================*/
-s_string_t *s_strldup_c( const char * restrict src, ssize_t len )
+ssize_t s_strcount( const s_string_t * restrict str, ssize_t start, const s_string_t * restrict needle )
 	{
-	ssize_t		SrcLen;
-	ssize_t		Size;
-	s_string_t	*Str;
+	ssize_t	StrLen;
 
-	if( src == NULL || len <= 0 )
-		return NULL;
+	STATS_CALL( s_strcount );
+	TRACE_CALL( s_strcount, s_strlen( str ) );
 
-	SrcLen	= ssmin( len, strlen( src ));
+	if( str == NULL || needle == NULL )
+		return -1;
 
-	if( SrcLen == 0 )
-		return NULL;
+	StrLen	= s_strlen( str );
 
-	Size	= _s_calcsize( SrcLen );
+	if( start < -StrLen || start > StrLen )
+		return -1;
 
-	if(( Str = malloc( Size )) == NULL )
-		return NULL;
+	if( start < 0 )
+		start  += StrLen;
 
-	_s_string_init( Str, SrcLen, 2 );
+	return FindAll( s_constcstr( str, start ), StrLen - start, s_constcstr( needle, 0 ), s_strlen( needle ), 0, NULL, 0 );
+	}
+/*============================================================================*/
+ssize_t s_findall( const s_string_t * restrict str, const s_string_t * restrict needle, ssize_t out_idx[], size_t max )
+	{
+	STATS_CALL( s_findall );
+	TRACE_CALL( s_findall, s_strlen( str ) );
 
-	s_strcpy_c( Str, src );
+	if( str == NULL || needle == NULL || ( out_idx == NULL && max > 0 ))
+		return -1;
 
-	return Str;
+	return FindAll( s_constcstr( str, 0 ), s_strlen( str ), s_constcstr( needle, 0 ), s_strlen( needle ), 0, out_idx, max );
 	}
-/*============================================================================*/
-s_string_t *s_strndup( const s_string_t * restrict src, ssize_t start, ssize_t len )
+/*============================================================================*/
+ssize_t s_stristr( const s_string_t * restrict str, ssize_t start, const s_string_t * restrict src, ssize_t srcstart )
 	{
-	ssize_t		SrcLen, DstLen;
-	ssize_t		Size;
-	s_string_t	*Dst;
+	ssize_t		StrLen, SrcLen;
+	ssize_t		Index;
+	const char	*StrPtr, *SrcPtr;
 
-/*
-	if( src == NULL )
-		return NULL;
-*/
+	STATS_CALL( s_stristr );
+	TRACE_CALL( s_stristr, s_strlen( str ) );
 
-	SrcLen	= s_strlen( src );
+	/* At least one of the strings is a NULL pointer... */
+	if( str == NULL || src == NULL )
+		/* ...no search is possible. */
+		return -1;
 
-	if( start < -SrcLen || start > SrcLen )
-		return NULL;
+	/* 'src' is an empty string... */
+	if(( SrcLen = s_strlen( src )) == 0 )
+		/* ...it will never be found inside 'str'. */
+		return -1;
+
+	/* 'srcstart' points outside of the string 'source'... */
+	if( srcstart < -SrcLen || srcstart > SrcLen )
+		/* ...nothing to be searched. */
+		return -1;
+
+	/* 'srcstart' is negative... */
+	if( srcstart < 0 )
+		/* ...let's normalize it counting from the end. */
+		srcstart+= SrcLen;
+
+	/* Calculate the effective length of the string to be searched. */
+	SrcLen -= srcstart;
+
+	/* 'str' is an empty string... */
+	if(( StrLen = s_strlen( str )) == 0 )
+		/* ...nothing can be found inside it. */
+		return -1;
+
+	/* 'start' points outside of the string 'str'... */
+	if( start < -StrLen || start > StrLen )
+		/* ...there's nothing to search in. */
+		return -1;
 
+	/* 'start' is negative... */
 	if( start < 0 )
-		start  += SrcLen;
+		/* ...let's normalize it counting from the end. */
+		start+= StrLen;
 
-	SrcLen -= start;
-
-	if( SrcLen == 0 && len <= 0 )
-		return NULL;
-
-	DstLen	= ssmax( len, SrcLen );
-
-	Size	= _s_calcsize( DstLen );
-
-	if(( Dst = malloc( Size )) == NULL )
-		return NULL;
-
-	_s_string_init( Dst, DstLen, 2 );
-
-	s_strcpy( Dst, src, start );
-
-	return Dst;
-	}
-/*============================================================================*/
-s_string_t *s_strndup_c( const char * restrict src, ssize_t len )
+	/* Calculate the effective length of the string to be searched in. */
+	StrLen -= start;
+
+	/* The string to be searched is longer than the string to search in... */
+	if(  SrcLen > StrLen )
+		/* ...it will never be found. */
+		return -1;
+
+	StrPtr	= s_constcstr( str, start );
+	SrcPtr	= s_constcstr( src, srcstart );
+
+	for( Index = 0; Index <= StrLen - SrcLen ; Index++ )
+		{
+		size_t	j;
+		for( j = 0; j < SrcLen && toupper( StrPtr[Index+j] ) == toupper( SrcPtr[j] ); j++ )
+			{}
+		if( j == SrcLen )
+			return Index + start;
+		}
+
+	return -1;
+	}
+/*============================================================================*/
+ssize_t s_stristr_c( const s_string_t *str, ssize_t start, const char *src )
 	{
-	ssize_t		SrcLen, DstLen;
-	ssize_t		Size;
-	s_string_t	*Dst;
-
-	if( src == NULL )
-		SrcLen	= 0;
-	else
-		SrcLen	= strlen( src );
-
-	if( SrcLen == 0 && len <= 0 )
-		return NULL;
-
-	DstLen	= ssmax( len, SrcLen );
-
-	Size	= _s_calcsize( DstLen );
+	ssize_t		StrLen, SrcLen;
+	ssize_t		Index;
+	const char	*StrPtr;
 
-	Dst		= malloc( Size );
+	STATS_CALL( s_stristr_c );
+	TRACE_CALL( s_stristr_c, s_strlen( str ) );
 
-	if( Dst == NULL )
-		return NULL;
+	/* At least one of the strings is a NULL pointer... */
+	if( str == NULL || src == NULL )
+		/* ...no search is possible. */
+		return -1;
+
+	/* If 'src' is an empty string it will not be found inside 'str'... */
+	if(( SrcLen = strlen( src )) == 0 )
+		return -1;
+
+	/* 'str' is an empty string... */
+	if(( StrLen = s_strlen( str )) == 0 )
+		/* ...nothing can be found inside it. */
+		return -1;
+
+	/* 'start' points outside of the string 'str'... */
+	if( start < -StrLen || start > StrLen )
+		/* ...there's nothing to search in. */
+		return -1;
+
+	/* 'start' is negative... */
+	if( start < 0 )
+		/* ...let's normalize it counting from the end. */
+		start+= StrLen;
+
+	/* Calculate the effective length of the string to be searched in. */
+	StrLen -= start;
+
+	/* The string to be searched is longer than the string to search in... */
+	if( SrcLen > StrLen )
+		/* ...it will never be found. */
+		return -1;
+
+	StrPtr	= s_constcstr( str, start );
+
+	for( Index = 0; Index <= StrLen - SrcLen ; Index++ )
+		{
+		size_t	j;
+		for( j = 0; j < SrcLen && toupper( StrPtr[Index+j] ) == toupper( src[j] ); j++ )
+			{}
+		if( j == SrcLen )
+			return Index + start;
+		}
+
+	return -1;
+	}
+/*============================================================================*/
+ssize_t c_stristr_s( const char *str, const s_string_t *src, ssize_t srcstart )
+	{
+	ssize_t		StrLen, SrcLen;
+	ssize_t		Index;
+	const char	*SrcPtr;
 
-	_s_string_init( Dst, DstLen, 2 );
+	STATS_CALL( c_stristr_s );
+	TRACE_CALL( c_stristr_s, TraceCLen( str ) );
 
-	s_strcpy_c( Dst, src );
+	/* At least one of the strings is a NULL pointer... */
+	if( str == NULL || src == NULL )
+		/* ...no search is possible. */
+		return -1;
+
+	/* 'src' is an empty string... */
+	if(( SrcLen = s_strlen( src )) == 0 )
+		/* ...it will never be found inside 'str'. */
+		return -1;
+
+	/* 'srcstart' points outside of the string 'source'... */
+	if( srcstart < -SrcLen || srcstart > SrcLen )
+		/* ...nothing to be searched. */
+		return -1;
+
+	/* 'srcstart' is negative... */
+	if( srcstart < 0 )
+		/* ...let's normalize it counting from the end. */
+		srcstart+= SrcLen;
+
+	/* Calculate the effective length of the string to be searched. */
+	SrcLen -= srcstart;
+
+	if(( StrLen = strlen( str )) == 0 )
+		return -1;
+
+	/* The string to be searched is longer than the string to search in... */
+	if(  SrcLen > StrLen )
+		/* ...it will never be found. */
+		return -1;
+
+	SrcPtr	= s_constcstr( src, srcstart );
+
+	for( Index = 0; Index <= StrLen - SrcLen ; Index++ )
+		{
+		size_t	j;
+		for( j = 0; j < SrcLen && toupper( str[Index+j] ) == toupper( SrcPtr[j] ); j++ )
+			{}
+		if( j == SrcLen )
+			return Index;
+		}
 
-	return Dst;
+	return -1;
 	}
-/*=========================================================================*//**
-s_strtok Tested OK!!!
-*//*==========================================================================*/
-ssize_t s_strtok( const s_string_t * restrict str, ssize_t * restrict start, const s_string_t * restrict delim, ssize_t delimstart, ssize_t * restrict length )
+/*============================================================================*/
+ssize_t s_strpbrk( const s_string_t * restrict str, ssize_t start, const s_string_t * restrict charset, ssize_t charsetstart )
 	{
-	ssize_t		StrLen, DelimLen;
-	ssize_t		Index, j, TokenLength, TokenStart;
-	const char	*StrPtr, *DelimPtr;
+	ssize_t		StrLen, CharSetLen;
+	ssize_t		Index, j;
+	const char	*StrPtr, *CharSetPtr;
 
-	if( str == NULL || delim == NULL || start == NULL )
+	STATS_CALL( s_strpbrk );
+	TRACE_CALL( s_strpbrk, s_strlen( str ) );
+
+	if( str == NULL || charset == NULL )
 		return -1;
 
-	/* 'delim' is an empty string... */
-	if(( DelimLen = s_strlen( delim )) == 0 )
+	/* 'charset' is an empty string... */
+	if(( CharSetLen = s_strlen( charset )) == 0 )
 		return -1;
 
-	if( delimstart < -DelimLen || delimstart >= DelimLen )
+	if( charsetstart < -CharSetLen || start >= CharSetLen )
 		return -1;
 
-	if( delimstart < 0 )
-		delimstart += DelimLen;
+	if( start < 0 )
+		charsetstart  += CharSetLen;
 
-	DelimLen   -= delimstart;
+	CharSetLen -= charsetstart;
 
 	/* 'str' is an empty string... */
 	if(( StrLen = s_strlen( str )) == 0 )
 		return -1;
 
-	if( *start < -StrLen || *start >= StrLen )
+	if( start < -StrLen || start >= StrLen )
 		return -1;
 
-	if( *start < 0 )
-		*start += StrLen;
+	if( start < 0 )
+		start  += StrLen;
 
-	StrPtr		= s_constcstr( str, 0 );
-	DelimPtr	= s_constcstr( delim, delimstart );
-
-	/* Skip delimiters at the beginning. */
-	for( Index = *start; Index < StrLen; Index++ )
-		{
-		for( j = 0; j < DelimLen && StrPtr[Index] != DelimPtr[j]; j++ )
-			{}
-		if( j >= DelimLen )
-			break;
-		}
-
-	/* We have reached the end of the string, there is no more tokens... */
-	if( Index >= StrLen )
-		{
-		*start	= StrLen;
-
-		if( length != NULL )
-			*length = 0;
-
-		return -1;
-		}
-
-	TokenStart	= Index;
-
-	/* Search the next delimiter. */
-	for( TokenLength = 0; Index < StrLen; Index++, TokenLength++ )
-		{
-		for( j = 0; j < DelimLen && StrPtr[Index] != DelimPtr[j]; j++ )
-			{}
-		if( j < DelimLen )
-			break;
-		}
+	StrLen -= start;
 
-	*start	= Index;
+	StrPtr		= s_constcstr( str, start );
+	CharSetPtr	= s_constcstr( charset, charsetstart );
 
-	if( length != NULL )
-		*length = TokenLength;
+	for( Index = 0; Index < StrLen; Index++ )
+		for( j = 0; j < CharSetLen; j++ )
+			if( StrPtr[Index] == CharSetPtr[j] )
+				return Index + start;
 
-	return TokenStart;
+	return -1;
 	}
-/*=========================================================================*//**
-s_strtok_c Tested OK!!!
-*//*==========================================================================*/
-ssize_t s_strtok_c( const s_string_t * restrict str, ssize_t * restrict start, const char * restrict delim, ssize_t * restrict length )
+/*============================================================================*/
+ssize_t s_strpbrk_c( const s_string_t * restrict str, ssize_t start, const char * restrict charset )
 	{
-	ssize_t		StrLen, DelimLen;
-	ssize_t		Index, j, TokenLength, TokenStart;
+	ssize_t		StrLen, CharSetLen;
+	ssize_t		Index, j;
 	const char	*StrPtr;
 
-	if( str == NULL || delim == NULL || start == NULL )
+	STATS_CALL( s_strpbrk_c );
+	TRACE_CALL( s_strpbrk_c, s_strlen( str ) );
+
+	if( str == NULL || charset == NULL )
 		return -1;
 
-	/* 'delim' is an empty string... */
-	if(( DelimLen = strlen( delim )) == 0 )
+	/* 'charset' is an empty string... */
+	if(( CharSetLen = strlen( charset )) == 0 )
 		return -1;
 
 	/* 'str' is an empty string... */
 	if(( StrLen = s_strlen( str )) == 0 )
 		return -1;
 
-	if( *start < -StrLen || *start >= StrLen )
+	if( start < -StrLen || start >= StrLen )
 		return -1;
 
-	if( *start < 0 )
-		*start += StrLen;
+	if( start < 0 )
+		start  += StrLen;
 
-	StrPtr		= s_constcstr( str, 0 );
+	StrLen -= start;
 
-	/* Skip delimiters at the beginning. */
-	for( Index = *start; Index < StrLen; Index++ )
-		{
-		for( j = 0; j < DelimLen && StrPtr[Index] != delim[j]; j++ )
-			{}
-		if( j >= DelimLen )
-			break;
-		}
+	StrPtr		= s_constcstr( str, start );
 
-	/* We have reached the end of the string, there is no more tokens... */
-	if( Index >= StrLen )
-		{
-		*start	= StrLen;
+	for( Index = 0; Index < StrLen; Index++ )
+		for( j = 0; j < CharSetLen; j++ )
+			if( StrPtr[Index] == charset[j] )
+				return Index + start;
 
-		if( length != NULL )
-			*length = 0;
+	return -1;
+	}
+/*============================================================================*/
+/* Returns the sum of the lengths of the 'n' s_strings in 'parts' (NULL
+   pointers count as empty strings) plus 'n - 1' times 'SepLen'. */
+static ssize_t PartsLength( size_t n, const s_string_t * const parts[], ssize_t SepLen )
+	{
+	ssize_t	Len	= 0;
+	size_t	i;
 
-		return -1;
-		}
+	for( i = 0; i < n; i++ )
+		Len	   += s_strlen( parts[i] );
 
-	TokenStart	= Index;
+	return n > 0 ? Len + ( n - 1 ) * SepLen : 0;
+	}
+/*============================================================================*/
+/* Copies the 'n' s_strings in 'parts', separated by 'Sep', to 'Dst', which must
+   have room for all of them. Returns a pointer to the end of the copied
+   characters. */
+static char *CopyParts( char * restrict Dst, size_t n, const s_string_t * const parts[], const char * restrict Sep, ssize_t SepLen )
+	{
+	ssize_t	Len;
+	size_t	i;
 
-	/* Search the next delimiter. */
-	for( TokenLength = 0; Index < StrLen; Index++, TokenLength++ )
+	for( i = 0; i < n; i++ )
 		{
-		for( j = 0; j < DelimLen && StrPtr[Index] != delim[j]; j++ )
-			{}
-		if( j < DelimLen )
-			break;
-		}
-
-	*start	= Index;
+		if( i > 0 && SepLen > 0 )
+			{
+			memcpy( Dst, Sep, SepLen );
+			Dst	   += SepLen;
+			}
 
-	if( length != NULL )
-		*length = TokenLength;
+		if(( Len = s_strlen( parts[i] )) > 0 )
+			{
+			memcpy( Dst, s_constcstr( parts[i], 0 ), Len );
+			Dst	   += Len;
+			}
+		}
 
-	return TokenStart;
+	return Dst;
 	}
-/*=========================================================================*//**
-s_strtok_s Tested OK!!!
-*//*==========================================================================*/
-ssize_t s_strtok_s( s_string_t * restrict dst, const s_string_t * restrict str, ssize_t * restrict start, const s_string_t * restrict delim, ssize_t delimstart )
+/*============================================================================*/
+ssize_t s_join( s_string_t * restrict dst, const s_string_t * restrict sep, size_t n, const s_string_t * const parts[] )
 	{
-	ssize_t		StrLen, DelimLen;
-	ssize_t		Index, j, TokenLength, TokenStart;
-	const char	*StrPtr, *DelimPtr;
+	ssize_t	DstUsedLen, SepLen, PartsLen;
+	char	*DstPtr;
 
-	if( dst == NULL || str == NULL || delim == NULL || start == NULL )
-		return -1;
+	STATS_CALL( s_join );
 
-	/* 'delim' is an empty string... */
-	if(( DelimLen = s_strlen( delim )) == 0 )
-		return -1;
-
-	/* 'str' is an empty string... */
-	if(( StrLen = s_strlen( str )) == 0 )
+	if( dst == NULL || dst->MustBeZero != 0 || dst->Writable == 0 || ( parts == NULL && n > 0 ))
 		return -1;
 
-	if( *start < -StrLen || *start >= StrLen )
+	DstUsedLen	= s_strlen( dst );
+	SepLen		= s_strlen( sep );
+
+	/* The lengths are added and the capacity checked only once... */
+	PartsLen	= PartsLength( n, parts, SepLen );
+
+	/* ...and if everything doesn't fit, 'dst' is not changed at all. */
+	if( PartsLen > s_strmaxlen( dst ) - DstUsedLen )
 		return -1;
 
-	if( *start < 0 )
-		*start += StrLen;
-
-	StrPtr		= s_constcstr( str, 0 );
-	DelimPtr	= s_constcstr( delim, delimstart );
+	if( PartsLen == 0 )
+		return DstUsedLen;
 
-	/* Skip delimiters at the beginning. */
-	for( Index = *start; Index < StrLen; Index++ )
-		{
-		for( j = 0; j < DelimLen && StrPtr[Index] != DelimPtr[j]; j++ )
-			{}
-		if( j >= DelimLen )
-			break;
-		}
+	DstPtr		= s_cstr( dst );
 
-	/* We have reached the end of the string, there is no more tokens... */
-	if( Index >= StrLen )
-		{
-		*start	= StrLen;
-		return -1;
-		}
+	*CopyParts( DstPtr + DstUsedLen, n, parts, s_constcstr( sep, 0 ), SepLen )	= '\0';
 
-	TokenStart	= Index;
+	DstUsedLen += PartsLen;
+	STATS_BYTES( s_join, PartsLen );
 
-	/* Search the next delimiter. */
-	for( TokenLength = 0; Index < StrLen; Index++, TokenLength++ )
-		{
-		for( j = 0; j < DelimLen && StrPtr[Index] != DelimPtr[j]; j++ )
-			{}
-		if( j < DelimLen )
-			break;
-		}
+	/* The header is written only once, after all the parts have been copied. */
+	SetUsedLen( dst, DstUsedLen );
 
-	*start	= Index;
+	return DstUsedLen;
+	}
+/*============================================================================*/
+ssize_t s_concat( s_string_t * restrict dst, size_t n, const s_string_t * const parts[] )
+	{
+	STATS_CALL( s_concat );
 
-	s_strlcpy_c( dst, &StrPtr[TokenStart], TokenLength );
+	return s_join( dst, NULL, n, parts );
+	}
+/*============================================================================*/
+s_string_t *s_join_m( const s_string_t * restrict sep, size_t n, const s_string_t * const parts[] )
+	{
+	STATS_CALL( s_join_m );
 
-	return TokenStart;
+	return s_join_ma( sep, n, parts, NULL );
 	}
-/*=========================================================================*//**
-s_strtok_sc Tested OK!!!
-*//*==========================================================================*/
-ssize_t s_strtok_sc( s_string_t * restrict dst, const s_string_t * restrict str, ssize_t * restrict start, const char * restrict delim )
+/*============================================================================*/
+s_string_t *s_join_ma( const s_string_t * restrict sep, size_t n, const s_string_t * const parts[], const s_allocator_t *alloc )
 	{
-	ssize_t		StrLen, DelimLen;
-	ssize_t		Index, j, TokenLength, TokenStart;
-	const char	*StrPtr;
+	ssize_t		SepLen, Len;
+	s_string_t	*Str;
+	int			Area;
+	char		*Ptr;
 
-	if( dst == NULL || str == NULL || delim == NULL || start == NULL )
-		return -1;
+	STATS_CALL( s_join_ma );
 
-	/* 'delim' is an empty string... */
-	if(( DelimLen = strlen( delim )) == 0 )
-		return -1;
-
-	/* 'str' is an empty string... */
-	if(( StrLen = s_strlen( str )) == 0 )
-		return -1;
+	if( parts == NULL && n > 0 )
+		return NULL;
 
-	if( *start < -StrLen || *start >= StrLen )
-		return -1;
+	SepLen	= s_strlen( sep );
+	Len		= PartsLength( n, parts, SepLen );
 
-	if( *start < 0 )
-		*start += StrLen;
+	/* The new s_string has exactly the size of the result. */
+	STATS_ALLOC( s_join_ma );
+	if(( Str = AllocateString( alloc, _s_calcsize( Len ), &Area )) == NULL )
+		return NULL;
 
-	StrPtr		= s_constcstr( str, 0 );
+	_s_string_init( Str, Len, Area );
 
-	/* Skip delimiters at the beginning. */
-	for( Index = *start; Index < StrLen; Index++ )
-		{
-		for( j = 0; j < DelimLen && StrPtr[Index] != delim[j]; j++ )
-			{}
-		if( j >= DelimLen )
-			break;
-		}
+	Ptr		= s_cstr( Str );
 
-	/* We have reached the end of the string, there is no more tokens... */
-	if( Index >= StrLen )
-		{
-		*start	= StrLen;
-		return -1;
-		}
+	*CopyParts( Ptr, n, parts, s_constcstr( sep, 0 ), SepLen )	= '\0';
 
-	TokenStart	= Index;
+	SetUsedLen( Str, Len );
 
-	/* Search the next delimiter. */
-	for( TokenLength = 0; Index < StrLen; Index++, TokenLength++ )
-		{
-		for( j = 0; j < DelimLen && StrPtr[Index] != delim[j]; j++ )
-			{}
-		if( j < DelimLen )
-			break;
-		}
+	return Str;
+	}
+/*============================================================================*/
+s_string_t *s_concat_m( size_t n, const s_string_t * const parts[] )
+	{
+	STATS_CALL( s_concat_m );
 
-	*start	= Index;
-
-	s_strlcpy_c( dst, &StrPtr[TokenStart], TokenLength );
+	return s_concat_ma( n, parts, NULL );
+	}
+/*============================================================================*/
+s_string_t *s_concat_ma( size_t n, const s_string_t * const parts[], const s_allocator_t *alloc )
+	{
+	STATS_CALL( s_concat_ma );
 
-	return TokenStart;
+	return s_join_ma( NULL, n, parts, alloc );
 	}
-/*=========================================================================*//**
-s_strtok_m Tested OK!!!
-*//*==========================================================================*/
-s_string_t *s_strtok_m( const s_string_t * restrict str, ssize_t * restrict start, const s_string_t * restrict delim, ssize_t delimstart )
+/*============================================================================*/
+s_string_t *s_strdup( const s_string_t * restrict src, ssize_t start )
 	{
-	ssize_t		StrLen, DelimLen;
-	ssize_t		Index, j, TokenLength, TokenStart;
-	const char	*StrPtr, *DelimPtr;
+	STATS_CALL( s_strdup );
 
-	if( str == NULL || delim == NULL || start == NULL )
+	return s_strdup_a( src, start, NULL );
+	}
+/*============================================================================*/
+s_string_t *s_strdup_a( const s_string_t * restrict src, ssize_t start, const s_allocator_t *alloc )
+	{
+	ssize_t		SrcLen;
+	ssize_t		Size;
+	s_string_t	*Str;
+	int			Area;
+
+	STATS_CALL( s_strdup_a );
+
+	if( src == NULL )
 		return NULL;
 
-	/* 'delim' is an empty string... */
-	if(( DelimLen = s_strlen( delim )) == 0 )
+	SrcLen	= s_strlen( src );
+
+	if( SrcLen == 0 )
 		return NULL;
 
-	if( delimstart < -DelimLen || delimstart >= DelimLen )
+	if( start < -SrcLen || start >= SrcLen )
 		return NULL;
 
-	if( delimstart < 0 )
-		delimstart += DelimLen;
-
-	DelimLen   -= delimstart;
+	if( start < 0 )
+		start  += SrcLen;
 
-	/* 'str' is an empty string... */
-	if(( StrLen = s_strlen( str )) == 0 )
-		return NULL;
-
-	if( *start < -StrLen || *start >= StrLen )
-		return NULL;
-
-	if( *start < 0 )
-		*start += StrLen;
-
-	StrPtr		= s_constcstr( str, 0 );
-	DelimPtr	= s_constcstr( delim, delimstart );
-
-	/* Skip delimiters at the beginning. */
-	for( Index = *start; Index < StrLen; Index++ )
-		{
-		for( j = 0; j < DelimLen && StrPtr[Index] != DelimPtr[j]; j++ )
-			{}
-		if( j >= DelimLen )
-			break;
-		}
+	SrcLen -= start;
 
-	/* We have reached the end of the string, there is no more tokens... */
-	if( Index >= StrLen )
-		{
-		*start	= StrLen;
+	Size	= _s_calcsize( SrcLen );
 
+	STATS_ALLOC( s_strdup_a );
+	if(( Str = AllocateString( alloc, Size, &Area )) == NULL )
 		return NULL;
-		}
 
-	TokenStart	= Index;
+	_s_string_init( Str, SrcLen, Area );
 
-	/* Search the next delimiter. */
-	for( TokenLength = 0; Index < StrLen; Index++, TokenLength++ )
-		{
-		for( j = 0; j < DelimLen && StrPtr[Index] != DelimPtr[j]; j++ )
-			{}
-		if( j < DelimLen )
-			break;
-		}
+	s_strcpy( Str, src, start );
 
-	*start	= Index;
+	return Str;
+	}
+/*============================================================================*/
+s_string_t *s_strdup_c( const char * restrict src )
+	{
+	STATS_CALL( s_strdup_c );
 
-	return s_strldup_c( &StrPtr[TokenStart], TokenLength );
+	return s_strdup_ca( src, NULL );
 	}
-/*=========================================================================*//**
-s_strtok_mc Tested OK!!!
-*//*==========================================================================*/
-s_string_t *s_strtok_mc( const s_string_t * restrict str, ssize_t * restrict start, const char * restrict delim )
+/*============================================================================*/
+s_string_t *s_strdup_ca( const char * restrict src, const s_allocator_t *alloc )
 	{
-	ssize_t		StrLen, DelimLen;
-	ssize_t		Index, j, TokenLength, TokenStart;
-	const char	*StrPtr;
+	ssize_t		SrcLen;
+	ssize_t		Size;
+	s_string_t	*Str;
+	int			Area;
 
-	if( str == NULL || delim == NULL || start == NULL )
-		return NULL;
+	STATS_CALL( s_strdup_ca );
 
-	/* 'delim' is an empty string... */
-	if(( DelimLen = strlen( delim )) == 0 )
-		return NULL;
-
-	/* 'str' is an empty string... */
-	if(( StrLen = s_strlen( str )) == 0 )
+	if( src == NULL )
 		return NULL;
 
-	if( *start < -StrLen || *start >= StrLen )
+	SrcLen	= strlen( src );
+
+	if( SrcLen == 0 )
 		return NULL;
 
-	if( *start < 0 )
-		*start += StrLen;
-
-	StrPtr		= s_constcstr( str, 0 );
-
-	/* Skip delimiters at the beginning. */
-	for( Index = *start; Index < StrLen; Index++ )
-		{
-		for( j = 0; j < DelimLen && StrPtr[Index] != delim[j]; j++ )
-			{}
-		if( j >= DelimLen )
-			break;
-		}
+	Size	= _s_calcsize( SrcLen );
 
-	/* We have reached the end of the string, there is no more tokens... */
-	if( Index >= StrLen )
-		{
-		*start	= StrLen;
+	STATS_ALLOC( s_strdup_ca );
+	Str		= AllocateString( alloc, Size, &Area );
 
+	if( Str == NULL )
 		return NULL;
-		}
-
-	TokenStart	= Index;
 
-	/* Search the next delimiter. */
-	for( TokenLength = 0; Index < StrLen; Index++, TokenLength++ )
-		{
-		for( j = 0; j < DelimLen && StrPtr[Index] != delim[j]; j++ )
-			{}
-		if( j < DelimLen )
-			break;
-		}
+	_s_string_init( Str, SrcLen, Area );
 
-	*start	= Index;
+	s_strcpy_c( Str, src );
 
-	return s_strldup_c( &StrPtr[TokenStart], TokenLength );
+	return Str;
 	}
 /*============================================================================*/
-ssize_t s_strspn( const s_string_t * restrict str, ssize_t start, const s_string_t * restrict charset, ssize_t csstart )
+s_string_t *s_strdup_x( const s_string_t * restrict src, ssize_t start )
 	{
-	ssize_t		StrLen, CharSetLen;
-	ssize_t		Count, j;
-	const char	*StrPtr, *CharSetPtr;
+	STATS_CALL( s_strdup_x );
 
-	if( str == NULL || charset == NULL )
-		return -1;
+	return s_strdup_xa( src, start, NULL );
+	}
+/*============================================================================*/
+s_string_t *s_strdup_xa( const s_string_t * restrict src, ssize_t start, const s_allocator_t *alloc )
+	{
+	ssize_t		SrcLen;
+	s_string_t	*Str;
+	int			Area;
 
-	/* 'charset' is an empty string... */
-	if(( CharSetLen = s_strlen( charset )) == 0 )
-		return -1;
-
-	if( csstart < -CharSetLen || csstart >= CharSetLen )
-		return -1;
-
-	if( csstart < 0 )
-		csstart  += CharSetLen;
-
-	CharSetLen -= csstart;
-
-	/* 'str' is an empty string... */
-	if(( StrLen = s_strlen( str )) == 0 )
-		return -1;
+	STATS_CALL( s_strdup_xa );
 
-	if( start < -StrLen || start >= StrLen )
-		return -1;
+	SrcLen	= s_strlen( src );
 
-	if( start < 0 )
-		start  += StrLen;
+	/* Unlike 's_strdup', an empty source results in an empty string. */
+	if( SrcLen > 0 )
+		{
+		if( start < -SrcLen || start >= SrcLen )
+			return NULL;
 
-	StrPtr		= s_constcstr( str, 0 );
-	CharSetPtr	= s_constcstr( charset, csstart );
+		if( start < 0 )
+			start  += SrcLen;
 
-	for( Count = 0; Count < StrLen; Count++ )
-		{
-		for( j = 0; j < CharSetLen && StrPtr[start+Count] != CharSetPtr[j]; j++ )
-			{}
-		if( j >= CharSetLen )
-			return Count;
+		SrcLen -= start;
 		}
+	else
+		start	= 0;
 
-	return Count;
+	STATS_ALLOC( s_strdup_xa );
+	if(( Str = AllocateString( alloc, _s_calcsize_x( SrcLen ), &Area )) == NULL )
+		return NULL;
+
+	_s_string_init_x( Str, SrcLen, Area );
+
+	s_strcpy( Str, src, start );
+
+	return Str;
 	}
 /*============================================================================*/
-ssize_t s_strspn_c( const s_string_t * restrict str, ssize_t start, const char * restrict charset )
+s_string_t *s_strdup_xc( const char * restrict src )
 	{
-	ssize_t		StrLen, CharSetLen;
-	ssize_t		Count, j;
-	const char	*StrPtr;
+	STATS_CALL( s_strdup_xc );
 
-	if( str == NULL || charset == NULL )
-		return -1;
+	return s_strdup_xca( src, NULL );
+	}
+/*============================================================================*/
+s_string_t *s_strdup_xca( const char * restrict src, const s_allocator_t *alloc )
+	{
+	ssize_t		SrcLen;
+	s_string_t	*Str;
+	int			Area;
 
-	/* 'charset' is an empty string... */
-	if(( CharSetLen = strlen( charset )) == 0 )
-		return -1;
-
-	/* 'str' is an empty string... */
-	if(( StrLen = s_strlen( str )) == 0 )
-		return -1;
+	STATS_CALL( s_strdup_xca );
 
-	if( start < -StrLen || start >= StrLen )
-		return -1;
+	SrcLen	= src != NULL ? (ssize_t)strlen( src ) : 0;
 
-	if( start < 0 )
-		start  += StrLen;
+	STATS_ALLOC( s_strdup_xca );
+	if(( Str = AllocateString( alloc, _s_calcsize_x( SrcLen ), &Area )) == NULL )
+		return NULL;
 
-	StrPtr		= s_constcstr( str, 0 );
+	_s_string_init_x( Str, SrcLen, Area );
 
-	for( Count = 0; Count < StrLen; Count++ )
-		{
-		for( j = 0; j < CharSetLen && StrPtr[start+Count] != charset[j]; j++ )
-			{}
-		if( j == CharSetLen )
-			return Count;
-		}
+	if( src != NULL )
+		s_strcpy_c( Str, src );
 
-	return Count;
+	return Str;
 	}
 /*============================================================================*/
-ssize_t s_strcspn( const s_string_t * restrict str, ssize_t start, const s_string_t * restrict charset, ssize_t csstart )
+s_string_t *s_strldup( const s_string_t * restrict src, ssize_t start, ssize_t len )
 	{
-	ssize_t		StrLen, CharSetLen;
-	ssize_t		Count, j;
-	const char	*StrPtr, *CharSetPtr;
+	STATS_CALL( s_strldup );
 
-	if( str == NULL || charset == NULL )
-		return -1;
+	return s_strldup_a( src, start, len, NULL );
+	}
+/*============================================================================*/
+s_string_t *s_strldup_a( const s_string_t * restrict src, ssize_t start, ssize_t len, const s_allocator_t *alloc )
+	{
+	ssize_t		SrcLen;
+	ssize_t		Size;
+	s_string_t	*Str;
+	int			Area;
 
-	/* 'charset' is an empty string... */
-	if(( CharSetLen = s_strlen( charset )) == 0 )
-		return -1;
+	STATS_CALL( s_strldup_a );
+
+	if( src == NULL || len <= 0 )
+		return NULL;
+
+	if(( SrcLen	= s_strlen( src )) == 0 )
+		return NULL;
 
-	if( csstart < -CharSetLen || csstart >= CharSetLen )
-		return -1;
+	if( start < -SrcLen || start > SrcLen )
+		return NULL;
 
-	if( csstart < 0 )
-		csstart  += CharSetLen;
+	if( start < 0 )
+		start += SrcLen;
 
-	CharSetLen -= csstart;
+	SrcLen -= start;
 
-	/* 'str' is an empty string... */
-	if(( StrLen = s_strlen( str )) == 0 )
-		return -1;
+	SrcLen	= ssmin( len, SrcLen );
 
-	if( start < -StrLen || start >= StrLen )
-		return -1;
+	Size	= _s_calcsize( SrcLen );
 
-	if( start < 0 )
-		start  += StrLen;
+	STATS_ALLOC( s_strldup_a );
+	if(( Str = AllocateString( alloc, Size, &Area )) == NULL )
+		return NULL;
 
-	StrPtr		= s_constcstr( str, 0 );
-	CharSetPtr	= s_constcstr( charset, csstart );
+	_s_string_init( Str, SrcLen, Area );
 
-	for( Count = 0; Count < StrLen; Count++ )
-		for( j = 0; j < CharSetLen; j++ )
-			if( StrPtr[start+Count] == CharSetPtr[j] )
-				return Count;
+	s_strcpy( Str, src, start );
 
-	return Count;
+	return Str;
 	}
 /*============================================================================*/
-ssize_t s_strcspn_c( const s_string_t * restrict str, ssize_t start, const char * restrict charset )
+s_string_t *s_strldup_c( const char * restrict src, ssize_t len )
 	{
-	ssize_t		StrLen, CharSetLen;
-	ssize_t		Count, j;
-	const char	*StrPtr;
+	STATS_CALL( s_strldup_c );
 
-	if( str == NULL || charset == NULL )
-		return -1;
+	return s_strldup_ca( src, len, NULL );
+	}
+/*============================================================================*/
+s_string_t *s_strldup_ca( const char * restrict src, ssize_t len, const s_allocator_t *alloc )
+	{
+	ssize_t		SrcLen;
+	ssize_t		Size;
+	s_string_t	*Str;
+	int			Area;
 
-	/* 'charset' is an empty string... */
-	if(( CharSetLen = strlen( charset )) == 0 )
-		return -1;
-
-	/* 'str' is an empty string... */
-	if(( StrLen = s_strlen( str )) == 0 )
-		return -1;
+	STATS_CALL( s_strldup_ca );
 
-	if( start < -StrLen || start >= StrLen )
-		return -1;
+	if( src == NULL || len <= 0 )
+		return NULL;
 
-	if( start < 0 )
-		start  += StrLen;
+	SrcLen	= ssmin( len, strlen( src ));
 
-	StrPtr		= s_constcstr( str, 0 );
+	if( SrcLen == 0 )
+		return NULL;
 
-	for( Count = 0; Count < StrLen; Count++ )
-		for( j = 0; j < CharSetLen; j++ )
-			if( StrPtr[start+Count] == charset[j] )
-				return Count;
+	Size	= _s_calcsize( SrcLen );
 
-	return Count;
+	STATS_ALLOC( s_strldup_ca );
+	if(( Str = AllocateString( alloc, Size, &Area )) == NULL )
+		return NULL;
+
+	_s_string_init( Str, SrcLen, Area );
+
+	s_strcpy_c( Str, src );
+
+	return Str;
+	}
+/*============================================================================*/
+s_string_t *s_strndup( const s_string_t * restrict src, ssize_t start, ssize_t len )
+	{
+	STATS_CALL( s_strndup );
+
+	return s_strndup_a( src, start, len, NULL );
 	}
 /*============================================================================*/
-s_string_t *s_extract_me( const s_string_t * restrict src, ssize_t start, ssize_t end )
+s_string_t *s_strndup_a( const s_string_t * restrict src, ssize_t start, ssize_t len, const s_allocator_t *alloc )
 	{
-	ssize_t	SrcLen;
+	ssize_t		SrcLen, DstLen;
+	ssize_t		Size;
+	s_string_t	*Dst;
+	int			Area;
 
-	if( src == NULL )
-		return NULL;	/* Would it be better returning an empty s_string??? */
+	STATS_CALL( s_strndup_a );
 
-	if(( SrcLen = s_strlen( src )) == 0 )
+/*
+	if( src == NULL )
 		return NULL;
+*/
+
+	SrcLen	= s_strlen( src );
 
-	if( start >= SrcLen )
+	if( start < -SrcLen || start > SrcLen )
 		return NULL;
+
+	if( start < 0 )
+		start  += SrcLen;
+
+	SrcLen -= start;
 
-	if( start < -SrcLen )
-		start	= 0;
-	else if( start < 0 )
-		start  += SrcLen;
+	if( SrcLen == 0 && len <= 0 )
+		return NULL;
 
-	if( end >= SrcLen )
-		end		= SrcLen - 1;
-	else if( end < -SrcLen )
-		end		= 0;
-	else if( end < 0 )
-		end	   += SrcLen;
+	DstLen	= ssmax( len, SrcLen );
 
-	if( start > end )
-		return NULL;	/* Would it be better returning an empty s_string??? */
+	Size	= _s_calcsize( DstLen );
 
-	return s_strndup_c( s_constcstr( src, start ), end - start + 1 );
+	STATS_ALLOC( s_strndup_a );
+	if(( Dst = AllocateString( alloc, Size, &Area )) == NULL )
+		return NULL;
+
+	_s_string_init( Dst, DstLen, Area );
+
+	s_strcpy( Dst, src, start );
+
+	return Dst;
 	}
 /*============================================================================*/
-s_string_t *s_extract_mec( const char * restrict src, ssize_t start, ssize_t end )
+s_string_t *s_strndup_c( const char * restrict src, ssize_t len )
 	{
-	ssize_t	SrcLen;
-
-	if( src == NULL )
-		return NULL;	/* Would it be better returning an empty s_string??? */
-
-	if(( SrcLen = strlen( src )) == 0 )
-		return NULL;
-
-	if( start >= SrcLen )
-		return NULL;
-
-	if( start < -SrcLen )
-		start	= 0;
-	else if( start < 0 )
-		start  += SrcLen;
-
-	if( end >= SrcLen )
-		end		= SrcLen - 1;
-	else if( end < -SrcLen )
-		end		= 0;
-	else if( end < 0 )
-		end	   += SrcLen;
-
-	if( start > end )
-		return NULL;	/* Would it be better returning an empty s_string??? */
+	STATS_CALL( s_strndup_c );
 
-	return s_strndup_c( src + start, end - start + 1 );
+	return s_strndup_ca( src, len, NULL );
 	}
 /*============================================================================*/
-s_string_t *s_extract_ml( const s_string_t * restrict src, ssize_t start, ssize_t len )
+s_string_t *s_strndup_ca( const char * restrict src, ssize_t len, const s_allocator_t *alloc )
 	{
-	ssize_t	SrcLen;
-
-	if( src == NULL || len <= 0 )
-		return NULL;	/* Would it be better returning an empty s_string??? */
+	ssize_t		SrcLen, DstLen;
+	ssize_t		Size;
+	s_string_t	*Dst;
+	int			Area;
 
-	if(( SrcLen = s_strlen( src )) == 0 )
-		return NULL;
+	STATS_CALL( s_strndup_ca );
 
-	if( start >= SrcLen )
-		return NULL;	/* Would it be better returning an empty s_string??? */
-	else if( start < -SrcLen )
-		start	= 0;
-	else if( start < 0 )
-		start  += SrcLen;
+	if( src == NULL )
+		SrcLen	= 0;
+	else
+		SrcLen	= strlen( src );
 
-	if( start + len > SrcLen )
-		len		= SrcLen - start;
+	if( SrcLen == 0 && len <= 0 )
+		return NULL;
 
-	return s_strndup_c( s_constcstr( src, start ), len );
-	}
-/*============================================================================*/
-s_string_t *s_extract_mlc( const char * restrict src, ssize_t start, ssize_t len )
-	{
-	ssize_t	SrcLen;
+	DstLen	= ssmax( len, SrcLen );
 
-	if( src == NULL || len <= 0 )
-		return NULL;	/* Would it be better returning an empty s_string??? */
+	Size	= _s_calcsize( DstLen );
 
-	SrcLen		= strlen( src );
+	STATS_ALLOC( s_strndup_ca );
+	Dst		= AllocateString( alloc, Size, &Area );
 
-	if( start < -SrcLen )
-		start	= 0;
-	else if( start < 0 )
-		start  += SrcLen;
+	if( Dst == NULL )
+		return NULL;
 
-	if( start >= SrcLen )
-		return NULL;	/* Would it be better returning an empty s_string??? */
+	_s_string_init( Dst, DstLen, Area );
 
-	if( start + len > SrcLen )
-		len		= SrcLen - start;
+	s_strcpy_c( Dst, src );
 
-	return s_strndup_c( src + start, len );
+	return Dst;
 	}
-/*============================================================================*/
-ssize_t s_extract_e( s_string_t * restrict dst, const s_string_t * restrict src, ssize_t start, ssize_t end )
+/*=========================================================================*//**
+s_strtok Tested OK!!!
+*//*==========================================================================*/
+ssize_t s_strtok( const s_string_t * restrict str, ssize_t * restrict start, const s_string_t * restrict delim, ssize_t delimstart, ssize_t * restrict length )
 	{
-	ssize_t	SrcLen;
+	ssize_t		StrLen, DelimLen;
+	ssize_t		Index, j, TokenLength, TokenStart;
+	const char	*StrPtr, *DelimPtr;
 
-	if( dst == NULL || dst->MustBeZero != 0 || !dst->Writable )
-		return -1;	/* Would it be better returning zero??? */
+	STATS_CALL( s_strtok );
+	TRACE_CALL( s_strtok, s_strlen( str ) );
 
-	if( src == NULL || ( SrcLen = s_strlen( src )) == 0 || start >= SrcLen )
-		return s_strcpy_c( dst, "" );
+	if( str == NULL || delim == NULL || start == NULL )
+		return -1;
+
+	/* 'delim' is an empty string... */
+	if(( DelimLen = s_strlen( delim )) == 0 )
+		return -1;
 
-	if( start < -SrcLen )
-		start	= 0;
-	else if( start < 0 )
-		start  += SrcLen;
+	if( delimstart < -DelimLen || delimstart >= DelimLen )
+		return -1;
 
-	if( end > SrcLen )
-		end	= SrcLen - 1;
-	else if( end < -SrcLen )
-		end		= 0;
-	else if( end < 0 )
-		end	   += SrcLen;
-
-	if( start > end )
-		return s_strcpy_c( dst, "" );
-
-	return s_strlcpy_c( dst, s_constcstr( src, start ), end - start + 1 );
-	}
-/*============================================================================*/
-ssize_t s_extract_ec( s_string_t * restrict dst, const char * restrict src, ssize_t start, ssize_t end )
-	{
-	ssize_t	SrcLen;
+	if( delimstart < 0 )
+		delimstart += DelimLen;
+
+	DelimLen   -= delimstart;
+
+	/* 'str' is an empty string... */
+	if(( StrLen = s_strlen( str )) == 0 )
+		return -1;
 
-	if( dst == NULL || dst->MustBeZero != 0 || !dst->Writable )
-		return -1;	/* Would it be better returning zero??? */
+	if( *start < -StrLen || *start >= StrLen )
+		return -1;
 
-	if( src == NULL || ( SrcLen = strlen( src )) == 0 || start >= SrcLen )
-		return s_strcpy_c( dst, "" );
+	if( *start < 0 )
+		*start += StrLen;
 
-	if( start < -SrcLen )
-		start	= 0;
-	else if( start < 0 )
-		start  += SrcLen;
+	StrPtr		= s_constcstr( str, 0 );
+	DelimPtr	= s_constcstr( delim, delimstart );
 
-	if( end >= SrcLen )
-		end		= SrcLen - 1;
-	else if( end < -SrcLen )
-		end		= 0;
-	else if( end < 0 )
-		end	   += SrcLen;
+	/* Skip delimiters at the beginning. */
+	for( Index = *start; Index < StrLen; Index++ )
+		{
+		for( j = 0; j < DelimLen && StrPtr[Index] != DelimPtr[j]; j++ )
+			{}
+		if( j >= DelimLen )
+			break;
+		}
 
-	if( start > end )
-		return s_strcpy_c( dst, "" );
+	/* We have reached the end of the string, there is no more tokens... */
+	if( Index >= StrLen )
+		{
+		*start	= StrLen;
 
-	return s_strlcpy_c( dst, src + start, end - start + 1 );
-	}
-/*============================================================================*/
-ssize_t s_extract_l( s_string_t * restrict dst, const s_string_t * restrict src, ssize_t start, ssize_t len )
-	{
-	ssize_t	SrcLen;
+		if( length != NULL )
+			*length = 0;
 
-	if( dst == NULL || dst->MustBeZero != 0 || !dst->Writable )
 		return -1;
-
-	if( len <= 0 || src == NULL || ( SrcLen = s_strlen( src )) == 0 || start >= SrcLen )
-		return s_strcpy_c( dst, "" );	/* Would it be better returning zero??? */
-
-	if( start < -SrcLen )
-		start	= 0;
-	else if( start < 0 )
-		start  += SrcLen;
-
-	if( start + len > SrcLen )
-		len		= SrcLen - start;
-
-	return s_strlcpy( dst, src, start, len );
-	}
-/*============================================================================*/
-ssize_t s_extract_lc( s_string_t * restrict dst, const char * restrict src, ssize_t start, ssize_t len )
-	{
-	ssize_t	SrcLen;
+		}
 
-	if( dst == NULL || dst->MustBeZero != 0 || !dst->Writable )
-		return -1;	/* Would it be better returning zero??? */
+	TokenStart	= Index;
 
-	if( len <= 0 || src == NULL || ( SrcLen = strlen( src )) == 0 || start >= SrcLen )
-		return s_strcpy_c( dst, "" );
+	/* Search the next delimiter. */
+	for( TokenLength = 0; Index < StrLen; Index++, TokenLength++ )
+		{
+		for( j = 0; j < DelimLen && StrPtr[Index] != DelimPtr[j]; j++ )
+			{}
+		if( j < DelimLen )
+			break;
+		}
 
-	if( start < -SrcLen )
-		start	= 0;
-	else if( start < 0 )
-		start  += SrcLen;
+	*start	= Index;
 
-	if( start + len > SrcLen )
-		len		= SrcLen - start;
+	if( length != NULL )
+		*length = TokenLength;
 
-	return s_strlcpy_c( dst, src, len );
+	return TokenStart;
 	}
-/*============================================================================*/
-ssize_t s_fill_l( s_string_t * restrict dst, ssize_t start, ssize_t len, int filler )
-	{
-	}
-/*============================================================================*/
-ssize_t s_fill_ls( s_string_t * restrict dst, ssize_t start, ssize_t len, const s_string_t * restrict src, ssize_t srcstart )
-	{
-	}
-/*============================================================================*/
-ssize_t s_fill_lc( s_string_t * restrict dst, ssize_t start, ssize_t len, const char		  * restrict src )
-	{
-	}
 /*=========================================================================*//**
-s_replace_de tested OK!
-*//*==========================================================================*/
-ssize_t s_replace_de( s_string_t * restrict dst, ssize_t start, ssize_t end, const s_string_t * restrict src, ssize_t srcstart, int filler )
+s_strtok_c Tested OK!!!
+*//*==========================================================================*/
+ssize_t s_strtok_c( const s_string_t * restrict str, ssize_t * restrict start, const char * restrict delim, ssize_t * restrict length )
 	{
-	ssize_t		SrcLen, DstLen, DstMaxLen, Len, TransfLen;
-	ssize_t 	LeftFill	= 0, RightFill	= 0;
-	char		*DstPtr;
-	const char	*SrcPtr;
+	ssize_t		StrLen, DelimLen;
+	ssize_t		Index, j, TokenLength, TokenStart;
+	const char	*StrPtr;
 
-	if( dst == NULL || dst->MustBeZero != 0 || dst->Writable == 0 || src == NULL || src->MustBeZero != 0 )
+	STATS_CALL( s_strtok_c );
+	TRACE_CALL( s_strtok_c, s_strlen( str ) );
+
+	if( str == NULL || delim == NULL || start == NULL )
 		return -1;
-
-	DstMaxLen	= s_strmaxlen( dst );
 
-	if( start >= DstMaxLen )
-		return 0;
-
-	DstLen		= s_strlen( dst );
-
-	if( end < -DstLen )
-		return 0;
-
-	if( end < 0 )
-		end	   += DstLen;
-	else if( end >= DstMaxLen )
-		end		= DstMaxLen - 1;
-
-	if( start < 0 )
-		start  += DstLen;
-
-	if( end < start )
+	/* 'delim' is an empty string... */
+	if(( DelimLen = strlen( delim )) == 0 )
 		return -1;
 
-	SrcLen		= s_strlen( src );
-
-	if( srcstart < 0 )
-		srcstart   += SrcLen;
-
-	Len			= end - start + 1;
-
-	if( start < 0 )
-		{
-		Len			= end - 0 + 1;
-		srcstart   -= start;
-		start		= 0;
-		}
-
-	TransfLen		= Len;
-
-	if( srcstart < -Len || srcstart >= SrcLen )
-		{
-		if( filler != '\0' )
-			LeftFill	= Len;
-		srcstart	= SrcLen;
-		TransfLen	= 0;
-		}
-	else if( srcstart < 0 )
-		{
-		if( filler != '\0' )
-			LeftFill	= -srcstart;
-		else
-			{
-			start	   -= srcstart;
-			Len		   += srcstart;
-			}
-		TransfLen  += srcstart;
-		srcstart	= 0;
-		}
-
-	if( Len - LeftFill > SrcLen - srcstart )
-		{
-		TransfLen	= SrcLen - srcstart;
-		if( filler != '\0' )
-			RightFill	= Len - LeftFill - TransfLen;
-		else
-			Len		    = LeftFill + TransfLen;;
-		}
+	/* 'str' is an empty string... */
+	if(( StrLen = s_strlen( str )) == 0 )
+		return -1;
+
+	if( *start < -StrLen || *start >= StrLen )
+		return -1;
+
+	if( *start < 0 )
+		*start += StrLen;
 
-	/* There are one or more gaps to fill, but the filler is zero... */
-	if( filler == 0 && ( LeftFill > 0 || RightFill > 0 || start > DstLen ))
-		/* ...the operation is not possible. */
+	StrPtr		= s_constcstr( str, 0 );
+
+	/* Skip delimiters at the beginning. */
+	for( Index = *start; Index < StrLen; Index++ )
+		{
+		for( j = 0; j < DelimLen && StrPtr[Index] != delim[j]; j++ )
+			{}
+		if( j >= DelimLen )
+			break;
+		}
+
+	/* We have reached the end of the string, there is no more tokens... */
+	if( Index >= StrLen )
+		{
+		*start	= StrLen;
+
+		if( length != NULL )
+			*length = 0;
+
+		return -1;
+		}
+
+	TokenStart	= Index;
+
+	/* Search the next delimiter. */
+	for( TokenLength = 0; Index < StrLen; Index++, TokenLength++ )
+		{
+		for( j = 0; j < DelimLen && StrPtr[Index] != delim[j]; j++ )
+			{}
+		if( j < DelimLen )
+			break;
+		}
+
+	*start	= Index;
+
+	if( length != NULL )
+		*length = TokenLength;
+
+	return TokenStart;
+	}
+/*=========================================================================*//**
+s_strtok_s Tested OK!!!
+*//*==========================================================================*/
+ssize_t s_strtok_s( s_string_t * restrict dst, const s_string_t * restrict str, ssize_t * restrict start, const s_string_t * restrict delim, ssize_t delimstart )
+	{
+	ssize_t		StrLen, DelimLen;
+	ssize_t		Index, j, TokenLength, TokenStart;
+	const char	*StrPtr, *DelimPtr;
+
+	STATS_CALL( s_strtok_s );
+	TRACE_CALL( s_strtok_s, s_strlen( str ) );
+
+	if( dst == NULL || str == NULL || delim == NULL || start == NULL )
+		return -1;
+
+	/* 'delim' is an empty string... */
+	if(( DelimLen = s_strlen( delim )) == 0 )
 		return -1;
 
-	if(( DstPtr = s_cstr( dst )) == NULL )
-		return -1;
+	/* 'str' is an empty string... */
+	if(( StrLen = s_strlen( str )) == 0 )
+		return -1;
+
+	if( *start < -StrLen || *start >= StrLen )
+		return -1;
+
+	if( *start < 0 )
+		*start += StrLen;
 
-	if(( SrcPtr = s_constcstr( src, 0 )) == NULL )
+	StrPtr		= s_constcstr( str, 0 );
+	DelimPtr	= s_constcstr( delim, delimstart );
+
+	/* Skip delimiters at the beginning. */
+	for( Index = *start; Index < StrLen; Index++ )
+		{
+		for( j = 0; j < DelimLen && StrPtr[Index] != DelimPtr[j]; j++ )
+			{}
+		if( j >= DelimLen )
+			break;
+		}
+
+	/* We have reached the end of the string, there is no more tokens... */
+	if( Index >= StrLen )
+		{
+		*start	= StrLen;
+		return -1;
+		}
+
+	TokenStart	= Index;
+
+	/* Search the next delimiter. */
+	for( TokenLength = 0; Index < StrLen; Index++, TokenLength++ )
+		{
+		for( j = 0; j < DelimLen && StrPtr[Index] != DelimPtr[j]; j++ )
+			{}
+		if( j < DelimLen )
+			break;
+		}
+
+	*start	= Index;
+
+	s_strlcpy_c( dst, &StrPtr[TokenStart], TokenLength );
+
+	return TokenStart;
+	}
+/*=========================================================================*//**
+s_strtok_sc Tested OK!!!
+*//*==========================================================================*/
+ssize_t s_strtok_sc( s_string_t * restrict dst, const s_string_t * restrict str, ssize_t * restrict start, const char * restrict delim )
+	{
+	ssize_t		StrLen, DelimLen;
+	ssize_t		Index, j, TokenLength, TokenStart;
+	const char	*StrPtr;
+
+	STATS_CALL( s_strtok_sc );
+	TRACE_CALL( s_strtok_sc, s_strlen( str ) );
+
+	if( dst == NULL || str == NULL || delim == NULL || start == NULL )
+		return -1;
+
+	/* 'delim' is an empty string... */
+	if(( DelimLen = strlen( delim )) == 0 )
 		return -1;
 
-	/* There s a gap between the current end of the string and the start position... */
-	if( start > DstLen )
-		/* ...let's fill the gap with the 'filler'. */
-		memset( &DstPtr[DstLen], filler, start - DstLen );
+	/* 'str' is an empty string... */
+	if(( StrLen = s_strlen( str )) == 0 )
+		return -1;
+
+	if( *start < -StrLen || *start >= StrLen )
+		return -1;
+
+	if( *start < 0 )
+		*start += StrLen;
+
+	StrPtr		= s_constcstr( str, 0 );
+
+	/* Skip delimiters at the beginning. */
+	for( Index = *start; Index < StrLen; Index++ )
+		{
+		for( j = 0; j < DelimLen && StrPtr[Index] != delim[j]; j++ )
+			{}
+		if( j >= DelimLen )
+			break;
+		}
+
+	/* We have reached the end of the string, there is no more tokens... */
+	if( Index >= StrLen )
+		{
+		*start	= StrLen;
+		return -1;
+		}
+
+	TokenStart	= Index;
+
+	/* Search the next delimiter. */
+	for( TokenLength = 0; Index < StrLen; Index++, TokenLength++ )
+		{
+		for( j = 0; j < DelimLen && StrPtr[Index] != delim[j]; j++ )
+			{}
+		if( j < DelimLen )
+			break;
+		}
+
+	*start	= Index;
 
-	/* There is a gap on the left of the destination... */
-	if( LeftFill > 0 )
-		/* ...let's fill the gap with the 'filler'. */
-		memset( &DstPtr[start], filler, LeftFill );
+	s_strlcpy_c( dst, &StrPtr[TokenStart], TokenLength );
+
+	return TokenStart;
+	}
+/*=========================================================================*//**
+s_strtok_m Tested OK!!!
+*//*==========================================================================*/
+s_string_t *s_strtok_m( const s_string_t * restrict str, ssize_t * restrict start, const s_string_t * restrict delim, ssize_t delimstart )
+	{
+	STATS_CALL( s_strtok_m );
+	TRACE_CALL( s_strtok_m, s_strlen( str ) );
+
+	return s_strtok_ma( str, start, delim, delimstart, NULL );
+	}
+/*============================================================================*/
+s_string_t *s_strtok_ma( const s_string_t * restrict str, ssize_t * restrict start, const s_string_t * restrict delim, ssize_t delimstart, const s_allocator_t *alloc )
+	{
+	ssize_t		StrLen, DelimLen;
+	ssize_t		Index, j, TokenLength, TokenStart;
+	const char	*StrPtr, *DelimPtr;
+
+	STATS_CALL( s_strtok_ma );
+
+	if( str == NULL || delim == NULL || start == NULL )
+		return NULL;
+
+	/* 'delim' is an empty string... */
+	if(( DelimLen = s_strlen( delim )) == 0 )
+		return NULL;
 
-	if( TransfLen > 0 )
-		memcpy( &DstPtr[start+LeftFill], &SrcPtr[srcstart], TransfLen );
+	if( delimstart < -DelimLen || delimstart >= DelimLen )
+		return NULL;
 
-	if( RightFill > 0 )
-		memset( &DstPtr[start+LeftFill+TransfLen], filler, RightFill );
+	if( delimstart < 0 )
+		delimstart += DelimLen;
 
-	/* Let's calculate how many characters were changed in the destination. */
-	LeftFill		= 0;
-	if( start > DstLen )
-		LeftFill	= start - DstLen;
-
-	if( start + Len > DstLen )
-		DstLen		= start + Len;
-
-	DstPtr[DstLen]	= '\0';
-
-	SetUsedLen( dst, DstLen );
-
-	return Len + LeftFill;
-
-#if 0
-	if( end >= DstMaxLen )
-		end		= DstMaxLen - 1;
-	else if( end < 0 )
-		end	   += DstLen;
+	DelimLen   -= delimstart;
 
-	if( start < 0 )
-		start  += DstLen;
+	/* 'str' is an empty string... */
+	if(( StrLen = s_strlen( str )) == 0 )
+		return NULL;
+
+	if( *start < -StrLen || *start >= StrLen )
+		return NULL;
+
+	if( *start < 0 )
+		*start += StrLen;
+
+	StrPtr		= s_constcstr( str, 0 );
+	DelimPtr	= s_constcstr( delim, delimstart );
+
+	/* Skip delimiters at the beginning. */
+	for( Index = *start; Index < StrLen; Index++ )
+		{
+		for( j = 0; j < DelimLen && StrPtr[Index] != DelimPtr[j]; j++ )
+			{}
+		if( j >= DelimLen )
+			break;
+		}
+
+	/* We have reached the end of the string, there is no more tokens... */
+	if( Index >= StrLen )
+		{
+		*start	= StrLen;
+
+		return NULL;
+		}
+
+	TokenStart	= Index;
+
+	/* Search the next delimiter. */
+	for( TokenLength = 0; Index < StrLen; Index++, TokenLength++ )
+		{
+		for( j = 0; j < DelimLen && StrPtr[Index] != DelimPtr[j]; j++ )
+			{}
+		if( j < DelimLen )
+			break;
+		}
+
+	*start	= Index;
+
+	return s_strldup_ca( &StrPtr[TokenStart], TokenLength, alloc );
+	}
+/*=========================================================================*//**
+s_strtok_mc Tested OK!!!
+*//*==========================================================================*/
+s_string_t *s_strtok_mc( const s_string_t * restrict str, ssize_t * restrict start, const char * restrict delim )
+	{
+	STATS_CALL( s_strtok_mc );
+	TRACE_CALL( s_strtok_mc, s_strlen( str ) );
+
+	return s_strtok_mca( str, start, delim, NULL );
+	}
+/*============================================================================*/
+s_string_t *s_strtok_mca( const s_string_t * restrict str, ssize_t * restrict start, const char * restrict delim, const s_allocator_t *alloc )
+	{
+	ssize_t		StrLen, DelimLen;
+	ssize_t		Index, j, TokenLength, TokenStart;
+	const char	*StrPtr;
+
+	STATS_CALL( s_strtok_mca );
+
+	if( str == NULL || delim == NULL || start == NULL )
+		return NULL;
+
+	/* 'delim' is an empty string... */
+	if(( DelimLen = strlen( delim )) == 0 )
+		return NULL;
 
-	if( end < start )
+	/* 'str' is an empty string... */
+	if(( StrLen = s_strlen( str )) == 0 )
+		return NULL;
+
+	if( *start < -StrLen || *start >= StrLen )
+		return NULL;
+
+	if( *start < 0 )
+		*start += StrLen;
+
+	StrPtr		= s_constcstr( str, 0 );
+
+	/* Skip delimiters at the beginning. */
+	for( Index = *start; Index < StrLen; Index++ )
+		{
+		for( j = 0; j < DelimLen && StrPtr[Index] != delim[j]; j++ )
+			{}
+		if( j >= DelimLen )
+			break;
+		}
+
+	/* We have reached the end of the string, there is no more tokens... */
+	if( Index >= StrLen )
+		{
+		*start	= StrLen;
+
+		return NULL;
+		}
+
+	TokenStart	= Index;
+
+	/* Search the next delimiter. */
+	for( TokenLength = 0; Index < StrLen; Index++, TokenLength++ )
+		{
+		for( j = 0; j < DelimLen && StrPtr[Index] != delim[j]; j++ )
+			{}
+		if( j < DelimLen )
+			break;
+		}
+
+	*start	= Index;
+
+	return s_strldup_ca( &StrPtr[TokenStart], TokenLength, alloc );
+	}
+/*============================================================================*/
+ssize_t s_strspn( const s_string_t * restrict str, ssize_t start, const s_string_t * restrict charset, ssize_t csstart )
+	{
+	ssize_t		StrLen, CharSetLen;
+	ssize_t		Count, j;
+	const char	*StrPtr, *CharSetPtr;
+
+	STATS_CALL( s_strspn );
+
+	if( str == NULL || charset == NULL )
+		return -1;
+
+	/* 'charset' is an empty string... */
+	if(( CharSetLen = s_strlen( charset )) == 0 )
 		return -1;
 
-	SrcLen		= s_strlen( src );
-
-	if( srcstart < 0 )
-		srcstart   += SrcLen;
-
-	Len	= end - start + 1;
-
-	if( start < 0 )
-		{
-		Len			= end - 0 + 1;
-		srcstart   -= start;
-		start		= 0;
-		}
-
-	if( srcstart < 0 )
-		{
-		LeftFill	= ssmin( LeftFill - srcstart, Len );
-		srcstart	= 0;
-		}
+	if( csstart < -CharSetLen || csstart >= CharSetLen )
+		return -1;
 
-	if( srcstart > SrcLen )
-		srcstart	= SrcLen;
+	if( csstart < 0 )
+		csstart  += CharSetLen;
 
-	if( srcstart + Len >= SrcLen )
-		RightFill	= SrcLen - srcstart;
+	CharSetLen -= csstart;
 
-	/* There are one or more gaps to fill, but the filler is zero... */
-	if( filler == 0 && ( LeftFill > 0 || RightFill > 0 || start > DstLen ))
-		/* ...the operation is not possible. */
+	/* 'str' is an empty string... */
+	if(( StrLen = s_strlen( str )) == 0 )
+		return -1;
+
+	if( start < -StrLen || start >= StrLen )
+		return -1;
+
+	if( start < 0 )
+		start  += StrLen;
+
+	StrPtr		= s_constcstr( str, 0 );
+	CharSetPtr	= s_constcstr( charset, csstart );
+
+	for( Count = 0; Count < StrLen; Count++ )
+		{
+		for( j = 0; j < CharSetLen && StrPtr[start+Count] != CharSetPtr[j]; j++ )
+			{}
+		if( j >= CharSetLen )
+			return Count;
+		}
+
+	return Count;
+	}
+/*============================================================================*/
+ssize_t s_strspn_c( const s_string_t * restrict str, ssize_t start, const char * restrict charset )
+	{
+	ssize_t		StrLen, CharSetLen;
+	ssize_t		Count, j;
+	const char	*StrPtr;
+
+	STATS_CALL( s_strspn_c );
+
+	if( str == NULL || charset == NULL )
+		return -1;
+
+	/* 'charset' is an empty string... */
+	if(( CharSetLen = strlen( charset )) == 0 )
 		return -1;
 
-	if(( DstPtr = s_cstr( dst )) == NULL )
+	/* 'str' is an empty string... */
+	if(( StrLen = s_strlen( str )) == 0 )
+		return -1;
+
+	if( start < -StrLen || start >= StrLen )
+		return -1;
+
+	if( start < 0 )
+		start  += StrLen;
+
+	StrPtr		= s_constcstr( str, 0 );
+
+	for( Count = 0; Count < StrLen; Count++ )
+		{
+		for( j = 0; j < CharSetLen && StrPtr[start+Count] != charset[j]; j++ )
+			{}
+		if( j == CharSetLen )
+			return Count;
+		}
+
+	return Count;
+	}
+/*============================================================================*/
+ssize_t s_strcspn( const s_string_t * restrict str, ssize_t start, const s_string_t * restrict charset, ssize_t csstart )
+	{
+	ssize_t		StrLen, CharSetLen;
+	ssize_t		Count, j;
+	const char	*StrPtr, *CharSetPtr;
+
+	STATS_CALL( s_strcspn );
+
+	if( str == NULL || charset == NULL )
+		return -1;
+
+	/* 'charset' is an empty string... */
+	if(( CharSetLen = s_strlen( charset )) == 0 )
 		return -1;
 
-	if(( SrcPtr = s_constcstr( src, 0 )) == NULL )
+	if( csstart < -CharSetLen || csstart >= CharSetLen )
 		return -1;
 
-	if( start > DstLen )
-		memset( &DstPtr[DstLen], filler, start - DstLen );
+	if( csstart < 0 )
+		csstart  += CharSetLen;
 
-	if( LeftFill > 0 )
-		{
-		memset( &DstPtr[start], filler, LeftFill );
-		start  += LeftFill;
-		}
+	CharSetLen -= csstart;
 
-	memcpy( &DstPtr[start], &SrcPtr[srcstart], Len - LeftFill - RightFill );
-	start  += Len - LeftFill - RightFill;
-
-	if( RightFill > 0 )
-		memset( &DstPtr[start], filler, RightFill );
-
-	return Len;
-#endif
+	/* 'str' is an empty string... */
+	if(( StrLen = s_strlen( str )) == 0 )
+		return -1;
+
+	if( start < -StrLen || start >= StrLen )
+		return -1;
+
+	if( start < 0 )
+		start  += StrLen;
+
+	StrPtr		= s_constcstr( str, 0 );
+	CharSetPtr	= s_constcstr( charset, csstart );
+
+	for( Count = 0; Count < StrLen; Count++ )
+		for( j = 0; j < CharSetLen; j++ )
+			if( StrPtr[start+Count] == CharSetPtr[j] )
+				return Count;
+
+	return Count;
 	}
 /*============================================================================*/
-ssize_t s_replace_se( s_string_t * restrict dst, ssize_t start, const s_string_t * restrict src, ssize_t srcstart, ssize_t srcend, int filler )
-	{
-	ssize_t	SrcLen, DstLen, DstMaxLen, Len, SrcStart;
-	char	*DstPtr;
-
-	if( dst == NULL || src == NULL )
+ssize_t s_strcspn_c( const s_string_t * restrict str, ssize_t start, const char * restrict charset )
+	{
+	ssize_t		StrLen, CharSetLen;
+	ssize_t		Count, j;
+	const char	*StrPtr;
+
+	STATS_CALL( s_strcspn_c );
+
+	if( str == NULL || charset == NULL )
+		return -1;
+
+	/* 'charset' is an empty string... */
+	if(( CharSetLen = strlen( charset )) == 0 )
 		return -1;
 
-	DstMaxLen = s_strmaxlen( dst );
+	/* 'str' is an empty string... */
+	if(( StrLen = s_strlen( str )) == 0 )
+		return -1;
+
+	if( start < -StrLen || start >= StrLen )
+		return -1;
+
+	if( start < 0 )
+		start  += StrLen;
+
+	StrPtr		= s_constcstr( str, 0 );
+
+	for( Count = 0; Count < StrLen; Count++ )
+		for( j = 0; j < CharSetLen; j++ )
+			if( StrPtr[start+Count] == charset[j] )
+				return Count;
+
+	return Count;
+	}
+/*============================================================================*/
+s_string_t *s_extract_me( const s_string_t * restrict src, ssize_t start, ssize_t end )
+	{
+	STATS_CALL( s_extract_me );
+
+	return s_extract_mea( src, start, end, NULL );
+	}
+/*============================================================================*/
+s_string_t *s_extract_mea( const s_string_t * restrict src, ssize_t start, ssize_t end, const s_allocator_t *alloc )
+	{
+	ssize_t	SrcLen;
+
+	STATS_CALL( s_extract_mea );
+
+	if( src == NULL )
+		return NULL;	/* Would it be better returning an empty s_string??? */
+
+	if(( SrcLen = s_strlen( src )) == 0 )
+		return NULL;
 
-	if( start >= DstMaxLen )
-		return -1;
+	if( start >= SrcLen )
+		return NULL;
+
+	if( start < -SrcLen )
+		start	= 0;
+	else if( start < 0 )
+		start  += SrcLen;
+
+	if( end >= SrcLen )
+		end		= SrcLen - 1;
+	else if( end < -SrcLen )
+		end		= 0;
+	else if( end < 0 )
+		end	   += SrcLen;
+
+	if( start > end )
+		return NULL;	/* Would it be better returning an empty s_string??? */
+
+	return s_strndup_ca( s_constcstr( src, start ), end - start + 1, alloc );
+	}
+/*============================================================================*/
+s_string_t *s_extract_mec( const char * restrict src, ssize_t start, ssize_t end )
+	{
+	STATS_CALL( s_extract_mec );
+
+	return s_extract_meca( src, start, end, NULL );
+	}
+/*============================================================================*/
+s_string_t *s_extract_meca( const char * restrict src, ssize_t start, ssize_t end, const s_allocator_t *alloc )
+	{
+	ssize_t	SrcLen;
+
+	STATS_CALL( s_extract_meca );
+
+	if( src == NULL )
+		return NULL;	/* Would it be better returning an empty s_string??? */
+
+	if(( SrcLen = strlen( src )) == 0 )
+		return NULL;
 
-	SrcLen = s_strlen( src );
+	if( start >= SrcLen )
+		return NULL;
+
+	if( start < -SrcLen )
+		start	= 0;
+	else if( start < 0 )
+		start  += SrcLen;
+
+	if( end >= SrcLen )
+		end		= SrcLen - 1;
+	else if( end < -SrcLen )
+		end		= 0;
+	else if( end < 0 )
+		end	   += SrcLen;
+
+	if( start > end )
+		return NULL;	/* Would it be better returning an empty s_string??? */
+
+	return s_strndup_ca( src + start, end - start + 1, alloc );
+	}
+/*============================================================================*/
+s_string_t *s_extract_ml( const s_string_t * restrict src, ssize_t start, ssize_t len )
+	{
+	STATS_CALL( s_extract_ml );
+
+	return s_extract_mla( src, start, len, NULL );
+	}
+/*============================================================================*/
+s_string_t *s_extract_mla( const s_string_t * restrict src, ssize_t start, ssize_t len, const s_allocator_t *alloc )
+	{
+	ssize_t	SrcLen;
+
+	STATS_CALL( s_extract_mla );
+
+	if( src == NULL || len <= 0 )
+		return NULL;	/* Would it be better returning an empty s_string??? */
+
+	if(( SrcLen = s_strlen( src )) == 0 )
+		return NULL;
+
+	if( start >= SrcLen )
+		return NULL;	/* Would it be better returning an empty s_string??? */
+	else if( start < -SrcLen )
+		start	= 0;
+	else if( start < 0 )
+		start  += SrcLen;
+
+	if( start + len > SrcLen )
+		len		= SrcLen - start;
+
+	return s_strndup_ca( s_constcstr( src, start ), len, alloc );
+	}
+/*============================================================================*/
+s_string_t *s_extract_mlc( const char * restrict src, ssize_t start, ssize_t len )
+	{
+	STATS_CALL( s_extract_mlc );
+
+	return s_extract_mlca( src, start, len, NULL );
+	}
+/*============================================================================*/
+s_string_t *s_extract_mlca( const char * restrict src, ssize_t start, ssize_t len, const s_allocator_t *alloc )
+	{
+	ssize_t	SrcLen;
+
+	STATS_CALL( s_extract_mlca );
+
+	if( src == NULL || len <= 0 )
+		return NULL;	/* Would it be better returning an empty s_string??? */
+
+	SrcLen		= strlen( src );
+
+	if( start < -SrcLen )
+		start	= 0;
+	else if( start < 0 )
+		start  += SrcLen;
+
+	if( start >= SrcLen )
+		return NULL;	/* Would it be better returning an empty s_string??? */
+
+	if( start + len > SrcLen )
+		len		= SrcLen - start;
+
+	return s_strndup_ca( src + start, len, alloc );
+	}
+/*============================================================================*/
+ssize_t s_extract_e( s_string_t * restrict dst, const s_string_t * restrict src, ssize_t start, ssize_t end )
+	{
+	ssize_t	SrcLen;
+
+	STATS_CALL( s_extract_e );
+
+	if( dst == NULL || dst->MustBeZero != 0 || !dst->Writable )
+		return -1;	/* Would it be better returning zero??? */
+
+	if( src == NULL || ( SrcLen = s_strlen( src )) == 0 || start >= SrcLen )
+		return s_strcpy_c( dst, "" );
 
-	if( srcend < -SrcLen )
-		return -1;
+	if( start < -SrcLen )
+		start	= 0;
+	else if( start < 0 )
+		start  += SrcLen;
 
-	SrcStart	= 0;
+	if( end > SrcLen )
+		end	= SrcLen - 1;
+	else if( end < -SrcLen )
+		end		= 0;
+	else if( end < 0 )
+		end	   += SrcLen;
+
+	if( start > end )
+		return s_strcpy_c( dst, "" );
+
+	return s_strlcpy_c( dst, s_constcstr( src, start ), end - start + 1 );
+	}
+/*============================================================================*/
+ssize_t s_extract_ec( s_string_t * restrict dst, const char * restrict src, ssize_t start, ssize_t end )
+	{
+	ssize_t	SrcLen;
+
+	STATS_CALL( s_extract_ec );
+
+	if( dst == NULL || dst->MustBeZero != 0 || !dst->Writable )
+		return -1;	/* Would it be better returning zero??? */
+
+	if( src == NULL || ( SrcLen = strlen( src )) == 0 || start >= SrcLen )
+		return s_strcpy_c( dst, "" );
 
-	DstLen = s_strlen( dst );
+	if( start < -SrcLen )
+		start	= 0;
+	else if( start < 0 )
+		start  += SrcLen;
+
+	if( end >= SrcLen )
+		end		= SrcLen - 1;
+	else if( end < -SrcLen )
+		end		= 0;
+	else if( end < 0 )
+		end	   += SrcLen;
+
+	if( start > end )
+		return s_strcpy_c( dst, "" );
+
+	return s_strlcpy_c( dst, src + start, end - start + 1 );
+	}
+/*============================================================================*/
+ssize_t s_extract_l( s_string_t * restrict dst, const s_string_t * restrict src, ssize_t start, ssize_t len )
+	{
+	ssize_t	SrcLen;
+
+	STATS_CALL( s_extract_l );
+
+	if( dst == NULL || dst->MustBeZero != 0 || !dst->Writable )
+		return -1;
 
-	if( start < -DstLen )
+	if( len <= 0 || src == NULL || ( SrcLen = s_strlen( src )) == 0 || start >= SrcLen )
+		return s_strcpy_c( dst, "" );	/* Would it be better returning zero??? */
+
+	if( start < -SrcLen )
+		start	= 0;
+	else if( start < 0 )
+		start  += SrcLen;
+
+	if( start + len > SrcLen )
+		len		= SrcLen - start;
+
+	return s_strlcpy( dst, src, start, len );
+	}
+/*============================================================================*/
+ssize_t s_extract_lc( s_string_t * restrict dst, const char * restrict src, ssize_t start, ssize_t len )
+	{
+	ssize_t	SrcLen;
+
+	STATS_CALL( s_extract_lc );
+
+	if( dst == NULL || dst->MustBeZero != 0 || !dst->Writable )
+		return -1;	/* Would it be better returning zero??? */
+
+	if( len <= 0 || src == NULL || ( SrcLen = strlen( src )) == 0 || start >= SrcLen )
+		return s_strcpy_c( dst, "" );
+
+	if( start < -SrcLen )
+		start	= 0;
+	else if( start < 0 )
+		start  += SrcLen;
+
+	if( start + len > SrcLen )
+		len		= SrcLen - start;
+
+	return s_strlcpy_c( dst, src, len );
+	}
+/*============================================================================*/
+ssize_t s_fill_l( s_string_t * restrict dst, ssize_t start, ssize_t len, int filler )
+	{
+	}
+/*============================================================================*/
+ssize_t s_fill_ls( s_string_t * restrict dst, ssize_t start, ssize_t len, const s_string_t * restrict src, ssize_t srcstart )
+	{
+	}
+/*============================================================================*/
+ssize_t s_fill_lc( s_string_t * restrict dst, ssize_t start, ssize_t len, const char		  * restrict src )
+	{
+	}
+/*=========================================================================*//**
+s_replace_de tested OK!
+*//*==========================================================================*/
+ssize_t s_replace_de( s_string_t * restrict dst, ssize_t start, ssize_t end, const s_string_t * restrict src, ssize_t srcstart, int filler )
+	{
+	ssize_t		SrcLen, DstLen, DstMaxLen, Len, TransfLen;
+	ssize_t 	LeftFill	= 0, RightFill	= 0;
+	char		*DstPtr;
+	const char	*SrcPtr;
+
+	STATS_CALL( s_replace_de );
+
+	if( dst == NULL || dst->MustBeZero != 0 || dst->Writable == 0 || src == NULL || src->MustBeZero != 0 )
+		return -1;
+
+	DstMaxLen	= s_strmaxlen( dst );
+
+	if( start >= DstMaxLen )
+		return 0;
+
+	DstLen		= s_strlen( dst );
+
+	if( end < -DstLen )
+		return 0;
+
+	if( end < 0 )
+		end	   += DstLen;
+	else if( end >= DstMaxLen )
+		end		= DstMaxLen - 1;
+
+	if( start < 0 )
+		start  += DstLen;
+
+	if( end < start )
+		return -1;
+
+	SrcLen		= s_strlen( src );
+
+	if( srcstart < 0 )
+		srcstart   += SrcLen;
+
+	Len			= end - start + 1;
+
+	if( start < 0 )
 		{
-		SrcStart= -( start + DstLen );
-		start	= 0;
+		Len			= end - 0 + 1;
+		srcstart   -= start;
+		start		= 0;
 		}
-	else if( start < 0 )
-		start  += DstLen;
 
-	if( srcend >= DstMaxLen )
-		srcend		= DstMaxLen - 1;
-	else if( srcend < 0 )
-		srcend	   += DstLen;
+	TransfLen		= Len;
 
-	if( srcstart > srcend || SrcStart >= SrcLen )
+	if( srcstart < -Len || srcstart >= SrcLen )
+		{
+		if( filler != '\0' )
+			LeftFill	= Len;
+		srcstart	= SrcLen;
+		TransfLen	= 0;
+		}
+	else if( srcstart < 0 )
+		{
+		if( filler != '\0' )
+			LeftFill	= -srcstart;
+		else
+			{
+			start	   -= srcstart;
+			Len		   += srcstart;
+			}
+		TransfLen  += srcstart;
+		srcstart	= 0;
+		}
+
+	if( Len - LeftFill > SrcLen - srcstart )
+		{
+		TransfLen	= SrcLen - srcstart;
+		if( filler != '\0' )
+			RightFill	= Len - LeftFill - TransfLen;
+		else
+			Len		    = LeftFill + TransfLen;;
+		}
+
+	/* There are one or more gaps to fill, but the filler is zero... */
+	if( filler == 0 && ( LeftFill > 0 || RightFill > 0 || start > DstLen ))
+		/* ...the operation is not possible. */
 		return -1;
 
-	Len			= ssmin( srcend - start + 1, SrcLen - SrcStart );
-	DstPtr		= s_cstr( dst );
+	if(( DstPtr = s_cstr( dst )) == NULL )
+		return -1;
+
+	if(( SrcPtr = s_constcstr( src, 0 )) == NULL )
+		return -1;
+
+	/* There s a gap between the current end of the string and the start position... */
+	if( start > DstLen )
+		/* ...let's fill the gap with the 'filler'. */
+		memset( &DstPtr[DstLen], filler, start - DstLen );
+
+	/* There is a gap on the left of the destination... */
+	if( LeftFill > 0 )
+		/* ...let's fill the gap with the 'filler'. */
+		memset( &DstPtr[start], filler, LeftFill );
+
+	if( TransfLen > 0 )
+		memcpy( &DstPtr[start+LeftFill], &SrcPtr[srcstart], TransfLen );
 
+	if( RightFill > 0 )
+		memset( &DstPtr[start+LeftFill+TransfLen], filler, RightFill );
+
+	/* Let's calculate how many characters were changed in the destination. */
+	LeftFill		= 0;
 	if( start > DstLen )
+		LeftFill	= start - DstLen;
+
+	if( start + Len > DstLen )
+		DstLen		= start + Len;
+
+	DstPtr[DstLen]	= '\0';
+
+	SetUsedLen( dst, DstLen );
+
+	return Len + LeftFill;
+
+#if 0
+	if( end >= DstMaxLen )
+		end		= DstMaxLen - 1;
+	else if( end < 0 )
+		end	   += DstLen;
+
+	if( start < 0 )
+		start  += DstLen;
+
+	if( end < start )
+		return -1;
+
+	SrcLen		= s_strlen( src );
+
+	if( srcstart < 0 )
+		srcstart   += SrcLen;
+
+	Len	= end - start + 1;
+
+	if( start < 0 )
 		{
-		if( filler == 0 )
-			return -1;
-		else
-			memset( DstPtr, filler, start - DstLen );
+		Len			= end - 0 + 1;
+		srcstart   -= start;
+		start		= 0;
 		}
 
-	memcpy( DstPtr + start, s_constcstr( src, SrcStart ), Len );
+	if( srcstart < 0 )
+		{
+		LeftFill	= ssmin( LeftFill - srcstart, Len );
+		srcstart	= 0;
+		}
 
-	if( start + Len > DstLen )
+	if( srcstart > SrcLen )
+		srcstart	= SrcLen;
+
+	if( srcstart + Len >= SrcLen )
+		RightFill	= SrcLen - srcstart;
+
+	/* There are one or more gaps to fill, but the filler is zero... */
+	if( filler == 0 && ( LeftFill > 0 || RightFill > 0 || start > DstLen ))
+		/* ...the operation is not possible. */
+		return -1;
+
+	if(( DstPtr = s_cstr( dst )) == NULL )
+		return -1;
+
+	if(( SrcPtr = s_constcstr( src, 0 )) == NULL )
+		return -1;
+
+	if( start > DstLen )
+		memset( &DstPtr[DstLen], filler, start - DstLen );
+
+	if( LeftFill > 0 )
 		{
-		*DstPtr	= '\0';
-		SetUsedLen( dst, start + Len );
+		memset( &DstPtr[start], filler, LeftFill );
+		start  += LeftFill;
 		}
 
-	return Len;
-	}
-/*============================================================================*/
-ssize_t s_replace_ec( s_string_t * restrict dst, ssize_t start, ssize_t end, const char * restrict src, int filler )
+	memcpy( &DstPtr[start], &SrcPtr[srcstart], Len - LeftFill - RightFill );
+	start  += Len - LeftFill - RightFill;
+
+	if( RightFill > 0 )
+		memset( &DstPtr[start], filler, RightFill );
+
+	return Len;
+#endif
+	}
+/*============================================================================*/
+ssize_t s_replace_se( s_string_t * restrict dst, ssize_t start, const s_string_t * restrict src, ssize_t srcstart, ssize_t srcend, int filler )
+	{
+	ssize_t	SrcLen, DstLen, DstMaxLen, Len, SrcStart;
+	char	*DstPtr;
+
+	STATS_CALL( s_replace_se );
+
+	if( dst == NULL || dst->MustBeZero != 0 || dst->Writable == 0 || src == NULL )
+		return -1;
+
+	DstMaxLen = s_strmaxlen( dst );
+
+	if( start >= DstMaxLen )
+		return -1;
+
+	SrcLen = s_strlen( src );
+
+	if( srcend < -SrcLen )
+		return -1;
+
+	SrcStart	= 0;
+
+	DstLen = s_strlen( dst );
+
+	if( start < -DstLen )
+		{
+		SrcStart= -( start + DstLen );
+		start	= 0;
+		}
+	else if( start < 0 )
+		start  += DstLen;
+
+	if( srcend >= DstMaxLen )
+		srcend		= DstMaxLen - 1;
+	else if( srcend < 0 )
+		srcend	   += DstLen;
+
+	if( srcstart > srcend || SrcStart >= SrcLen )
+		return -1;
+
+	Len			= ssmin( srcend - start + 1, SrcLen - SrcStart );
+	DstPtr		= s_cstr( dst );
+
+	if( start > DstLen )
+		{
+		if( filler == 0 )
+			return -1;
+		else
+			memset( DstPtr, filler, start - DstLen );
+		}
+
+	memcpy( DstPtr + start, s_constcstr( src, SrcStart ), Len );
+
+	if( start + Len > DstLen )
+		{
+		*DstPtr	= '\0';
+		SetUsedLen( dst, start + Len );
+		}
+
+	return Len;
+	}
+/*============================================================================*/
+ssize_t s_replace_ec( s_string_t * restrict dst, ssize_t start, ssize_t end, const char * restrict src, int filler )
+	{
+	ssize_t	SrcLen, DstLen, DstMaxLen, Len, SrcStart;
+	char	*DstPtr;
+
+	STATS_CALL( s_replace_ec );
+
+	if( dst == NULL || dst->MustBeZero != 0 || dst->Writable == 0 || src == NULL )
+		return -1;
+
+	if( start >= ( DstMaxLen = s_strmaxlen( dst )))
+		return -1;
+
+	if( end < -( DstLen = s_strlen( dst )))
+		return -1;
+
+	SrcStart	= 0;
+
+	if( start < -DstLen )
+		{
+		SrcStart= -( start + DstLen );
+		start	= 0;
+		}
+	else if( start < 0 )
+		start  += DstLen;
+
+	if( end >= DstMaxLen )
+		end		= DstMaxLen - 1;
+	else if( end < 0 )
+		end	   += DstLen;
+
+	SrcLen = strlen( src );
+
+	if( start > end || SrcStart >= SrcLen )
+		return -1;
+
+	Len			= ssmin( end - start + 1, SrcLen - SrcStart );
+
+	DstPtr		= s_cstr( dst );
+
+	if( start > DstLen )
+		{
+		if( filler == 0 )
+			return -1;
+		else
+			memset( DstPtr, filler, start - DstLen );
+		}
+
+	memcpy( DstPtr + start, src + SrcStart, Len );
+
+	if( start + Len > DstLen )
+		{
+		*DstPtr	= '\0';
+		SetUsedLen( dst, start + Len );
+		}
+
+	return Len;
+	}
+/*============================================================================*/
+ssize_t s_replace_l( s_string_t * restrict dst, ssize_t start, ssize_t len, const s_string_t * restrict src, ssize_t srcstart, int filler )
+	{
+	ssize_t	SrcLen, DstLen, DstMaxLen, SrcStart;
+	char	*DstPtr;
+
+	STATS_CALL( s_replace_l );
+
+	if( dst == NULL || dst->MustBeZero != 0 || dst->Writable == 0 || src == NULL )
+		return -1;
+
+	if( len < 0 )
+		return 0;
+
+	if( start >= ( DstMaxLen = s_strmaxlen( dst )))
+		return 0;
+
+	if( start + len > DstMaxLen )
+		len		= DstMaxLen - start;
+
+	DstLen		= s_strlen( dst );
+
+	SrcStart	= 0;
+
+	if( start < -DstLen )
+		{
+		SrcStart= -( start + DstLen );
+		start	= 0;
+		}
+	else if( start < 0 )
+		start  += DstLen;
+
+	SrcLen = s_strlen( src );
+
+	if( SrcStart >= SrcLen )
+		return 0;
+
+	len			= ssmin( len, SrcLen - SrcStart );
+	DstPtr		= s_cstr( dst );
+
+	if( start > DstLen )
+		{
+		if( filler == 0 )
+			return -1;
+		else
+			memset( DstPtr, filler, start - DstLen );
+		}
+
+	memcpy( DstPtr + start, s_constcstr( src, SrcStart ), len );
+
+	if( start + len > DstLen )
+		{
+		*DstPtr	= '\0';
+		SetUsedLen( dst, start + len );
+		}
+
+	return len;
+	}
+/*============================================================================*/
+ssize_t s_replace_lc( s_string_t * restrict dst, ssize_t start, ssize_t len, const char * restrict src, int filler )
+	{
+	ssize_t	SrcLen, DstLen, DstMaxLen, SrcStart;
+	char	*DstPtr;
+
+	STATS_CALL( s_replace_lc );
+
+	if( dst == NULL || dst->MustBeZero != 0 || dst->Writable == 0 || src == NULL )
+		return -1;
+
+	if( len < 0 )
+		return 0;
+
+	if( start >= ( DstMaxLen = s_strmaxlen( dst )))
+		return 0;
+
+	if( start + len > DstMaxLen )
+		len		= DstMaxLen - start;
+
+	DstLen		= s_strlen( dst );
+
+	SrcStart	= 0;
+
+	if( start < -DstLen )
+		{
+		SrcStart= -( start + DstLen );
+		start	= 0;
+		}
+	else if( start < 0 )
+		start  += DstLen;
+
+	SrcLen = strlen( src );
+
+	if( SrcStart >= SrcLen )
+		return 0;
+
+	len			= ssmin( len, SrcLen - SrcStart );
+	DstPtr		= s_cstr( dst );
+
+	if( start > DstLen )
+		{
+		if( filler == 0 )
+			return -1;
+		else
+			memset( DstPtr, filler, start - DstLen );
+		}
+
+	memcpy( DstPtr + start, src + SrcStart, len );
+
+	if( start + len > DstLen )
+		{
+		*DstPtr	= '\0';
+		SetUsedLen( dst, start + len );
+		}
+
+	return len;
+	}
+/*============================================================================*/
+ssize_t s_strlwr( s_string_t * restrict str, ssize_t start )
+	{
+	char	*Ptr;
+	ssize_t	UsedLen;
+	ssize_t	Index, Count;
+
+	if( str == NULL || str->MustBeZero != 0 || str->Writable == 0 )
+		return -1;
+
+	UsedLen	= s_strlen( str );
+
+	if( UsedLen == 0 )
+		return 0;
+
+	if(( Ptr = s_cstr( str )) == NULL )
+		return -1;
+
+	for( Count = 0, Index = 0; Index < UsedLen; Index++ )
+		if( isupper( Ptr[Index] ))
+			{
+			Count++;
+			Ptr[Index]	= tolower( Ptr[Index] );
+			}
+
+	return Count;
+	}
+/*============================================================================*/
+ssize_t s_strupr( s_string_t * restrict str, ssize_t start )
+	{
+	char	*Ptr;
+	ssize_t	UsedLen;
+	ssize_t	Index, Count;
+
+	if( str == NULL || str->MustBeZero != 0 || str->Writable == 0 )
+		return -1;
+
+	UsedLen	= s_strlen( str );
+
+	if( UsedLen == 0 )
+		return 0;
+
+	if(( Ptr = s_cstr( str )) == NULL )
+		return -1;
+
+	for( Count = 0, Index = 0; Index < UsedLen; Index++ )
+		if( islower( Ptr[Index] ))
+			{
+			Count++;
+			Ptr[Index]	= toupper( Ptr[Index] );
+			}
+
+	return Count;
+	}
+/*============================================================================*/
+ssize_t s_ltrim( s_string_t * restrict str, ssize_t start )
+	{
+	return 0;
+	}
+/*============================================================================*/
+ssize_t s_rtrim( s_string_t * restrict str, ssize_t start )
+	{
+	return 0;
+	}
+/*============================================================================*/
+/*TODO*/
+ssize_t s_insert_l( s_string_t * restrict dst, ssize_t dststart, const s_string_t * restrict src, ssize_t srcstart, ssize_t len, int filler )
+	{
+	ssize_t	SrcLen, DstLen, DstMaxLen;
+	ssize_t	Offset;
+	char	*DstPtr;
+
+	STATS_CALL( s_insert_l );
+
+	if( dst == NULL || dst->MustBeZero != 0 || dst->Writable == 0 || src == NULL )
+		return -1;
+
+	if( len < 0 )
+		return 0;
+
+	if( dststart >= ( DstMaxLen = s_strmaxlen( dst )))
+		return 0;
+
+	if( srcstart >= ( SrcLen = s_strlen( src )))
+		return 0;
+
+	if( dststart + len > DstMaxLen )
+		len			= DstMaxLen - dststart;
+
+	if( srcstart + len > SrcLen )
+		len			= SrcLen - srcstart;
+
+	DstLen			= s_strlen( dst );
+
+	Offset	= ssmin( dststart + DstLen, srcstart + SrcLen );
+	if( Offset < 0 )
+		len		   += Offset;
+
+	if( dststart < -DstLen )
+		dststart	= Offset -( dststart + DstLen );
+	else if( dststart < 0 )
+		dststart   += DstLen;
+
+	if( srcstart < -SrcLen )
+		{
+		dststart   += -( srcstart + SrcLen );
+		srcstart	= 0;
+		}
+	else if( srcstart < 0 )
+		srcstart   += SrcLen;
+
+	if( srcstart >= SrcLen || dststart >= DstLen )
+		return 0;
+
+	len				= ssmin( len, SrcLen - srcstart );
+	DstPtr			= s_cstr( dst );
+
+	if( dststart > DstLen )
+		{
+		if( filler == 0 )
+			return -1;
+		else
+			memset( DstPtr, filler, dststart - DstLen );
+		}
+
+	memcpy( DstPtr + dststart, s_constcstr( src, srcstart ), len );
+
+	if( dststart + len > DstLen )
+		{
+		*DstPtr	= '\0';
+		SetUsedLen( dst, dststart + len );
+		}
+
+	return len;
+	}
+/*============================================================================*/
+ssize_t s_extins_lc( s_string_t * restrict dst, ssize_t dststart, const char * restrict src, ssize_t srcstart, ssize_t len, int filler );
+/*============================================================================*/
+/* All the pairs of decimal digits from "00" to "99", used to convert integers
+   to text two digits at a time. */
+static const char DigitPairs[201] =
+	"00010203040506070809" "10111213141516171819" "20212223242526272829" "30313233343536373839" "40414243444546474849"
+	"50515253545556575859" "60616263646566676869" "70717273747576777879" "80818283848586878889" "90919293949596979899";
+
+static const char HexDigitsLower[]	= "0123456789abcdef";
+static const char HexDigitsUpper[]	= "0123456789ABCDEF";
+/*============================================================================*/
+/* Returns the number of decimal digits needed to represent 'Value'. */
+static int DecimalDigits( uint64_t Value )
+	{
+	static const uint64_t	PowersOf10[20]	=
+		{
+		1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull,
+		10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull,
+		1000000000000000ull, 10000000000000000ull, 100000000000000000ull, 1000000000000000000ull,
+		10000000000000000000ull
+		};
+	int	Digits;
+
+	/* log10( 2 ) ~= 1233 / 4096, this estimate is either exact or one too small. */
+	Digits	= (( 64 - __builtin_clzll( Value | 1 )) * 1233 ) >> 12;
+
+	return Digits + (( Value | 1 ) >= PowersOf10[Digits] );
+	}
+/*============================================================================*/
+/* Writes the 'NumDigits' decimal digits of 'Value' at 'Dst', two at a time,
+   from the least significant to the most significant. */
+static void WriteDecimal( char * restrict Dst, uint64_t Value, int NumDigits )
+	{
+	char	*p	= Dst + NumDigits;
+
+	while( Value >= 100 )
+		{
+		const char	*Pair	= &DigitPairs[( Value % 100 ) * 2];
+
+		Value  /= 100;
+		*--p	= Pair[1];
+		*--p	= Pair[0];
+		}
+
+	if( Value >= 10 )
+		{
+		*--p	= DigitPairs[Value * 2 + 1];
+		*--p	= DigitPairs[Value * 2];
+		}
+	else
+		*--p	= (char)( '0' + Value );
+	}
+/*============================================================================*/
+/* Returns the number of hexadecimal digits needed to represent 'Value'. */
+static int HexDigits( uint64_t Value )
+	{
+	return ( 64 - __builtin_clzll( Value | 1 ) + 3 ) >> 2;
+	}
+/*============================================================================*/
+static void WriteHex( char * restrict Dst, uint64_t Value, int NumDigits, const char * restrict Digits )
+	{
+	char	*p	= Dst + NumDigits;
+
+	do
+		{
+		*--p	= Digits[Value & 0x0f];
+		Value >>= 4;
+		}
+	while( p > Dst );
+	}
+/*============================================================================*/
+/* Tables for the shortest round-trip conversion of doubles to text (the Ryu
+   algorithm, by Ulf Adams). 'Pow5InvSplit[q]' holds the 125 most significant
+   bits of 2^k / 5^q rounded up and 'Pow5Split[i]' holds the 125 most
+   significant bits of 5^i, both as { low 64 bits, high 64 bits }. */
+static const uint64_t Pow5InvSplit[342][2] =
+	{
+	{ 0x0000000000000001u, 0x2000000000000000u }, { 0x999999999999999au, 0x1999999999999999u },
+	{ 0x47ae147ae147ae15u, 0x147ae147ae147ae1u }, { 0x6c8b4395810624deu, 0x10624dd2f1a9fbe7u },
+	{ 0x7a786c226809d496u, 0x1a36e2eb1c432ca5u }, { 0x61f9f01b866e43abu, 0x14f8b588e368f084u },
+	{ 0xb4c7f34938583622u, 0x10c6f7a0b5ed8d36u }, { 0x87a6520ec08d236au, 0x1ad7f29abcaf4857u },
+	{ 0x9fb841a566d74f88u, 0x15798ee2308c39dfu }, { 0xe62d01511f12a607u, 0x112e0be826d694b2u },
+	{ 0xd6ae6881cb5109a4u, 0x1b7cdfd9d7bdbab7u }, { 0xdef1ed34a2a73aeau, 0x15fd7fe17964955fu },
+	{ 0x7f27f0f6e885c8bbu, 0x119799812dea1119u }, { 0x650cb4be40d60df8u, 0x1c25c268497681c2u },
+	{ 0xea70909833de7193u, 0x16849b86a12b9b01u }, { 0x21f3a6e0297ec143u, 0x1203af9ee756159bu },
+	{ 0x6985d7cd0f313537u, 0x1cd2b297d889bc2bu }, { 0x2137dfd73f5a90f9u, 0x170ef54646d49689u },
+	{ 0xe75fe645cc4873fau, 0x12725dd1d243aba0u }, { 0xa5663d3c7a0d865du, 0x1d83c94fb6d2ac34u },
+	{ 0x511e976394d79eb1u, 0x179ca10c9242235du }, { 0xda7edf82dd794bc1u, 0x12e3b40a0e9b4f7du },
+	{ 0x2a6498d1625bac68u, 0x1e392010175ee596u }, { 0xeeb6e0a781e2f053u, 0x182db34012b25144u },
+	{ 0x58924d52ce4f26a9u, 0x1357c299a88ea76au }, { 0x27507bb7b07ea441u, 0x1ef2d0f5da7dd8aau },
+	{ 0x52a6c95fc0655034u, 0x18c240c4aecb13bbu }, { 0x0eebd44c99eaa690u, 0x13ce9a36f23c0fc9u },
+	{ 0xb17953adc3110a80u, 0x1fb0f6be50601941u }, { 0xc12ddc8b02740867u, 0x195a5efea6b34767u },
+	{ 0x3424b06f3529a052u, 0x14484bfeebc29f86u }, { 0x901d59f290ee19dbu, 0x1039d66589687f9eu },
+	{ 0x4cfbc31db4b0295fu, 0x19f623d5a8a73297u }, { 0x3d9635b15d59bab2u, 0x14c4e977ba1f5bacu },
+	{ 0x97ab5e277de16228u, 0x109d8792fb4c4956u }, { 0xf2abc9d8c9689d0du, 0x1a95a5b7f87a0ef0u },
+	{ 0x5bbca17a3aba173eu, 0x154484932d2e725au }, { 0xafca1ac82efb45cbu, 0x11039d428a8b8eaeu },
+	{ 0xb2dcf7a6b1920945u, 0x1b38fb9daa78e44au }, { 0xf57d92ebc141a104u, 0x15c72fb1552d836eu },
+	{ 0xc46475896767b403u, 0x116c262777579c58u }, { 0x6d6d88dbd8a5ecd2u, 0x1be03d0bf225c6f4u },
+	{ 0x8abe071646eb23dbu, 0x164cfda3281e38c3u }, { 0x6efe6c11d255b649u, 0x11d7314f534b609cu },
+	{ 0xb197134fb6ef8a0eu, 0x1c8b821885456760u }, { 0x27ac0f72f8bfa1a5u, 0x16d601ad376ab91au },
+	{ 0xb95672c260994e1eu, 0x1244ce242c5560e1u }, { 0xf5571e03cdc21695u, 0x1d3ae36d13bbce35u },
+	{ 0x2aac18030b01ababu, 0x17624f8a762fd82bu }, { 0xbbbce0026f348956u, 0x12b50c6ec4f31355u },
+	{ 0x92c7ccd0b1eda889u, 0x1dee7a4ad4b81eefu }, { 0xdbd30a408e57ba07u, 0x17f1fb6f10934bf2u },
+	{ 0x7ca8d50071dfc806u, 0x1327fc58da0f6ff5u }, { 0xfaa7bb33e9660cd6u, 0x1ea6608e29b24cbbu },
+	{ 0x9552fc298784d711u, 0x18851a0b548ea3c9u }, { 0xaaa8c9bad2d0ac0eu, 0x139dae6f76d88307u },
+	{ 0xdddadc5e1e1aace3u, 0x1f62b0b257c0d1a5u }, { 0x7e48b04b4b488a4fu, 0x191bc08eac9a4151u },
+	{ 0xcb6d59d5d5d3a1d9u, 0x141633a556e1cddau }, { 0x3c577b1177dc817bu, 0x1011c2eaabe7d7e2u },
+	{ 0xc6f25e825960cf2au, 0x19b604aaaca62636u }, { 0x6bf518684780a5bbu, 0x14919d5556eb51c5u },
+	{ 0x232a79ed06008496u, 0x10747ddddf22a7d1u }, { 0xd1dd8fe1a3340756u, 0x1a53fc9631d10c81u },
+	{ 0xa7e4731ae8f66c45u, 0x150ffd44f4a73d34u }, { 0x531d28e253f8569eu, 0x10d9976a5d52975du },
+	{ 0xeb61db03b98d5762u, 0x1af5bf109550f22eu }, { 0xbc4e48cfc7a445e8u, 0x159165a6ddda5b58u },
+	{ 0x6371d3d96c836b20u, 0x11411e1f17e1e2adu }, { 0x9f1c8628ad9f11cdu, 0x1b9b6364f3030448u },
+	{ 0xe5b06b53be18db0bu, 0x1615e91d8f359d06u }, { 0xeaf3890fcb4715a2u, 0x11ab20e472914a6bu },
+	{ 0x44b8db4c7871bc37u, 0x1c45016d841baa46u }, { 0x03c715d6c6c1635fu, 0x169d9abe03495505u },
+	{ 0x3638de456bcde919u, 0x1217aefe69077737u }, { 0x56c163a2461641c1u, 0x1cf2b1970e725858u },
+	{ 0xdf011c81d1ab67ceu, 0x17288e1271f51379u }, { 0x7f3416ce4155eca5u, 0x1286d80ec190dc61u },
+	{ 0x6520247d3556476eu, 0x1da48ce468e7c702u }, { 0xea801d30f7783925u, 0x17b6d71d20b96c01u },
+	{ 0xbb99b0f3f92cfa84u, 0x12f8ac174d612334u }, { 0x5f5c4e532847f739u, 0x1e5aacf215683854u },
+	{ 0x7f7d0b75b9d32c2eu, 0x18488a5b44536043u }, { 0x9930d5f7c7dc2358u, 0x136d3b7c36a919cfu },
+	{ 0x8eb4898c72f9d226u, 0x1f152bf9f10e8fb2u }, { 0x722a07a38f2e41b8u, 0x18ddbcc7f40ba628u },
+	{ 0xc1bb394fa5be9afau, 0x13e497065cd61e86u }, { 0x9c5ec2190930f7f6u, 0x1fd424d6faf030d7u },
+	{ 0x49e56814075a5ff8u, 0x197683df2f268d79u }, { 0x6e51201005e1e660u, 0x145ecfe5bf520ac7u },
+	{ 0xf1da800cd181851au, 0x104bd984990e6f05u }, { 0x4fc400148268d4f5u, 0x1a12f5a0f4e3e4d6u },
+	{ 0xd96999aa01ed772bu, 0x14dbf7b3f71cb711u }, { 0xadee1488018ac5bcu, 0x10aff95cc5b09274u },
+	{ 0x497ceda668de092cu, 0x1ab328946f80ea54u }, { 0x3aca57b853e4d424u, 0x155c2076bf9a5510u },
+	{ 0x623b7960431d7683u, 0x1116805effaeaa73u }, { 0x9d2bf566d1c8bd9eu, 0x1b5733cb32b110b8u },
+	{ 0x7dbcc452416d647fu, 0x15df5ca28ef40d60u }, { 0xcafd69db678ab6ccu, 0x117f7d4ed8c33de6u },
+	{ 0xab2f0fc572778adfu, 0x1bff2ee48e052fd7u }, { 0x88f273045b92d580u, 0x1665bf1d3e6a8cacu },
+	{ 0xd3f528d049424466u, 0x11eaff4a98553d56u }, { 0xb988414d4203a0a3u, 0x1cab3210f3bb9557u },
+	{ 0x6139cdd76802e6e9u, 0x16ef5b40c2fc7779u }, { 0xe761717920025254u, 0x125915cd68c9f92du },
+	{ 0xa568b58e999d5086u, 0x1d5b561574765b7cu }, { 0x5120913ee14aa6d2u, 0x177c44ddf6c515fdu },
+	{ 0xa74d40ff1aa21f0eu, 0x12c9d0b1923744cau }, { 0x0baece64f769cb4au, 0x1e0fb44f50586e11u },
+	{ 0x3c8bd850c5ee3c3bu, 0x180c903f7379f1a7u }, { 0xca0979da37f1c9c9u, 0x133d4032c2c7f485u },
+	{ 0xa9a8c2f6bfe942dbu, 0x1ec866b79e0cba6fu }, { 0x2153cf2bccba9be3u, 0x18a0522c7e709526u },
+	{ 0x1aa9728970954982u, 0x13b374f06526ddb8u }, { 0xf775840f1a88759du, 0x1f8587e7083e2f8cu },
+	{ 0x5f9136727ba05e17u, 0x19379fec0698260au }, { 0x1940f85b9619e4dfu, 0x142c7ff0054684d5u },
+	{ 0xe100c6afab47ea4cu, 0x1023998cd1053710u }, { 0xce67a44c453fdd47u, 0x19d28f47b4d524e7u },
+	{ 0xd852e9d69dccb106u, 0x14a8729fc3ddb71fu }, { 0x79dbee454b0a2738u, 0x1086c219697e2c19u },
+	{ 0x295fe3a211a9d859u, 0x1a71368f0f30468fu }, { 0xbab31c81a7bb137au, 0x15275ed8d8f36ba5u },
+	{ 0x6228e39aec95a92fu, 0x10ec4be0ad8f8951u }, { 0x9d0e38f7e0ef7517u, 0x1b13ac9aaf4c0ee8u },
+	{ 0xb0d82d931a592a79u, 0x15a956e225d67253u }, { 0x8d79be0f4847552eu, 0x11544581b7dec1dcu },
+	{ 0x158f967eda0bbb7cu, 0x1bba08cf8c979c94u }, { 0x77a611ff14d62f97u, 0x162e6d72d6dfb076u },
+	{ 0xf951a7ff43de8c79u, 0x11bebdf578b2f391u }, { 0xc21c3ffed2fdad8eu, 0x1c6463225ab7ec1cu },
+	{ 0x01b0333242648ad8u, 0x16b6b5b5155ff017u }, { 0x0159c28e9b83a246u, 0x122bc490dde659acu },
+	{ 0xcef604175f3903a3u, 0x1d12d41afca3c2acu }, { 0x725e69ac4c2d9c83u, 0x17424348ca1c9bbdu },
+	{ 0xf5185489d68ae39cu, 0x129b69070816e2fdu }, { 0xee8d540fbdab05c6u, 0x1dc574d80cf16b2fu },
+	{ 0xbed77672fe226b05u, 0x17d12a4670c1228cu }, { 0xff12c528cb4ebc04u, 0x130dbb6b8d674ed6u },
+	{ 0xcb513b74787df9a0u, 0x1e7c5f127bd87e24u }, { 0x090dc929f9fe614du, 0x18637f41fcad31b7u },
+	{ 0xa0d7d42194cb810au, 0x1382cc34ca2427c5u }, { 0x67bfb9cf5478ce77u, 0x1f37ad21436d0c6fu },
+	{ 0x1fcc94a5dd2d71f9u, 0x18f9574dcf8a7059u }, { 0x7fd6dd517dbdf4c7u, 0x13faac3e3fa1f37au },
+	{ 0xffbe2ee8c92fee0bu, 0x1ff779fd329cb8c3u }, { 0x6631bf20a0f324d6u, 0x1992c7fdc216fa36u },
+	{ 0xb827cc1a1a5c1d78u, 0x14756ccb01abfb5eu }, { 0x935309ae7b7ce460u, 0x105df0a267bcc918u },
+	{ 0x1eeb42b0c594a099u, 0x1a2fe76a3f9474f4u }, { 0xe58902270476e6e1u, 0x14f31f8832dd2a5cu },
+	{ 0xb7a0ce859d2bebe7u, 0x10c27fa028b0eeb0u }, { 0x59014a6f61dfdfd8u, 0x1ad0cc33744e4ab4u },
+	{ 0xe0cdd525e7e64cadu, 0x1573d68f903ea229u }, { 0x4d7177518651d6f1u, 0x11297872d9cbb4eeu },
+	{ 0x7be8bee8d6e957e8u, 0x1b758d848fac54b0u }, { 0xfcba3253df211320u, 0x15f7a46a0c89dd59u },
+	{ 0x63c8284318e74280u, 0x1192e9ee706e4aaeu }, { 0x060d0d3827d86a66u, 0x1c1e43171a4a1117u },
+	{ 0x6b3da42cecad21ebu, 0x167e9c127b6e7412u }, { 0x88fe1cf0bd574e56u, 0x11fee341fc585cdbu },
+	{ 0x419694b462254a23u, 0x1ccb0536608d615fu }, { 0x67abaa29e81dd4e9u, 0x1708d0f84d3de77fu },
+	{ 0xb95621bb2017dd87u, 0x126d73f9d764b932u }, { 0xc223692b668c95a5u, 0x1d7becc2f23ac1eau },
+	{ 0xce82ba891ed6de1du, 0x179657025b6234bbu }, { 0xa53562074bdf1818u, 0x12deac01e2b4f6fcu },
+	{ 0x3b889cd87964f359u, 0x1e3113363787f194u }, { 0xfc6d4a46c783f5e1u, 0x18274291c6065adcu },
+	{ 0x30576e9f06032b1au, 0x13529ba7d19eaf17u }, { 0x1a257dcb3cd1de90u, 0x1eea92a61c311825u },
+	{ 0x481dfe3c30a7e540u, 0x18bba884e35a79b7u }, { 0xd34b31c9c0865100u, 0x13c9539d82aec7c5u },
+	{ 0x5211e942cda3b4cdu, 0x1fa885c8d117a609u }, { 0x74db21023e1c90a4u, 0x19539e3a40dfb807u },
+	{ 0xf715b401cb4a0d50u, 0x1442e4fb67196005u }, { 0xf8de299b09080aa7u, 0x103583fc527ab337u },
+	{ 0x8e304291a80cddd7u, 0x19ef3993b72ab859u }, { 0x3e8d020e200a4b13u, 0x14bf6142f8eef9e1u },
+	{ 0x653d9b3e80083c0fu, 0x10991a9bfa58c7e7u }, { 0x6ec8f864000d2ce4u, 0x1a8e90f9908e0ca5u },
+	{ 0x8bd3f9e999a423eau, 0x153eda614071a3b7u }, { 0x3ca994bae1501cbbu, 0x10ff151a99f482f9u },
+	{ 0xc775bac49bb3612bu, 0x1b31bb5dc320d18eu }, { 0xd2c4956a16291a89u, 0x15c162b168e70e0bu },
+	{ 0xdbd0778811ba7ba1u, 0x11678227871f3e6fu }, { 0x2c80bf401c5d929bu, 0x1bd8d03f3e9863e6u },
+	{ 0xbd33cc3349e47549u, 0x16470cff6546b651u }, { 0xca8fd68f6e505dd4u, 0x11d270cc51055ea7u },
+	{ 0x4419574be3b3c953u, 0x1c83e7ad4e6efdd9u }, { 0x0347790982f63aa9u, 0x16cfec8aa52597e1u },
+	{ 0xcf6c60d468c4fbbau, 0x123ff06eea847980u }, { 0xe57a34870e07f92au, 0x1d331a4b10d3f59au },
+	{ 0x512e906c0b399422u, 0x175c1508da432ae2u }, { 0xda8ba6bcd5c7a9b5u, 0x12b010d3e1cf5581u },
+	{ 0x90df712e22d90f87u, 0x1de6815302e5559cu }, { 0xda4c5a8b4f140c6cu, 0x17eb9aa8cf1dde16u },
+	{ 0xaea37ba2a5a9a38au, 0x1322e220a5b17e78u }, { 0x7dd25f6aa2a905a9u, 0x1e9e369aa2b59727u },
+	{ 0x97db7f888220d154u, 0x187e92154ef7ac1fu }, { 0x797c6606ce80a777u, 0x139874ddd8c6234cu },
+	{ 0x8f2d700ae4010bf1u, 0x1f5a549627a36badu }, { 0x0c2459a25000d65au, 0x191510781fb5efbeu },
+	{ 0x701d1481d99a4515u, 0x1410d9f9b2f7f2feu }, { 0xc017439b147b6a77u, 0x100d7b2e28c65bfeu },
+	{ 0xccf205c4ed9243f2u, 0x19af2b7d0e0a2ccau }, { 0x0a5b37d0be0e9cc2u, 0x148c22ca71a1bd6fu },
+	{ 0x0848f973cb3ee3ceu, 0x10701bd527b4978cu }, { 0xda0e5bec78649fb0u, 0x1a4cf9550c5425acu },
+	{ 0x7b3eaff060507fc0u, 0x150a6110d6a9b7bdu }, { 0x95cbbff380406633u, 0x10d51a73deee2c97u },
+	{ 0xefac665266cd7052u, 0x1aee90b964b04758u }, { 0x2623850eb8a459dbu, 0x158ba6fab6f36c47u },
+	{ 0x1e82d0d893b6ae49u, 0x113c85955f29236cu }, { 0xfd9e1af41f8ab075u, 0x1b9408eefea838acu },
+	{ 0x97b1af29b2d559f7u, 0x16100725988693bdu }, { 0xac8e25baf5777b2cu, 0x11a66c1e139edc97u },
+	{ 0x7a7d092b2258c513u, 0x1c3d79c9b8fe2dbfu }, { 0x61fda0ef4ead6a76u, 0x169794a160cb57ccu },
+	{ 0xe7fe1a590bbdeec5u, 0x1212dd4de7091309u }, { 0xa6635d5b45fcb13au, 0x1ceafbafd80e84dcu },
+	{ 0x851c4aaf6b308dc8u, 0x172262f3133ed0b0u }, { 0xd0e36ef2bc26d7d4u, 0x1281e8c275cbda26u },
+	{ 0xb49f17eac6a48c86u, 0x1d9ca79d894629d7u }, { 0x2a18dfef0550706bu, 0x17b08617a104ee46u },
+	{ 0x54e0b3259dd9f389u, 0x12f39e794d9d8b6bu }, { 0x87cdeb6f62f65274u, 0x1e5297287c2f4578u },
+	{ 0xd30b22bf825ea85du, 0x18421286c9bf6ac6u }, { 0x0f3c1bcc684bb9e4u, 0x13680ed23aff889fu },
+	{ 0x18602c7a4079296du, 0x1f0ce4839198da98u }, { 0x46b356c833942124u, 0x18d71d360e13e213u },
+	{ 0x388f78a029434db6u, 0x13df4a91a4dcb4dcu }, { 0x5a7f2766a86baf8au, 0x1fcbaa82a1612160u },
+	{ 0x153285ebb9efbfa2u, 0x196fbb9bb44db44du }, { 0xaa8ed189618c994eu, 0x145962e2f6a4903du },
+	{ 0xeed8a7a11ad6e10cu, 0x1047824f2bb6d9cau }, { 0x7e27729b5e249b45u, 0x1a0c03b1df8af611u },
+	{ 0xfe85f549181d4904u, 0x14d6695b193bf80du }, { 0xcb9e5dd4134aa0d0u, 0x10ab877c142ff9a4u },
+	{ 0xdf63c9535211014du, 0x1aac0bf9b9e65c3au }, { 0x191ca10f74da6771u, 0x15566ffafb1eb02fu },
+	{ 0xadb080d92a4852c1u, 0x1111f32f2f4bc025u }, { 0x15e7348eaa0d5134u, 0x1b4feb7eb212cd09u },
+	{ 0xab1f5d3eee710dc4u, 0x15d98932280f0a6du }, { 0xbc1917658b8da49du, 0x117ad428200c0857u },
+	{ 0x2cf4f23c127c3a94u, 0x1bf7b9d9cce00d59u }, { 0xf0c3f4fcdb969543u, 0x165fc7e170b33de0u },
+	{ 0x5a365d9716121103u, 0x11e6398126f5cb1au }, { 0x9056fc24f01ce804u, 0x1ca38f350b22de90u },
+	{ 0xd9df301d8ce3ecd0u, 0x16e93f5da2824ba6u }, { 0xe17f59b13d8323dau, 0x125432b14ecea2ebu },
+	{ 0x68cbc2b52f38395cu, 0x1d53844ee47dd179u }, { 0x53d6355dbf602de3u, 0x177603725064a794u },
+	{ 0xa9782ab165e68b1cu, 0x12c4cf8ea6b6ec76u }, { 0x0f26aab56fd744fau, 0x1e07b27dd78b13f1u },
+	{ 0x3f52222abfdf6a62u, 0x18062864ac6f4327u }, { 0x65db4e88997f884eu, 0x1338205089f29c1fu },
+	{ 0x6fc54a7428cc0d4au, 0x1ec033b40fea9365u }, { 0x596aa1f68709a43bu, 0x1899c2f673220f84u },
+	{ 0xadeee7f86c07b696u, 0x13ae3591f5b4d936u }, { 0x497e3ff3e00c5756u, 0x1f7d228322baf524u },
+	{ 0xd464fff64cd6ac45u, 0x1930e868e89590e9u }, { 0x4383fff83d7889d1u, 0x14272053ed4473eeu },
+	{ 0xcf9cccc69793a174u, 0x101f4d0ff1038ff1u }, { 0x7f6147a425b90252u, 0x19cbae7fe805b31cu },
+	{ 0xcc4dd2e9b7c7350fu, 0x14a2f1ffecd15c16u }, { 0x3d0b0f215fd290d9u, 0x10825b3323dab012u },
+	{ 0x61ab4b689950e7c1u, 0x1a6a2b85062ab350u }, { 0x4e22a2ba1440b967u, 0x1521bc6a6b555c40u },
+	{ 0x0b4ee894dd009453u, 0x10e7c9eebc4449cdu }, { 0x1217da87c800ed51u, 0x1b0c764ac6d3a948u },
+	{ 0xdb46486ca000bddau, 0x15a391d56bdc876cu }, { 0x490506bd4ccd64afu, 0x114fa7ddefe39f8au },
+	{ 0xa8080ac87ae23ab1u, 0x1bb2a62fe638ff43u }, { 0x5339a239fbe82ef4u, 0x162884f31e93ff69u },
+	{ 0x75c7b4fb2fecf25du, 0x11ba03f5b20fff87u }, { 0x22d92191e647ea2eu, 0x1c5cd322b67fff3fu },
+	{ 0xb57a8141850654f2u, 0x16b0a8e891ffff65u }, { 0xc4620101373843f5u, 0x1226ed86db3332b7u },
+	{ 0x3a366801f1f39feeu, 0x1d0b15a491eb8459u }, { 0xfb5eb99b27f6198bu, 0x173c115074bc69e0u },
+	{ 0x2f7efae2865e7ad6u, 0x129674405d6387e7u }, { 0xe597f7d0d6fd9156u, 0x1dbd86cd6238d971u },
+	{ 0x8479930d78cadaabu, 0x17cad23de82d7ac1u }, { 0xd06142712d6f1556u, 0x1308a831868ac89au },
+	{ 0x4d686a4eaf182222u, 0x1e74404f3daada91u }, { 0xa453883ef279b4e8u, 0x185d003f6488aedau },
+	{ 0xe9dc6cff28615d87u, 0x137d99cc506d58aeu }, { 0xa960ae650d6895a4u, 0x1f2f5c7a1a488de4u },
+	{ 0xbab3beb73ded4483u, 0x18f2b061aea07183u }, { 0x2ef6322c318a9d36u, 0x13f559e7bee6c136u },
+	{ 0xe4bd1d13827761f0u, 0x1feef63f97d79b89u }, { 0x83ca7da9352c4e5au, 0x198bf832dfdfafa1u },
+	{ 0x9ca1fe20f756a515u, 0x146ff9c24cb2f2e7u }, { 0x4a1b31b3f9121daau, 0x1059949b708f28b9u },
+	{ 0x435eb5ecc1b695ddu, 0x1a28edc580e50df5u }, { 0x35e55e57015ede4au, 0x14ed8b04671da4c4u },
+	{ 0xc4b77eac0118b1d5u, 0x10be08d0527e1d69u }, { 0xa12597799b5ab622u, 0x1ac9a7b3b7302f0fu },
+	{ 0x4db7ac6149155e81u, 0x156e1fc2f8f358d9u }, { 0xd7c6238107444b9bu, 0x1124e63593f5e0adu },
+	{ 0x593d059b3ed3ac2bu, 0x1b6e3d2286563449u }, { 0xe0fd9e15cbdc89bcu, 0x15f1ca820511c36du },
+	{ 0xb3fe18116fe3a163u, 0x118e3b9b37416924u }, { 0x866359b57fd29bd1u, 0x1c16c5c525357507u },
+	{ 0xd1e91491330ee30eu, 0x16789e3750f790d2u }, { 0x74ba76da8f3f1c0bu, 0x11fa182c40c60d75u },
+	{ 0xedf72490e531c678u, 0x1cc359e067a348bbu }, { 0x8b2c1d40b75b052du, 0x1702ae4d1fb5d3c9u },
+	{ 0x6f567dcd5f7c0424u, 0x12688b70e62b0fd4u }, { 0x7ef0c94898c66d06u, 0x1d74124e3d11b2edu },
+	{ 0x98c0a106e09ebd9fu, 0x17900ea4fda7c257u }, { 0x470080d24d4bcae6u, 0x12d9a550caec9b79u },
+	{ 0xd800ce1d487944a2u, 0x1e29088144adc58eu }, { 0x1333d8176d2dd082u, 0x1820d39a9d57d13fu },
+	{ 0xa8f646792424a6ceu, 0x134d76154aaca765u }, { 0x74bd3d8ea03aa47du, 0x1ee25688777aa56fu },
+	{ 0x5d64313ee6955064u, 0x18b51206c5fbb78cu }, { 0x4ab68dcbebaaa6b7u, 0x13c40e6bd1962c70u },
+	{ 0x1124161312aaa457u, 0x1fa01712e8f0471au }, { 0xda8344dc0eeee9dfu, 0x194cdf4253f36c14u },
+	{ 0xe2029d7cd8bf2180u, 0x143d7f6843292343u }, { 0x4e687dfd7a328133u, 0x103132b9cf541c36u },
+	{ 0x4a40c9959050ceb8u, 0x19e851294bb9c6bdu }, { 0x0833d477a6a70bc6u, 0x14b9da876fc7d231u },
+	{ 0xa02976c61eec096bu, 0x1094aed2bfd30e8du }, { 0x004257a364acdbdfu, 0x1a877e1dffb81749u },
+	{ 0xcd01dfb5ea23e319u, 0x153931b1996012a0u }, { 0x70ce4c91881cb5aeu, 0x10fa8e27ade6754du },
+	{ 0x1ae3adb5a69455e2u, 0x1b2a7d0c4970bbafu }, { 0x7be957c4854377e8u, 0x15bb973d078d62f2u },
+	{ 0xc987796a0435f987u, 0x1162df64060ab58eu }, { 0x75a58f1006bcc271u, 0x1bd1656cd67788e4u },
+	{ 0xf7b7a5a66bca3527u, 0x16411df0ab92d3e9u }, { 0x5fc61e1ebca1c41fu, 0x11cdb18d560f0feeu },
+	{ 0xffa363646102d365u, 0x1c7c4f4889b1b316u }, { 0x32e91c504d9bdc51u, 0x16c9d906d48e28dfu },
+	{ 0x8f20e37371497d0eu, 0x123b140576d820b2u }, { 0x7e9b0585820f2e7cu, 0x1d2b533bf159cdeau },
+	{ 0xcbaf379e01a5becau, 0x1755dc2ff447d7eeu }, { 0x0958f94b348498a1u, 0x12ab168cc36cacbfu }
+	};
+static const uint64_t Pow5Split[326][2] =
+	{
+	{ 0x0000000000000000u, 0x1000000000000000u }, { 0x0000000000000000u, 0x1400000000000000u },
+	{ 0x0000000000000000u, 0x1900000000000000u }, { 0x0000000000000000u, 0x1f40000000000000u },
+	{ 0x0000000000000000u, 0x1388000000000000u }, { 0x0000000000000000u, 0x186a000000000000u },
+	{ 0x0000000000000000u, 0x1e84800000000000u }, { 0x0000000000000000u, 0x1312d00000000000u },
+	{ 0x0000000000000000u, 0x17d7840000000000u }, { 0x0000000000000000u, 0x1dcd650000000000u },
+	{ 0x0000000000000000u, 0x12a05f2000000000u }, { 0x0000000000000000u, 0x174876e800000000u },
+	{ 0x0000000000000000u, 0x1d1a94a200000000u }, { 0x0000000000000000u, 0x12309ce540000000u },
+	{ 0x0000000000000000u, 0x16bcc41e90000000u }, { 0x0000000000000000u, 0x1c6bf52634000000u },
+	{ 0x0000000000000000u, 0x11c37937e0800000u }, { 0x0000000000000000u, 0x16345785d8a00000u },
+	{ 0x0000000000000000u, 0x1bc16d674ec80000u }, { 0x0000000000000000u, 0x1158e460913d0000u },
+	{ 0x0000000000000000u, 0x15af1d78b58c4000u }, { 0x0000000000000000u, 0x1b1ae4d6e2ef5000u },
+	{ 0x0000000000000000u, 0x10f0cf064dd59200u }, { 0x0000000000000000u, 0x152d02c7e14af680u },
+	{ 0x0000000000000000u, 0x1a784379d99db420u }, { 0x0000000000000000u, 0x108b2a2c28029094u },
+	{ 0x0000000000000000u, 0x14adf4b7320334b9u }, { 0x4000000000000000u, 0x19d971e4fe8401e7u },
+	{ 0x8800000000000000u, 0x1027e72f1f128130u }, { 0xaa00000000000000u, 0x1431e0fae6d7217cu },
+	{ 0xd480000000000000u, 0x193e5939a08ce9dbu }, { 0xc9a0000000000000u, 0x1f8def8808b02452u },
+	{ 0xbe04000000000000u, 0x13b8b5b5056e16b3u }, { 0xad85000000000000u, 0x18a6e32246c99c60u },
+	{ 0xd8e6400000000000u, 0x1ed09bead87c0378u }, { 0x878fe80000000000u, 0x13426172c74d822bu },
+	{ 0x6973e20000000000u, 0x1812f9cf7920e2b6u }, { 0x03d0da8000000000u, 0x1e17b84357691b64u },
+	{ 0x8262889000000000u, 0x12ced32a16a1b11eu }, { 0x22fb2ab400000000u, 0x178287f49c4a1d66u },
+	{ 0xabb9f56100000000u, 0x1d6329f1c35ca4bfu }, { 0xcb54395ca0000000u, 0x125dfa371a19e6f7u },
+	{ 0xbe2947b3c8000000u, 0x16f578c4e0a060b5u }, { 0x2db399a0ba000000u, 0x1cb2d6f618c878e3u },
+	{ 0xfc90400474400000u, 0x11efc659cf7d4b8du }, { 0x7bb4500591500000u, 0x166bb7f0435c9e71u },
+	{ 0xdaa16406f5a40000u, 0x1c06a5ec5433c60du }, { 0xa8a4de8459868000u, 0x118427b3b4a05bc8u },
+	{ 0xd2ce16256fe82000u, 0x15e531a0a1c872bau }, { 0x87819baecbe22800u, 0x1b5e7e08ca3a8f69u },
+	{ 0xf4b1014d3f6d5900u, 0x111b0ec57e6499a1u }, { 0x71dd41a08f48af40u, 0x1561d276ddfdc00au },
+	{ 0x0e549208b31adb10u, 0x1aba4714957d300du }, { 0x28f4db456ff0c8eau, 0x10b46c6cdd6e3e08u },
+	{ 0x33321216cbecfb24u, 0x14e1878814c9cd8au }, { 0xbffe969c7ee839edu, 0x1a19e96a19fc40ecu },
+	{ 0xf7ff1e21cf512434u, 0x105031e2503da893u }, { 0xf5fee5aa43256d41u, 0x14643e5ae44d12b8u },
+	{ 0x337e9f14d3eec892u, 0x197d4df19d605767u }, { 0x005e46da08ea7ab6u, 0x1fdca16e04b86d41u },
+	{ 0xa03aec4845928cb2u, 0x13e9e4e4c2f34448u }, { 0xc849a75a56f72fdeu, 0x18e45e1df3b0155au },
+	{ 0x7a5c1130ecb4fbd6u, 0x1f1d75a5709c1ab1u }, { 0xec798abe93f11d65u, 0x13726987666190aeu },
+	{ 0xa797ed6e38ed64bfu, 0x184f03e93ff9f4dau }, { 0x517de8c9c728bdefu, 0x1e62c4e38ff87211u },
+	{ 0xd2eeb17e1c7976b5u, 0x12fdbb0e39fb474au }, { 0x87aa5ddda397d462u, 0x17bd29d1c87a191du },
+	{ 0xe994f5550c7dc97bu, 0x1dac74463a989f64u }, { 0x11fd195527ce9dedu, 0x128bc8abe49f639fu },
+	{ 0xd67c5faa71c24568u, 0x172ebad6ddc73c86u }, { 0x8c1b77950e32d6c2u, 0x1cfa698c95390ba8u },
+	{ 0x57912abd28dfc639u, 0x121c81f7dd43a749u }, { 0xad75756c7317b7c8u, 0x16a3a275d494911bu },
+	{ 0x98d2d2c78fdda5bau, 0x1c4c8b1349b9b562u }, { 0x9f83c3bcb9ea8794u, 0x11afd6ec0e14115du },
+	{ 0x0764b4abe8652979u, 0x161bcca7119915b5u }, { 0x493de1d6e27e73d7u, 0x1ba2bfd0d5ff5b22u },
+	{ 0x6dc6ad264d8f0866u, 0x1145b7e285bf98f5u }, { 0xc938586fe0f2ca80u, 0x159725db272f7f32u },
+	{ 0x7b866e8bd92f7d20u, 0x1afcef51f0fb5effu }, { 0xad34051767bdae34u, 0x10de1593369d1b5fu },
+	{ 0x9881065d41ad19c1u, 0x15159af804446237u }, { 0x7ea147f492186032u, 0x1a5b01b605557ac5u },
+	{ 0x6f24ccf8db4f3c1fu, 0x1078e111c3556cbbu }, { 0x4aee003712230b27u, 0x14971956342ac7eau },
+	{ 0xdda98044d6abcdf0u, 0x19bcdfabc13579e4u }, { 0x0a89f02b062b60b6u, 0x10160bcb58c16c2fu },
+	{ 0xcd2c6c35c7b638e4u, 0x141b8ebe2ef1c73au }, { 0x8077874339a3c71du, 0x1922726dbaae3909u },
+	{ 0xe0956914080cb8e4u, 0x1f6b0f092959c74bu }, { 0x6c5d61ac8507f38eu, 0x13a2e965b9d81c8fu },
+	{ 0x4774ba17a649f072u, 0x188ba3bf284e23b3u }, { 0x1951e89d8fdc6c8fu, 0x1eae8caef261aca0u },
+	{ 0x0fd3316279e9c3d9u, 0x132d17ed577d0be4u }, { 0x13c7fdbb186434cfu, 0x17f85de8ad5c4eddu },
+	{ 0x58b9fd29de7d4203u, 0x1df67562d8b36294u }, { 0xb7743e3a2b0e4942u, 0x12ba095dc7701d9cu },
+	{ 0xe5514dc8b5d1db92u, 0x17688bb5394c2503u }, { 0xdea5a13ae3465277u, 0x1d42aea2879f2e44u },
+	{ 0x0b2784c4ce0bf38au, 0x1249ad2594c37cebu }, { 0xcdf165f6018ef06du, 0x16dc186ef9f45c25u },
+	{ 0x416dbf7381f2ac88u, 0x1c931e8ab871732fu }, { 0x88e497a83137abd5u, 0x11dbf316b346e7fdu },
+	{ 0xeb1dbd923d8596cau, 0x1652efdc6018a1fcu }, { 0x25e52cf6cce6fc7du, 0x1be7abd3781eca7cu },
+	{ 0x97af3c1a40105dceu, 0x1170cb642b133e8du }, { 0xfd9b0b20d0147542u, 0x15ccfe3d35d80e30u },
+	{ 0x3d01cde904199292u, 0x1b403dcc834e11bdu }, { 0x462120b1a28ffb9bu, 0x1108269fd210cb16u },
+	{ 0xd7a968de0b33fa82u, 0x154a3047c694fddbu }, { 0xcd93c3158e00f923u, 0x1a9cbc59b83a3d52u },
+	{ 0xc07c59ed78c09bb6u, 0x10a1f5b813246653u }, { 0xb09b7068d6f0c2a3u, 0x14ca732617ed7fe8u },
+	{ 0xdcc24c830cacf34cu, 0x19fd0fef9de8dfe2u }, { 0xc9f96fd1e7ec180fu, 0x103e29f5c2b18bedu },
+	{ 0x3c77cbc661e71e13u, 0x144db473335deee9u }, { 0x8b95beb7fa60e598u, 0x1961219000356aa3u },
+	{ 0x6e7b2e65f8f91efeu, 0x1fb969f40042c54cu }, { 0xc50cfcffbb9bb35fu, 0x13d3e2388029bb4fu },
+	{ 0xb6503c3faa82a037u, 0x18c8dac6a0342a23u }, { 0xa3e44b4f95234844u, 0x1efb1178484134acu },
+	{ 0xe66eaf11bd360d2bu, 0x135ceaeb2d28c0ebu }, { 0xe00a5ad62c839075u, 0x183425a5f872f126u },
+	{ 0x980cf18bb7a47493u, 0x1e412f0f768fad70u }, { 0x5f0816f752c6c8dcu, 0x12e8bd69aa19cc66u },
+	{ 0xf6ca1cb527787b13u, 0x17a2ecc414a03f7fu }, { 0xf47ca3e2715699d7u, 0x1d8ba7f519c84f5fu },
+	{ 0xf8cde66d86d62026u, 0x127748f9301d319bu }, { 0xf7016008e88ba830u, 0x17151b377c247e02u },
+	{ 0xb4c1b80b22ae923cu, 0x1cda62055b2d9d83u }, { 0x50f91306f5ad1b65u, 0x12087d4358fc8272u },
+	{ 0xe53757c8b318623fu, 0x168a9c942f3ba30eu }, { 0x9e852dbadfde7acfu, 0x1c2d43b93b0a8bd2u },
+	{ 0xa3133c94cbeb0cc1u, 0x119c4a53c4e69763u }, { 0x8bd80bb9fee5cff1u, 0x16035ce8b6203d3cu },
+	{ 0xaece0ea87e9f43eeu, 0x1b843422e3a84c8bu }, { 0x4d40c9294f238a75u, 0x1132a095ce492fd7u },
+	{ 0x2090fb73a2ec6d12u, 0x157f48bb41db7bcdu }, { 0x68b53a508ba78856u, 0x1adf1aea12525ac0u },
+	{ 0x417144725748b536u, 0x10cb70d24b7378b8u }, { 0x51cd958eed1ae283u, 0x14fe4d06de5056e6u },
+	{ 0xe640faf2a8619b24u, 0x1a3de04895e46c9fu }, { 0xefe89cd7a93d00f7u, 0x1066ac2d5daec3e3u },
+	{ 0xebe2c40d938c4134u, 0x14805738b51a74dcu }, { 0x26db7510f86f5181u, 0x19a06d06e2611214u },
+	{ 0x9849292a9b4592f1u, 0x100444244d7cab4cu }, { 0xbe5b73754216f7adu, 0x1405552d60dbd61fu },
+	{ 0xadf25052929cb598u, 0x1906aa78b912cba7u }, { 0x996ee4673743e2ffu, 0x1f485516e7577e91u },
+	{ 0xffe54ec0828a6ddfu, 0x138d352e5096af1au }, { 0xbfdea270a32d0957u, 0x18708279e4bc5ae1u },
+	{ 0x2fd64b0ccbf84badu, 0x1e8ca3185deb719au }, { 0x5de5eee7ff7b2f4cu, 0x1317e5ef3ab32700u },
+	{ 0x755f6aa1ff59fb1fu, 0x17dddf6b095ff0c0u }, { 0x92b7454a7f3079e7u, 0x1dd55745cbb7ecf0u },
+	{ 0x5bb28b4e8f7e4c30u, 0x12a5568b9f52f416u }, { 0xf29f2e22335ddf3cu, 0x174eac2e8727b11bu },
+	{ 0xef46f9aac035570bu, 0x1d22573a28f19d62u }, { 0xd58c5c0ab8215667u, 0x123576845997025du },
+	{ 0x4aef730d6629ac01u, 0x16c2d4256ffcc2f5u }, { 0x9dab4fd0bfb41701u, 0x1c73892ecbfbf3b2u },
+	{ 0xa28b11e277d08e60u, 0x11c835bd3f7d784fu }, { 0x8b2dd65b15c4b1f9u, 0x163a432c8f5cd663u },
+	{ 0x6df94bf1db35de77u, 0x1bc8d3f7b3340bfcu }, { 0xc4bbcf772901ab0au, 0x115d847ad000877du },
+	{ 0x35eac354f34215cdu, 0x15b4e5998400a95du }, { 0x8365742a30129b40u, 0x1b221effe500d3b4u },
+	{ 0xd21f689a5e0ba108u, 0x10f5535fef208450u }, { 0x06a742c0f58e894au, 0x1532a837eae8a565u },
+	{ 0x4851137132f22b9du, 0x1a7f5245e5a2cebeu }, { 0xed32ac26bfd75b42u, 0x108f936baf85c136u },
+	{ 0xa87f57306fcd3212u, 0x14b378469b673184u }, { 0xd29f2cfc8bc07e97u, 0x19e056584240fde5u },
+	{ 0xa3a37c1dd7584f1eu, 0x102c35f729689eafu }, { 0x8c8c5b254d2e62e6u, 0x14374374f3c2c65bu },
+	{ 0x6faf71eea079fb9fu, 0x1945145230b377f2u }, { 0x0b9b4e6a48987a87u, 0x1f965966bce055efu },
+	{ 0x674111026d5f4c94u, 0x13bdf7e0360c35b5u }, { 0xc111554308b71fbau, 0x18ad75d8438f4322u },
+	{ 0x7155aa93cae4e7a8u, 0x1ed8d34e547313ebu }, { 0x26d58a9c5ecf10c9u, 0x13478410f4c7ec73u },
+	{ 0xf08aed437682d4fbu, 0x1819651531f9e78fu }, { 0xecada89454238a3au, 0x1e1fbe5a7e786173u },
+	{ 0x73ec895cb4963664u, 0x12d3d6f88f0b3ce8u }, { 0x90e7abb3e1bbc3fdu, 0x1788ccb6b2ce0c22u },
+	{ 0x352196a0da2ab4fdu, 0x1d6affe45f818f2bu }, { 0x0134fe24885ab11eu, 0x1262dfeebbb0f97bu },
+	{ 0xc1823dadaa715d65u, 0x16fb97ea6a9d37d9u }, { 0x31e2cd19150db4bfu, 0x1cba7de5054485d0u },
+	{ 0x1f2dc02fad2890f7u, 0x11f48eaf234ad3a2u }, { 0xa6f9303b9872b535u, 0x1671b25aec1d888au },
+	{ 0x50b77c4a7e8f6282u, 0x1c0e1ef1a724eaadu }, { 0x5272adae8f199d91u, 0x1188d357087712acu },
+	{ 0x670f591a32e004f6u, 0x15eb082cca94d757u }, { 0x40d32f60bf980633u, 0x1b65ca37fd3a0d2du },
+	{ 0x4883fd9c77bf03e0u, 0x111f9e62fe44483cu }, { 0x5aa4fd0395aec4d8u, 0x156785fbbdd55a4bu },
+	{ 0x314e3c447b1a760eu, 0x1ac1677aad4ab0deu }, { 0xded0e5aaccf089c9u, 0x10b8e0acac4eae8au },
+	{ 0x96851f15802cac3bu, 0x14e718d7d7625a2du }, { 0xfc2666dae037d74au, 0x1a20df0dcd3af0b8u },
+	{ 0x9d980048cc22e68eu, 0x10548b68a044d673u }, { 0x84fe005aff2ba032u, 0x1469ae42c8560c10u },
+	{ 0xa63d8071bef6883eu, 0x198419d37a6b8f14u }, { 0xcfcce08e2eb42a4eu, 0x1fe52048590672d9u },
+	{ 0x21e00c58dd309a70u, 0x13ef342d37a407c8u }, { 0x2a580f6f147cc10du, 0x18eb0138858d09bau },
+	{ 0xb4ee134ad99bf150u, 0x1f25c186a6f04c28u }, { 0x7114cc0ec80176d2u, 0x137798f428562f99u },
+	{ 0xcd59ff127a01d486u, 0x18557f31326bbb7fu }, { 0xc0b07ed7188249a8u, 0x1e6adefd7f06aa5fu },
+	{ 0xd86e4f466f516e09u, 0x1302cb5e6f642a7bu }, { 0xce89e3180b25c98bu, 0x17c37e360b3d351au },
+	{ 0x822c5bde0def3beeu, 0x1db45dc38e0c8261u }, { 0xf15bb96ac8b58575u, 0x1290ba9a38c7d17cu },
+	{ 0x2db2a7c57ae2e6d2u, 0x1734e940c6f9c5dcu }, { 0x391f51b6d99ba086u, 0x1d022390f8b83753u },
+	{ 0x03b3931248014454u, 0x1221563a9b732294u }, { 0x04a077d6da019569u, 0x16a9abc9424feb39u },
+	{ 0x45c895cc9081fac3u, 0x1c5416bb92e3e607u }, { 0x8b9d5d9fda513cbau, 0x11b48e353bce6fc4u },
+	{ 0xae84b507d0e58be8u, 0x1621b1c28ac20bb5u }, { 0x1a25e249c51eeee3u, 0x1baa1e332d728ea3u },
+	{ 0xf057ad6e1b33554du, 0x114a52dffc679925u }, { 0x6c6d98c9a2002aa1u, 0x159ce797fb817f6fu },
+	{ 0x4788fefc0a803549u, 0x1b04217dfa61df4bu }, { 0x0cb59f5d8690214eu, 0x10e294eebc7d2b8fu },
+	{ 0xcfe30734e83429a1u, 0x151b3a2a6b9c7672u }, { 0x83dbc9022241340au, 0x1a6208b50683940fu },
+	{ 0xb2695da15568c086u, 0x107d457124123c89u }, { 0x1f03b509aac2f0a7u, 0x149c96cd6d16cbacu },
+	{ 0x26c4a24c1573acd1u, 0x19c3bc80c85c7e97u }, { 0x783ae56f8d684c03u, 0x101a55d07d39cf1eu },
+	{ 0x16499ecb70c25f03u, 0x1420eb449c8842e6u }, { 0x9bdc067e4cf2f6c4u, 0x19292615c3aa539fu },
+	{ 0x82d3081de02fb476u, 0x1f736f9b3494e887u }, { 0xb1c3e512ac1dd0c9u, 0x13a825c100dd1154u },
+	{ 0xde34de57572544fcu, 0x18922f31411455a9u }, { 0x55c215ed2cee963bu, 0x1eb6bafd91596b14u },
+	{ 0xb5994db43c151de5u, 0x133234de7ad7e2ecu }, { 0xe2ffa1214b1a655eu, 0x17fec216198ddba7u },
+	{ 0xdbbf89699de0feb6u, 0x1dfe729b9ff15291u }, { 0x2957b5e202ac9f31u, 0x12bf07a143f6d39bu },
+	{ 0xf3ada35a8357c6feu, 0x176ec98994f48881u }, { 0x70990c31242db8bdu, 0x1d4a7bebfa31aaa2u },
+	{ 0x865fa79eb69c9376u, 0x124e8d737c5f0aa5u }, { 0xe7f791866443b854u, 0x16e230d05b76cd4eu },
+	{ 0xa1f575e7fd54a669u, 0x1c9abd04725480a2u }, { 0xa53969b0fe54e801u, 0x11e0b622c774d065u },
+	{ 0x0e87c41d3dea2202u, 0x1658e3ab7952047fu }, { 0xd229b5248d64aa82u, 0x1bef1c9657a6859eu },
+	{ 0x435a1136d85eea91u, 0x117571ddf6c81383u }, { 0x143095848e76a536u, 0x15d2ce55747a1864u },
+	{ 0x193cbae5b2144e83u, 0x1b4781ead1989e7du }, { 0x2fc5f4cf8f4cb112u, 0x110cb132c2ff630eu },
+	{ 0xbbb77203731fdd56u, 0x154fdd7f73bf3bd1u }, { 0x2aa54e844fe7d4acu, 0x1aa3d4df50af0ac6u },
+	{ 0xdaa75112b1f0e4ebu, 0x10a6650b926d66bbu }, { 0xd15125575e6d1e26u, 0x14cffe4e7708c06au },
+	{ 0x85a56ead360865b0u, 0x1a03fde214caf085u }, { 0x7387652c41c53f8eu, 0x10427ead4cfed653u },
+	{ 0x50693e7752368f71u, 0x14531e58a03e8be8u }, { 0x64838e1526c4334eu, 0x1967e5eec84e2ee2u },
+	{ 0xfda4719a70754022u, 0x1fc1df6a7a61ba9au }, { 0xde86c70086494815u, 0x13d92ba28c7d14a0u },
+	{ 0x162878c0a7db9a1au, 0x18cf768b2f9c59c9u }, { 0x5bb296f0d1d280a1u, 0x1f03542dfb83703bu },
+	{ 0x194f9e5683239064u, 0x1362149cbd322625u }, { 0x5fa385ec23ec747eu, 0x183a99c3ec7eafaeu },
+	{ 0xf78c67672ce7919du, 0x1e494034e79e5b99u }, { 0x3ab7c0a07c10bb02u, 0x12edc82110c2f940u },
+	{ 0x4965b0c89b14e9c3u, 0x17a93a2954f3b790u }, { 0x5bbf1cfac1da2433u, 0x1d9388b3aa30a574u },
+	{ 0xb957721cb92856a0u, 0x127c35704a5e6768u }, { 0xe7ad4ea3e7726c48u, 0x171b42cc5cf60142u },
+	{ 0xa198a24ce14f075au, 0x1ce2137f74338193u }, { 0x44ff65700cd16498u, 0x120d4c2fa8a030fcu },
+	{ 0x563f3ecc1005bdbeu, 0x16909f3b92c83d3bu }, { 0x2bcf0e7f14072d2eu, 0x1c34c70a777a4c8au },
+	{ 0x5b61690f6c847c3du, 0x11a0fc668aac6fd6u }, { 0xf239c35347a59b4cu, 0x16093b802d578bcbu },
+	{ 0xeec83428198f021fu, 0x1b8b8a6038ad6ebeu }, { 0x553d20990ff96153u, 0x1137367c236c6537u },
+	{ 0x2a8c68bf53f7b9a8u, 0x1585041b2c477e85u }, { 0x752f82ef28f5a812u, 0x1ae64521f7595e26u },
+	{ 0x093db1d57999890bu, 0x10cfeb353a97dad8u }, { 0x0b8d1e4ad7ffeb4eu, 0x1503e602893dd18eu },
+	{ 0x8e7065dd8dffe622u, 0x1a44df832b8d45f1u }, { 0xf9063faa78bfefd5u, 0x106b0bb1fb384bb6u },
+	{ 0xb747cf9516efebcau, 0x1485ce9e7a065ea4u }, { 0xe519c37a5cabe6bdu, 0x19a742461887f64du },
+	{ 0xaf301a2c79eb7036u, 0x1008896bcf54f9f0u }, { 0xdafc20b798664c43u, 0x140aabc6c32a386cu },
+	{ 0x11bb28e57e7fdf54u, 0x190d56b873f4c688u }, { 0x1629f31ede1fd72au, 0x1f50ac6690f1f82au },
+	{ 0x4dda37f34ad3e67au, 0x13926bc01a973b1au }, { 0xe150c5f01d88e019u, 0x187706b0213d09e0u },
+	{ 0x19a4f76c24eb181fu, 0x1e94c85c298c4c59u }, { 0xb0071aa39712ef13u, 0x131cfd3999f7afb7u },
+	{ 0x9c08e14c7cd7aad8u, 0x17e43c8800759ba5u }, { 0x030b199f9c0d958eu, 0x1ddd4baa0093028fu },
+	{ 0x61e6f003c1887d79u, 0x12aa4f4a405be199u }, { 0xba60ac04b1ea9cd7u, 0x1754e31cd072d9ffu },
+	{ 0xa8f8d705de65440du, 0x1d2a1be4048f907fu }, { 0xc99b8663aaff4a88u, 0x123a516e82d9ba4fu },
+	{ 0xbc0267fc95bf1d2au, 0x16c8e5ca239028e3u }, { 0xab0301fbbb2ee474u, 0x1c7b1f3cac74331cu },
+	{ 0xeae1e13d54fd4ec9u, 0x11ccf385ebc89ff1u }, { 0x659a598caa3ca27bu, 0x1640306766bac7eeu },
+	{ 0xff00efefd4cbcb1au, 0x1bd03c81406979e9u }, { 0x3f6095f5e4ff5ef0u, 0x116225d0c841ec32u },
+	{ 0xcf38bb735e3f36acu, 0x15baaf44fa52673eu }, { 0x8306ea5035cf0457u, 0x1b295b1638e7010eu },
+	{ 0x11e4527221a162b6u, 0x10f9d8ede39060a9u }, { 0x565d670eaa09bb64u, 0x15384f295c7478d3u },
+	{ 0x2bf4c0d2548c2a3du, 0x1a8662f3b3919708u }, { 0x1b78f88374d79a66u, 0x1093fdd8503afe65u },
+	{ 0x625736a4520d8100u, 0x14b8fd4e6449bdfeu }, { 0xfaed044d6690e140u, 0x19e73ca1fd5c2d7du },
+	{ 0xbcd422b0601a8cc8u, 0x103085e53e599c6eu }, { 0x6c092b5c78212ffau, 0x143ca75e8df0038au },
+	{ 0x070b763396297bf8u, 0x194bd136316c046du }, { 0x48ce53c07bb3daf6u, 0x1f9ec583bdc70588u },
+	{ 0x2d80f4584d5068dau, 0x13c33b72569c6375u }, { 0x78e1316e60a48310u, 0x18b40a4eec437c52u }
+	};
+/*============================================================================*/
+/* ceil( log2( 5^e )) for 0 < e <= 3528, and 1 for e == 0. */
+static inline int32_t Pow5Bits( int32_t e )
+	{
+	return (int32_t)((( (uint32_t)e * 1217359 ) >> 19 ) + 1 );
+	}
+/*============================================================================*/
+/* floor( log10( 2^e )) for 0 <= e <= 1650. */
+static inline uint32_t Log10Pow2( int32_t e )
+	{
+	return ( (uint32_t)e * 78913 ) >> 18;
+	}
+/*============================================================================*/
+/* floor( log10( 5^e )) for 0 <= e <= 2620. */
+static inline uint32_t Log10Pow5( int32_t e )
+	{
+	return ( (uint32_t)e * 732923 ) >> 20;
+	}
+/*============================================================================*/
+static inline int MultipleOfPowerOf5( uint64_t Value, uint32_t p )
+	{
+	uint32_t	Count;
+
+	for( Count = 0; Value % 5 == 0; Value /= 5 )
+		Count++;
+
+	return Count >= p;
+	}
+/*============================================================================*/
+static inline int MultipleOfPowerOf2( uint64_t Value, uint32_t p )
+	{
+	return ( Value & (( 1ull << p ) - 1 )) == 0;
+	}
+/*============================================================================*/
+static inline uint64_t MulShift64( uint64_t m, const uint64_t * restrict Mul, int32_t j )
+	{
+	const unsigned __int128	b0	= (unsigned __int128)m * Mul[0];
+	const unsigned __int128	b2	= (unsigned __int128)m * Mul[1];
+
+	return (uint64_t)((( b0 >> 64 ) + b2 ) >> ( j - 64 ));
+	}
+/*============================================================================*/
+/* Converts the finite, non-zero double with the given raw fields to the
+   shortest decimal 'Digits' * 10^'Exponent' that converts back to the same
+   double, choosing the closest one if there is more than one. */
+static void ShortestDecimal( uint64_t IeeeMantissa, uint32_t IeeeExponent, uint64_t * restrict Digits, int32_t * restrict Exponent )
+	{
+	int32_t		e2, e10;
+	uint64_t	m2, mv, vr, vp, vm, Output;
+	uint32_t	mmShift;
+	int			AcceptBounds;
+	int			vmIsTrailingZeros	= 0, vrIsTrailingZeros	= 0;
+	int32_t		Removed				= 0;
+	uint8_t		LastRemovedDigit	= 0;
+
+	/* Step 1: decode the floating point number and unify normalized and subnormal cases. */
+	if( IeeeExponent == 0 )
+		{
+		e2	= 1 - 1023 - 52 - 2;
+		m2	= IeeeMantissa;
+		}
+	else
+		{
+		e2	= (int32_t)IeeeExponent - 1023 - 52 - 2;
+		m2	= ( 1ull << 52 ) | IeeeMantissa;
+		}
+
+	AcceptBounds	= ( m2 & 1 ) == 0;
+
+	/* Step 2: determine the interval of valid decimal representations. */
+	mv		= 4 * m2;
+	mmShift	= IeeeMantissa != 0 || IeeeExponent <= 1;
+
+	/* Step 3: convert to a decimal power base using 128-bit arithmetic. */
+	if( e2 >= 0 )
+		{
+		const uint32_t	q	= Log10Pow2( e2 ) - ( e2 > 3 );
+		const int32_t	k	= 125 + Pow5Bits( (int32_t)q ) - 1;
+		const int32_t	i	= -e2 + (int32_t)q + k;
+
+		e10	= (int32_t)q;
+		vr	= MulShift64( 4 * m2, Pow5InvSplit[q], i );
+		vp	= MulShift64( 4 * m2 + 2, Pow5InvSplit[q], i );
+		vm	= MulShift64( 4 * m2 - 1 - mmShift, Pow5InvSplit[q], i );
+
+		if( q <= 21 )
+			{
+			/* Only one of mp, mv and mm can be a multiple of 5, if any. */
+			if( mv % 5 == 0 )
+				vrIsTrailingZeros	= MultipleOfPowerOf5( mv, q );
+			else if( AcceptBounds )
+				vmIsTrailingZeros	= MultipleOfPowerOf5( mv - 1 - mmShift, q );
+			else
+				vp				   -= MultipleOfPowerOf5( mv + 2, q );
+			}
+		}
+	else
+		{
+		const uint32_t	q	= Log10Pow5( -e2 ) - ( -e2 > 1 );
+		const int32_t	i	= -e2 - (int32_t)q;
+		const int32_t	k	= Pow5Bits( i ) - 125;
+		const int32_t	j	= (int32_t)q - k;
+
+		e10	= (int32_t)q + e2;
+		vr	= MulShift64( 4 * m2, Pow5Split[i], j );
+		vp	= MulShift64( 4 * m2 + 2, Pow5Split[i], j );
+		vm	= MulShift64( 4 * m2 - 1 - mmShift, Pow5Split[i], j );
+
+		if( q <= 1 )
+			{
+			/* mv has at least q trailing zero bits, so vr has at least q trailing decimal zeros. */
+			vrIsTrailingZeros	= 1;
+			if( AcceptBounds )
+				vmIsTrailingZeros	= mmShift == 1;
+			else
+				--vp;
+			}
+		else if( q < 63 )
+			vrIsTrailingZeros	= MultipleOfPowerOf2( mv, q );
+		}
+
+	/* Step 4: find the shortest decimal representation in the interval of valid representations. */
+	if( vmIsTrailingZeros || vrIsTrailingZeros )
+		{
+		/* The general case, which happens rarely (~0.7%). */
+		while( vp / 10 > vm / 10 )
+			{
+			vmIsTrailingZeros  &= vm % 10 == 0;
+			vrIsTrailingZeros  &= LastRemovedDigit == 0;
+			LastRemovedDigit	= (uint8_t)( vr % 10 );
+			vr				   /= 10;
+			vp				   /= 10;
+			vm				   /= 10;
+			Removed++;
+			}
+
+		if( vmIsTrailingZeros )
+			while( vm % 10 == 0 )
+				{
+				vrIsTrailingZeros  &= LastRemovedDigit == 0;
+				LastRemovedDigit	= (uint8_t)( vr % 10 );
+				vr				   /= 10;
+				vp				   /= 10;
+				vm				   /= 10;
+				Removed++;
+				}
+
+		/* Round to even if the exact number is .....50..0. */
+		if( vrIsTrailingZeros && LastRemovedDigit == 5 && vr % 2 == 0 )
+			LastRemovedDigit	= 4;
+
+		/* We need to take vr + 1 if vr is outside bounds or we need to round up. */
+		Output	= vr + (( vr == vm && ( !AcceptBounds || !vmIsTrailingZeros )) || LastRemovedDigit >= 5 );
+		}
+	else
+		{
+		/* Specialized for the common case (~99.3%). */
+		int	RoundUp	= 0;
+
+		/* Remove two digits at a time when possible (~86.2%). */
+		if( vp / 100 > vm / 100 )
+			{
+			RoundUp	= vr % 100 >= 50;
+			vr	   /= 100;
+			vp	   /= 100;
+			vm	   /= 100;
+			Removed+= 2;
+			}
+
+		while( vp / 10 > vm / 10 )
+			{
+			RoundUp	= vr % 10 >= 5;
+			vr	   /= 10;
+			vp	   /= 10;
+			vm	   /= 10;
+			Removed++;
+			}
+
+		/* We need to take vr + 1 if vr is outside bounds or we need to round up. */
+		Output	= vr + ( vr == vm || RoundUp );
+		}
+
+	*Digits		= Output;
+	*Exponent	= e10 + Removed;
+	}
+/*============================================================================*/
+/* Writes at 'Dst' (which must have room for at least 25 characters) the
+   shortest text that converts back to exactly 'Value'. The fixed notation is
+   used for decimal exponents from -4 to 15, the scientific notation otherwise,
+   the same way as the '%g' conversion of 'printf'. Returns the number of
+   characters written. */
+static int FormatDouble( char * restrict Dst, double Value )
+	{
+	uint64_t	Bits, Digits;
+	uint32_t	IeeeExponent;
+	uint64_t	IeeeMantissa;
+	int32_t		Exponent, SciExponent;
+	int			NumDigits, Len	= 0;
+
+	memcpy( &Bits, &Value, sizeof Bits );
+
+	IeeeMantissa	= Bits & (( 1ull << 52 ) - 1 );
+	IeeeExponent	= (uint32_t)( Bits >> 52 ) & 0x7ff;
+
+	if( IeeeExponent == 0x7ff && IeeeMantissa != 0 )
+		{
+		memcpy( Dst, "nan", 3 );
+		return 3;
+		}
+
+	if( Bits >> 63 )
+		Dst[Len++]	= '-';
+
+	if( IeeeExponent == 0x7ff )
+		{
+		memcpy( Dst + Len, "inf", 3 );
+		return Len + 3;
+		}
+
+	if( IeeeExponent == 0 && IeeeMantissa == 0 )
+		{
+		Dst[Len++]	= '0';
+		return Len;
+		}
+
+	ShortestDecimal( IeeeMantissa, IeeeExponent, &Digits, &Exponent );
+
+	NumDigits	= DecimalDigits( Digits );
+	SciExponent	= Exponent + NumDigits - 1;
+
+	if( SciExponent >= -4 && SciExponent < 16 )
+		{
+		/* Fixed notation. */
+		if( Exponent >= 0 )
+			{
+			/* An integer, the digits followed by 'Exponent' zeros. */
+			WriteDecimal( Dst + Len, Digits, NumDigits );
+			Len	   += NumDigits;
+			memset( Dst + Len, '0', Exponent );
+			Len	   += Exponent;
+			}
+		else if( SciExponent >= 0 )
+			{
+			/* The decimal point falls among the digits. */
+			WriteDecimal( Dst + Len + 1, Digits, NumDigits );
+			memmove( Dst + Len, Dst + Len + 1, SciExponent + 1 );
+			Dst[Len + SciExponent + 1]	= '.';
+			Len	   += NumDigits + 1;
+			}
+		else
+			{
+			/* A fraction, "0." and then -'SciExponent' - 1 zeros before the digits. */
+			Dst[Len++]	= '0';
+			Dst[Len++]	= '.';
+			memset( Dst + Len, '0', -SciExponent - 1 );
+			Len	   += -SciExponent - 1;
+			WriteDecimal( Dst + Len, Digits, NumDigits );
+			Len	   += NumDigits;
+			}
+		}
+	else
+		{
+		/* Scientific notation, with at least two digits in the exponent. */
+		WriteDecimal( Dst + Len + 1, Digits, NumDigits );
+		Dst[Len]	= Dst[Len + 1];
+		if( NumDigits > 1 )
+			{
+			Dst[Len + 1]	= '.';
+			Len			   += NumDigits + 1;
+			}
+		else
+			Len++;
+
+		Dst[Len++]	= 'e';
+		Dst[Len++]	= SciExponent < 0 ? '-' : '+';
+
+		if( SciExponent < 0 )
+			SciExponent	= -SciExponent;
+
+		if( SciExponent >= 100 )
+			{
+			Dst[Len++]		= (char)( '0' + SciExponent / 100 );
+			SciExponent	   %= 100;
+			}
+
+		Dst[Len++]	= DigitPairs[SciExponent * 2];
+		Dst[Len++]	= DigitPairs[SciExponent * 2 + 1];
+		}
+
+	return Len;
+	}
+/*============================================================================*/
+/* Reserves 'Len' characters at the end of 'dst'. Returns a pointer to where they
+   must be written, or NULL if 'dst' is invalid, read-only or has no room for
+   them. The caller must finish the operation with 'EndAppend'. */
+static char *BeginAppend( s_string_t * restrict dst, ssize_t Len, ssize_t * restrict UsedLen )
+	{
+	char	*Ptr;
+
+	if( dst == NULL || dst->MustBeZero != 0 || dst->Writable == 0 )
+		return NULL;
+
+	*UsedLen	= s_strlen( dst );
+
+	if( Len > s_strmaxlen( dst ) - *UsedLen || ( Ptr = s_cstr( dst )) == NULL )
+		return NULL;
+
+	return Ptr + *UsedLen;
+	}
+/*============================================================================*/
+static ssize_t EndAppend( s_string_t * restrict dst, char * restrict End )
+	{
+	ssize_t	NewLen	= End - s_cstr( dst );
+
+	/* Terminate the new resulting string and update its length. */
+	*End	= '\0';
+	SetUsedLen( dst, NewLen );
+
+	return NewLen;
+	}
+/*============================================================================*/
+ssize_t s_append_u64( s_string_t * restrict dst, uint64_t value )
+	{
+	int		NumDigits	= DecimalDigits( value );
+	ssize_t	UsedLen;
+	char	*Ptr;
+
+	STATS_CALL( s_append_u64 );
+
+	if(( Ptr = BeginAppend( dst, NumDigits, &UsedLen )) == NULL )
+		return -1;
+
+	WriteDecimal( Ptr, value, NumDigits );
+
+	return EndAppend( dst, Ptr + NumDigits );
+	}
+/*============================================================================*/
+ssize_t s_append_i64( s_string_t * restrict dst, int64_t value )
+	{
+	uint64_t	Magnitude	= value < 0 ? -(uint64_t)value : (uint64_t)value;
+	int			NumDigits	= DecimalDigits( Magnitude );
+	ssize_t		UsedLen;
+	char		*Ptr;
+
+	STATS_CALL( s_append_i64 );
+
+	if(( Ptr = BeginAppend( dst, NumDigits + ( value < 0 ), &UsedLen )) == NULL )
+		return -1;
+
+	if( value < 0 )
+		*Ptr++	= '-';
+
+	WriteDecimal( Ptr, Magnitude, NumDigits );
+
+	return EndAppend( dst, Ptr + NumDigits );
+	}
+/*============================================================================*/
+ssize_t s_append_x64( s_string_t * restrict dst, uint64_t value, int mindigits )
+	{
+	int		NumDigits	= HexDigits( value );
+	ssize_t	UsedLen;
+	char	*Ptr;
+
+	STATS_CALL( s_append_x64 );
+
+	NumDigits	= mindigits > NumDigits ? ( mindigits > 16 ? 16 : mindigits ) : NumDigits;
+
+	if(( Ptr = BeginAppend( dst, NumDigits, &UsedLen )) == NULL )
+		return -1;
+
+	WriteHex( Ptr, value, NumDigits, HexDigitsLower );
+
+	return EndAppend( dst, Ptr + NumDigits );
+	}
+/*============================================================================*/
+ssize_t s_append_X64( s_string_t * restrict dst, uint64_t value, int mindigits )
+	{
+	int		NumDigits	= HexDigits( value );
+	ssize_t	UsedLen;
+	char	*Ptr;
+
+	STATS_CALL( s_append_X64 );
+
+	NumDigits	= mindigits > NumDigits ? ( mindigits > 16 ? 16 : mindigits ) : NumDigits;
+
+	if(( Ptr = BeginAppend( dst, NumDigits, &UsedLen )) == NULL )
+		return -1;
+
+	WriteHex( Ptr, value, NumDigits, HexDigitsUpper );
+
+	return EndAppend( dst, Ptr + NumDigits );
+	}
+/*============================================================================*/
+ssize_t s_append_f64( s_string_t * restrict dst, double value )
+	{
+	char	Buffer[32];
+	int		Len;
+	ssize_t	UsedLen;
+	char	*Ptr;
+
+	STATS_CALL( s_append_f64 );
+
+	/* The text is generated in a local buffer because its exact length is
+	   only known at the end, and a number cannot be partially appended. */
+	Len	= FormatDouble( Buffer, value );
+
+	if(( Ptr = BeginAppend( dst, Len, &UsedLen )) == NULL )
+		return -1;
+
+	memcpy( Ptr, Buffer, Len );
+
+	return EndAppend( dst, Ptr + Len );
+	}
+/*============================================================================*/
+s_view_t s_view( const s_string_t * restrict str, ssize_t start, ssize_t len )
+	{
+	s_view_t	View	= { "", 0 };
+	ssize_t		StrLen;
+
+	if( str == NULL || len <= 0 || ( StrLen = s_strlen( str )) == 0 || start >= StrLen )
+		return View;
+
+	if( start < -StrLen )
+		start	= 0;
+	else if( start < 0 )
+		start  += StrLen;
+
+	View.Ptr	= s_constcstr( str, start );
+	View.Len	= ssmin( len, StrLen - start );
+
+	return View;
+	}
+/*============================================================================*/
+s_view_t s_view_c( const char * restrict src )
+	{
+	s_view_t	View	= { "", 0 };
+
+	STATS_CALL( s_view_c );
+
+	if( src != NULL )
+		{
+		View.Ptr	= src;
+		View.Len	= strlen( src );
+		}
+
+	return View;
+	}
+/*============================================================================*/
+/* Loads 8 characters as a little-endian 64-bit word, whatever the byte order of
+   the machine is. */
+static inline uint64_t Load8( const char *Ptr )
+	{
+	uint64_t	Word;
+
+	memcpy( &Word, Ptr, sizeof Word );
+
+#if			__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	Word	= __builtin_bswap64( Word );
+#endif	/*	__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ */
+
+	return Word;
+	}
+/*============================================================================*/
+/* Returns non-zero if all the 8 characters loaded in 'Word' are decimal digits
+   (SWAR, 'SIMD within a register'). */
+static inline int Is8Digits( uint64_t Word )
+	{
+	return ((( Word & 0xf0f0f0f0f0f0f0f0ull ) | ((( Word + 0x0606060606060606ull ) & 0xf0f0f0f0f0f0f0f0ull ) >> 4 )) == 0x3333333333333333ull );
+	}
+/*============================================================================*/
+/* Converts the 8 decimal digits loaded in 'Word' to their value, with three
+   multiplications instead of eight. */
+static inline uint32_t Parse8Digits( uint64_t Word )
+	{
+	Word   -= 0x3030303030303030ull;
+	Word	= ( Word * 10 ) + ( Word >> 8 );
+	Word	= ((( Word & 0x000000ff000000ffull ) * 0x000f424000000064ull ) + ((( Word >> 16 ) & 0x000000ff000000ffull ) * 0x0000271000000001ull )) >> 32;
+
+	return (uint32_t)Word;
+	}
+/*============================================================================*/
+/* Parses an unsigned decimal integer (without sign) of at most 'Len'
+   characters at 'Ptr'. Returns the number of digits consumed, and sets
+   '*Overflow' if the value doesn't fit in 64 bits. */
+static ssize_t ParseDigits( const char * restrict Ptr, ssize_t Len, uint64_t * restrict Value, int * restrict Overflow )
+	{
+	uint64_t	Result	= 0;
+	ssize_t		i		= 0;
+
+	*Overflow	= 0;
+
+	/* Eight digits at a time while we can... */
+	while( Len - i >= 8 && Is8Digits( Load8( Ptr + i )))
+		{
+		if( __builtin_mul_overflow( Result, 100000000u, &Result ) || __builtin_add_overflow( Result, Parse8Digits( Load8( Ptr + i )), &Result ))
+			*Overflow	= 1;
+		i  += 8;
+		}
+
+	/* ...and then one by one. */
+	for( ; i < Len && Ptr[i] >= '0' && Ptr[i] <= '9'; i++ )
+		if( __builtin_mul_overflow( Result, 10u, &Result ) || __builtin_add_overflow( Result, (unsigned)( Ptr[i] - '0' ), &Result ))
+			*Overflow	= 1;
+
+	*Value	= Result;
+
+	return i;
+	}
+/*============================================================================*/
+ssize_t s_parse_u64_v( s_view_t view, uint64_t * restrict value )
+	{
+	uint64_t	Result;
+	ssize_t		Sign, Digits;
+	int			Overflow;
+
+	STATS_CALL( s_parse_u64_v );
+
+	if( view.Ptr == NULL || view.Len <= 0 )
+		return 0;
+
+	Sign	= view.Ptr[0] == '+';
+
+	if(( Digits = ParseDigits( view.Ptr + Sign, view.Len - Sign, &Result, &Overflow )) == 0 )
+		return 0;
+
+	if( value != NULL )
+		*value	= Overflow ? UINT64_MAX : Result;
+
+	return Overflow ? -1 : Sign + Digits;
+	}
+/*============================================================================*/
+ssize_t s_parse_i64_v( s_view_t view, int64_t * restrict value )
+	{
+	uint64_t	Result, Limit;
+	ssize_t		Sign, Digits;
+	int			Overflow, Negative;
+
+	STATS_CALL( s_parse_i64_v );
+
+	if( view.Ptr == NULL || view.Len <= 0 )
+		return 0;
+
+	Negative	= view.Ptr[0] == '-';
+	Sign		= Negative || view.Ptr[0] == '+';
+
+	if(( Digits = ParseDigits( view.Ptr + Sign, view.Len - Sign, &Result, &Overflow )) == 0 )
+		return 0;
+
+	/* The magnitude of the most negative value is one greater than the most positive. */
+	Limit		= Negative ? (uint64_t)INT64_MAX + 1 : (uint64_t)INT64_MAX;
+	Overflow   |= Result > Limit;
+
+	if( value != NULL )
+		*value	= Overflow ? ( Negative ? INT64_MIN : INT64_MAX ) : Negative ? (int64_t)( 0 - Result ) : (int64_t)Result;
+
+	return Overflow ? -1 : Sign + Digits;
+	}
+/*============================================================================*/
+/* The powers of five from 5^-342 to 5^308, normalized to 128 bits (most
+   significant bit set), as { high 64 bits, low 64 bits }. The negative powers
+   are rounded up, the positive ones truncated. Used by the Eisel-Lemire
+   algorithm. */
+static const uint64_t Pow5_128[651][2] =
+	{
+	{ 0xeef453d6923bd65au, 0x113faa2906a13b3fu }, { 0x9558b4661b6565f8u, 0x4ac7ca59a424c507u },
+	{ 0xbaaee17fa23ebf76u, 0x5d79bcf00d2df649u }, { 0xe95a99df8ace6f53u, 0xf4d82c2c107973dcu },
+	{ 0x91d8a02bb6c10594u, 0x79071b9b8a4be869u }, { 0xb64ec836a47146f9u, 0x9748e2826cdee284u },
+	{ 0xe3e27a444d8d98b7u, 0xfd1b1b2308169b25u }, { 0x8e6d8c6ab0787f72u, 0xfe30f0f5e50e20f7u },
+	{ 0xb208ef855c969f4fu, 0xbdbd2d335e51a935u }, { 0xde8b2b66b3bc4723u, 0xad2c788035e61382u },
+	{ 0x8b16fb203055ac76u, 0x4c3bcb5021afcc31u }, { 0xaddcb9e83c6b1793u, 0xdf4abe242a1bbf3du },
+	{ 0xd953e8624b85dd78u, 0xd71d6dad34a2af0du }, { 0x87d4713d6f33aa6bu, 0x8672648c40e5ad68u },
+	{ 0xa9c98d8ccb009506u, 0x680efdaf511f18c2u }, { 0xd43bf0effdc0ba48u, 0x0212bd1b2566def2u },
+	{ 0x84a57695fe98746du, 0x014bb630f7604b57u }, { 0xa5ced43b7e3e9188u, 0x419ea3bd35385e2du },
+	{ 0xcf42894a5dce35eau, 0x52064cac828675b9u }, { 0x818995ce7aa0e1b2u, 0x7343efebd1940993u },
+	{ 0xa1ebfb4219491a1fu, 0x1014ebe6c5f90bf8u }, { 0xca66fa129f9b60a6u, 0xd41a26e077774ef6u },
+	{ 0xfd00b897478238d0u, 0x8920b098955522b4u }, { 0x9e20735e8cb16382u, 0x55b46e5f5d5535b0u },
+	{ 0xc5a890362fddbc62u, 0xeb2189f734aa831du }, { 0xf712b443bbd52b7bu, 0xa5e9ec7501d523e4u },
+	{ 0x9a6bb0aa55653b2du, 0x47b233c92125366eu }, { 0xc1069cd4eabe89f8u, 0x999ec0bb696e840au },
+	{ 0xf148440a256e2c76u, 0xc00670ea43ca250du }, { 0x96cd2a865764dbcau, 0x380406926a5e5728u },
+	{ 0xbc807527ed3e12bcu, 0xc605083704f5ecf2u }, { 0xeba09271e88d976bu, 0xf7864a44c633682eu },
+	{ 0x93445b8731587ea3u, 0x7ab3ee6afbe0211du }, { 0xb8157268fdae9e4cu, 0x5960ea05bad82964u },
+	{ 0xe61acf033d1a45dfu, 0x6fb92487298e33bdu }, { 0x8fd0c16206306babu, 0xa5d3b6d479f8e056u },
+	{ 0xb3c4f1ba87bc8696u, 0x8f48a4899877186cu }, { 0xe0b62e2929aba83cu, 0x331acdabfe94de87u },
+	{ 0x8c71dcd9ba0b4925u, 0x9ff0c08b7f1d0b14u }, { 0xaf8e5410288e1b6fu, 0x07ecf0ae5ee44dd9u },
+	{ 0xdb71e91432b1a24au, 0xc9e82cd9f69d6150u }, { 0x892731ac9faf056eu, 0xbe311c083a225cd2u },
+	{ 0xab70fe17c79ac6cau, 0x6dbd630a48aaf406u }, { 0xd64d3d9db981787du, 0x092cbbccdad5b108u },
+	{ 0x85f0468293f0eb4eu, 0x25bbf56008c58ea5u }, { 0xa76c582338ed2621u, 0xaf2af2b80af6f24eu },
+	{ 0xd1476e2c07286faau, 0x1af5af660db4aee1u }, { 0x82cca4db847945cau, 0x50d98d9fc890ed4du },
+	{ 0xa37fce126597973cu, 0xe50ff107bab528a0u }, { 0xcc5fc196fefd7d0cu, 0x1e53ed49a96272c8u },
+	{ 0xff77b1fcbebcdc4fu, 0x25e8e89c13bb0f7au }, { 0x9faacf3df73609b1u, 0x77b191618c54e9acu },
+	{ 0xc795830d75038c1du, 0xd59df5b9ef6a2417u }, { 0xf97ae3d0d2446f25u, 0x4b0573286b44ad1du },
+	{ 0x9becce62836ac577u, 0x4ee367f9430aec32u }, { 0xc2e801fb244576d5u, 0x229c41f793cda73fu },
+	{ 0xf3a20279ed56d48au, 0x6b43527578c1110fu }, { 0x9845418c345644d6u, 0x830a13896b78aaa9u },
+	{ 0xbe5691ef416bd60cu, 0x23cc986bc656d553u }, { 0xedec366b11c6cb8fu, 0x2cbfbe86b7ec8aa8u },
+	{ 0x94b3a202eb1c3f39u, 0x7bf7d71432f3d6a9u }, { 0xb9e08a83a5e34f07u, 0xdaf5ccd93fb0cc53u },
+	{ 0xe858ad248f5c22c9u, 0xd1b3400f8f9cff68u }, { 0x91376c36d99995beu, 0x23100809b9c21fa1u },
+	{ 0xb58547448ffffb2du, 0xabd40a0c2832a78au }, { 0xe2e69915b3fff9f9u, 0x16c90c8f323f516cu },
+	{ 0x8dd01fad907ffc3bu, 0xae3da7d97f6792e3u }, { 0xb1442798f49ffb4au, 0x99cd11cfdf41779cu },
+	{ 0xdd95317f31c7fa1du, 0x40405643d711d583u }, { 0x8a7d3eef7f1cfc52u, 0x482835ea666b2572u },
+	{ 0xad1c8eab5ee43b66u, 0xda3243650005eecfu }, { 0xd863b256369d4a40u, 0x90bed43e40076a82u },
+	{ 0x873e4f75e2224e68u, 0x5a7744a6e804a291u }, { 0xa90de3535aaae202u, 0x711515d0a205cb36u },
+	{ 0xd3515c2831559a83u, 0x0d5a5b44ca873e03u }, { 0x8412d9991ed58091u, 0xe858790afe9486c2u },
+	{ 0xa5178fff668ae0b6u, 0x626e974dbe39a872u }, { 0xce5d73ff402d98e3u, 0xfb0a3d212dc8128fu },
+	{ 0x80fa687f881c7f8eu, 0x7ce66634bc9d0b99u }, { 0xa139029f6a239f72u, 0x1c1fffc1ebc44e80u },
+	{ 0xc987434744ac874eu, 0xa327ffb266b56220u }, { 0xfbe9141915d7a922u, 0x4bf1ff9f0062baa8u },
+	{ 0x9d71ac8fada6c9b5u, 0x6f773fc3603db4a9u }, { 0xc4ce17b399107c22u, 0xcb550fb4384d21d3u },
+	{ 0xf6019da07f549b2bu, 0x7e2a53a146606a48u }, { 0x99c102844f94e0fbu, 0x2eda7444cbfc426du },
+	{ 0xc0314325637a1939u, 0xfa911155fefb5308u }, { 0xf03d93eebc589f88u, 0x793555ab7eba27cau },
+	{ 0x96267c7535b763b5u, 0x4bc1558b2f3458deu }, { 0xbbb01b9283253ca2u, 0x9eb1aaedfb016f16u },
+	{ 0xea9c227723ee8bcbu, 0x465e15a979c1cadcu }, { 0x92a1958a7675175fu, 0x0bfacd89ec191ec9u },
+	{ 0xb749faed14125d36u, 0xcef980ec671f667bu }, { 0xe51c79a85916f484u, 0x82b7e12780e7401au },
+	{ 0x8f31cc0937ae58d2u, 0xd1b2ecb8b0908810u }, { 0xb2fe3f0b8599ef07u, 0x861fa7e6dcb4aa15u },
+	{ 0xdfbdcece67006ac9u, 0x67a791e093e1d49au }, { 0x8bd6a141006042bdu, 0xe0c8bb2c5c6d24e0u },
+	{ 0xaecc49914078536du, 0x58fae9f773886e18u }, { 0xda7f5bf590966848u, 0xaf39a475506a899eu },
+	{ 0x888f99797a5e012du, 0x6d8406c952429603u }, { 0xaab37fd7d8f58178u, 0xc8e5087ba6d33b83u },
+	{ 0xd5605fcdcf32e1d6u, 0xfb1e4a9a90880a64u }, { 0x855c3be0a17fcd26u, 0x5cf2eea09a55067fu },
+	{ 0xa6b34ad8c9dfc06fu, 0xf42faa48c0ea481eu }, { 0xd0601d8efc57b08bu, 0xf13b94daf124da26u },
+	{ 0x823c12795db6ce57u, 0x76c53d08d6b70858u }, { 0xa2cb1717b52481edu, 0x54768c4b0c64ca6eu },
+	{ 0xcb7ddcdda26da268u, 0xa9942f5dcf7dfd09u }, { 0xfe5d54150b090b02u, 0xd3f93b35435d7c4cu },
+	{ 0x9efa548d26e5a6e1u, 0xc47bc5014a1a6dafu }, { 0xc6b8e9b0709f109au, 0x359ab6419ca1091bu },
+	{ 0xf867241c8cc6d4c0u, 0xc30163d203c94b62u }, { 0x9b407691d7fc44f8u, 0x79e0de63425dcf1du },
+	{ 0xc21094364dfb5636u, 0x985915fc12f542e4u }, { 0xf294b943e17a2bc4u, 0x3e6f5b7b17b2939du },
+	{ 0x979cf3ca6cec5b5au, 0xa705992ceecf9c42u }, { 0xbd8430bd08277231u, 0x50c6ff782a838353u },
+	{ 0xece53cec4a314ebdu, 0xa4f8bf5635246428u }, { 0x940f4613ae5ed136u, 0x871b7795e136be99u },
+	{ 0xb913179899f68584u, 0x28e2557b59846e3fu }, { 0xe757dd7ec07426e5u, 0x331aeada2fe589cfu },
+	{ 0x9096ea6f3848984fu, 0x3ff0d2c85def7621u }, { 0xb4bca50b065abe63u, 0x0fed077a756b53a9u },
+	{ 0xe1ebce4dc7f16dfbu, 0xd3e8495912c62894u }, { 0x8d3360f09cf6e4bdu, 0x64712dd7abbbd95cu },
+	{ 0xb080392cc4349decu, 0xbd8d794d96aacfb3u }, { 0xdca04777f541c567u, 0xecf0d7a0fc5583a0u },
+	{ 0x89e42caaf9491b60u, 0xf41686c49db57244u }, { 0xac5d37d5b79b6239u, 0x311c2875c522ced5u },
+	{ 0xd77485cb25823ac7u, 0x7d633293366b828bu }, { 0x86a8d39ef77164bcu, 0xae5dff9c02033197u },
+	{ 0xa8530886b54dbdebu, 0xd9f57f830283fdfcu }, { 0xd267caa862a12d66u, 0xd072df63c324fd7bu },
+	{ 0x8380dea93da4bc60u, 0x4247cb9e59f71e6du }, { 0xa46116538d0deb78u, 0x52d9be85f074e608u },
+	{ 0xcd795be870516656u, 0x67902e276c921f8bu }, { 0x806bd9714632dff6u, 0x00ba1cd8a3db53b6u },
+	{ 0xa086cfcd97bf97f3u, 0x80e8a40eccd228a4u }, { 0xc8a883c0fdaf7df0u, 0x6122cd128006b2cdu },
+	{ 0xfad2a4b13d1b5d6cu, 0x796b805720085f81u }, { 0x9cc3a6eec6311a63u, 0xcbe3303674053bb0u },
+	{ 0xc3f490aa77bd60fcu, 0xbedbfc4411068a9cu }, { 0xf4f1b4d515acb93bu, 0xee92fb5515482d44u },
+	{ 0x991711052d8bf3c5u, 0x751bdd152d4d1c4au }, { 0xbf5cd54678eef0b6u, 0xd262d45a78a0635du },
+	{ 0xef340a98172aace4u, 0x86fb897116c87c34u }, { 0x9580869f0e7aac0eu, 0xd45d35e6ae3d4da0u },
+	{ 0xbae0a846d2195712u, 0x8974836059cca109u }, { 0xe998d258869facd7u, 0x2bd1a438703fc94bu },
+	{ 0x91ff83775423cc06u, 0x7b6306a34627ddcfu }, { 0xb67f6455292cbf08u, 0x1a3bc84c17b1d542u },
+	{ 0xe41f3d6a7377eecau, 0x20caba5f1d9e4a93u }, { 0x8e938662882af53eu, 0x547eb47b7282ee9cu },
+	{ 0xb23867fb2a35b28du, 0xe99e619a4f23aa43u }, { 0xdec681f9f4c31f31u, 0x6405fa00e2ec94d4u },
+	{ 0x8b3c113c38f9f37eu, 0xde83bc408dd3dd04u }, { 0xae0b158b4738705eu, 0x9624ab50b148d445u },
+	{ 0xd98ddaee19068c76u, 0x3badd624dd9b0957u }, { 0x87f8a8d4cfa417c9u, 0xe54ca5d70a80e5d6u },
+	{ 0xa9f6d30a038d1dbcu, 0x5e9fcf4ccd211f4cu }, { 0xd47487cc8470652bu, 0x7647c3200069671fu },
+	{ 0x84c8d4dfd2c63f3bu, 0x29ecd9f40041e073u }, { 0xa5fb0a17c777cf09u, 0xf468107100525890u },
+	{ 0xcf79cc9db955c2ccu, 0x7182148d4066eeb4u }, { 0x81ac1fe293d599bfu, 0xc6f14cd848405530u },
+	{ 0xa21727db38cb002fu, 0xb8ada00e5a506a7cu }, { 0xca9cf1d206fdc03bu, 0xa6d90811f0e4851cu },
+	{ 0xfd442e4688bd304au, 0x908f4a166d1da663u }, { 0x9e4a9cec15763e2eu, 0x9a598e4e043287feu },
+	{ 0xc5dd44271ad3cdbau, 0x40eff1e1853f29fdu }, { 0xf7549530e188c128u, 0xd12bee59e68ef47cu },
+	{ 0x9a94dd3e8cf578b9u, 0x82bb74f8301958ceu }, { 0xc13a148e3032d6e7u, 0xe36a52363c1faf01u },
+	{ 0xf18899b1bc3f8ca1u, 0xdc44e6c3cb279ac1u }, { 0x96f5600f15a7b7e5u, 0x29ab103a5ef8c0b9u },
+	{ 0xbcb2b812db11a5deu, 0x7415d448f6b6f0e7u }, { 0xebdf661791d60f56u, 0x111b495b3464ad21u },
+	{ 0x936b9fcebb25c995u, 0xcab10dd900beec34u }, { 0xb84687c269ef3bfbu, 0x3d5d514f40eea742u },
+	{ 0xe65829b3046b0afau, 0x0cb4a5a3112a5112u }, { 0x8ff71a0fe2c2e6dcu, 0x47f0e785eaba72abu },
+	{ 0xb3f4e093db73a093u, 0x59ed216765690f56u }, { 0xe0f218b8d25088b8u, 0x306869c13ec3532cu },
+	{ 0x8c974f7383725573u, 0x1e414218c73a13fbu }, { 0xafbd2350644eeacfu, 0xe5d1929ef90898fau },
+	{ 0xdbac6c247d62a583u, 0xdf45f746b74abf39u }, { 0x894bc396ce5da772u, 0x6b8bba8c328eb783u },
+	{ 0xab9eb47c81f5114fu, 0x066ea92f3f326564u }, { 0xd686619ba27255a2u, 0xc80a537b0efefebdu },
+	{ 0x8613fd0145877585u, 0xbd06742ce95f5f36u }, { 0xa798fc4196e952e7u, 0x2c48113823b73704u },
+	{ 0xd17f3b51fca3a7a0u, 0xf75a15862ca504c5u }, { 0x82ef85133de648c4u, 0x9a984d73dbe722fbu },
+	{ 0xa3ab66580d5fdaf5u, 0xc13e60d0d2e0ebbau }, { 0xcc963fee10b7d1b3u, 0x318df905079926a8u },
+	{ 0xffbbcfe994e5c61fu, 0xfdf17746497f7052u }, { 0x9fd561f1fd0f9bd3u, 0xfeb6ea8bedefa633u },
+	{ 0xc7caba6e7c5382c8u, 0xfe64a52ee96b8fc0u }, { 0xf9bd690a1b68637bu, 0x3dfdce7aa3c673b0u },
+	{ 0x9c1661a651213e2du, 0x06bea10ca65c084eu }, { 0xc31bfa0fe5698db8u, 0x486e494fcff30a62u },
+	{ 0xf3e2f893dec3f126u, 0x5a89dba3c3efccfau }, { 0x986ddb5c6b3a76b7u, 0xf89629465a75e01cu },
+	{ 0xbe89523386091465u, 0xf6bbb397f1135823u }, { 0xee2ba6c0678b597fu, 0x746aa07ded582e2cu },
+	{ 0x94db483840b717efu, 0xa8c2a44eb4571cdcu }, { 0xba121a4650e4ddebu, 0x92f34d62616ce413u },
+	{ 0xe896a0d7e51e1566u, 0x77b020baf9c81d17u }, { 0x915e2486ef32cd60u, 0x0ace1474dc1d122eu },
+	{ 0xb5b5ada8aaff80b8u, 0x0d819992132456bau }, { 0xe3231912d5bf60e6u, 0x10e1fff697ed6c69u },
+	{ 0x8df5efabc5979c8fu, 0xca8d3ffa1ef463c1u }, { 0xb1736b96b6fd83b3u, 0xbd308ff8a6b17cb2u },
+	{ 0xddd0467c64bce4a0u, 0xac7cb3f6d05ddbdeu }, { 0x8aa22c0dbef60ee4u, 0x6bcdf07a423aa96bu },
+	{ 0xad4ab7112eb3929du, 0x86c16c98d2c953c6u }, { 0xd89d64d57a607744u, 0xe871c7bf077ba8b7u },
+	{ 0x87625f056c7c4a8bu, 0x11471cd764ad4972u }, { 0xa93af6c6c79b5d2du, 0xd598e40d3dd89bcfu },
+	{ 0xd389b47879823479u, 0x4aff1d108d4ec2c3u }, { 0x843610cb4bf160cbu, 0xcedf722a585139bau },
+	{ 0xa54394fe1eedb8feu, 0xc2974eb4ee658828u }, { 0xce947a3da6a9273eu, 0x733d226229feea32u },
+	{ 0x811ccc668829b887u, 0x0806357d5a3f525fu }, { 0xa163ff802a3426a8u, 0xca07c2dcb0cf26f7u },
+	{ 0xc9bcff6034c13052u, 0xfc89b393dd02f0b5u }, { 0xfc2c3f3841f17c67u, 0xbbac2078d443ace2u },
+	{ 0x9d9ba7832936edc0u, 0xd54b944b84aa4c0du }, { 0xc5029163f384a931u, 0x0a9e795e65d4df11u },
+	{ 0xf64335bcf065d37du, 0x4d4617b5ff4a16d5u }, { 0x99ea0196163fa42eu, 0x504bced1bf8e4e45u },
+	{ 0xc06481fb9bcf8d39u, 0xe45ec2862f71e1d6u }, { 0xf07da27a82c37088u, 0x5d767327bb4e5a4cu },
+	{ 0x964e858c91ba2655u, 0x3a6a07f8d510f86fu }, { 0xbbe226efb628afeau, 0x890489f70a55368bu },
+	{ 0xeadab0aba3b2dbe5u, 0x2b45ac74ccea842eu }, { 0x92c8ae6b464fc96fu, 0x3b0b8bc90012929du },
+	{ 0xb77ada0617e3bbcbu, 0x09ce6ebb40173744u }, { 0xe55990879ddcaabdu, 0xcc420a6a101d0515u },
+	{ 0x8f57fa54c2a9eab6u, 0x9fa946824a12232du }, { 0xb32df8e9f3546564u, 0x47939822dc96abf9u },
+	{ 0xdff9772470297ebdu, 0x59787e2b93bc56f7u }, { 0x8bfbea76c619ef36u, 0x57eb4edb3c55b65au },
+	{ 0xaefae51477a06b03u, 0xede622920b6b23f1u }, { 0xdab99e59958885c4u, 0xe95fab368e45ecedu },
+	{ 0x88b402f7fd75539bu, 0x11dbcb0218ebb414u }, { 0xaae103b5fcd2a881u, 0xd652bdc29f26a119u },
+	{ 0xd59944a37c0752a2u, 0x4be76d3346f0495fu }, { 0x857fcae62d8493a5u, 0x6f70a4400c562ddbu },
+	{ 0xa6dfbd9fb8e5b88eu, 0xcb4ccd500f6bb952u }, { 0xd097ad07a71f26b2u, 0x7e2000a41346a7a7u },
+	{ 0x825ecc24c873782fu, 0x8ed400668c0c28c8u }, { 0xa2f67f2dfa90563bu, 0x728900802f0f32fau },
+	{ 0xcbb41ef979346bcau, 0x4f2b40a03ad2ffb9u }, { 0xfea126b7d78186bcu, 0xe2f610c84987bfa8u },
+	{ 0x9f24b832e6b0f436u, 0x0dd9ca7d2df4d7c9u }, { 0xc6ede63fa05d3143u, 0x91503d1c79720dbbu },
+	{ 0xf8a95fcf88747d94u, 0x75a44c6397ce912au }, { 0x9b69dbe1b548ce7cu, 0xc986afbe3ee11abau },
+	{ 0xc24452da229b021bu, 0xfbe85badce996168u }, { 0xf2d56790ab41c2a2u, 0xfae27299423fb9c3u },
+	{ 0x97c560ba6b0919a5u, 0xdccd879fc967d41au }, { 0xbdb6b8e905cb600fu, 0x5400e987bbc1c920u },
+	{ 0xed246723473e3813u, 0x290123e9aab23b68u }, { 0x9436c0760c86e30bu, 0xf9a0b6720aaf6521u },
+	{ 0xb94470938fa89bceu, 0xf808e40e8d5b3e69u }, { 0xe7958cb87392c2c2u, 0xb60b1d1230b20e04u },
+	{ 0x90bd77f3483bb9b9u, 0xb1c6f22b5e6f48c2u }, { 0xb4ecd5f01a4aa828u, 0x1e38aeb6360b1af3u },
+	{ 0xe2280b6c20dd5232u, 0x25c6da63c38de1b0u }, { 0x8d590723948a535fu, 0x579c487e5a38ad0eu },
+	{ 0xb0af48ec79ace837u, 0x2d835a9df0c6d851u }, { 0xdcdb1b2798182244u, 0xf8e431456cf88e65u },
+	{ 0x8a08f0f8bf0f156bu, 0x1b8e9ecb641b58ffu }, { 0xac8b2d36eed2dac5u, 0xe272467e3d222f3fu },
+	{ 0xd7adf884aa879177u, 0x5b0ed81dcc6abb0fu }, { 0x86ccbb52ea94baeau, 0x98e947129fc2b4e9u },
+	{ 0xa87fea27a539e9a5u, 0x3f2398d747b36224u }, { 0xd29fe4b18e88640eu, 0x8eec7f0d19a03aadu },
+	{ 0x83a3eeeef9153e89u, 0x1953cf68300424acu }, { 0xa48ceaaab75a8e2bu, 0x5fa8c3423c052dd7u },
+	{ 0xcdb02555653131b6u, 0x3792f412cb06794du }, { 0x808e17555f3ebf11u, 0xe2bbd88bbee40bd0u },
+	{ 0xa0b19d2ab70e6ed6u, 0x5b6aceaeae9d0ec4u }, { 0xc8de047564d20a8bu, 0xf245825a5a445275u },
+	{ 0xfb158592be068d2eu, 0xeed6e2f0f0d56712u }, { 0x9ced737bb6c4183du, 0x55464dd69685606bu },
+	{ 0xc428d05aa4751e4cu, 0xaa97e14c3c26b886u }, { 0xf53304714d9265dfu, 0xd53dd99f4b3066a8u },
+	{ 0x993fe2c6d07b7fabu, 0xe546a8038efe4029u }, { 0xbf8fdb78849a5f96u, 0xde98520472bdd033u },
+	{ 0xef73d256a5c0f77cu, 0x963e66858f6d4440u }, { 0x95a8637627989aadu, 0xdde7001379a44aa8u },
+	{ 0xbb127c53b17ec159u, 0x5560c018580d5d52u }, { 0xe9d71b689dde71afu, 0xaab8f01e6e10b4a6u },
+	{ 0x9226712162ab070du, 0xcab3961304ca70e8u }, { 0xb6b00d69bb55c8d1u, 0x3d607b97c5fd0d22u },
+	{ 0xe45c10c42a2b3b05u, 0x8cb89a7db77c506au }, { 0x8eb98a7a9a5b04e3u, 0x77f3608e92adb242u },
+	{ 0xb267ed1940f1c61cu, 0x55f038b237591ed3u }, { 0xdf01e85f912e37a3u, 0x6b6c46dec52f6688u },
+	{ 0x8b61313bbabce2c6u, 0x2323ac4b3b3da015u }, { 0xae397d8aa96c1b77u, 0xabec975e0a0d081au },
+	{ 0xd9c7dced53c72255u, 0x96e7bd358c904a21u }, { 0x881cea14545c7575u, 0x7e50d64177da2e54u },
+	{ 0xaa242499697392d2u, 0xdde50bd1d5d0b9e9u }, { 0xd4ad2dbfc3d07787u, 0x955e4ec64b44e864u },
+	{ 0x84ec3c97da624ab4u, 0xbd5af13bef0b113eu }, { 0xa6274bbdd0fadd61u, 0xecb1ad8aeacdd58eu },
+	{ 0xcfb11ead453994bau, 0x67de18eda5814af2u }, { 0x81ceb32c4b43fcf4u, 0x80eacf948770ced7u },
+	{ 0xa2425ff75e14fc31u, 0xa1258379a94d028du }, { 0xcad2f7f5359a3b3eu, 0x096ee45813a04330u },
+	{ 0xfd87b5f28300ca0du, 0x8bca9d6e188853fcu }, { 0x9e74d1b791e07e48u, 0x775ea264cf55347eu },
+	{ 0xc612062576589ddau, 0x95364afe032a819eu }, { 0xf79687aed3eec551u, 0x3a83ddbd83f52205u },
+	{ 0x9abe14cd44753b52u, 0xc4926a9672793543u }, { 0xc16d9a0095928a27u, 0x75b7053c0f178294u },
+	{ 0xf1c90080baf72cb1u, 0x5324c68b12dd6339u }, { 0x971da05074da7beeu, 0xd3f6fc16ebca5e04u },
+	{ 0xbce5086492111aeau, 0x88f4bb1ca6bcf585u }, { 0xec1e4a7db69561a5u, 0x2b31e9e3d06c32e6u },
+	{ 0x9392ee8e921d5d07u, 0x3aff322e62439fd0u }, { 0xb877aa3236a4b449u, 0x09befeb9fad487c3u },
+	{ 0xe69594bec44de15bu, 0x4c2ebe687989a9b4u }, { 0x901d7cf73ab0acd9u, 0x0f9d37014bf60a11u },
+	{ 0xb424dc35095cd80fu, 0x538484c19ef38c95u }, { 0xe12e13424bb40e13u, 0x2865a5f206b06fbau },
+	{ 0x8cbccc096f5088cbu, 0xf93f87b7442e45d4u }, { 0xafebff0bcb24aafeu, 0xf78f69a51539d749u },
+	{ 0xdbe6fecebdedd5beu, 0xb573440e5a884d1cu }, { 0x89705f4136b4a597u, 0x31680a88f8953031u },
+	{ 0xabcc77118461cefcu, 0xfdc20d2b36ba7c3eu }, { 0xd6bf94d5e57a42bcu, 0x3d32907604691b4du },
+	{ 0x8637bd05af6c69b5u, 0xa63f9a49c2c1b110u }, { 0xa7c5ac471b478423u, 0x0fcf80dc33721d54u },
+	{ 0xd1b71758e219652bu, 0xd3c36113404ea4a9u }, { 0x83126e978d4fdf3bu, 0x645a1cac083126eau },
+	{ 0xa3d70a3d70a3d70au, 0x3d70a3d70a3d70a4u }, { 0xccccccccccccccccu, 0xcccccccccccccccdu },
+	{ 0x8000000000000000u, 0x0000000000000000u }, { 0xa000000000000000u, 0x0000000000000000u },
+	{ 0xc800000000000000u, 0x0000000000000000u }, { 0xfa00000000000000u, 0x0000000000000000u },
+	{ 0x9c40000000000000u, 0x0000000000000000u }, { 0xc350000000000000u, 0x0000000000000000u },
+	{ 0xf424000000000000u, 0x0000000000000000u }, { 0x9896800000000000u, 0x0000000000000000u },
+	{ 0xbebc200000000000u, 0x0000000000000000u }, { 0xee6b280000000000u, 0x0000000000000000u },
+	{ 0x9502f90000000000u, 0x0000000000000000u }, { 0xba43b74000000000u, 0x0000000000000000u },
+	{ 0xe8d4a51000000000u, 0x0000000000000000u }, { 0x9184e72a00000000u, 0x0000000000000000u },
+	{ 0xb5e620f480000000u, 0x0000000000000000u }, { 0xe35fa931a0000000u, 0x0000000000000000u },
+	{ 0x8e1bc9bf04000000u, 0x0000000000000000u }, { 0xb1a2bc2ec5000000u, 0x0000000000000000u },
+	{ 0xde0b6b3a76400000u, 0x0000000000000000u }, { 0x8ac7230489e80000u, 0x0000000000000000u },
+	{ 0xad78ebc5ac620000u, 0x0000000000000000u }, { 0xd8d726b7177a8000u, 0x0000000000000000u },
+	{ 0x878678326eac9000u, 0x0000000000000000u }, { 0xa968163f0a57b400u, 0x0000000000000000u },
+	{ 0xd3c21bcecceda100u, 0x0000000000000000u }, { 0x84595161401484a0u, 0x0000000000000000u },
+	{ 0xa56fa5b99019a5c8u, 0x0000000000000000u }, { 0xcecb8f27f4200f3au, 0x0000000000000000u },
+	{ 0x813f3978f8940984u, 0x4000000000000000u }, { 0xa18f07d736b90be5u, 0x5000000000000000u },
+	{ 0xc9f2c9cd04674edeu, 0xa400000000000000u }, { 0xfc6f7c4045812296u, 0x4d00000000000000u },
+	{ 0x9dc5ada82b70b59du, 0xf020000000000000u }, { 0xc5371912364ce305u, 0x6c28000000000000u },
+	{ 0xf684df56c3e01bc6u, 0xc732000000000000u }, { 0x9a130b963a6c115cu, 0x3c7f400000000000u },
+	{ 0xc097ce7bc90715b3u, 0x4b9f100000000000u }, { 0xf0bdc21abb48db20u, 0x1e86d40000000000u },
+	{ 0x96769950b50d88f4u, 0x1314448000000000u }, { 0xbc143fa4e250eb31u, 0x17d955a000000000u },
+	{ 0xeb194f8e1ae525fdu, 0x5dcfab0800000000u }, { 0x92efd1b8d0cf37beu, 0x5aa1cae500000000u },
+	{ 0xb7abc627050305adu, 0xf14a3d9e40000000u }, { 0xe596b7b0c643c719u, 0x6d9ccd05d0000000u },
+	{ 0x8f7e32ce7bea5c6fu, 0xe4820023a2000000u }, { 0xb35dbf821ae4f38bu, 0xdda2802c8a800000u },
+	{ 0xe0352f62a19e306eu, 0xd50b2037ad200000u }, { 0x8c213d9da502de45u, 0x4526f422cc340000u },
+	{ 0xaf298d050e4395d6u, 0x9670b12b7f410000u }, { 0xdaf3f04651d47b4cu, 0x3c0cdd765f114000u },
+	{ 0x88d8762bf324cd0fu, 0xa5880a69fb6ac800u }, { 0xab0e93b6efee0053u, 0x8eea0d047a457a00u },
+	{ 0xd5d238a4abe98068u, 0x72a4904598d6d880u }, { 0x85a36366eb71f041u, 0x47a6da2b7f864750u },
+	{ 0xa70c3c40a64e6c51u, 0x999090b65f67d924u }, { 0xd0cf4b50cfe20765u, 0xfff4b4e3f741cf6du },
+	{ 0x82818f1281ed449fu, 0xbff8f10e7a8921a4u }, { 0xa321f2d7226895c7u, 0xaff72d52192b6a0du },
+	{ 0xcbea6f8ceb02bb39u, 0x9bf4f8a69f764490u }, { 0xfee50b7025c36a08u, 0x02f236d04753d5b4u },
+	{ 0x9f4f2726179a2245u, 0x01d762422c946590u }, { 0xc722f0ef9d80aad6u, 0x424d3ad2b7b97ef5u },
+	{ 0xf8ebad2b84e0d58bu, 0xd2e0898765a7deb2u }, { 0x9b934c3b330c8577u, 0x63cc55f49f88eb2fu },
+	{ 0xc2781f49ffcfa6d5u, 0x3cbf6b71c76b25fbu }, { 0xf316271c7fc3908au, 0x8bef464e3945ef7au },
+	{ 0x97edd871cfda3a56u, 0x97758bf0e3cbb5acu }, { 0xbde94e8e43d0c8ecu, 0x3d52eeed1cbea317u },
+	{ 0xed63a231d4c4fb27u, 0x4ca7aaa863ee4bddu }, { 0x945e455f24fb1cf8u, 0x8fe8caa93e74ef6au },
+	{ 0xb975d6b6ee39e436u, 0xb3e2fd538e122b44u }, { 0xe7d34c64a9c85d44u, 0x60dbbca87196b616u },
+	{ 0x90e40fbeea1d3a4au, 0xbc8955e946fe31cdu }, { 0xb51d13aea4a488ddu, 0x6babab6398bdbe41u },
+	{ 0xe264589a4dcdab14u, 0xc696963c7eed2dd1u }, { 0x8d7eb76070a08aecu, 0xfc1e1de5cf543ca2u },
+	{ 0xb0de65388cc8ada8u, 0x3b25a55f43294bcbu }, { 0xdd15fe86affad912u, 0x49ef0eb713f39ebeu },
+	{ 0x8a2dbf142dfcc7abu, 0x6e3569326c784337u }, { 0xacb92ed9397bf996u, 0x49c2c37f07965404u },
+	{ 0xd7e77a8f87daf7fbu, 0xdc33745ec97be906u }, { 0x86f0ac99b4e8dafdu, 0x69a028bb3ded71a3u },
+	{ 0xa8acd7c0222311bcu, 0xc40832ea0d68ce0cu }, { 0xd2d80db02aabd62bu, 0xf50a3fa490c30190u },
+	{ 0x83c7088e1aab65dbu, 0x792667c6da79e0fau }, { 0xa4b8cab1a1563f52u, 0x577001b891185938u },
+	{ 0xcde6fd5e09abcf26u, 0xed4c0226b55e6f86u }, { 0x80b05e5ac60b6178u, 0x544f8158315b05b4u },
+	{ 0xa0dc75f1778e39d6u, 0x696361ae3db1c721u }, { 0xc913936dd571c84cu, 0x03bc3a19cd1e38e9u },
+	{ 0xfb5878494ace3a5fu, 0x04ab48a04065c723u }, { 0x9d174b2dcec0e47bu, 0x62eb0d64283f9c76u },
+	{ 0xc45d1df942711d9au, 0x3ba5d0bd324f8394u }, { 0xf5746577930d6500u, 0xca8f44ec7ee36479u },
+	{ 0x9968bf6abbe85f20u, 0x7e998b13cf4e1ecbu }, { 0xbfc2ef456ae276e8u, 0x9e3fedd8c321a67eu },
+	{ 0xefb3ab16c59b14a2u, 0xc5cfe94ef3ea101eu }, { 0x95d04aee3b80ece5u, 0xbba1f1d158724a12u },
+	{ 0xbb445da9ca61281fu, 0x2a8a6e45ae8edc97u }, { 0xea1575143cf97226u, 0xf52d09d71a3293bdu },
+	{ 0x924d692ca61be758u, 0x593c2626705f9c56u }, { 0xb6e0c377cfa2e12eu, 0x6f8b2fb00c77836cu },
+	{ 0xe498f455c38b997au, 0x0b6dfb9c0f956447u }, { 0x8edf98b59a373fecu, 0x4724bd4189bd5eacu },
+	{ 0xb2977ee300c50fe7u, 0x58edec91ec2cb657u }, { 0xdf3d5e9bc0f653e1u, 0x2f2967b66737e3edu },
+	{ 0x8b865b215899f46cu, 0xbd79e0d20082ee74u }, { 0xae67f1e9aec07187u, 0xecd8590680a3aa11u },
+	{ 0xda01ee641a708de9u, 0xe80e6f4820cc9495u }, { 0x884134fe908658b2u, 0x3109058d147fdcddu },
+	{ 0xaa51823e34a7eedeu, 0xbd4b46f0599fd415u }, { 0xd4e5e2cdc1d1ea96u, 0x6c9e18ac7007c91au },
+	{ 0x850fadc09923329eu, 0x03e2cf6bc604ddb0u }, { 0xa6539930bf6bff45u, 0x84db8346b786151cu },
+	{ 0xcfe87f7cef46ff16u, 0xe612641865679a63u }, { 0x81f14fae158c5f6eu, 0x4fcb7e8f3f60c07eu },
+	{ 0xa26da3999aef7749u, 0xe3be5e330f38f09du }, { 0xcb090c8001ab551cu, 0x5cadf5bfd3072cc5u },
+	{ 0xfdcb4fa002162a63u, 0x73d9732fc7c8f7f6u }, { 0x9e9f11c4014dda7eu, 0x2867e7fddcdd9afau },
+	{ 0xc646d63501a1511du, 0xb281e1fd541501b8u }, { 0xf7d88bc24209a565u, 0x1f225a7ca91a4226u },
+	{ 0x9ae757596946075fu, 0x3375788de9b06958u }, { 0xc1a12d2fc3978937u, 0x0052d6b1641c83aeu },
+	{ 0xf209787bb47d6b84u, 0xc0678c5dbd23a49au }, { 0x9745eb4d50ce6332u, 0xf840b7ba963646e0u },
+	{ 0xbd176620a501fbffu, 0xb650e5a93bc3d898u }, { 0xec5d3fa8ce427affu, 0xa3e51f138ab4cebeu },
+	{ 0x93ba47c980e98cdfu, 0xc66f336c36b10137u }, { 0xb8a8d9bbe123f017u, 0xb80b0047445d4184u },
+	{ 0xe6d3102ad96cec1du, 0xa60dc059157491e5u }, { 0x9043ea1ac7e41392u, 0x87c89837ad68db2fu },
+	{ 0xb454e4a179dd1877u, 0x29babe4598c311fbu }, { 0xe16a1dc9d8545e94u, 0xf4296dd6fef3d67au },
+	{ 0x8ce2529e2734bb1du, 0x1899e4a65f58660cu }, { 0xb01ae745b101e9e4u, 0x5ec05dcff72e7f8fu },
+	{ 0xdc21a1171d42645du, 0x76707543f4fa1f73u }, { 0x899504ae72497ebau, 0x6a06494a791c53a8u },
+	{ 0xabfa45da0edbde69u, 0x0487db9d17636892u }, { 0xd6f8d7509292d603u, 0x45a9d2845d3c42b6u },
+	{ 0x865b86925b9bc5c2u, 0x0b8a2392ba45a9b2u }, { 0xa7f26836f282b732u, 0x8e6cac7768d7141eu },
+	{ 0xd1ef0244af2364ffu, 0x3207d795430cd926u }, { 0x8335616aed761f1fu, 0x7f44e6bd49e807b8u },
+	{ 0xa402b9c5a8d3a6e7u, 0x5f16206c9c6209a6u }, { 0xcd036837130890a1u, 0x36dba887c37a8c0fu },
+	{ 0x802221226be55a64u, 0xc2494954da2c9789u }, { 0xa02aa96b06deb0fdu, 0xf2db9baa10b7bd6cu },
+	{ 0xc83553c5c8965d3du, 0x6f92829494e5acc7u }, { 0xfa42a8b73abbf48cu, 0xcb772339ba1f17f9u },
+	{ 0x9c69a97284b578d7u, 0xff2a760414536efbu }, { 0xc38413cf25e2d70du, 0xfef5138519684abau },
+	{ 0xf46518c2ef5b8cd1u, 0x7eb258665fc25d69u }, { 0x98bf2f79d5993802u, 0xef2f773ffbd97a61u },
+	{ 0xbeeefb584aff8603u, 0xaafb550ffacfd8fau }, { 0xeeaaba2e5dbf6784u, 0x95ba2a53f983cf38u },
+	{ 0x952ab45cfa97a0b2u, 0xdd945a747bf26183u }, { 0xba756174393d88dfu, 0x94f971119aeef9e4u },
+	{ 0xe912b9d1478ceb17u, 0x7a37cd5601aab85du }, { 0x91abb422ccb812eeu, 0xac62e055c10ab33au },
+	{ 0xb616a12b7fe617aau, 0x577b986b314d6009u }, { 0xe39c49765fdf9d94u, 0xed5a7e85fda0b80bu },
+	{ 0x8e41ade9fbebc27du, 0x14588f13be847307u }, { 0xb1d219647ae6b31cu, 0x596eb2d8ae258fc8u },
+	{ 0xde469fbd99a05fe3u, 0x6fca5f8ed9aef3bbu }, { 0x8aec23d680043beeu, 0x25de7bb9480d5854u },
+	{ 0xada72ccc20054ae9u, 0xaf561aa79a10ae6au }, { 0xd910f7ff28069da4u, 0x1b2ba1518094da04u },
+	{ 0x87aa9aff79042286u, 0x90fb44d2f05d0842u }, { 0xa99541bf57452b28u, 0x353a1607ac744a53u },
+	{ 0xd3fa922f2d1675f2u, 0x42889b8997915ce8u }, { 0x847c9b5d7c2e09b7u, 0x69956135febada11u },
+	{ 0xa59bc234db398c25u, 0x43fab9837e699095u }, { 0xcf02b2c21207ef2eu, 0x94f967e45e03f4bbu },
+	{ 0x8161afb94b44f57du, 0x1d1be0eebac278f5u }, { 0xa1ba1ba79e1632dcu, 0x6462d92a69731732u },
+	{ 0xca28a291859bbf93u, 0x7d7b8f7503cfdcfeu }, { 0xfcb2cb35e702af78u, 0x5cda735244c3d43eu },
+	{ 0x9defbf01b061adabu, 0x3a0888136afa64a7u }, { 0xc56baec21c7a1916u, 0x088aaa1845b8fdd0u },
+	{ 0xf6c69a72a3989f5bu, 0x8aad549e57273d45u }, { 0x9a3c2087a63f6399u, 0x36ac54e2f678864bu },
+	{ 0xc0cb28a98fcf3c7fu, 0x84576a1bb416a7ddu }, { 0xf0fdf2d3f3c30b9fu, 0x656d44a2a11c51d5u },
+	{ 0x969eb7c47859e743u, 0x9f644ae5a4b1b325u }, { 0xbc4665b596706114u, 0x873d5d9f0dde1feeu },
+	{ 0xeb57ff22fc0c7959u, 0xa90cb506d155a7eau }, { 0x9316ff75dd87cbd8u, 0x09a7f12442d588f2u },
+	{ 0xb7dcbf5354e9beceu, 0x0c11ed6d538aeb2fu }, { 0xe5d3ef282a242e81u, 0x8f1668c8a86da5fau },
+	{ 0x8fa475791a569d10u, 0xf96e017d694487bcu }, { 0xb38d92d760ec4455u, 0x37c981dcc395a9acu },
+	{ 0xe070f78d3927556au, 0x85bbe253f47b1417u }, { 0x8c469ab843b89562u, 0x93956d7478ccec8eu },
+	{ 0xaf58416654a6babbu, 0x387ac8d1970027b2u }, { 0xdb2e51bfe9d0696au, 0x06997b05fcc0319eu },
+	{ 0x88fcf317f22241e2u, 0x441fece3bdf81f03u }, { 0xab3c2fddeeaad25au, 0xd527e81cad7626c3u },
+	{ 0xd60b3bd56a5586f1u, 0x8a71e223d8d3b074u }, { 0x85c7056562757456u, 0xf6872d5667844e49u },
+	{ 0xa738c6bebb12d16cu, 0xb428f8ac016561dbu }, { 0xd106f86e69d785c7u, 0xe13336d701beba52u },
+	{ 0x82a45b450226b39cu, 0xecc0024661173473u }, { 0xa34d721642b06084u, 0x27f002d7f95d0190u },
+	{ 0xcc20ce9bd35c78a5u, 0x31ec038df7b441f4u }, { 0xff290242c83396ceu, 0x7e67047175a15271u },
+	{ 0x9f79a169bd203e41u, 0x0f0062c6e984d386u }, { 0xc75809c42c684dd1u, 0x52c07b78a3e60868u },
+	{ 0xf92e0c3537826145u, 0xa7709a56ccdf8a82u }, { 0x9bbcc7a142b17ccbu, 0x88a66076400bb691u },
+	{ 0xc2abf989935ddbfeu, 0x6acff893d00ea435u }, { 0xf356f7ebf83552feu, 0x0583f6b8c4124d43u },
+	{ 0x98165af37b2153deu, 0xc3727a337a8b704au }, { 0xbe1bf1b059e9a8d6u, 0x744f18c0592e4c5cu },
+	{ 0xeda2ee1c7064130cu, 0x1162def06f79df73u }, { 0x9485d4d1c63e8be7u, 0x8addcb5645ac2ba8u },
+	{ 0xb9a74a0637ce2ee1u, 0x6d953e2bd7173692u }, { 0xe8111c87c5c1ba99u, 0xc8fa8db6ccdd0437u },
+	{ 0x910ab1d4db9914a0u, 0x1d9c9892400a22a2u }, { 0xb54d5e4a127f59c8u, 0x2503beb6d00cab4bu },
+	{ 0xe2a0b5dc971f303au, 0x2e44ae64840fd61du }, { 0x8da471a9de737e24u, 0x5ceaecfed289e5d2u },
+	{ 0xb10d8e1456105dadu, 0x7425a83e872c5f47u }, { 0xdd50f1996b947518u, 0xd12f124e28f77719u },
+	{ 0x8a5296ffe33cc92fu, 0x82bd6b70d99aaa6fu }, { 0xace73cbfdc0bfb7bu, 0x636cc64d1001550bu },
+	{ 0xd8210befd30efa5au, 0x3c47f7e05401aa4eu }, { 0x8714a775e3e95c78u, 0x65acfaec34810a71u },
+	{ 0xa8d9d1535ce3b396u, 0x7f1839a741a14d0du }, { 0xd31045a8341ca07cu, 0x1ede48111209a050u },
+	{ 0x83ea2b892091e44du, 0x934aed0aab460432u }, { 0xa4e4b66b68b65d60u, 0xf81da84d5617853fu },
+	{ 0xce1de40642e3f4b9u, 0x36251260ab9d668eu }, { 0x80d2ae83e9ce78f3u, 0xc1d72b7c6b426019u },
+	{ 0xa1075a24e4421730u, 0xb24cf65b8612f81fu }, { 0xc94930ae1d529cfcu, 0xdee033f26797b627u },
+	{ 0xfb9b7cd9a4a7443cu, 0x169840ef017da3b1u }, { 0x9d412e0806e88aa5u, 0x8e1f289560ee864eu },
+	{ 0xc491798a08a2ad4eu, 0xf1a6f2bab92a27e2u }, { 0xf5b5d7ec8acb58a2u, 0xae10af696774b1dbu },
+	{ 0x9991a6f3d6bf1765u, 0xacca6da1e0a8ef29u }, { 0xbff610b0cc6edd3fu, 0x17fd090a58d32af3u },
+	{ 0xeff394dcff8a948eu, 0xddfc4b4cef07f5b0u }, { 0x95f83d0a1fb69cd9u, 0x4abdaf101564f98eu },
+	{ 0xbb764c4ca7a4440fu, 0x9d6d1ad41abe37f1u }, { 0xea53df5fd18d5513u, 0x84c86189216dc5edu },
+	{ 0x92746b9be2f8552cu, 0x32fd3cf5b4e49bb4u }, { 0xb7118682dbb66a77u, 0x3fbc8c33221dc2a1u },
+	{ 0xe4d5e82392a40515u, 0x0fabaf3feaa5334au }, { 0x8f05b1163ba6832du, 0x29cb4d87f2a7400eu },
+	{ 0xb2c71d5bca9023f8u, 0x743e20e9ef511012u }, { 0xdf78e4b2bd342cf6u, 0x914da9246b255416u },
+	{ 0x8bab8eefb6409c1au, 0x1ad089b6c2f7548eu }, { 0xae9672aba3d0c320u, 0xa184ac2473b529b1u },
+	{ 0xda3c0f568cc4f3e8u, 0xc9e5d72d90a2741eu }, { 0x8865899617fb1871u, 0x7e2fa67c7a658892u },
+	{ 0xaa7eebfb9df9de8du, 0xddbb901b98feeab7u }, { 0xd51ea6fa85785631u, 0x552a74227f3ea565u },
+	{ 0x8533285c936b35deu, 0xd53a88958f87275fu }, { 0xa67ff273b8460356u, 0x8a892abaf368f137u },
+	{ 0xd01fef10a657842cu, 0x2d2b7569b0432d85u }, { 0x8213f56a67f6b29bu, 0x9c3b29620e29fc73u },
+	{ 0xa298f2c501f45f42u, 0x8349f3ba91b47b8fu }, { 0xcb3f2f7642717713u, 0x241c70a936219a73u },
+	{ 0xfe0efb53d30dd4d7u, 0xed238cd383aa0110u }, { 0x9ec95d1463e8a506u, 0xf4363804324a40aau },
+	{ 0xc67bb4597ce2ce48u, 0xb143c6053edcd0d5u }, { 0xf81aa16fdc1b81dau, 0xdd94b7868e94050au },
+	{ 0x9b10a4e5e9913128u, 0xca7cf2b4191c8326u }, { 0xc1d4ce1f63f57d72u, 0xfd1c2f611f63a3f0u },
+	{ 0xf24a01a73cf2dccfu, 0xbc633b39673c8cecu }, { 0x976e41088617ca01u, 0xd5be0503e085d813u },
+	{ 0xbd49d14aa79dbc82u, 0x4b2d8644d8a74e18u }, { 0xec9c459d51852ba2u, 0xddf8e7d60ed1219eu },
+	{ 0x93e1ab8252f33b45u, 0xcabb90e5c942b503u }, { 0xb8da1662e7b00a17u, 0x3d6a751f3b936243u },
+	{ 0xe7109bfba19c0c9du, 0x0cc512670a783ad4u }, { 0x906a617d450187e2u, 0x27fb2b80668b24c5u },
+	{ 0xb484f9dc9641e9dau, 0xb1f9f660802dedf6u }, { 0xe1a63853bbd26451u, 0x5e7873f8a0396973u },
+	{ 0x8d07e33455637eb2u, 0xdb0b487b6423e1e8u }, { 0xb049dc016abc5e5fu, 0x91ce1a9a3d2cda62u },
+	{ 0xdc5c5301c56b75f7u, 0x7641a140cc7810fbu }, { 0x89b9b3e11b6329bau, 0xa9e904c87fcb0a9du },
+	{ 0xac2820d9623bf429u, 0x546345fa9fbdcd44u }, { 0xd732290fbacaf133u, 0xa97c177947ad4095u },
+	{ 0x867f59a9d4bed6c0u, 0x49ed8eabcccc485du }, { 0xa81f301449ee8c70u, 0x5c68f256bfff5a74u },
+	{ 0xd226fc195c6a2f8cu, 0x73832eec6fff3111u }, { 0x83585d8fd9c25db7u, 0xc831fd53c5ff7eabu },
+	{ 0xa42e74f3d032f525u, 0xba3e7ca8b77f5e55u }, { 0xcd3a1230c43fb26fu, 0x28ce1bd2e55f35ebu },
+	{ 0x80444b5e7aa7cf85u, 0x7980d163cf5b81b3u }, { 0xa0555e361951c366u, 0xd7e105bcc332621fu },
+	{ 0xc86ab5c39fa63440u, 0x8dd9472bf3fefaa7u }, { 0xfa856334878fc150u, 0xb14f98f6f0feb951u },
+	{ 0x9c935e00d4b9d8d2u, 0x6ed1bf9a569f33d3u }, { 0xc3b8358109e84f07u, 0x0a862f80ec4700c8u },
+	{ 0xf4a642e14c6262c8u, 0xcd27bb612758c0fau }, { 0x98e7e9cccfbd7dbdu, 0x8038d51cb897789cu },
+	{ 0xbf21e44003acdd2cu, 0xe0470a63e6bd56c3u }, { 0xeeea5d5004981478u, 0x1858ccfce06cac74u },
+	{ 0x95527a5202df0ccbu, 0x0f37801e0c43ebc8u }, { 0xbaa718e68396cffdu, 0xd30560258f54e6bau },
+	{ 0xe950df20247c83fdu, 0x47c6b82ef32a2069u }, { 0x91d28b7416cdd27eu, 0x4cdc331d57fa5441u },
+	{ 0xb6472e511c81471du, 0xe0133fe4adf8e952u }, { 0xe3d8f9e563a198e5u, 0x58180fddd97723a6u },
+	{ 0x8e679c2f5e44ff8fu, 0x570f09eaa7ea7648u }
+	};
+/*============================================================================*/
+/* The Eisel-Lemire algorithm: converts 'Mantissa' * 10^'Exp10' (with 'Mantissa'
+   exact and non-zero) to the nearest double, rounding half to even. With the
+   second 64-bit product the result is always correctly rounded for an exact
+   mantissa of up to 19 digits (Mushtak and Lemire, "Fast Number Parsing
+   Without Fallback"), so there is no case left undecided. */
+static void EiselLemire( uint64_t Mantissa, int64_t Exp10, int Negative, double * restrict Value )
+	{
+	unsigned __int128	Product;
+	uint64_t			High, Low, Bits;
+	int					LeadingZeros, UpperBit, Shift;
+	int64_t				Power2;
+
+	if( Exp10 < -342 )
+		{
+		Bits	= 0;
+		goto Done;
+		}
+
+	if( Exp10 > 308 )
+		{
+		Bits	= 0x7ffull << 52;
+		goto Done;
+		}
+
+	LeadingZeros	= __builtin_clzll( Mantissa );
+	Mantissa	  <<= LeadingZeros;
+
+	/* The first 64-bit product is enough unless its low bits are all ones. */
+	Product	= (unsigned __int128)Mantissa * Pow5_128[Exp10 + 342][0];
+	High	= (uint64_t)( Product >> 64 );
+	Low		= (uint64_t)Product;
+
+	if(( High & 0x1ff ) == 0x1ff )
+		{
+		unsigned __int128	Second	= (unsigned __int128)Mantissa * Pow5_128[Exp10 + 342][1];
+		uint64_t			SecondHigh	= (uint64_t)( Second >> 64 );
+
+		Low	   += SecondHigh;
+		if( SecondHigh > Low )
+			High++;
+		}
+
+	UpperBit	= (int)( High >> 63 );
+	Shift		= UpperBit + 64 - 52 - 3;
+	Mantissa	= High >> Shift;
+	Power2		= (((( 152170 + 65536 ) * Exp10 ) >> 16 ) + 63 ) + UpperBit - LeadingZeros + 1023;
+
+	if( Power2 <= 0 )
+		{
+		/* A subnormal number (or zero). */
+		if( -Power2 + 1 >= 64 )
+			{
+			Bits	= 0;
+			goto Done;
+			}
+		Mantissa  >>= -Power2 + 1;
+		Mantissa   += Mantissa & 1;
+		Mantissa  >>= 1;
+		Power2		= Mantissa < ( 1ull << 52 ) ? 0 : 1;
+		Bits		= ( Mantissa & (( 1ull << 52 ) - 1 )) | ( (uint64_t)Power2 << 52 );
+		goto Done;
+		}
+
+	/* The product is exactly half-way between two doubles, we must round to even. */
+	if( Low <= 1 && Exp10 >= -4 && Exp10 <= 23 && ( Mantissa & 3 ) == 1 && ( Mantissa << Shift ) == High )
+		Mantissa   &= ~1ull;
+
+	Mantissa   += Mantissa & 1;
+	Mantissa  >>= 1;
+
+	if( Mantissa >= ( 2ull << 52 ))
+		{
+		Mantissa	= 1ull << 52;
+		Power2++;
+		}
+
+	if( Power2 >= 0x7ff )
+		Bits	= 0x7ffull << 52;
+	else
+		Bits	= ( Mantissa & (( 1ull << 52 ) - 1 )) | ( (uint64_t)Power2 << 52 );
+
+Done:
+	Bits   |= (uint64_t)Negative << 63;
+	memcpy( Value, &Bits, sizeof *Value );
+	}
+/*============================================================================*/
+/* Returns non-zero if the 'Len' characters at 'Ptr' are 'Word' (in lower case),
+   ignoring the case. */
+static int MatchWord( const char * restrict Ptr, ssize_t Len, const char * restrict Word )
+	{
+	ssize_t	i;
+
+	for( i = 0; Word[i] != '\0'; i++ )
+		if( i >= Len || tolower( (unsigned char)Ptr[i] ) != Word[i] )
+			return 0;
+
+	return 1;
+	}
+/*============================================================================*/
+/* The "C" locale, for the numbers that 's_parse_f64_v' hands to the C library,
+   which must not depend on the decimal point of the current locale. */
+static locale_t			CLocale;
+static pthread_once_t	CLocaleOnce	= PTHREAD_ONCE_INIT;
+/*============================================================================*/
+static void CreateCLocale( void )
+	{
+	CLocale	= newlocale( LC_ALL_MASK, "C", (locale_t)0 );
+	}
+/*============================================================================*/
+ssize_t s_parse_f64_v( s_view_t view, double * restrict value )
+	{
+	static const double	PowersOf10[23]	=
+		{
+		1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+	const char	*Ptr	= view.Ptr;
+	ssize_t		Len		= view.Len;
+	ssize_t		i		= 0, DigitsStart;
+	uint64_t	Mantissa	= 0;
+	int64_t		Exp10		= 0;
+	int			Significant	= 0, Truncated = 0, Negative = 0, AnyDigit = 0;
+	double		Result;
+
+	STATS_CALL( s_parse_f64_v );
+
+	if( Ptr == NULL || Len <= 0 )
+		return 0;
+
+	if( Ptr[0] == '-' || Ptr[0] == '+' )
+		Negative	= Ptr[i++] == '-';
+
+	/* Infinities and NaNs are spelled the same way as accepted by 'strtod'. */
+	if( i < Len && ( Ptr[i] | 0x20 ) == 'i' && MatchWord( Ptr + i, Len - i, "inf" ))
+		{
+		Result	= Negative ? -__builtin_inf() : __builtin_inf();
+		i	   += MatchWord( Ptr + i, Len - i, "infinity" ) ? 8 : 3;
+		goto Finish;
+		}
+
+	if( i < Len && ( Ptr[i] | 0x20 ) == 'n' && MatchWord( Ptr + i, Len - i, "nan" ))
+		{
+		Result	= Negative ? -__builtin_nan( "" ) : __builtin_nan( "" );
+		i	   += 3;
+		goto Finish;
+		}
+
+	/* Up to 19 significant digits are accumulated in 'Mantissa'. The leading
+	   zeros are not significant. Any digit beyond that makes the result inexact. */
+	for( DigitsStart = i; i < Len; i++ )
+		{
+		if( Ptr[i] < '0' || Ptr[i] > '9' )
+			break;
+		if( Significant + 8 <= 19 && Mantissa != 0 && Len - i >= 8 && Is8Digits( Load8( Ptr + i )))
+			{
+			Mantissa	= Mantissa * 100000000u + Parse8Digits( Load8( Ptr + i ));
+			Significant+= 8;
+			i		   += 7;
+			}
+		else if( Significant < 19 )
+			{
+			Mantissa	= Mantissa * 10 + ( Ptr[i] - '0' );
+			Significant+= Mantissa != 0;
+			}
+		else
+			{
+			Truncated  |= Ptr[i] != '0';
+			Exp10++;
+			}
+		}
+
+	AnyDigit	= i > DigitsStart;
+
+	if( i < Len && Ptr[i] == '.' )
+		{
+		for( DigitsStart = ++i; i < Len; i++ )
+			{
+			if( Ptr[i] < '0' || Ptr[i] > '9' )
+				break;
+			if( Significant + 8 <= 19 && Mantissa != 0 && Len - i >= 8 && Is8Digits( Load8( Ptr + i )))
+				{
+				Mantissa	= Mantissa * 100000000u + Parse8Digits( Load8( Ptr + i ));
+				Significant+= 8;
+				Exp10	   -= 8;
+				i		   += 7;
+				}
+			else if( Significant < 19 )
+				{
+				Mantissa	= Mantissa * 10 + ( Ptr[i] - '0' );
+				Significant+= Mantissa != 0;
+				Exp10--;
+				}
+			else
+				Truncated  |= Ptr[i] != '0';
+			}
+
+		AnyDigit   |= i > DigitsStart;
+
+		/* A lone '.' is not a number. */
+		if( !AnyDigit )
+			return 0;
+		}
+
+	if( !AnyDigit )
+		return 0;
+
+	/* The exponent is only consumed if it has at least one digit. */
+	if( i < Len && ( Ptr[i] | 0x20 ) == 'e' )
+		{
+		ssize_t	j			= i + 1;
+		int		ExpNegative	= 0;
+		int64_t	Exponent	= 0;
+
+		if( j < Len && ( Ptr[j] == '-' || Ptr[j] == '+' ))
+			ExpNegative	= Ptr[j++] == '-';
+
+		if( j < Len && Ptr[j] >= '0' && Ptr[j] <= '9' )
+			{
+			for( ; j < Len && Ptr[j] >= '0' && Ptr[j] <= '9'; j++ )
+				/* Anything this big is already an overflow or an underflow. */
+				if( Exponent < 100000 )
+					Exponent	= Exponent * 10 + ( Ptr[j] - '0' );
+
+			Exp10  += ExpNegative ? -Exponent : Exponent;
+			i		= j;
+			}
+		}
+
+	if( Mantissa == 0 && !Truncated )
+		{
+		Result	= Negative ? -0.0 : 0.0;
+		goto Finish;
+		}
+
+	/* Clinger's fast path: both the mantissa and the power of ten are exact doubles. */
+	if( !Truncated && Mantissa <= ( 1ull << 53 ) && Exp10 >= -22 && Exp10 <= 22 )
+		{
+		Result	= (double)Mantissa;
+		Result	= Exp10 < 0 ? Result / PowersOf10[-Exp10] : Result * PowersOf10[Exp10];
+		Result	= Negative ? -Result : Result;
+		goto Finish;
+		}
+
+	if( !Truncated )
+		{
+		EiselLemire( Mantissa, Exp10, Negative, &Result );
+		goto Finish;
+		}
+
+	/* The slow path, the number has too many digits. We let the C library do the
+	   work on a NUL terminated copy of the number, always in the "C" locale. */
+		{
+		char	Local[128];
+		char	*Copy;
+
+		pthread_once( &CLocaleOnce, CreateCLocale );
+
+		if( CLocale == (locale_t)0 )
+			return -1;
+
+		if(( Copy = i < (ssize_t)sizeof Local ? Local : Allocate( NULL, i + 1 )) == NULL )
+			return -1;
+
+		if( Copy != Local )
+			STATS_ALLOC( s_parse_f64_v );
+
+		memcpy( Copy, Ptr, i );
+		Copy[i]	= '\0';
+		Result	= strtod_l( Copy, NULL, CLocale );
+
+		if( Copy != Local )
+			Release( NULL, Copy );
+		}
+
+Finish:
+	if( value != NULL )
+		*value	= Result;
+
+	return i;
+	}
+/*============================================================================*/
+ssize_t s_parse_u64( const s_string_t * restrict str, ssize_t start, ssize_t len, uint64_t * restrict value )
+	{
+	STATS_CALL( s_parse_u64 );
+
+	return s_parse_u64_v( s_view( str, start, len ), value );
+	}
+/*============================================================================*/
+ssize_t s_parse_i64( const s_string_t * restrict str, ssize_t start, ssize_t len, int64_t * restrict value )
+	{
+	STATS_CALL( s_parse_i64 );
+
+	return s_parse_i64_v( s_view( str, start, len ), value );
+	}
+/*============================================================================*/
+ssize_t s_parse_f64( const s_string_t * restrict str, ssize_t start, ssize_t len, double * restrict value )
+	{
+	STATS_CALL( s_parse_f64 );
+
+	return s_parse_f64_v( s_view( str, start, len ), value );
+	}
+/*============================================================================*/
+/* Validates UTF-8 (RFC 3629: no overlong forms, no surrogates and nothing above
+   U+10FFFF) one character at a time. Used when there is no SIMD support.
+   Returns non-zero if the 'Len' bytes at 'Ptr' are valid. */
+static int Utf8ValidateScalar( const uint8_t * restrict Ptr, size_t Len )
+	{
+	size_t	i	= 0;
+	uint8_t	c, Low, High;
+
+	while( i < Len )
+		{
+		uint64_t	Word;
+
+		/* Eight ASCII characters at a time while we can... */
+		if( Len - i >= 8 && ( memcpy( &Word, Ptr + i, sizeof Word ), ( Word & 0x8080808080808080ull ) == 0 ))
+			{
+			i  += 8;
+			continue;
+			}
+
+		if(( c = Ptr[i] ) < 0x80 )
+			{
+			i++;
+			continue;
+			}
+
+		/* The range of the second byte is narrower for some lead bytes, to
+		   reject overlong forms, surrogates and values above U+10FFFF. */
+		Low		= c == 0xe0 ? 0xa0 : c == 0xf0 ? 0x90 : 0x80;
+		High	= c == 0xed ? 0x9f : c == 0xf4 ? 0x8f : 0xbf;
+
+		if( c >= 0xc2 && c <= 0xdf )
+			{
+			if( Len - i < 2 || Ptr[i+1] < 0x80 || Ptr[i+1] > 0xbf )
+				return 0;
+			i  += 2;
+			}
+		else if( c >= 0xe0 && c <= 0xef )
+			{
+			if( Len - i < 3 || Ptr[i+1] < Low || Ptr[i+1] > High || ( Ptr[i+2] & 0xc0 ) != 0x80 )
+				return 0;
+			i  += 3;
+			}
+		else if( c >= 0xf0 && c <= 0xf4 )
+			{
+			if( Len - i < 4 || Ptr[i+1] < Low || Ptr[i+1] > High || ( Ptr[i+2] & 0xc0 ) != 0x80 || ( Ptr[i+3] & 0xc0 ) != 0x80 )
+				return 0;
+			i  += 4;
+			}
+		else
+			return 0;
+		}
+
+	return 1;
+	}
+/*============================================================================*/
+#if			defined __x86_64__ || defined __i386__
+
+/* The error classes of the 'lookup' UTF-8 validation algorithm (John Keiser and
+   Daniel Lemire, "Validating UTF-8 in less than one instruction per byte").
+   Each pair of consecutive bytes is classified by three table lookups (the high
+   and the low nibbles of the first byte and the high nibble of the second), and
+   the pair is invalid if the three results have a bit in common. */
+#define	UTF8_TOO_SHORT		( 1 << 0 )	/* A lead byte followed by another lead byte or by ASCII. */
+#define	UTF8_TOO_LONG		( 1 << 1 )	/* ASCII followed by a continuation byte. */
+#define	UTF8_OVERLONG_3		( 1 << 2 )	/* E0 80..9F */
+#define	UTF8_TOO_LARGE		( 1 << 3 )	/* F4 90..BF or F5..FF */
+#define	UTF8_SURROGATE		( 1 << 4 )	/* ED A0..BF */
+#define	UTF8_OVERLONG_2		( 1 << 5 )	/* C0..C1 */
+#define	UTF8_TOO_LARGE_1000	( 1 << 6 )	/* F5..FF 80..8F */
+#define	UTF8_OVERLONG_4		( 1 << 6 )	/* F0 80..8F */
+#define	UTF8_TWO_CONTS		( 1 << 7 )	/* Two continuation bytes, must be the 3rd/4th byte of a sequence. */
+#define	UTF8_CARRY			( UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS )
+
+/* Validates 16 bytes at a time with SSSE3 (PSHUFB). The last partial block is
+   padded with zeros, which are valid ASCII. */
+__attribute__((target("ssse3")))
+static int Utf8ValidateSSSE3( const uint8_t * restrict Ptr, size_t Len )
+	{
+	const __m128i	Byte1High	= _mm_setr_epi8(
+		UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+		UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+		UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+		UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+		UTF8_TOO_SHORT,
+		UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+		(char)( UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4 ));
+	const __m128i	Byte1Low	= _mm_setr_epi8(
+		UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+		UTF8_CARRY | UTF8_OVERLONG_2,
+		UTF8_CARRY,
+		UTF8_CARRY,
+		UTF8_CARRY | UTF8_TOO_LARGE,
+		(char)( UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 ),
+		(char)( UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 ),
+		(char)( UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 ),
+		(char)( UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 ),
+		(char)( UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 ),
+		(char)( UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 ),
+		(char)( UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 ),
+		(char)( UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 ),
+		(char)( UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE ),
+		(char)( UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 ),
+		(char)( UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 ));
+	const __m128i	Byte2High	= _mm_setr_epi8(
+		UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+		UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+		(char)( UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4 ),
+		(char)( UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE ),
+		(char)( UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE ),
+		(char)( UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE ),
+		UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT );
+	/* A block ending with any of these bytes leaves a sequence unfinished. */
+	const __m128i	MaxValue	= _mm_setr_epi8( -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)( 0xf0 - 1 ), (char)( 0xe0 - 1 ), (char)( 0xc0 - 1 ));
+	const __m128i	Nibble		= _mm_set1_epi8( 0x0f );
+	__m128i			Error		= _mm_setzero_si128();
+	__m128i			Prev		= _mm_setzero_si128();
+	__m128i			Incomplete	= _mm_setzero_si128();
+	uint8_t			Tail[16];
+	size_t			i;
+
+	for( i = 0; i < Len; i += 16 )
+		{
+		__m128i	Input, Prev1, Prev2, Prev3, Special, MustBeCont;
+
+		if( Len - i >= 16 )
+			Input	= _mm_loadu_si128( (const __m128i*)( Ptr + i ));
+		else
+			{
+			memset( Tail, 0, sizeof Tail );
+			memcpy( Tail, Ptr + i, Len - i );
+			Input	= _mm_loadu_si128( (const __m128i*)Tail );
+			}
+
+		/* A block of ASCII characters can only be wrong if the previous block
+		   ended in the middle of a sequence. */
+		if( _mm_movemask_epi8( Input ) == 0 )
+			{
+			Error		= _mm_or_si128( Error, Incomplete );
+			Incomplete	= _mm_setzero_si128();
+			Prev		= Input;
+			continue;
+			}
+
+		Prev1		= _mm_alignr_epi8( Input, Prev, 15 );
+		Special		= _mm_and_si128( _mm_and_si128(
+						_mm_shuffle_epi8( Byte1High, _mm_and_si128( _mm_srli_epi16( Prev1, 4 ), Nibble )),
+						_mm_shuffle_epi8( Byte1Low, _mm_and_si128( Prev1, Nibble ))),
+						_mm_shuffle_epi8( Byte2High, _mm_and_si128( _mm_srli_epi16( Input, 4 ), Nibble )));
+
+		/* The two bytes after a three byte lead and the three bytes after a four
+		   byte lead must be continuations, and the lookups above flag exactly
+		   them with 'TWO_CONTS'. */
+		Prev2		= _mm_alignr_epi8( Input, Prev, 14 );
+		Prev3		= _mm_alignr_epi8( Input, Prev, 13 );
+		MustBeCont	= _mm_or_si128( _mm_subs_epu8( Prev2, _mm_set1_epi8( (char)( 0xe0 - 0x80 ))), _mm_subs_epu8( Prev3, _mm_set1_epi8( (char)( 0xf0 - 0x80 ))));
+		MustBeCont	= _mm_and_si128( MustBeCont, _mm_set1_epi8( (char)0x80 ));
+
+		Error		= _mm_or_si128( Error, _mm_xor_si128( MustBeCont, Special ));
+		Incomplete	= _mm_subs_epu8( Input, MaxValue );
+		Prev		= Input;
+		}
+
+	Error	= _mm_or_si128( Error, Incomplete );
+
+	return _mm_movemask_epi8( _mm_cmpeq_epi8( Error, _mm_setzero_si128() )) == 0xffff;
+	}
+
+#endif	/*	defined __x86_64__ || defined __i386__ */
+/*============================================================================*/
+/* Returns non-zero if the 'Len' bytes at 'Ptr' are valid UTF-8, using the
+   fastest validator this processor supports. */
+static int Utf8Validate( const uint8_t * restrict Ptr, size_t Len )
+	{
+#if			defined __x86_64__ || defined __i386__
+	if( __builtin_cpu_supports( "ssse3" ))
+		return Utf8ValidateSSSE3( Ptr, Len );
+#endif	/*	defined __x86_64__ || defined __i386__ */
+
+	return Utf8ValidateScalar( Ptr, Len );
+	}
+/*============================================================================*/
+/* Returns the number of code points in the 'Len' bytes of valid UTF-8 at 'Ptr',
+   that is, the number of bytes that are not continuation bytes (10xxxxxx). */
+static size_t Utf8Count( const uint8_t * restrict Ptr, size_t Len )
+	{
+	size_t	Continuations	= 0;
+	size_t	i				= 0;
+
+#if			defined __SSE2__
+	while( Len - i >= 16 )
+		{
+		__m128i	Counters	= _mm_setzero_si128();
+		int		n;
+
+		/* The continuation bytes are less than -64 as signed characters. Each
+		   byte counter can be incremented at most 255 times before being added up. */
+		for( n = 0; n < 255 && Len - i >= 16; n++, i += 16 )
+			Counters	= _mm_sub_epi8( Counters, _mm_cmpgt_epi8( _mm_set1_epi8( -64 ), _mm_loadu_si128( (const __m128i*)( Ptr + i ))));
+
+		Counters		= _mm_sad_epu8( Counters, _mm_setzero_si128() );
+		Continuations  += _mm_extract_epi16( Counters, 0 ) + _mm_extract_epi16( Counters, 4 );
+		}
+#endif	/*	defined __SSE2__ */
+
+	for( ; i < Len; i++ )
+		Continuations  += ( Ptr[i] & 0xc0 ) == 0x80;
+
+	return Len - Continuations;
+	}
+/*============================================================================*/
+/* Returns the number of code points of 'str' or UTF8_INVALID. The result is
+   cached in the header extension of the strings that have one. 'CodePoints'
+   may be misaligned, so it is copied with 'memcpy' and published by the flag
+   EXT_CODEPOINTS. Concurrent readers may both fill the cache, but they write
+   the same bytes, and only after they see the flag do the others read them. */
+static int64_t Utf8Info( const s_string_t * restrict str )
+	{
+	s_string_ext_t	*Ext	= GetExt( str );
+	const uint8_t	*Ptr;
+	ssize_t			Len;
+	int64_t			CodePoints;
+
+	if( Ext != NULL && ( __atomic_load_n( &Ext->Valid, __ATOMIC_ACQUIRE ) & EXT_CODEPOINTS ))
+		{
+		memcpy( &CodePoints, &Ext->CodePoints, sizeof CodePoints );
+		return CodePoints;
+		}
+
+	Ptr			= (const uint8_t*)s_constcstr( str, 0 );
+	Len			= s_strlen( str );
+	CodePoints	= Utf8Validate( Ptr, Len ) ? (int64_t)Utf8Count( Ptr, Len ) : UTF8_INVALID;
+
+	if( Ext != NULL )
+		{
+		memcpy( &Ext->CodePoints, &CodePoints, sizeof CodePoints );
+		__atomic_fetch_or( &Ext->Valid, EXT_CODEPOINTS, __ATOMIC_RELEASE );
+		}
+
+	return CodePoints;
+	}
+/*============================================================================*/
+int s_utf8_validate_v( s_view_t view )
+	{
+	STATS_CALL( s_utf8_validate_v );
+
+	if( view.Ptr == NULL || view.Len <= 0 )
+		return 1;
+
+	return Utf8Validate( (const uint8_t*)view.Ptr, view.Len );
+	}
+/*============================================================================*/
+int s_utf8_validate( const s_string_t * restrict str )
+	{
+	STATS_CALL( s_utf8_validate );
+
+	return Utf8Info( str ) != UTF8_INVALID;
+	}
+/*============================================================================*/
+ssize_t s_utf8_len_v( s_view_t view )
+	{
+	STATS_CALL( s_utf8_len_v );
+
+	if( view.Ptr == NULL || view.Len <= 0 )
+		return 0;
+
+	if( !Utf8Validate( (const uint8_t*)view.Ptr, view.Len ))
+		return -1;
+
+	return Utf8Count( (const uint8_t*)view.Ptr, view.Len );
+	}
+/*============================================================================*/
+ssize_t s_utf8_len( const s_string_t * restrict str )
+	{
+	int64_t	CodePoints	= Utf8Info( str );
+
+	STATS_CALL( s_utf8_len );
+
+	return CodePoints == UTF8_INVALID ? -1 : CodePoints;
+	}
+/*============================================================================*/
+/* Returns the position of the 'N'th (from zero) code point of the 'Len' bytes
+   of valid UTF-8 at 'Ptr', counting from the code point that begins at 'From',
+   or 'Len' if there are not enough code points. Whole blocks of 16 bytes are
+   skipped by counting their lead (non-continuation) bytes. */
+static size_t Utf8Skip( const uint8_t * restrict Ptr, size_t Len, size_t From, size_t N )
+	{
+	size_t	i	= From;
+
+#if			defined __SSE2__
+	for( ; Len - i >= 16; i += 16 )
+		{
+		/* The continuation bytes are less than -64 as signed characters. */
+		unsigned	Leads	= ~_mm_movemask_epi8( _mm_cmpgt_epi8( _mm_set1_epi8( -64 ), _mm_loadu_si128( (const __m128i*)( Ptr + i )))) & 0xffff;
+		size_t		Count	= __builtin_popcount( Leads );
+
+		if( N < Count )
+			{
+			/* The code point we want begins in this block, let's drop the leads before it. */
+			for( ; N > 0; N-- )
+				Leads  &= Leads - 1;
+			return i + __builtin_ctz( Leads );
+			}
+
+		N  -= Count;
+		}
+#endif	/*	defined __SSE2__ */
+
+	for( ; i < Len; i++ )
+		if(( Ptr[i] & 0xc0 ) != 0x80 && N-- == 0 )
+			return i;
+
+	return Len;
+	}
+/*============================================================================*/
+/* Held while a code point index is being built, so only one thread builds it
+   (and allocates it, for the strings with indirect payload). */
+static pthread_mutex_t	IndexLock	= PTHREAD_MUTEX_INITIALIZER;
+/*============================================================================*/
+/* Returns a pointer to the code point checkpoints of 'str', which are right
+   after the header extension or, for the strings with indirect payload, in a
+   block of their own (NULL if it was not allocated yet). */
+static inline uint8_t *Utf8Checkpoints( const s_string_t * restrict str, const s_string_ext_t * restrict Ext )
+	{
+	if( Ext->Data != NULL )
+		return (uint8_t*)Ext->Index;
+
+	return (uint8_t*)&str->PayLoad[ExtOffset( str ) + sizeof( s_string_ext_t )];
+	}
+/*============================================================================*/
+/* Returns the byte offset of the code point 'Index' of 'str', which must be
+   valid UTF-8 with more than 'Index' code points. Strings with room for a
+   code point index get it built on the first call, so any later call scans
+   at most UTF8_INDEX_STEP code points until the string is changed. */
+static size_t Utf8Offset( const s_string_t * restrict str, size_t Index )
+	{
+	s_string_ext_t	*Ext	= GetExt( str );
+	const uint8_t	*Ptr	= (const uint8_t*)s_constcstr( str, 0 );
+	size_t			Len		= s_strlen( str );
+	uint8_t			*Checkpoints;
+	uint32_t		Offset, k;
+
+	if( Ext == NULL || Ext->IndexCap == 0 )
+		return Utf8Skip( Ptr, Len, 0, Index );
+
+	/* The index is built lazily, the first time it is needed after a change.
+	   It is a cache, it may be filled even for a 'const' string, so the
+	   checkpoints are published by EXT_INDEX, as 'Utf8Info' does. */
+	if(( __atomic_load_n( &Ext->Valid, __ATOMIC_ACQUIRE ) & EXT_INDEX ) == 0 )
+		{
+		pthread_mutex_lock( &IndexLock );
+
+		/* The strings with indirect payload (a memory mapped file, for
+		   instance) get the memory for their index only when it is needed. */
+		if( Ext->Data != NULL && Ext->Index == NULL )
+			Ext->Index	= Allocate( StringAllocator( str, NULL ), Ext->IndexCap * sizeof( uint32_t ));
+
+		/* Another thread may have built it while we waited. */
+		if(( Checkpoints = Utf8Checkpoints( str, Ext )) != NULL && ( __atomic_load_n( &Ext->Valid, __ATOMIC_ACQUIRE ) & EXT_INDEX ) == 0 )
+			{
+			for( Offset = 0, k = 0; k < Ext->IndexCap && Offset < Len; k++ )
+				{
+				memcpy( &Checkpoints[k * sizeof Offset], &Offset, sizeof Offset );
+				Offset	= Utf8Skip( Ptr, Len, Offset, UTF8_INDEX_STEP );
+				}
+			__atomic_fetch_or( &Ext->Valid, EXT_INDEX, __ATOMIC_RELEASE );
+			}
+
+		pthread_mutex_unlock( &IndexLock );
+
+		/* Without memory for the index we just scan the string. */
+		if( Checkpoints == NULL )
+			return Utf8Skip( Ptr, Len, 0, Index );
+		}
+	else
+		Checkpoints	= Utf8Checkpoints( str, Ext );
+
+	k	= Index / UTF8_INDEX_STEP;
+	memcpy( &Offset, &Checkpoints[k * sizeof Offset], sizeof Offset );
+
+	return Utf8Skip( Ptr, Len, Offset, Index % UTF8_INDEX_STEP );
+	}
+/*============================================================================*/
+ssize_t s_utf8_offset( const s_string_t * restrict str, ssize_t index )
+	{
+	int64_t	CodePoints	= Utf8Info( str );
+
+	STATS_CALL( s_utf8_offset );
+
+	if( CodePoints == UTF8_INVALID )
+		return -1;
+
+	if( index < 0 )
+		index  += CodePoints;
+
+	/* The position right after the last code point is also valid, it is the length of the string. */
+	if( index < 0 || index > CodePoints )
+		return -1;
+
+	if( index == CodePoints )
+		return s_strlen( str );
+
+	return Utf8Offset( str, index );
+	}
+/*============================================================================*/
+int32_t s_utf8_at( const s_string_t * restrict str, ssize_t index )
+	{
+	const uint8_t	*Ptr;
+	int64_t			CodePoints	= Utf8Info( str );
+	int32_t			Value;
+
+	STATS_CALL( s_utf8_at );
+
+	if( CodePoints == UTF8_INVALID )
+		return -1;
+
+	if( index < 0 )
+		index  += CodePoints;
+
+	if( index < 0 || index >= CodePoints )
+		return -1;
+
+	Ptr	= (const uint8_t*)s_constcstr( str, Utf8Offset( str, index ));
+
+	/* The string was already validated, so the sequence is complete and well formed. */
+	if( Ptr[0] < 0x80 )
+		Value	= Ptr[0];
+	else if( Ptr[0] < 0xe0 )
+		Value	= (( Ptr[0] & 0x1f ) <<  6 ) |  ( Ptr[1] & 0x3f );
+	else if( Ptr[0] < 0xf0 )
+		Value	= (( Ptr[0] & 0x0f ) << 12 ) | (( Ptr[1] & 0x3f ) <<  6 ) |  ( Ptr[2] & 0x3f );
+	else
+		Value	= (( Ptr[0] & 0x07 ) << 18 ) | (( Ptr[1] & 0x3f ) << 12 ) | (( Ptr[2] & 0x3f ) << 6 ) | ( Ptr[3] & 0x3f );
+
+	return Value;
+	}
+/*============================================================================*/
+/* The default size of the buffer of an s_reader and the alignment of its
+   buffer (a page, the best for 'read'). */
+#define	S_READER_BUFSIZE	( 1 << 20 )
+#define	S_READER_ALIGN		4096
+/*============================================================================*/
+struct s_reader
+	{
+	int		Fd;			/* The file descriptor being read. */
+	int		Eof;		/* Non-zero after 'read' returned zero. */
+	char	*Buffer;	/* Aligned buffer. */
+	char	*Block;		/* The allocated memory that contains the buffer. */
+	size_t	Size;		/* Size of the buffer. */
+	size_t	Start;		/* Position of the first character not yet delivered. */
+	size_t	Scanned;	/* Position up to which the buffer is known to have no '\n'. */
+	size_t	End;		/* Position after the last character read. */
+	const s_allocator_t	*Alloc;	/* The allocator of the reader and its buffer. */
+	};
+/*============================================================================*/
+/* Returns the first position aligned to S_READER_ALIGN inside 'Block'. */
+static inline char *AlignReaderBuffer( char *Block )
+	{
+	return (char*)(( (uintptr_t)Block + S_READER_ALIGN - 1 ) & ~(uintptr_t)( S_READER_ALIGN - 1 ));
+	}
+/*============================================================================*/
+/* Returns a pointer to the first '\n' in the 'Len' characters at 'Ptr', or NULL
+   if there is none. */
+static const char *FindNewline( const char * restrict Ptr, size_t Len )
+	{
+	size_t	i	= 0;
+
+#if			defined __SSE2__
+	const __m128i	Newline	= _mm_set1_epi8( '\n' );
+
+	for( ; Len - i >= 16; i += 16 )
+		{
+		int	Mask	= _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_loadu_si128( (const __m128i*)( Ptr + i )), Newline ));
+
+		if( Mask != 0 )
+			return Ptr + i + __builtin_ctz( Mask );
+		}
+#endif	/*	defined __SSE2__ */
+
+	for( ; i < Len; i++ )
+		if( Ptr[i] == '\n' )
+			return Ptr + i;
+
+	return NULL;
+	}
+/*============================================================================*/
+s_reader_t *s_reader_open( int fd, size_t bufsize )
+	{
+	s_reader_t	*Reader;
+
+	STATS_CALL( s_reader_open );
+
+	if( fd < 0 )
+		return NULL;
+
+	STATS_ALLOC( s_reader_open );
+	if(( Reader = Allocate( NULL, sizeof *Reader )) == NULL )
+		return NULL;
+
+	Reader->Alloc	= GetAllocator( NULL );
+	Reader->Fd		= fd;
+	Reader->Eof		= 0;
+	Reader->Size	= bufsize > 0 ? bufsize : S_READER_BUFSIZE;
+	Reader->Start	= 0;
+	Reader->Scanned	= 0;
+	Reader->End		= 0;
+
+	/* The allocator doesn't know about alignment, so the buffer is aligned
+	   inside a slightly bigger block. */
+	STATS_ALLOC( s_reader_open );
+	if(( Reader->Block = Allocate( Reader->Alloc, Reader->Size + S_READER_ALIGN - 1 )) == NULL )
+		{
+		Release( Reader->Alloc, Reader );
+		return NULL;
+		}
+
+	Reader->Buffer	= AlignReaderBuffer( Reader->Block );
+
+	return Reader;
+	}
+/*============================================================================*/
+void s_reader_close( s_reader_t *reader )
+	{
+	STATS_CALL( s_reader_close );
+
+	if( reader == NULL )
+		return;
+
+	Release( reader->Alloc, reader->Block );
+	Release( reader->Alloc, reader );
+	}
+/*============================================================================*/
+/* Reads more characters into the buffer of 'Reader', first moving the
+   beginning of an incomplete line to the start of the buffer (or doubling the
+   buffer if the line already fills it). Returns the number of characters read,
+   zero at the end of the file or a negative value in case of error. */
+static ssize_t FillReader( s_reader_t * restrict Reader )
+	{
+	ssize_t	Read;
+
+	if( Reader->Start > 0 )
+		{
+		memmove( Reader->Buffer, Reader->Buffer + Reader->Start, Reader->End - Reader->Start );
+		Reader->End	   -= Reader->Start;
+		Reader->Scanned-= Reader->Start;
+		Reader->Start	= 0;
+		}
+
+	/* The line is longer than the buffer... */
+	if( Reader->End == Reader->Size )
+		{
+		/* ...let's make it grow. */
+		size_t	Offset	= Reader->Buffer - Reader->Block;
+		char	*Block, *Buffer;
+
+		if(( Block = Reader->Alloc->Realloc( Reader->Alloc->Context, Reader->Block, Reader->Size * 2 + S_READER_ALIGN - 1 )) == NULL )
+			return -1;
+
+		/* The new block may have a different alignment. */
+		Buffer	= AlignReaderBuffer( Block );
+		if( Buffer != Block + Offset )
+			memmove( Buffer, Block + Offset, Reader->End );
+
+		Reader->Block	= Block;
+		Reader->Buffer	= Buffer;
+		Reader->Size   *= 2;
+		}
+
+	do
+		Read	= read( Reader->Fd, Reader->Buffer + Reader->End, Reader->Size - Reader->End );
+	while( Read < 0 && errno == EINTR );
+
+	if( Read > 0 )
+		Reader->End	   += Read;
+	else if( Read == 0 )
+		Reader->Eof		= 1;
+
+	return Read;
+	}
+/*============================================================================*/
+ssize_t s_getline_v( s_reader_t * restrict reader, s_view_t * restrict line )
+	{
+	const char	*Newline;
+	size_t		Start;
+
+	STATS_CALL( s_getline_v );
+
+	if( reader == NULL )
+		return -2;
+
+	for( ;; )
+		{
+		/* The characters already scanned in a previous call are not scanned again. */
+		if(( Newline = FindNewline( reader->Buffer + reader->Scanned, reader->End - reader->Scanned )) != NULL )
+			{
+			Start			= reader->Start;
+			reader->Start	= reader->Scanned	= Newline - reader->Buffer + 1;
+			break;
+			}
+
+		reader->Scanned	= reader->End;
+
+		/* The last line of the file may not end with a '\n'. */
+		if( reader->Eof )
+			{
+			if( reader->Start == reader->End )
+				return -1;
+
+			Start			= reader->Start;
+			Newline			= reader->Buffer + reader->End;
+			reader->Start	= reader->End;
+			break;
+			}
+
+		if( FillReader( reader ) < 0 )
+			return -2;
+		}
+
+	if( line != NULL )
+		{
+		line->Ptr	= reader->Buffer + Start;
+		line->Len	= Newline - line->Ptr;
+		}
+
+	STATS_BYTES( s_getline_v, Newline - ( reader->Buffer + Start ));
+
+	return Newline - ( reader->Buffer + Start );
+	}
+/*============================================================================*/
+ssize_t s_getline( s_reader_t * restrict reader, s_string_t * restrict dst )
+	{
+	s_view_t	Line;
+	ssize_t		Len, BytesToCopy;
+	char		*DstPtr;
+
+	STATS_CALL( s_getline );
+
+	/* The line is not consumed if there is nowhere to put it. */
+	if( dst == NULL || dst->MustBeZero != 0 || dst->Writable == 0 )
+		return -2;
+
+	if(( Len = s_getline_v( reader, &Line )) < 0 )
+		return Len;
+
+	DstPtr		= s_cstr( dst );
+	BytesToCopy	= ssmin( Len, s_strmaxlen( dst ));
+	STATS_COPY( s_getline, BytesToCopy, Len );
+
+	/* The line goes straight from the buffer to the s_string. */
+	memcpy( DstPtr, Line.Ptr, BytesToCopy );
+	DstPtr[BytesToCopy]	= '\0';
+
+	SetUsedLen( dst, BytesToCopy );
+
+	return Len;
+	}
+/*============================================================================*/
+/* Creates in the heap the header of an s_string whose characters are not right
+   after it but at 'Data', in the memory area 'DataArea'. The string can hold up
+   to 'MaxLen' characters and currently holds 'Len'. */
+static s_string_t *NewIndirect( char *Data, size_t Len, size_t MaxLen, int DataArea, int Writable )
+	{
+	s_string_t		*Str;
+	s_string_ext_t	*Ext;
+	int				Log2Bytes	= CounterBits( MaxLen );
+	int				Area;
+
+	/* The code point index is allocated only if some UTF-8 function needs
+	   it, so wrapping a buffer costs the same whatever its size. */
+	if(( Str = AllocateString( NULL, 1 + 2 * ( 1 << Log2Bytes ) + sizeof( s_string_ext_t ), &Area )) == NULL )
+		return NULL;
+
+	Str->MustBeZero	= 0;
+	Str->Sizes		= 2;	/* Two size counters and the header extension. */
+	Str->Bits		= Log2Bytes;
+	Str->Area		= Area;	/* The header is in the heap, wherever the characters are. */
+	Str->Writable	= 1;	/* Only while the counters are set. */
+
+	Ext				= GetExt( Str );
+	Ext->IndexCap	= IndexCapacity( MaxLen );
+	Ext->Index		= NULL;
+	Ext->Data		= Data;
+	Ext->DataArea	= DataArea;
+	Ext->FreeFn		= NULL;
+
+	SetMaxLen( Str, MaxLen );
+	SetUsedLen( Str, Len );		/* Also invalidates the cached information. */
+
+	Str->Writable	= Writable;
+
+	return Str;
+	}
+/*============================================================================*/
+/* Returns the size of the memory mapping of a file of 'Len' bytes, which is
+   at least one byte longer than the file, to hold the NUL terminator. */
+static size_t MappingSize( size_t Len )
+	{
+	size_t	PageSize	= sysconf( _SC_PAGESIZE );
+
+	return ( Len + 1 + PageSize - 1 ) & ~( PageSize - 1 );
+	}
+/*============================================================================*/
+s_string_t *s_mmap_file( const char * restrict path, int access )
+	{
+	struct stat	Stat;
+	s_string_t	*Str;
+	char		*Map;
+	size_t		Len;
+	int			Fd;
+
+	STATS_CALL( s_mmap_file );
+
+	if( path == NULL || ( Fd = open( path, O_RDONLY )) < 0 )
+		return NULL;
+
+	if( fstat( Fd, &Stat ) != 0 || !S_ISREG( Stat.st_mode ))
+		{
+		close( Fd );
+		return NULL;
+		}
+
+	Len	= Stat.st_size;
+
+	/* The mapping of the file is not NUL terminated if its length is a
+	   multiple of the page size, so first we reserve zeroed anonymous memory
+	   one byte longer than the file and then we map the file over it. */
+	if(( Map = mmap( NULL, MappingSize( Len ), PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 )) == MAP_FAILED )
+		{
+		close( Fd );
+		return NULL;
+		}
+
+	if( Len > 0 && mmap( Map, Len, PROT_READ, MAP_PRIVATE | MAP_FIXED, Fd, 0 ) == MAP_FAILED )
+		{
+		munmap( Map, MappingSize( Len ));
+		close( Fd );
+		return NULL;
+		}
+
+	/* The mapping stays valid after the file is closed. */
+	close( Fd );
+
+	STATS_ALLOC( s_mmap_file );
+	if(( Str = NewIndirect( Map, Len, Len, AREA_MAPPED, 0 )) == NULL )
+		{
+		munmap( Map, MappingSize( Len ));
+		return NULL;
+		}
+
+	s_mmap_advise( Str, access );
+
+	return Str;
+	}
+/*============================================================================*/
+int s_mmap_advise( const s_string_t * restrict str, int access )
+	{
+	static const int	Advices[]	= { MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED, MADV_DONTNEED };
+	s_string_ext_t		*Ext		= GetExt( str );
+
+	STATS_CALL( s_mmap_advise );
+
+	if( Ext == NULL || Ext->DataArea != AREA_MAPPED )
+		return -1;
+
+	if( access < 0 || access >= (int)( sizeof Advices / sizeof Advices[0] ))
+		return -1;
+
+	return madvise( Ext->Data, MappingSize( s_strlen( str )), Advices[access] );
+	}
+/*============================================================================*/
+s_string_t *s_adopt( char *buf, size_t len, size_t cap, void (*free_fn)( void * ))
+	{
+	s_string_t	*Str;
+
+	STATS_CALL( s_adopt );
+
+	/* There must be room for the NUL terminator. */
+	if( buf == NULL || cap == 0 || len >= cap )
+		return NULL;
+
+	buf[len]	= '\0';
+
+	STATS_ALLOC( s_adopt );
+	if(( Str = NewIndirect( buf, len, cap - 1, AREA_ADOPTED, 1 )) == NULL )
+		return NULL;
+
+	GetExt( Str )->FreeFn	= free_fn;
+
+	return Str;
+	}
+/*============================================================================*/
+s_string_t *s_wrap_const( const char *buf, size_t len )
+	{
+	STATS_CALL( s_wrap_const );
+
+	/* The functions of the library may read the terminator. */
+	if( buf == NULL || buf[len] != '\0' )
+		return NULL;
+
+	STATS_ALLOC( s_wrap_const );
+	return NewIndirect( (char*)buf, len, len, AREA_CONST, 0 );
+	}
+/*============================================================================*/
+void s_free( s_string_t *str )
+	{
+	STATS_CALL( s_free );
+
+	s_free_a( str, NULL );
+	}
+/*============================================================================*/
+void s_free_a( s_string_t *str, const s_allocator_t *alloc )
+	{
+	s_string_ext_t	*Ext;
+
+	STATS_CALL( s_free_a );
+
+	/* Only the s_strings in the heap can be freed. */
+	if( str == NULL || str->MustBeZero != 0 || str->Area < 2 )
+		return;
+
+	alloc	= StringAllocator( str, alloc );
+
+	if(( Ext = GetExt( str )) != NULL && Ext->Data != NULL )
+		{
+		if( Ext->DataArea == AREA_MAPPED )
+			munmap( Ext->Data, MappingSize( s_strmaxlen( str )));
+		else if( Ext->FreeFn != NULL )
+			Ext->FreeFn( Ext->Data );
+
+		Release( alloc, Ext->Index );
+		}
+
+	Release( alloc, str );
+	}
+/*============================================================================*/
+/* Writes all the 'Count' buffers of 'Iov' (at most 64, well below any
+   'IOV_MAX') to 'Fd', calling 'writev' again after partial writes. Changes
+   'Iov'. Returns the number of bytes written or a negative value in case of
+   error. If 'Done' is not NULL it receives the number of bytes written, even
+   in case of error. */
+static ssize_t WriteAll( int Fd, struct iovec * restrict Iov, int Count, size_t * restrict Done )
+	{
+	ssize_t	Total	= 0, Written;
+
+	if( Done != NULL )
+		*Done	= 0;
+
+	while( Count > 0 )
+		{
+		if(( Written = writev( Fd, Iov, Count )) < 0 )
+			{
+			if( errno == EINTR )
+				continue;
+			return -1;
+			}
+
+		Total  += Written;
+
+		if( Done != NULL )
+			*Done	= Total;
+
+		/* Skip the buffers completely written... */
+		for( ; Count > 0 && (size_t)Written >= Iov->iov_len; Count--, Iov++ )
+			Written	   -= Iov->iov_len;
+
+		/* ...and the part written of the next one. */
+		if( Count > 0 )
+			{
+			Iov->iov_base	= (char*)Iov->iov_base + Written;
+			Iov->iov_len   -= Written;
+			}
+		}
+
+	return Total;
+	}
+/*============================================================================*/
+ssize_t s_write( int fd, const s_string_t * restrict str )
+	{
+	struct iovec	Iov;
+
+	STATS_CALL( s_write );
+
+	Iov.iov_base	= (void*)s_constcstr( str, 0 );
+	Iov.iov_len		= s_strlen( str );
+
+	STATS_BYTES( s_write, Iov.iov_len );
+
+	return WriteAll( fd, &Iov, 1, NULL );
+	}
+/*============================================================================*/
+ssize_t s_writev( int fd, size_t n, const s_string_t * const strs[] )
+	{
+	struct iovec	Iov[64];
+	ssize_t			Total	= 0, Written;
+	size_t			i;
+	int				Count;
+
+	STATS_CALL( s_writev );
+
+	if( strs == NULL && n > 0 )
+		return -1;
+
+	/* The strings are written in batches, with a single 'writev' for each. */
+	for( i = 0; i < n; )
+		{
+		for( Count = 0; Count < (int)( sizeof Iov / sizeof Iov[0] ) && i < n; i++ )
+			if(( Iov[Count].iov_len = s_strlen( strs[i] )) > 0 )
+				Iov[Count++].iov_base	= (void*)s_constcstr( strs[i], 0 );
+
+		if(( Written = WriteAll( fd, Iov, Count, NULL )) < 0 )
+			return -1;
+
+		Total  += Written;
+		}
+
+	STATS_BYTES( s_writev, Total );
+
+	return Total;
+	}
+/*============================================================================*/
+/* The default size of the buffer of an s_writer. */
+#define	S_WRITER_BUFSIZE	( 1 << 16 )
+/*============================================================================*/
+struct s_writer
+	{
+	int		Fd;			/* The file descriptor being written. */
+	char	*Buffer;	/* The characters not written yet. */
+	size_t	Size;		/* Size of the buffer. */
+	size_t	Used;		/* Number of characters in the buffer. */
+	const s_allocator_t	*Alloc;	/* The allocator of the writer and its buffer. */
+	};
+/*============================================================================*/
+s_writer_t *s_writer_open( int fd, size_t bufsize )
+	{
+	s_writer_t	*Writer;
+
+	STATS_CALL( s_writer_open );
+
+	if( fd < 0 )
+		return NULL;
+
+	STATS_ALLOC( s_writer_open );
+	if(( Writer = Allocate( NULL, sizeof *Writer )) == NULL )
+		return NULL;
+
+	Writer->Alloc	= GetAllocator( NULL );
+	Writer->Fd		= fd;
+	Writer->Size	= bufsize > 0 ? bufsize : S_WRITER_BUFSIZE;
+	Writer->Used	= 0;
+
+	STATS_ALLOC( s_writer_open );
+	if(( Writer->Buffer = Allocate( Writer->Alloc, Writer->Size )) == NULL )
+		{
+		Release( Writer->Alloc, Writer );
+		return NULL;
+		}
+
+	return Writer;
+	}
+/*============================================================================*/
+/* Writes the buffer of 'Writer' followed by the 'Len' characters at 'Ptr', in
+   a single system call. Only the characters actually written are removed from
+   the buffer, so after an error it keeps those that were not. Returns the
+   number of bytes written or a negative value in case of error. */
+static ssize_t WriterDrain( s_writer_t * restrict Writer, const char * restrict Ptr, size_t Len )
+	{
+	struct iovec	Iov[2];
+	ssize_t			Result;
+	size_t			Done;
+
+	Iov[0].iov_base	= Writer->Buffer;
+	Iov[0].iov_len	= Writer->Used;
+	Iov[1].iov_base	= (void*)Ptr;
+	Iov[1].iov_len	= Len;
+
+	Result	= WriteAll( Writer->Fd, Iov, Len > 0 ? 2 : 1, &Done );
+
+	if( Done >= Writer->Used )
+		Writer->Used	= 0;
+	else
+		{
+		memmove( Writer->Buffer, Writer->Buffer + Done, Writer->Used - Done );
+		Writer->Used   -= Done;
+		}
+
+	return Result;
+	}
+/*============================================================================*/
+ssize_t s_writer_flush( s_writer_t * restrict writer )
+	{
+	STATS_CALL( s_writer_flush );
+
+	if( writer == NULL )
+		return -1;
+
+	return WriterDrain( writer, NULL, 0 );
+	}
+/*============================================================================*/
+ssize_t s_writer_put_v( s_writer_t * restrict writer, s_view_t view )
+	{
+	STATS_CALL( s_writer_put_v );
+
+	if( writer == NULL || view.Ptr == NULL || view.Len < 0 )
+		return -1;
+
+	STATS_BYTES( s_writer_put_v, view.Len );
+
+	/* If it doesn't fit, it is not copied, it is written together with what
+	   is in the buffer in a single system call. */
+	if( (size_t)view.Len > writer->Size - writer->Used )
+		return WriterDrain( writer, view.Ptr, view.Len ) < 0 ? -1 : view.Len;
+
+	/* Otherwise it is kept for later. */
+	memcpy( writer->Buffer + writer->Used, view.Ptr, view.Len );
+	writer->Used   += view.Len;
+
+	return view.Len;
+	}
+/*============================================================================*/
+ssize_t s_writer_put( s_writer_t * restrict writer, const s_string_t * restrict str )
+	{
+	s_view_t	View;
+
+	STATS_CALL( s_writer_put );
+
+	View.Ptr	= s_constcstr( str, 0 );
+	View.Len	= s_strlen( str );
+
+	return s_writer_put_v( writer, View );
+	}
+/*============================================================================*/
+int s_writer_close( s_writer_t *writer )
+	{
+	ssize_t	Result;
+
+	STATS_CALL( s_writer_close );
+
+	if( writer == NULL )
+		return -1;
+
+	Result	= s_writer_flush( writer );
+
+	Release( writer->Alloc, writer->Buffer );
+	Release( writer->Alloc, writer );
+
+	return Result < 0 ? -1 : 0;
+	}
+/*============================================================================*/
+/* Flags of a conversion specification of the formatting functions. */
+#define	FMT_LEFT		0x01	/* '-' */
+#define	FMT_PLUS		0x02	/* '+' */
+#define	FMT_SPACE		0x04	/* ' ' */
+#define	FMT_ALT			0x08	/* '#' */
+#define	FMT_ZERO		0x10	/* '0' */
+/*============================================================================*/
+/* The formatting functions write directly into the storage area of the
+   destination s_string through this cursor. Characters that would go beyond the
+   maximum length of the s_string are counted but discarded. */
+typedef struct
+	{
+	char		*Ptr;		/* The storage area of the s_string. */
+	ssize_t		Pos;		/* Index where the next character will be written. */
+	ssize_t		MaxLen;		/* Maximum length of the s_string. */
+	ssize_t		Count;		/* Number of characters generated so far (for '%n'). */
+	} fmtcursor_t;
+/*============================================================================*/
+static void FmtPut( fmtcursor_t * restrict Cursor, const char * restrict Src, ssize_t Len )
+	{
+	ssize_t	Room	= ssmin( Len, Cursor->MaxLen - Cursor->Pos );
+
+	if( Room > 0 )
+		{
+		memcpy( Cursor->Ptr + Cursor->Pos, Src, Room );
+		Cursor->Pos	   += Room;
+		}
+
+	Cursor->Count  += Len;
+	}
+/*============================================================================*/
+static void FmtFill( fmtcursor_t * restrict Cursor, int c, ssize_t Len )
+	{
+	ssize_t	Room;
+
+	if( Len <= 0 )
+		return;
+
+	if(( Room = ssmin( Len, Cursor->MaxLen - Cursor->Pos )) > 0 )
+		{
+		memset( Cursor->Ptr + Cursor->Pos, c, Room );
+		Cursor->Pos	   += Room;
+		}
+
+	Cursor->Count  += Len;
+	}
+/*============================================================================*/
+/* Emits an integer conversion ('d', 'i', 'u', 'o', 'x' or 'X') honoring all the
+   flags, the field width and the precision the same way the C library does. */
+static void FmtInteger( fmtcursor_t * restrict Cursor, uintmax_t Value, int Sign, int Base, int Upper, int Flags, int Width, int Precision )
+	{
+	const char			*Digits	= Upper ? HexDigitsUpper : HexDigitsLower;
+	char				Buffer[3 * sizeof( uintmax_t )];
+	char				Prefix[3];
+	int					PrefixLen	= 0;
+	int					NumDigits	= 0;
+	int					Zeros, Total;
+
+	/* Generate the digits from the least significant to the most significant.
+	   The decimal ones are generated two at a time. */
+	if( Base == 10 && Value != 0 )
+		{
+		NumDigits	= DecimalDigits( Value );
+		WriteDecimal( &Buffer[sizeof Buffer - NumDigits], Value, NumDigits );
+		}
+	else
+		for( ; Value != 0; Value /= Base )
+			Buffer[sizeof Buffer - ++NumDigits]	= Digits[Value % Base];
+
+	if( Sign != 0 )
+		Prefix[PrefixLen++]	= (char)Sign;
+
+	/* The '0' flag is ignored if a precision was given or the field is left-justified. */
+	if( Precision >= 0 || ( Flags & FMT_LEFT ))
+		Flags  &= ~FMT_ZERO;
+
+	/* The alternate form of the octal conversion forces the first digit to be a zero. */
+	if(( Flags & FMT_ALT ) && Base == 8 && Precision <= NumDigits )
+		Precision	= NumDigits + 1;
+
+	/* The alternate form of the hexadecimal conversion prepends "0x" to non-zero values. */
+	if(( Flags & FMT_ALT ) && Base == 16 && NumDigits != 0 )
+		{
+		Prefix[PrefixLen++]	= '0';
+		Prefix[PrefixLen++]	= Upper ? 'X' : 'x';
+		}
+
+	/* A value of zero with no explicit precision is printed as a single '0'. */
+	if( Precision < 0 )
+		Precision	= 1;
+
+	Zeros	= Precision > NumDigits ? Precision - NumDigits : 0;
+	Total	= PrefixLen + Zeros + NumDigits;
+
+	if(( Flags & FMT_ZERO ) && Width > Total )
+		{
+		Zeros  += Width - Total;
+		Total	= Width;
+		}
+
+	if(( Flags & FMT_LEFT ) == 0 )
+		FmtFill( Cursor, ' ', Width - Total );
+
+	FmtPut( Cursor, Prefix, PrefixLen );
+	FmtFill( Cursor, '0', Zeros );
+	FmtPut( Cursor, &Buffer[sizeof Buffer - NumDigits], NumDigits );
+
+	if( Flags & FMT_LEFT )
+		FmtFill( Cursor, ' ', Width - Total );
+	}
+/*============================================================================*/
+/* Emits a sequence of characters ('s' and 'c' conversions) padded to the field
+   width. */
+static void FmtChars( fmtcursor_t * restrict Cursor, const char * restrict Src, ssize_t Len, int Flags, int Width )
+	{
+	if(( Flags & FMT_LEFT ) == 0 )
+		FmtFill( Cursor, ' ', Width - Len );
+
+	FmtPut( Cursor, Src, Len );
+
+	if( Flags & FMT_LEFT )
+		FmtFill( Cursor, ' ', Width - Len );
+	}
+/*============================================================================*/
+/* Formats according to 'format' directly into 'dst', starting at index 'start'.
+   The common conversions (integers, characters and strings) are handled here,
+   the floating point and pointer conversions are delegated one by one to
+   'snprintf', which also writes directly into the s_string. Anything that is not
+   understood (positional arguments, for instance) makes the whole format be
+   re-done by 'vsnprintf'. The used length is updated only once, at the end. */
+static ssize_t FormatInto( s_string_t * restrict dst, ssize_t start, const char * restrict format, va_list ap, ssize_t * restrict Wanted )
+	{
+	fmtcursor_t	Cursor;
+	const char	*p, *q;
+	va_list		Saved;
+
+	if( dst == NULL || dst->MustBeZero != 0 || dst->Writable == 0 || format == NULL )
+		return -1;
+
+	if(( Cursor.Ptr = s_cstr( dst )) == NULL )
+		return -1;
+
+	Cursor.MaxLen	= s_strmaxlen( dst );
+	Cursor.Pos		= start;
+	Cursor.Count	= 0;
+
+	/* Keep a copy of the arguments in case we need to start over with 'vsnprintf'. */
+	va_copy( Saved, ap );
+
+	for( p = format; *p != '\0'; )
+		{
+		int			Flags		= 0;
+		int			Width		= 0;
+		int			Precision	= -1;
+		int			Length		= 0;	/* 'H' = hh, 'h', 'l', 'L' = ll or long double, 'z', 'j', 't'. */
+		int			Conversion;
+
+		/* Copy the literal text up to the next conversion specification in one go. */
+		if(( q = strchr( p, '%' )) == NULL )
+			q	= p + strlen( p );
+
+		FmtPut( &Cursor, p, q - p );
+
+		if( *q == '\0' )
+			break;
+
+		p	= q + 1;
+
+		for( ;; p++ )
+			{
+			if( *p == '-' )
+				Flags  |= FMT_LEFT;
+			else if( *p == '+' )
+				Flags  |= FMT_PLUS;
+			else if( *p == ' ' )
+				Flags  |= FMT_SPACE;
+			else if( *p == '#' )
+				Flags  |= FMT_ALT;
+			else if( *p == '0' )
+				Flags  |= FMT_ZERO;
+			else
+				break;
+			}
+
+		if( *p == '*' )
+			{
+			p++;
+			/* A negative field width is taken as a '-' flag followed by a positive width. */
+			if(( Width = va_arg( ap, int )) < 0 )
+				{
+				Flags  |= FMT_LEFT;
+				Width	= -Width;
+				}
+			}
+		else
+			for( ; *p >= '0' && *p <= '9'; p++ )
+				Width	= Width * 10 + ( *p - '0' );
+
+		if( *p == '.' )
+			{
+			p++;
+			if( *p == '*' )
+				{
+				p++;
+				/* A negative precision is taken as if the precision were omitted. */
+				if(( Precision = va_arg( ap, int )) < 0 )
+					Precision	= -1;
+				}
+			else
+				for( Precision = 0; *p >= '0' && *p <= '9'; p++ )
+					Precision	= Precision * 10 + ( *p - '0' );
+			}
+
+		switch( *p )
+			{
+			case 'h':
+				Length	= p[1] == 'h' ? ( p++, 'H' ) : 'h';
+				p++;
+				break;
+			case 'l':
+				Length	= p[1] == 'l' ? ( p++, 'L' ) : 'l';
+				p++;
+				break;
+			case 'q':
+			case 'L':
+				Length	= 'L';
+				p++;
+				break;
+			case 'z':
+			case 'j':
+			case 't':
+				Length	= *p++;
+				break;
+			}
+
+		switch( Conversion = *p++ )
+			{
+			case '%':
+				FmtPut( &Cursor, "%", 1 );
+				break;
+
+			case 'd':
+			case 'i':
+				{
+				intmax_t	Value;
+				uintmax_t	Magnitude;
+
+				switch( Length )
+					{
+					case 'H':	Value	= (signed char)va_arg( ap, int );	break;
+					case 'h':	Value	= (short)va_arg( ap, int );			break;
+					case 'l':	Value	= va_arg( ap, long );				break;
+					case 'L':	Value	= va_arg( ap, long long );			break;
+					case 'z':	Value	= va_arg( ap, ssize_t );			break;
+					case 'j':	Value	= va_arg( ap, intmax_t );			break;
+					case 't':	Value	= va_arg( ap, ptrdiff_t );			break;
+					default:	Value	= va_arg( ap, int );				break;
+					}
+
+				Magnitude	= Value < 0 ? -(uintmax_t)Value : (uintmax_t)Value;
+
+				FmtInteger( &Cursor, Magnitude, Value < 0 ? '-' : ( Flags & FMT_PLUS ) ? '+' : ( Flags & FMT_SPACE ) ? ' ' : 0,
+							10, 0, Flags, Width, Precision );
+				break;
+				}
+
+			case 'u':
+			case 'o':
+			case 'x':
+			case 'X':
+				{
+				uintmax_t	Value;
+
+				switch( Length )
+					{
+					case 'H':	Value	= (unsigned char)va_arg( ap, unsigned );	break;
+					case 'h':	Value	= (unsigned short)va_arg( ap, unsigned );	break;
+					case 'l':	Value	= va_arg( ap, unsigned long );				break;
+					case 'L':	Value	= va_arg( ap, unsigned long long );			break;
+					case 'z':	Value	= va_arg( ap, size_t );						break;
+					case 'j':	Value	= va_arg( ap, uintmax_t );					break;
+					case 't':	Value	= va_arg( ap, ptrdiff_t );					break;
+					default:	Value	= va_arg( ap, unsigned );					break;
+					}
+
+				FmtInteger( &Cursor, Value, 0, Conversion == 'u' ? 10 : Conversion == 'o' ? 8 : 16, Conversion == 'X',
+							Flags, Width, Precision );
+				break;
+				}
+
+			case 'c':
+				{
+				char	c;
+
+				if( Length == 'l' )
+					goto Delegate;
+
+				c	= (char)va_arg( ap, int );
+				FmtChars( &Cursor, &c, 1, Flags, Width );
+				break;
+				}
+
+			case 's':
+				{
+				const char	*s;
+
+				if( Length == 'l' )
+					goto Delegate;
+
+				/* The C library prints "(null)" for null pointers, unless the precision is too short to hold it. */
+				if(( s = va_arg( ap, const char * )) == NULL )
+					s	= Precision < 0 || Precision >= 6 ? "(null)" : "";
+
+				FmtChars( &Cursor, s, Precision < 0 ? (ssize_t)strlen( s ) : (ssize_t)strnlen( s, Precision ), Flags, Width );
+				break;
+				}
+
+			case 'n':
+				switch( Length )
+					{
+					case 'H':	*va_arg( ap, signed char * )	= (signed char)Cursor.Count;	break;
+					case 'h':	*va_arg( ap, short * )			= (short)Cursor.Count;			break;
+					case 'l':	*va_arg( ap, long * )			= (long)Cursor.Count;			break;
+					case 'L':	*va_arg( ap, long long * )		= (long long)Cursor.Count;		break;
+					case 'z':	*va_arg( ap, ssize_t * )		= (ssize_t)Cursor.Count;		break;
+					case 'j':	*va_arg( ap, intmax_t * )		= (intmax_t)Cursor.Count;		break;
+					case 't':	*va_arg( ap, ptrdiff_t * )		= (ptrdiff_t)Cursor.Count;		break;
+					default:	*va_arg( ap, int * )			= (int)Cursor.Count;			break;
+					}
+				break;
+
+			case 'e':
+			case 'E':
+			case 'f':
+			case 'F':
+			case 'g':
+			case 'G':
+			case 'a':
+			case 'A':
+			case 'p':
+			Delegate:
+				{
+				char	Spec[32];
+				char	*s	= Spec;
+				ssize_t	Room, n;
+
+				/* Rebuild the conversion specification with the width and precision already resolved. */
+				*s++	= '%';
+				if( Flags & FMT_LEFT )	*s++	= '-';
+				if( Flags & FMT_PLUS )	*s++	= '+';
+				if( Flags & FMT_SPACE )	*s++	= ' ';
+				if( Flags & FMT_ALT )	*s++	= '#';
+				if( Flags & FMT_ZERO )	*s++	= '0';
+				if( Width > 0 )			s  += sprintf( s, "%d", Width );
+				if( Precision >= 0 )	s  += sprintf( s, ".%d", Precision );
+				if( Length == 'l' )		*s++	= 'l';
+				if( Length == 'L' )		*s++	= 'L';
+				*s++	= (char)Conversion;
+				*s		= '\0';
+
+				Room	= Cursor.MaxLen - Cursor.Pos;
+
+				/* 'snprintf' writes directly into the s_string, the terminating '\0' always fits. */
+				if( Conversion == 'p' )
+					n	= snprintf( Cursor.Ptr + Cursor.Pos, Room + 1, Spec, va_arg( ap, void * ));
+				else if( Conversion == 'c' )
+					n	= snprintf( Cursor.Ptr + Cursor.Pos, Room + 1, Spec, va_arg( ap, wint_t ));
+				else if( Conversion == 's' )
+					n	= snprintf( Cursor.Ptr + Cursor.Pos, Room + 1, Spec, va_arg( ap, const wchar_t * ));
+				else if( Length == 'L' )
+					n	= snprintf( Cursor.Ptr + Cursor.Pos, Room + 1, Spec, va_arg( ap, long double ));
+				else
+					n	= snprintf( Cursor.Ptr + Cursor.Pos, Room + 1, Spec, va_arg( ap, double ));
+
+				if( n < 0 )
+					n	= 0;
+
+				Cursor.Pos	   += ssmin( n, Room );
+				Cursor.Count   += n;
+				break;
+				}
+
+			default:
+				{
+				ssize_t	n;
+
+				/* Something we don't handle here (positional arguments, for instance).
+				   Let's start over and let the C library do all the work. */
+				n			= vsnprintf( Cursor.Ptr + start, Cursor.MaxLen - start + 1, format, Saved );
+				Cursor.Pos	= n < 0 ? start : start + ssmin( n, Cursor.MaxLen - start );
+				Cursor.Count= n < 0 ? 0 : n;
+				p			= "";
+				break;
+				}
+			}
+		}
+
+	va_end( Saved );
+
+	/* Terminate the new resulting string and update its length, only once. */
+	Cursor.Ptr[Cursor.Pos]	= '\0';
+	SetUsedLen( dst, Cursor.Pos );
+
+	/* How many characters the result would have if 'dst' were large enough. */
+	*Wanted	= Cursor.Count;
+
+	return Cursor.Pos;
+	}
+/*============================================================================*/
+ssize_t s_vsprintf( s_string_t * restrict dst, const char * restrict format, va_list ap )
+	{
+	ssize_t	Result, Wanted;
+
+	STATS_CALL( s_vsprintf );
+
+	if(( Result = FormatInto( dst, 0, format, ap, &Wanted )) >= 0 )
+		STATS_COPY( s_vsprintf, Result, Wanted );
+
+	return Result;
+	}
+/*============================================================================*/
+ssize_t s_sprintf( s_string_t * restrict dst, const char * restrict format, ... )
+	{
+	va_list	ap;
+	ssize_t	Result, Wanted;
+
+	STATS_CALL( s_sprintf );
+
+	va_start( ap, format );
+	Result	= FormatInto( dst, 0, format, ap, &Wanted );
+	va_end( ap );
+
+	if( Result >= 0 )
+		STATS_COPY( s_sprintf, Result, Wanted );
+
+	return Result;
+	}
+/*============================================================================*/
+ssize_t s_vcatprintf( s_string_t * restrict dst, const char * restrict format, va_list ap )
+	{
+	ssize_t	Start	= s_strlen( dst ), Result, Wanted;
+
+	STATS_CALL( s_vcatprintf );
+
+	if(( Result = FormatInto( dst, Start, format, ap, &Wanted )) >= 0 )
+		STATS_COPY( s_vcatprintf, Result - Start, Wanted );
+
+	return Result;
+	}
+/*============================================================================*/
+ssize_t s_catprintf( s_string_t * restrict dst, const char * restrict format, ... )
+	{
+	va_list	ap;
+	ssize_t	Start	= s_strlen( dst ), Result, Wanted;
+
+	STATS_CALL( s_catprintf );
+
+	va_start( ap, format );
+	Result	= FormatInto( dst, Start, format, ap, &Wanted );
+	va_end( ap );
+
+	if( Result >= 0 )
+		STATS_COPY( s_catprintf, Result - Start, Wanted );
+
+	return Result;
+	}
+/*============================================================================*/
+/* The default initial capacities of an s_strvec. */
+#define	S_STRVEC_COUNT		16
+#define	S_STRVEC_BYTES		256
+/* The largest number of strings whose offsets and prefixes can be sized
+   without wrapping around, 'Offsets' has one more element. */
+#define	STRVEC_MAX_COUNT	( SIZE_MAX / sizeof( uint64_t ) - 1 )
+/*============================================================================*/
+struct s_strvec
+	{
+	char				*Data;		/* The characters of all the strings, one after the other. */
+	size_t				*Offsets;	/* Where each string begins in 'Data', plus where the next one would begin. */
+	uint64_t			*Prefixes;	/* The first 8 characters of each string, see 'Prefix8'. */
+	size_t				Count;		/* Number of strings. */
+	size_t				CountCap;	/* Number of strings that fit in 'Offsets'. */
+	size_t				DataCap;	/* Size of 'Data'. */
+	const s_allocator_t	*Alloc;		/* The allocator of the vector and its arrays. */
+	};
+/*============================================================================*/
+s_strvec_t *s_strvec_new( size_t count, size_t bytes )
+	{
+	s_strvec_t	*Vec;
+
+	STATS_CALL( s_strvec_new );
+
+	if( count > STRVEC_MAX_COUNT )
+		return NULL;
+
+	STATS_ALLOC( s_strvec_new );
+	if(( Vec = Allocate( NULL, sizeof *Vec )) == NULL )
+		return NULL;
+
+	Vec->Alloc		= GetAllocator( NULL );
+	Vec->Count		= 0;
+	Vec->CountCap	= count > 0 ? count : S_STRVEC_COUNT;
+	Vec->DataCap	= bytes > 0 ? bytes : S_STRVEC_BYTES;
+
+	STATS_ALLOC( s_strvec_new );
+	STATS_ALLOC( s_strvec_new );
+	STATS_ALLOC( s_strvec_new );
+	Vec->Offsets	= Allocate( Vec->Alloc, ( Vec->CountCap + 1 ) * sizeof Vec->Offsets[0] );
+	Vec->Prefixes	= Allocate( Vec->Alloc, Vec->CountCap * sizeof Vec->Prefixes[0] );
+	Vec->Data		= Allocate( Vec->Alloc, Vec->DataCap );
+
+	if( Vec->Offsets == NULL || Vec->Prefixes == NULL || Vec->Data == NULL )
+		{
+		s_strvec_free( Vec );
+		return NULL;
+		}
+
+	Vec->Offsets[0]	= 0;
+
+	return Vec;
+	}
+/*============================================================================*/
+void s_strvec_free( s_strvec_t *vec )
+	{
+	STATS_CALL( s_strvec_free );
+
+	if( vec == NULL )
+		return;
+
+	Release( vec->Alloc, vec->Data );
+	Release( vec->Alloc, vec->Prefixes );
+	Release( vec->Alloc, vec->Offsets );
+	Release( vec->Alloc, vec );
+	}
+/*============================================================================*/
+void s_strvec_clear( s_strvec_t *vec )
+	{
+	STATS_CALL( s_strvec_clear );
+
+	if( vec != NULL )
+		vec->Count	= 0;
+	}
+/*============================================================================*/
+ssize_t s_strvec_count( const s_strvec_t *vec )
+	{
+	return vec != NULL ? (ssize_t)vec->Count : 0;
+	}
+/*============================================================================*/
+/* Makes room in 'Vec' for one more string of 'Len' characters, doubling the
+   arrays as needed. Returns zero if there is not enough memory. */
+static int StrvecReserve( s_strvec_t * restrict Vec, size_t Len )
+	{
+	size_t	Used	= Vec->Offsets[Vec->Count];
+	size_t	NewCap;
+	void	*Ptr;
+
+	if( Vec->Count == Vec->CountCap )
+		{
+		if( Vec->CountCap > STRVEC_MAX_COUNT / 2 )
+			return 0;
+
+		NewCap	= Vec->CountCap * 2;
+
+		STATS_ALLOC( s_strvec_append_v );
+		if(( Ptr = Vec->Alloc->Realloc( Vec->Alloc->Context, Vec->Offsets, ( NewCap + 1 ) * sizeof Vec->Offsets[0] )) == NULL )
+			return 0;
+
+		Vec->Offsets	= Ptr;
+
+		STATS_ALLOC( s_strvec_append_v );
+		if(( Ptr = Vec->Alloc->Realloc( Vec->Alloc->Context, Vec->Prefixes, NewCap * sizeof Vec->Prefixes[0] )) == NULL )
+			return 0;
+
+		Vec->Prefixes	= Ptr;
+		Vec->CountCap	= NewCap;
+		}
+
+	if( Vec->DataCap - Used < Len )
+		{
+		if( Len > SIZE_MAX - Used )
+			return 0;
+
+		/* The capacity is doubled, unless that would wrap around. */
+		for( NewCap = Vec->DataCap; NewCap - Used < Len; NewCap = NewCap <= SIZE_MAX / 2 ? NewCap * 2 : Used + Len )
+			{}
+
+		STATS_ALLOC( s_strvec_append_v );
+		if(( Ptr = Vec->Alloc->Realloc( Vec->Alloc->Context, Vec->Data, NewCap )) == NULL )
+			return 0;
+
+		Vec->Data		= Ptr;
+		Vec->DataCap	= NewCap;
+		}
+
+	return 1;
+	}
+/*============================================================================*/
+ssize_t s_strvec_append_v( s_strvec_t * restrict vec, s_view_t view )
+	{
+	size_t	Used;
+
+	STATS_CALL( s_strvec_append_v );
+
+	if( vec == NULL || view.Ptr == NULL || view.Len < 0 )
+		return -1;
+
+	if( !StrvecReserve( vec, view.Len ))
+		return -1;
+
+	Used	= vec->Offsets[vec->Count];
+
+	memcpy( vec->Data + Used, view.Ptr, view.Len );
+	STATS_BYTES( s_strvec_append_v, view.Len );
+
+	vec->Prefixes[vec->Count]	= Prefix8( view.Ptr, view.Len );
+	vec->Offsets[++vec->Count]	= Used + view.Len;
+
+	return vec->Count - 1;
+	}
+/*============================================================================*/
+ssize_t s_strvec_append( s_strvec_t * restrict vec, const s_string_t * restrict str )
+	{
+	s_view_t	View;
+
+	STATS_CALL( s_strvec_append );
+
+	if( str == NULL )
+		return -1;
+
+	View.Ptr	= s_constcstr( str, 0 );
+	View.Len	= s_strlen( str );
+
+	return s_strvec_append_v( vec, View );
+	}
+/*============================================================================*/
+ssize_t s_strvec_append_c( s_strvec_t * restrict vec, const char * restrict str )
+	{
+	STATS_CALL( s_strvec_append_c );
+
+	if( str == NULL )
+		return -1;
+
+	return s_strvec_append_v( vec, s_view_c( str ));
+	}
+/*============================================================================*/
+s_view_t s_strvec_at( const s_strvec_t *vec, ssize_t index )
+	{
+	s_view_t	View	= { "", 0 };
+
+	if( vec == NULL || index < -(ssize_t)vec->Count || index >= (ssize_t)vec->Count )
+		{
+		View.Ptr	= NULL;
+		return View;
+		}
+
+	if( index < 0 )
+		index  += vec->Count;
+
+	View.Ptr	= vec->Data + vec->Offsets[index];
+	View.Len	= vec->Offsets[index + 1] - vec->Offsets[index];
+
+	return View;
+	}
+/*============================================================================*/
+ssize_t s_strvec_tok( s_strvec_t * restrict vec, const s_string_t * restrict str, const s_string_t * restrict delim, ssize_t delimstart )
+	{
+	ssize_t		Start	= 0, Index, Count = 0;
+	s_view_t	View;
+
+	STATS_CALL( s_strvec_tok );
+
+	if( vec == NULL )
+		return -1;
+
+	/* The tokens are exactly those of 's_strtok', copied straight from 'str'. */
+	while(( Index = s_strtok( str, &Start, delim, delimstart, &View.Len )) >= 0 )
+		{
+		View.Ptr	= s_constcstr( str, Index );
+
+		if( s_strvec_append_v( vec, View ) < 0 )
+			return -1;
+
+		Count++;
+		}
+
+	return Count;
+	}
+/*============================================================================*/
+ssize_t s_strvec_tok_c( s_strvec_t * restrict vec, const s_string_t * restrict str, const char * restrict delim )
+	{
+	ssize_t		Start	= 0, Index, Count = 0;
+	s_view_t	View;
+
+	STATS_CALL( s_strvec_tok_c );
+
+	if( vec == NULL )
+		return -1;
+
+	while(( Index = s_strtok_c( str, &Start, delim, &View.Len )) >= 0 )
+		{
+		View.Ptr	= s_constcstr( str, Index );
+
+		if( s_strvec_append_v( vec, View ) < 0 )
+			return -1;
+
+		Count++;
+		}
+
+	return Count;
+	}
+/*============================================================================*/
+s_strvec_t *s_strvec_from( size_t n, const s_string_t * const parts[] )
+	{
+	s_strvec_t	*Vec;
+	size_t		i;
+
+	STATS_CALL( s_strvec_from );
+
+	if( parts == NULL && n > 0 )
+		return NULL;
+
+	/* The arrays are allocated at once with their final sizes. */
+	if(( Vec = s_strvec_new( n, PartsLength( n, parts, 0 ))) == NULL )
+		return NULL;
+
+	/* NULL elements are taken as empty strings. */
+	for( i = 0; i < n; i++ )
+		s_strvec_append_v( Vec, s_view( parts[i], 0, s_strlen( parts[i] )));
+
+	return Vec;
+	}
+/*============================================================================*/
+s_string_t *s_strvec_get_m( const s_strvec_t *vec, ssize_t index )
+	{
+	s_view_t	View;
+	s_string_t	*Str;
+	int			Area;
+
+	STATS_CALL( s_strvec_get_m );
+
+	if(( View = s_strvec_at( vec, index )).Ptr == NULL )
+		return NULL;
+
+	STATS_ALLOC( s_strvec_get_m );
+	if(( Str = AllocateString( NULL, _s_calcsize( View.Len ), &Area )) == NULL )
+		return NULL;
+
+	/* Unlike 's_strdup', an empty element results in an empty string. */
+	_s_string_init( Str, View.Len, Area );
+
+	memcpy( s_cstr( Str ), View.Ptr, View.Len );
+	s_cstr( Str )[View.Len]	= '\0';
+	SetUsedLen( Str, View.Len );
+
+	return Str;
+	}
+/*============================================================================*/
+/* Returns a bit for each of the (up to 4) strings of 'Vec' from 'First' that
+   have length 'Len' and prefix 'Prefix', the candidates to be equal to a key. */
+static unsigned StrvecCandidates( const s_strvec_t * restrict Vec, size_t First, size_t Len, uint64_t Prefix )
+	{
+	const size_t	*Offsets	= Vec->Offsets + First;
+	const uint64_t	*Prefixes	= Vec->Prefixes + First;
+	unsigned		Bits		= 0;
+	size_t			i			= 0, n = Vec->Count - First < 4 ? Vec->Count - First : 4;
+
+#if			defined __SSE2__
+	for( ; i + 2 <= n; i += 2 )
+		{
+		/* The lengths are the differences between consecutive offsets. SSE2
+		   has no 64-bit equality, both halves of each lane must be equal. */
+		__m128i	Lens	= _mm_sub_epi64( _mm_loadu_si128( (const __m128i*)( Offsets + i + 1 )), _mm_loadu_si128( (const __m128i*)( Offsets + i )));
+		__m128i	Equal	= _mm_and_si128( _mm_cmpeq_epi32( Lens, _mm_set1_epi64x( Len )), _mm_cmpeq_epi32( _mm_loadu_si128( (const __m128i*)( Prefixes + i )), _mm_set1_epi64x( Prefix )));
+
+		Equal	= _mm_and_si128( Equal, _mm_shuffle_epi32( Equal, _MM_SHUFFLE( 2, 3, 0, 1 )));
+		Bits   |= _mm_movemask_pd( _mm_castsi128_pd( Equal )) << i;
+		}
+#endif	/*	defined __SSE2__ */
+
+	for( ; i < n; i++ )
+		Bits   |= ( Offsets[i + 1] - Offsets[i] == Len && Prefixes[i] == Prefix ) << i;
+
+	return Bits;
+	}
+/*============================================================================*/
+/* Returns non-zero if the string 'Index' of 'Vec', a candidate returned by
+   'StrvecCandidates', is equal to 'Key'. Only the characters after the prefix
+   are left to compare. */
+static inline int StrvecEqual( const s_strvec_t * restrict Vec, size_t Index, s_view_t Key )
+	{
+	return Key.Len <= 8 || memcmp( Vec->Data + Vec->Offsets[Index] + 8, Key.Ptr + 8, Key.Len - 8 ) == 0;
+	}
+/*============================================================================*/
+ssize_t s_strvec_find_v( const s_strvec_t *vec, s_view_t key )
+	{
+	uint64_t	Prefix;
+	unsigned	Bits;
+	size_t		i;
+
+	STATS_CALL( s_strvec_find_v );
+	TRACE_CALL( s_strvec_find_v, vec == NULL ? 0 : vec->Offsets[vec->Count] );
+
+	if( vec == NULL || key.Ptr == NULL || key.Len < 0 )
+		return -1;
+
+	Prefix	= Prefix8( key.Ptr, key.Len );
+
+	for( i = 0; i < vec->Count; i += 4 )
+		for( Bits = StrvecCandidates( vec, i, key.Len, Prefix ); Bits != 0; Bits &= Bits - 1 )
+			if( StrvecEqual( vec, i + __builtin_ctz( Bits ), key ))
+				return i + __builtin_ctz( Bits );
+
+	return -1;
+	}
+/*============================================================================*/
+ssize_t s_strvec_find( const s_strvec_t *vec, const s_string_t *key )
+	{
+	STATS_CALL( s_strvec_find );
+
+	if( key == NULL )
+		return -1;
+
+	return s_strvec_find_v( vec, s_view( key, 0, s_strlen( key )));
+	}
+/*============================================================================*/
+ssize_t s_strvec_eq_mask_v( const s_strvec_t * restrict vec, s_view_t key, uint64_t * restrict mask )
+	{
+	uint64_t	Prefix;
+	unsigned	Bits;
+	size_t		i, Count = 0;
+
+	STATS_CALL( s_strvec_eq_mask_v );
+	TRACE_CALL( s_strvec_eq_mask_v, vec == NULL ? 0 : vec->Offsets[vec->Count] );
+
+	if( vec == NULL || mask == NULL || key.Ptr == NULL || key.Len < 0 )
+		return -1;
+
+	memset( mask, 0, ( vec->Count + 63 ) / 64 * sizeof mask[0] );
+
+	Prefix	= Prefix8( key.Ptr, key.Len );
+
+	/* The blocks of 4 strings never straddle two words of the mask. */
+	for( i = 0; i < vec->Count; i += 4 )
+		for( Bits = StrvecCandidates( vec, i, key.Len, Prefix ); Bits != 0; Bits &= Bits - 1 )
+			if( StrvecEqual( vec, i + __builtin_ctz( Bits ), key ))
+				{
+				mask[i / 64]   |= (uint64_t)1 << (( i + __builtin_ctz( Bits )) % 64 );
+				Count++;
+				}
+
+	return Count;
+	}
+/*============================================================================*/
+ssize_t s_strvec_eq_mask( const s_strvec_t * restrict vec, const s_string_t * restrict key, uint64_t * restrict mask )
+	{
+	STATS_CALL( s_strvec_eq_mask );
+
+	if( key == NULL )
+		return -1;
+
+	return s_strvec_eq_mask_v( vec, s_view( key, 0, s_strlen( key )), mask );
+	}
+/*============================================================================*/
+/* Partitions smaller than this are sorted by insertion. */
+#define	SORT_INSERTION		16
+/* Arrays with at least this number of strings are first split into buckets by
+   their first character, and the buckets are sorted in parallel. */
+#define	SORT_RADIX			4096
+/* The buckets that are split again by their next characters, at most this
+   number of times for each thread, so the large ones don't keep a thread
+   busy while the others wait. */
+#define	SORT_SPLITS			4
+
+typedef struct
+	{
+	uint64_t		Key;		/* Up to 8 characters from the current depth, see 'SortKey'. */
+	const uint8_t	*Ptr;		/* The characters of the string. */
+	size_t			Len;		/* Its length. */
+	size_t			Index;		/* Its position in the array before sorting, to break ties. */
+	s_string_t		*Str;
+	} sort_item_t;
+
+typedef struct
+	{
+	size_t			Begin;		/* Where the strings of the bucket begin in the array. */
+	size_t			Count;		/* How many there are, 0 for a bucket that was split again. */
+	size_t			Depth;		/* How many characters they have in common. */
+	} sort_task_t;
+
+typedef struct
+	{
+	sort_item_t		*Items;
+	sort_task_t		*Tasks;			/* The buckets of the radix passes, sorted in parallel. */
+	int				Flags;
+	uint8_t			Fold[256];		/* How each character is compared. */
+	} sort_t;
+/*============================================================================*/
+/* Loads in 'Item->Key' the characters of the string from 'Depth' to 'Depth' +
+   7 in the same way as 'Prefix8', folding them if needed. */
+static inline void SortKey( const sort_t * restrict Sort, sort_item_t * restrict Item, size_t Depth )
+	{
+	size_t		Len	= Item->Len - Depth < 8 ? Item->Len - Depth : 8, i;
+	uint64_t	Key	= 0;
+
+	if( !( Sort->Flags & S_SORT_ICASE ))
+		{
+		Item->Key	= Prefix8( (const char*)Item->Ptr + Depth, Len );
+		return;
+		}
+
+	for( i = 0; i < Len; i++ )
+		Key	   |= (uint64_t)Sort->Fold[Item->Ptr[Depth + i]] << ( 56 - 8 * i );
+
+	Item->Key	= Key;
+	}
+/*============================================================================*/
+/* Compares the keys of two strings at 'Depth' and, if they are equal, how
+   many of the 8 characters they cover, so a string that ends before another
+   with the same characters comes first. */
+static inline int SortKeyCmp( const sort_item_t * restrict a, const sort_item_t * restrict b, size_t Depth )
+	{
+	size_t	LenA	= a->Len - Depth < 8 ? a->Len - Depth : 8;
+	size_t	LenB	= b->Len - Depth < 8 ? b->Len - Depth : 8;
+
+	if( a->Key != b->Key )
+		return a->Key < b->Key ? -1 : +1;
+
+	return ( LenA > LenB ) - ( LenA < LenB );
+	}
+/*============================================================================*/
+/* Compares two strings with the same first 'Depth' characters. */
+static int SortCmp( const sort_t * restrict Sort, const sort_item_t * restrict a, const sort_item_t * restrict b, size_t Depth )
+	{
+	size_t	Len	= a->Len < b->Len ? a->Len : b->Len, i;
+
+	for( i = Depth; i < Len; i++ )
+		if( Sort->Fold[a->Ptr[i]] != Sort->Fold[b->Ptr[i]] )
+			return Sort->Fold[a->Ptr[i]] - Sort->Fold[b->Ptr[i]];
+
+	if( a->Len != b->Len )
+		return a->Len < b->Len ? -1 : +1;
+
+	if( Sort->Flags & S_SORT_STABLE )
+		return ( a->Index > b->Index ) - ( a->Index < b->Index );
+
+	return 0;
+	}
+/*============================================================================*/
+static void SortInsertion( const sort_t * restrict Sort, sort_item_t * restrict Items, size_t n, size_t Depth )
+	{
+	sort_item_t	Item;
+	size_t		i, j;
+
+	for( i = 1; i < n; i++ )
+		{
+		Item	= Items[i];
+
+		for( j = i; j > 0 && SortCmp( Sort, &Items[j - 1], &Item, Depth ) > 0; j-- )
+			Items[j]	= Items[j - 1];
+
+		Items[j]	= Item;
+		}
+	}
+/*============================================================================*/
+static int SortIndexCmp( const void *a, const void *b )
+	{
+	size_t	IndexA	= ((const sort_item_t*)a )->Index;
+	size_t	IndexB	= ((const sort_item_t*)b )->Index;
+
+	return ( IndexA > IndexB ) - ( IndexA < IndexB );
+	}
+/*============================================================================*/
+static inline void SortSwap( sort_item_t *a, sort_item_t *b )
+	{
+	sort_item_t	Swap	= *a;
+
+	*a	= *b;
+	*b	= Swap;
+	}
+/*============================================================================*/
+/* Returns the median of three strings by their keys at 'Depth'. */
+static const sort_item_t *SortPivot( const sort_item_t *a, const sort_item_t *b, const sort_item_t *c, size_t Depth )
+	{
+	if( SortKeyCmp( a, b, Depth ) > 0 )
+		{
+		const sort_item_t	*Swap	= a;
+
+		a	= b;
+		b	= Swap;
+		}
+
+	if( SortKeyCmp( b, c, Depth ) <= 0 )
+		return b;
+
+	return SortKeyCmp( a, c, Depth ) > 0 ? a : c;
+	}
+/*============================================================================*/
+/* Moves down the string 'Root' of the binary heap of the 'n' strings at
+   'Items' until it is not smaller than its children. */
+static void SortSiftDown( const sort_t * restrict Sort, sort_item_t * restrict Items, size_t Root, size_t n, size_t Depth )
+	{
+	size_t	Child;
+
+	while(( Child = 2 * Root + 1 ) < n )
+		{
+		if( Child + 1 < n && SortCmp( Sort, &Items[Child], &Items[Child + 1], Depth ) < 0 )
+			Child++;
+
+		if( SortCmp( Sort, &Items[Root], &Items[Child], Depth ) >= 0 )
+			return;
+
+		SortSwap( &Items[Root], &Items[Child] );
+		Root	= Child;
+		}
+	}
+/*============================================================================*/
+/* Heapsort of the 'n' strings at 'Items', which have the same first 'Depth'
+   characters. It is slower than the multikey quicksort, but it is never
+   quadratic. */
+static void SortHeap( const sort_t * restrict Sort, sort_item_t * restrict Items, size_t n, size_t Depth )
+	{
+	size_t	i;
+
+	for( i = n / 2; i > 0; i-- )
+		SortSiftDown( Sort, Items, i - 1, n, Depth );
+
+	for( i = n; i > 1; i-- )
+		{
+		SortSwap( &Items[0], &Items[i - 1] );
+		SortSiftDown( Sort, Items, 0, i - 1, Depth );
+		}
+	}
+/*============================================================================*/
+/* Returns how many times the 'n' strings can be split before the multikey
+   quicksort gives up and falls back to heapsort: twice the depth of the
+   recursion with perfect pivots. */
+static int SortLimit( size_t n )
+	{
+	return 2 * ( 64 - __builtin_clzll( n | 1 ));
+	}
+/*============================================================================*/
+/* Multikey quicksort of the 'n' strings at 'Items', which have the same first
+   'Depth' characters and their keys loaded at 'Depth'. The strings are split
+   in three by comparing their keys with a pivot, the ones with a key equal
+   to the pivot's are sorted by their next 8 characters. Only the parts that
+   are not the largest are sorted recursively, so the recursion is at most
+   log2( n ) deep, and the loop goes on with the largest. After 'Limit' splits
+   without moving to the next characters the rest is heapsorted, bounding the
+   worst case to O( n log n ) comparisons of keys. */
+static void SortMultikey( const sort_t * restrict Sort, sort_item_t * restrict Items, size_t n, size_t Depth, int Limit )
 	{
-	ssize_t	SrcLen, DstLen, DstMaxLen, Len, SrcStart;
-	char	*DstPtr;
+	sort_item_t	Pivot;
+	size_t		Lt, Gt, Mid, i;
+	int			Cmp;
+
+	while( n > SORT_INSERTION )
+		{
+		if( Limit == 0 )
+			{
+			SortHeap( Sort, Items, n, Depth );
+			return;
+			}
+
+		Pivot	= *SortPivot( &Items[0], &Items[n / 2], &Items[n - 1], Depth );
+
+		/* [0, Lt) are smaller than the pivot, [Lt, i) equal and (Gt, n) bigger. */
+		for( Lt = 0, i = 0, Gt = n; i < Gt; )
+			{
+			if(( Cmp = SortKeyCmp( &Items[i], &Pivot, Depth )) < 0 )
+				SortSwap( &Items[Lt++], &Items[i++] );
+			else if( Cmp > 0 )
+				SortSwap( &Items[--Gt], &Items[i] );
+			else
+				i++;
+			}
+
+		/* The strings that end within the key are all equal, there is nothing
+		   left to sort in the middle. */
+		if( Pivot.Len - Depth < 8 )
+			{
+			if(( Sort->Flags & S_SORT_STABLE ) && Gt - Lt > 1 )
+				qsort( Items + Lt, Gt - Lt, sizeof Items[0], SortIndexCmp );
+			Mid	= 0;
+			}
+		else
+			{
+			Mid	= Gt - Lt;
+			for( i = Lt; i < Gt; i++ )
+				SortKey( Sort, &Items[i], Depth + 8 );
+			}
+
+		if( Lt >= n - Gt && Lt >= Mid )
+			{
+			SortMultikey( Sort, Items + Gt, n - Gt, Depth, Limit - 1 );
+			SortMultikey( Sort, Items + Lt, Mid, Depth + 8, Limit );
+			n		= Lt;
+			Limit--;
+			}
+		else if( n - Gt >= Mid )
+			{
+			SortMultikey( Sort, Items, Lt, Depth, Limit - 1 );
+			SortMultikey( Sort, Items + Lt, Mid, Depth + 8, Limit );
+			Items  += Gt;
+			n	   -= Gt;
+			Limit--;
+			}
+		else
+			{
+			SortMultikey( Sort, Items, Lt, Depth, Limit - 1 );
+			SortMultikey( Sort, Items + Gt, n - Gt, Depth, Limit - 1 );
+			Items  += Lt;
+			n		= Mid;
+			Depth  += 8;
+			}
+		}
+
+	SortInsertion( Sort, Items, n, Depth );
+	}
+/*============================================================================*/
+/* Returns how many characters after the first 'Depth' all the 'n' strings at
+   'Items' have in common. */
+static size_t SortCommon( const sort_t * restrict Sort, const sort_item_t * restrict Items, size_t n, size_t Depth )
+	{
+	size_t	Common	= Items[0].Len - Depth, i, j;
+
+	for( i = 1; i < n && Common > 0; i++ )
+		{
+		if( Items[i].Len - Depth < Common )
+			Common	= Items[i].Len - Depth;
+
+		for( j = 0; j < Common; j++ )
+			if( Sort->Fold[Items[i].Ptr[Depth + j]] != Sort->Fold[Items[0].Ptr[Depth + j]] )
+				break;
+
+		Common	= j;
+		}
+
+	return Common;
+	}
+/*============================================================================*/
+/* A stable counting sort of the 'n' strings at 'Items' by their character at
+   'Depth', through 'Scratch'. Adds a task for each bucket to the 'Tasks' of
+   'Sort' from 'Tasks' on and returns how many there are now. The strings
+   that end before 'Depth' are all equal and already in their original order,
+   they are left first and need no task. */
+static size_t SortSplit( sort_t * restrict Sort, sort_item_t * restrict Items, sort_item_t * restrict Scratch, size_t n, size_t Depth, size_t Tasks )
+	{
+	size_t	Count[257]	= { 0 };
+	size_t	Bounds[258], i;
+
+	for( i = 0; i < n; i++ )
+		Count[Items[i].Len > Depth ? 1 + Sort->Fold[Items[i].Ptr[Depth]] : 0]++;
+
+	for( Bounds[0] = 0, i = 0; i < 257; i++ )
+		Bounds[i + 1]	= Bounds[i] + Count[i];
+
+	memcpy( Count, Bounds, sizeof Count );
+	for( i = 0; i < n; i++ )
+		Scratch[Count[Items[i].Len > Depth ? 1 + Sort->Fold[Items[i].Ptr[Depth]] : 0]++]	= Items[i];
+
+	memcpy( Items, Scratch, n * sizeof Items[0] );
+
+	for( i = 1; i < 257; i++ )
+		if( Bounds[i + 1] > Bounds[i] )
+			{
+			Sort->Tasks[Tasks].Begin	= Items - Sort->Items + Bounds[i];
+			Sort->Tasks[Tasks].Count	= Bounds[i + 1] - Bounds[i];
+			Sort->Tasks[Tasks].Depth	= Depth + 1;
+			Tasks++;
+			}
+
+	return Tasks;
+	}
+/*============================================================================*/
+/* Sorts one of the buckets of the radix passes. */
+static void SortBucket( void *Arg, size_t Task )
+	{
+	sort_t		*Sort	= Arg;
+	sort_item_t	*Items	= Sort->Items + Sort->Tasks[Task].Begin;
+	size_t		n		= Sort->Tasks[Task].Count, i;
+
+	if( n < 2 )
+		return;
+
+	for( i = 0; i < n; i++ )
+		SortKey( Sort, &Items[i], Sort->Tasks[Task].Depth );
+
+	SortMultikey( Sort, Items, n, Sort->Tasks[Task].Depth, SortLimit( n ));
+	}
+/*============================================================================*/
+int s_sort( s_string_t *strs[], size_t n, int flags )
+	{
+	sort_t		Sort;
+	sort_item_t	*Items, *Radix;
+	size_t		i, KeyLen, Bytes	= 0, Tasks, Large, Depth;
+	int			Splits;
+
+	STATS_CALL( s_sort );
 
-	if( dst == NULL || src == NULL )
+	if( strs == NULL && n > 0 )
 		return -1;
 
-	if( start >= ( DstMaxLen = s_strmaxlen( dst )))
+	if( n < 2 )
+		return 0;
+
+	if( n > SIZE_MAX / sizeof Items[0] )
 		return -1;
 
-	if( end < -( DstLen = s_strlen( dst )))
+	STATS_ALLOC( s_sort );
+	if(( Items = Allocate( NULL, n * sizeof Items[0] )) == NULL )
 		return -1;
 
-	SrcStart	= 0;
+	Sort.Flags	= flags;
+	for( i = 0; i < 256; i++ )
+		Sort.Fold[i]	= flags & S_SORT_ICASE ? toupper( i ) : i;
 
-	if( start < -DstLen )
+	/* The strings are read through the array of items, which has everything
+	   needed to compare them, so their headers are decoded only once. NULL
+	   pointers are taken as empty strings. */
+	for( i = 0; i < n; i++ )
 		{
-		SrcStart= -( start + DstLen );
-		start	= 0;
+		s_view_t	View	= s_view( strs[i], 0, s_strlen( strs[i] ));
+
+		Items[i].Ptr	= (const uint8_t*)View.Ptr;
+		Items[i].Len	= View.Len;
+		Items[i].Index	= i;
+		Items[i].Str	= strs[i];
+		Bytes		   += View.Len;
 		}
-	else if( start < 0 )
-		start  += DstLen;
 
-	if( end >= DstMaxLen )
-		end		= DstMaxLen - 1;
-	else if( end < 0 )
-		end	   += DstLen;
+	if( n < SORT_RADIX )
+		{
+		/* The strings with a header extension may have their keys cached. */
+		for( i = 0; i < n; i++ )
+			if( flags & S_SORT_ICASE )
+				SortKey( &Sort, &Items[i], 0 );
+			else
+				Items[i].Key	= StrKey( strs[i], &KeyLen );
+
+		SortMultikey( &Sort, Items, n, 0, SortLimit( n ));
+		}
+	else
+		{
+		/* Each split adds at most 256 tasks. */
+		Splits	= SORT_SPLITS * ParallelThreads();
+		Large	= n / ( 2 * ParallelThreads());
 
-	SrcLen = strlen( src );
+		STATS_ALLOC( s_sort );
+		Radix		= Allocate( NULL, n * sizeof Radix[0] );
+		STATS_ALLOC( s_sort );
+		Sort.Tasks	= Allocate( NULL, ( Splits + 1 ) * 256 * sizeof Sort.Tasks[0] );
 
-	if( start > end || SrcStart >= SrcLen )
-		return -1;
+		if( Radix == NULL || Sort.Tasks == NULL )
+			{
+			Release( NULL, Sort.Tasks );
+			Release( NULL, Radix );
+			Release( NULL, Items );
+			return -1;
+			}
 
-	Len			= ssmin( end - start + 1, SrcLen - SrcStart );
+		/* The buckets by the first character, then the ones with more than
+		   'Large' strings are split again after the characters they all have
+		   in common. They are handled in order, so the new ones are too. */
+		Sort.Items	= Items;
+		Tasks		= SortSplit( &Sort, Items, Radix, n, 0, 0 );
 
-	DstPtr		= s_cstr( dst );
+		for( i = 0; i < Tasks && Splits > 0; i++ )
+			if( Sort.Tasks[i].Count > Large )
+				{
+				Depth	= Sort.Tasks[i].Depth;
+				Depth  += SortCommon( &Sort, Items + Sort.Tasks[i].Begin, Sort.Tasks[i].Count, Depth );
 
-	if( start > DstLen )
-		{
-		if( filler == 0 )
-			return -1;
-		else
-			memset( DstPtr, filler, start - DstLen );
+				Tasks	= SortSplit( &Sort, Items + Sort.Tasks[i].Begin, Radix, Sort.Tasks[i].Count, Depth, Tasks );
+				Sort.Tasks[i].Count	= 0;
+				Splits--;
+				}
+
+		ParallelFor( Tasks, Bytes + n * sizeof Items[0], 0, SortBucket, &Sort );
+
+		Release( NULL, Sort.Tasks );
+		Release( NULL, Radix );
 		}
 
-	memcpy( DstPtr + start, src + SrcStart, Len );
+	for( i = 0; i < n; i++ )
+		strs[i]	= Items[i].Str;
 
-	if( start + Len > DstLen )
+	Release( NULL, Items );
+
+	return 0;
+	}
+/*============================================================================*/
+/* The control bytes of an s_map, one for each slot. A full slot has the low 7
+   bits of the hash of its key, the empty and deleted ones have the high bit
+   set, so the free slots of a group are found with a single 'movemask'. */
+#define	MAP_EMPTY			0x80
+#define	MAP_DELETED			0xfe
+/* The number of slots whose control bytes are compared at once. */
+#define	MAP_GROUP			16
+/* The default initial capacity of an s_map, in slots (a power of two). */
+#define	S_MAP_SLOTS			16
+
+typedef struct
+	{
+	uint64_t	Hash;		/* The full hash of the key, so the misses and rehashes don't read it. */
+	size_t		Len;		/* The length of the key. */
+	char		*Key;		/* A NUL terminated copy of the key. */
+	void		*Value;
+	} map_slot_t;
+
+struct s_map
+	{
+	uint8_t				*Ctrl;		/* 'Cap' control bytes and a copy of the first MAP_GROUP, for the groups that wrap around. */
+	map_slot_t			*Slots;
+	size_t				Cap;		/* Number of slots, a power of two of at least MAP_GROUP. */
+	size_t				Count;		/* Number of keys. */
+	size_t				Deleted;	/* Number of MAP_DELETED slots. */
+	uint64_t			Seed;
+	int					Flags;
+	const s_allocator_t	*Alloc;		/* The allocator of the map and of the copies of the keys. */
+	};
+/*============================================================================*/
+/* Converts to lowercase the ASCII letters of the 8 characters in 'Word', all
+   at once. */
+static inline uint64_t FoldAscii( uint64_t Word )
+	{
+	uint64_t	Heptets	= Word & 0x7f7f7f7f7f7f7f7full;
+	/* The high bit of each byte of 'AboveA' is set if the byte is at least 'A',
+	   and the one of 'AboveZ' if it is above 'Z'. Neither sum carries. */
+	uint64_t	AboveA	= Heptets + 0x3f3f3f3f3f3f3f3full;
+	uint64_t	AboveZ	= Heptets + 0x2525252525252525ull;
+
+	return Word | (( AboveA & ~AboveZ & ~Word & 0x8080808080808080ull ) >> 2 );
+	}
+/*============================================================================*/
+/* Returns the 8 characters of 'Ptr' from 'i' (padded with zeros if there are
+   less than 8 up to 'Len'), folded if 'Fold' is not zero. */
+static inline uint64_t MapWord( const char * restrict Ptr, size_t Len, size_t i, int Fold )
+	{
+	uint64_t	Word	= 0;
+
+	memcpy( &Word, Ptr + i, Len - i < 8 ? Len - i : 8 );
+
+	return Fold ? FoldAscii( Word ) : Word;
+	}
+/*============================================================================*/
+/* Hashes the 'Len' characters at 'Ptr' 8 at a time, mixing the words in the
+   same way as MurmurHash3 and finishing with its 'fmix64'. */
+static uint64_t MapHash( const char * restrict Ptr, size_t Len, uint64_t Seed, int Fold )
+	{
+	uint64_t	Hash	= Seed ^ ( Len * 0x9e3779b97f4a7c15ull ), Word;
+	size_t		i;
+
+	for( i = 0; i < Len; i += 8 )
 		{
-		*DstPtr	= '\0';
-		SetUsedLen( dst, start + Len );
+		Word	= MapWord( Ptr, Len, i, Fold ) * 0x87c37b91114253d5ull;
+		Word	= ( Word << 31 | Word >> 33 ) * 0x4cf5ad432745937full;
+		Hash   ^= Word;
+		Hash	= ( Hash << 27 | Hash >> 37 ) * 5 + 0x52dce729;
 		}
 
-	return Len;
+	Hash   ^= Hash >> 33;
+	Hash   *= 0xff51afd7ed558ccdull;
+	Hash   ^= Hash >> 33;
+	Hash   *= 0xc4ceb9fe1a85ec53ull;
+	Hash   ^= Hash >> 33;
+
+	return Hash;
 	}
 /*============================================================================*/
-ssize_t s_replace_l( s_string_t * restrict dst, ssize_t start, ssize_t len, const s_string_t * restrict src, ssize_t srcstart, int filler )
+/* Returns non-zero if the 'Len' characters of 'a' and 'b' are equal, ignoring
+   the case of the ASCII letters if 'Fold' is not zero. */
+static inline int MapKeyEqual( const char * restrict a, const char * restrict b, size_t Len, int Fold )
 	{
-	ssize_t	SrcLen, DstLen, DstMaxLen, SrcStart;
-	char	*DstPtr;
+	size_t	i;
 
-	if( dst == NULL || src == NULL )
-		return -1;
-
-	if( len < 0 )
-		return 0;
+	if( !Fold )
+		return memcmp( a, b, Len ) == 0;
 
-	if( start >= ( DstMaxLen = s_strmaxlen( dst )))
-		return 0;
+	for( i = 0; i < Len; i += 8 )
+		if( MapWord( a, Len, i, 1 ) != MapWord( b, Len, i, 1 ))
+			return 0;
 
-	if( start + len > DstMaxLen )
-		len		= DstMaxLen - start;
+	return 1;
+	}
+/*============================================================================*/
+/* Returns a bit for each of the MAP_GROUP control bytes at 'Ctrl' equal to
+   'Byte'. */
+static inline unsigned MapMatch( const uint8_t * restrict Ctrl, uint8_t Byte )
+	{
+#if			defined __SSE2__
+	return _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_loadu_si128( (const __m128i*)Ctrl ), _mm_set1_epi8( (char)Byte )));
+#else	/*	defined __SSE2__ */
+	unsigned	Bits	= 0;
+	int			i;
 
-	DstLen		= s_strlen( dst );
+	for( i = 0; i < MAP_GROUP; i++ )
+		Bits   |= ( Ctrl[i] == Byte ) << i;
 
-	SrcStart	= 0;
+	return Bits;
+#endif	/*	defined __SSE2__ */
+	}
+/*============================================================================*/
+/* Returns a bit for each of the MAP_GROUP slots from 'Ctrl' that are empty or
+   deleted. */
+static inline unsigned MapMatchFree( const uint8_t * restrict Ctrl )
+	{
+#if			defined __SSE2__
+	return _mm_movemask_epi8( _mm_loadu_si128( (const __m128i*)Ctrl ));
+#else	/*	defined __SSE2__ */
+	unsigned	Bits	= 0;
+	int			i;
 
-	if( start < -DstLen )
+	for( i = 0; i < MAP_GROUP; i++ )
+		Bits   |= ( Ctrl[i] >> 7 ) << i;
+
+	return Bits;
+#endif	/*	defined __SSE2__ */
+	}
+/*============================================================================*/
+static inline void MapSetCtrl( s_map_t * restrict Map, size_t Index, uint8_t Byte )
+	{
+	Map->Ctrl[Index]	= Byte;
+
+	if( Index < MAP_GROUP )
+		Map->Ctrl[Map->Cap + Index]	= Byte;
+	}
+/*============================================================================*/
+/* Returns the slot of 'Map' with the key 'Ptr' of 'Len' characters and hash
+   'Hash', or -1 if there is none. In that case, if 'Free' is not NULL, sets
+   it to the first empty or deleted slot where the key could be inserted. The
+   groups are probed at triangular offsets, which visit all of them because
+   the capacity is a power of two, until one with an empty slot. */
+static ssize_t MapFind( const s_map_t * restrict Map, const char * restrict Ptr, size_t Len, uint64_t Hash, size_t * restrict Free )
+	{
+	size_t		Mask	= Map->Cap - 1, Pos = ( Hash >> 7 ) & Mask, Step = 0, Index;
+	unsigned	Bits;
+	int			Fold	= Map->Flags & S_MAP_ICASE;
+
+	if( Free != NULL )
+		*Free	= SIZE_MAX;
+
+	for( ;; )
 		{
-		SrcStart= -( start + DstLen );
-		start	= 0;
+		/* Only the keys with the same 7 bits of hash, full hash and length
+		   are compared, most misses don't read any key at all. */
+		for( Bits = MapMatch( Map->Ctrl + Pos, Hash & 0x7f ); Bits != 0; Bits &= Bits - 1 )
+			{
+			Index	= ( Pos + __builtin_ctz( Bits )) & Mask;
+
+			if( Map->Slots[Index].Hash == Hash && Map->Slots[Index].Len == Len && MapKeyEqual( Map->Slots[Index].Key, Ptr, Len, Fold ))
+				return Index;
+			}
+
+		if( Free != NULL && *Free == SIZE_MAX && ( Bits = MapMatchFree( Map->Ctrl + Pos )) != 0 )
+			*Free	= ( Pos + __builtin_ctz( Bits )) & Mask;
+
+		if( MapMatch( Map->Ctrl + Pos, MAP_EMPTY ) != 0 )
+			return -1;
+
+		Step   += MAP_GROUP;
+		Pos		= ( Pos + Step ) & Mask;
 		}
-	else if( start < 0 )
-		start  += DstLen;
+	}
+/*============================================================================*/
+/* Returns the first empty or deleted slot of 'Map' in the probe sequence of
+   'Hash'. */
+static size_t MapFindFree( const s_map_t * restrict Map, uint64_t Hash )
+	{
+	size_t		Mask	= Map->Cap - 1, Pos = ( Hash >> 7 ) & Mask, Step = 0;
+	unsigned	Bits;
 
-	SrcLen = s_strlen( src );
+	while(( Bits = MapMatchFree( Map->Ctrl + Pos )) == 0 )
+		{
+		Step   += MAP_GROUP;
+		Pos		= ( Pos + Step ) & Mask;
+		}
 
-	if( SrcStart >= SrcLen )
+	return ( Pos + __builtin_ctz( Bits )) & Mask;
+	}
+/*============================================================================*/
+/* Moves all the keys of 'Map' to new arrays of 'Cap' slots, dropping the
+   deleted slots. The stored hashes are reused, the keys are not read. */
+static int MapRehash( s_map_t * restrict Map, size_t Cap )
+	{
+	uint8_t		*OldCtrl	= Map->Ctrl;
+	map_slot_t	*OldSlots	= Map->Slots;
+	size_t		OldCap		= Map->Cap, i, Free;
+	uint8_t		*Ctrl;
+	map_slot_t	*Slots;
+
+	if( Cap > SIZE_MAX / sizeof Slots[0] )
 		return 0;
 
-	len			= ssmin( len, SrcLen - SrcStart );
-	DstPtr		= s_cstr( dst );
+	STATS_ALLOC( s_map_set_v );
+	STATS_ALLOC( s_map_set_v );
+	Ctrl	= Allocate( Map->Alloc, Cap + MAP_GROUP );
+	Slots	= Allocate( Map->Alloc, Cap * sizeof Slots[0] );
 
-	if( start > DstLen )
-		{
-		if( filler == 0 )
-			return -1;
-		else
-			memset( DstPtr, filler, start - DstLen );
+	if( Ctrl == NULL || Slots == NULL )
+		{
+		Release( Map->Alloc, Ctrl );
+		Release( Map->Alloc, Slots );
+		return 0;
 		}
 
-	memcpy( DstPtr + start, s_constcstr( src, SrcStart ), len );
+	memset( Ctrl, MAP_EMPTY, Cap + MAP_GROUP );
 
-	if( start + len > DstLen )
+	Map->Ctrl		= Ctrl;
+	Map->Slots		= Slots;
+	Map->Cap		= Cap;
+	Map->Deleted	= 0;
+
+	for( i = 0; i < OldCap; i++ )
+		if( OldCtrl[i] < MAP_EMPTY )
+			{
+			Free	= MapFindFree( Map, OldSlots[i].Hash );
+			MapSetCtrl( Map, Free, OldSlots[i].Hash & 0x7f );
+			Slots[Free]	= OldSlots[i];
+			}
+
+	Release( Map->Alloc, OldCtrl );
+	Release( Map->Alloc, OldSlots );
+
+	return 1;
+	}
+/*============================================================================*/
+s_map_t *s_map_new( size_t count, int flags )
+	{
+	s_map_t	*Map;
+	size_t	Cap	= S_MAP_SLOTS;
+
+	STATS_CALL( s_map_new );
+
+	/* Room for 'count' keys without exceeding the maximum load of 7/8. */
+	while( Cap - Cap / 8 <= count )
 		{
-		*DstPtr	= '\0';
-		SetUsedLen( dst, start + len );
+		if( Cap > SIZE_MAX / ( 2 * sizeof( map_slot_t )))
+			return NULL;
+
+		Cap	   *= 2;
 		}
 
-	return len;
+	STATS_ALLOC( s_map_new );
+	if(( Map = Allocate( NULL, sizeof *Map )) == NULL )
+		return NULL;
+
+	Map->Alloc		= GetAllocator( NULL );
+	Map->Ctrl		= NULL;
+	Map->Slots		= NULL;
+	Map->Cap		= 0;
+	Map->Count		= 0;
+	Map->Flags		= flags;
+	/* A seed that changes from map to map (with ASLR, from run to run) makes
+	   it harder to choose keys that collide. */
+	Map->Seed		= MapHash( (const char*)&Map, sizeof Map, 0x243f6a8885a308d3ull, 0 );
+
+	if( !MapRehash( Map, Cap ))
+		{
+		Release( Map->Alloc, Map );
+		return NULL;
+		}
+
+	return Map;
 	}
 /*============================================================================*/
-ssize_t s_replace_lc( s_string_t * restrict dst, ssize_t start, ssize_t len, const char * restrict src, int filler )
+void s_map_free( s_map_t *map )
 	{
-	ssize_t	SrcLen, DstLen, DstMaxLen, SrcStart;
-	char	*DstPtr;
+	size_t	i;
+
+	STATS_CALL( s_map_free );
+
+	if( map == NULL )
+		return;
 
-	if( dst == NULL || src == NULL )
+	for( i = 0; i < map->Cap; i++ )
+		if( map->Ctrl[i] < MAP_EMPTY )
+			Release( map->Alloc, map->Slots[i].Key );
+
+	Release( map->Alloc, map->Ctrl );
+	Release( map->Alloc, map->Slots );
+	Release( map->Alloc, map );
+	}
+/*============================================================================*/
+ssize_t s_map_count( const s_map_t *map )
+	{
+	if( map == NULL )
 		return -1;
 
-	if( len < 0 )
-		return 0;
-
-	if( start >= ( DstMaxLen = s_strmaxlen( dst )))
-		return 0;
+	return map->Count;
+	}
+/*============================================================================*/
+int s_map_set_v( s_map_t * restrict map, s_view_t key, void *value )
+	{
+	uint64_t	Hash;
+	ssize_t		Index;
+	size_t		Free;
+	char		*Key;
 
-	if( start + len > DstMaxLen )
-		len		= DstMaxLen - start;
+	STATS_CALL( s_map_set_v );
+	TRACE_CALL( s_map_set_v, key.Len );
 
-	DstLen		= s_strlen( dst );
+	if( map == NULL || key.Ptr == NULL || key.Len < 0 )
+		return -1;
 
-	SrcStart	= 0;
+	Hash	= MapHash( key.Ptr, key.Len, map->Seed, map->Flags & S_MAP_ICASE );
 
-	if( start < -DstLen )
+	if(( Index = MapFind( map, key.Ptr, key.Len, Hash, &Free )) >= 0 )
 		{
-		SrcStart= -( start + DstLen );
-		start	= 0;
+		map->Slots[Index].Value	= value;
+		return 0;
 		}
-	else if( start < 0 )
-		start  += DstLen;
 
-	SrcLen = strlen( src );
+	/* The table grows if it would be more than 7/8 full, or is just cleaned
+	   of deleted slots if they are most of the used ones. */
+	if( map->Count + map->Deleted + 1 > map->Cap - map->Cap / 8 )
+		{
+		if( !MapRehash( map, map->Count + 1 > map->Cap * 7 / 16 ? map->Cap * 2 : map->Cap ))
+			return -1;
 
-	if( SrcStart >= SrcLen )
-		return 0;
+		Free	= MapFindFree( map, Hash );
+		}
 
-	len			= ssmin( len, SrcLen - SrcStart );
-	DstPtr		= s_cstr( dst );
+	STATS_ALLOC( s_map_set_v );
+	if(( Key = Allocate( map->Alloc, key.Len + 1 )) == NULL )
+		return -1;
 
-	if( start > DstLen )
-		{
-		if( filler == 0 )
-			return -1;
-		else
-			memset( DstPtr, filler, start - DstLen );
-		}
+	memcpy( Key, key.Ptr, key.Len );
+	Key[key.Len]	= '\0';
+	STATS_BYTES( s_map_set_v, key.Len );
 
-	memcpy( DstPtr + start, src + SrcStart, len );
+	map->Deleted   -= map->Ctrl[Free] == MAP_DELETED;
+	MapSetCtrl( map, Free, Hash & 0x7f );
 
-	if( start + len > DstLen )
-		{
-		*DstPtr	= '\0';
-		SetUsedLen( dst, start + len );
-		}
+	map->Slots[Free].Hash	= Hash;
+	map->Slots[Free].Len	= key.Len;
+	map->Slots[Free].Key	= Key;
+	map->Slots[Free].Value	= value;
+	map->Count++;
+
+	return 1;
+	}
+/*============================================================================*/
+int s_map_set( s_map_t * restrict map, const s_string_t * restrict key, void *value )
+	{
+	STATS_CALL( s_map_set );
 
-	return len;
+	if( key == NULL )
+		return -1;
+
+	return s_map_set_v( map, s_view( key, 0, s_strlen( key )), value );
 	}
-/*============================================================================*/
-ssize_t s_strlwr( s_string_t * restrict str, ssize_t start )
-	{
-	char	*Ptr;
-	ssize_t	UsedLen;
-	ssize_t	Index, Count;
-
-	if( str == NULL || str->MustBeZero != 0 || str->Writable == 0 )
-		return -1;
-
-	UsedLen	= s_strlen( str );
-
-	if( UsedLen == 0 )
-		return 0;
-
-	if(( Ptr = s_cstr( str )) == NULL )
-		return -1;
-
-	for( Count = 0, Index = 0; Index < UsedLen; Index++ )
-		if( isupper( Ptr[Index] ))
-			{
-			Count++;
-			Ptr[Index]	= tolower( Ptr[Index] );
-			}
-
-	return Count;
-	}
-/*============================================================================*/
-ssize_t s_strupr( s_string_t * restrict str, ssize_t start )
-	{
-	char	*Ptr;
-	ssize_t	UsedLen;
-	ssize_t	Index, Count;
-
-	if( str == NULL || str->MustBeZero != 0 || str->Writable == 0 )
-		return -1;
-
-	UsedLen	= s_strlen( str );
-
-	if( UsedLen == 0 )
-		return 0;
-
-	if(( Ptr = s_cstr( str )) == NULL )
-		return -1;
-
-	for( Count = 0, Index = 0; Index < UsedLen; Index++ )
-		if( islower( Ptr[Index] ))
-			{
-			Count++;
-			Ptr[Index]	= toupper( Ptr[Index] );
-			}
-
-	return Count;
+/*============================================================================*/
+int s_map_set_c( s_map_t * restrict map, const char * restrict key, void *value )
+	{
+	STATS_CALL( s_map_set_c );
+
+	if( key == NULL )
+		return -1;
+
+	return s_map_set_v( map, s_view_c( key ), value );
 	}
-/*============================================================================*/
-ssize_t s_ltrim( s_string_t * restrict str, ssize_t start )
-	{
-	return 0;
-	}
-/*============================================================================*/
-ssize_t s_rtrim( s_string_t * restrict str, ssize_t start )
-	{
-	return 0;
-	}
-/*============================================================================*/
-/*TODO*/
-ssize_t s_insert_l( s_string_t * restrict dst, ssize_t dststart, const s_string_t * restrict src, ssize_t srcstart, ssize_t len, int filler )
+/*============================================================================*/
+int s_map_get_v( const s_map_t * restrict map, s_view_t key, void **value )
 	{
-	ssize_t	SrcLen, DstLen, DstMaxLen;
-	ssize_t	Offset;
-	char	*DstPtr;
+	ssize_t	Index;
+
+	STATS_CALL( s_map_get_v );
+	TRACE_CALL( s_map_get_v, key.Len );
 
-	if( dst == NULL || src == NULL )
+	if( map == NULL || key.Ptr == NULL || key.Len < 0 )
 		return -1;
 
-	if( len < 0 )
-		return 0;
-
-	if( dststart >= ( DstMaxLen = s_strmaxlen( dst )))
+	if(( Index = MapFind( map, key.Ptr, key.Len, MapHash( key.Ptr, key.Len, map->Seed, map->Flags & S_MAP_ICASE ), NULL )) < 0 )
 		return 0;
 
-	if( srcstart >= ( SrcLen = s_strlen( src )))
-		return 0;
+	if( value != NULL )
+		*value	= map->Slots[Index].Value;
 
-	if( dststart + len > DstMaxLen )
-		len			= DstMaxLen - dststart;
+	return 1;
+	}
+/*============================================================================*/
+int s_map_get( const s_map_t * restrict map, const s_string_t * restrict key, void **value )
+	{
+	STATS_CALL( s_map_get );
 
-	if( srcstart + len > SrcLen )
-		len			= SrcLen - srcstart;
+	if( key == NULL )
+		return -1;
 
-	DstLen			= s_strlen( dst );
+	return s_map_get_v( map, s_view( key, 0, s_strlen( key )), value );
+	}
+/*============================================================================*/
+int s_map_get_c( const s_map_t * restrict map, const char * restrict key, void **value )
+	{
+	STATS_CALL( s_map_get_c );
 
-	Offset	= ssmin( dststart + DstLen, srcstart + SrcLen );
-	if( Offset < 0 )
-		len		   += Offset;
+	if( key == NULL )
+		return -1;
 
-	if( dststart < -DstLen )
-		dststart	= Offset -( dststart + DstLen );
-	else if( dststart < 0 )
-		dststart   += DstLen;
+	return s_map_get_v( map, s_view_c( key ), value );
+	}
+/*============================================================================*/
+int s_map_del_v( s_map_t * restrict map, s_view_t key )
+	{
+	ssize_t	Index;
 
-	if( srcstart < -SrcLen )
-		{
-		dststart   += -( srcstart + SrcLen );
-		srcstart	= 0;
-		}
-	else if( srcstart < 0 )
-		srcstart   += SrcLen;
+	STATS_CALL( s_map_del_v );
 
-	if( srcstart >= SrcLen || dststart >= DstLen )
+	if( map == NULL || key.Ptr == NULL || key.Len < 0 )
+		return -1;
+
+	if(( Index = MapFind( map, key.Ptr, key.Len, MapHash( key.Ptr, key.Len, map->Seed, map->Flags & S_MAP_ICASE ), NULL )) < 0 )
 		return 0;
 
-	len				= ssmin( len, SrcLen - srcstart );
-	DstPtr			= s_cstr( dst );
+	Release( map->Alloc, map->Slots[Index].Key );
 
-	if( dststart > DstLen )
-		{
-		if( filler == 0 )
-			return -1;
-		else
-			memset( DstPtr, filler, dststart - DstLen );
-		}
+	/* The slot must stay in the way of the probes of the keys after it. */
+	MapSetCtrl( map, Index, MAP_DELETED );
+	map->Deleted++;
+	map->Count--;
 
-	memcpy( DstPtr + dststart, s_constcstr( src, srcstart ), len );
+	return 1;
+	}
+/*============================================================================*/
+int s_map_del( s_map_t * restrict map, const s_string_t * restrict key )
+	{
+	STATS_CALL( s_map_del );
 
-	if( dststart + len > DstLen )
-		{
-		*DstPtr	= '\0';
-		SetUsedLen( dst, dststart + len );
-		}
+	if( key == NULL )
+		return -1;
 
-	return len;
+	return s_map_del_v( map, s_view( key, 0, s_strlen( key )));
 	}
 /*============================================================================*/
-ssize_t s_extins_lc( s_string_t * restrict dst, ssize_t dststart, const char * restrict src, ssize_t srcstart, ssize_t len, int filler );
+int s_map_del_c( s_map_t * restrict map, const char * restrict key )
+	{
+	STATS_CALL( s_map_del_c );
+
+	if( key == NULL )
+		return -1;
+
+	return s_map_del_v( map, s_view_c( key ));
+	}
+/*============================================================================*/
+ssize_t s_map_next( const s_map_t * restrict map, ssize_t pos, s_view_t * restrict key, void **value )
+	{
+	size_t	i;
+
+	if( map == NULL || pos < 0 )
+		return -1;
+
+	for( i = pos; i < map->Cap; i++ )
+		if( map->Ctrl[i] < MAP_EMPTY )
+			{
+			if( key != NULL )
+				{
+				key->Ptr	= map->Slots[i].Key;
+				key->Len	= map->Slots[i].Len;
+				}
+			if( value != NULL )
+				*value	= map->Slots[i].Value;
+
+			return i + 1;
+			}
+
+	return -1;
+	}
 /*============================================================================*/
 ssize_t _s_calcsize( ssize_t len )
 	{
@@ -3757,19 +9956,12 @@ void _s_string_init( s_string_t *str, ssize_t len, int area )
 	int		Log2Bytes;
 	char	*Ptr;
 
-	if( len < ( (ssize_t)1 <<  8 ) - 1 )
-		Log2Bytes	= 0;
-	else if( len < ( (ssize_t)1 << 16 ) - 1 )
-		Log2Bytes	= 1;
-	else if( len < ( (ssize_t)1 << 32 ) - 1 )
-		Log2Bytes	= 2;
-	else
-		Log2Bytes	= 3;
+	Log2Bytes	= CounterBits( len );
 
 	str->MustBeZero = 0;
 	str->Sizes		= 1;	/* We will have two size counters (maximum and used). */
 	str->Bits		= Log2Bytes;
-	str->Area		= area; /* The memory area that the string is allocated (0=bss, 1=stack, 2=heap). */
+	str->Area		= area; /* The memory area that the string is allocated (0=bss, 1=stack, 2=heap, 3=heap with its allocator). */
 	str->Writable	= 1;	/* The string is writable (at least for now). */
 
 	SetMaxLen( str, len );
@@ -3782,79 +9974,285 @@ void _s_string_init( s_string_t *str, ssize_t len, int area )
 	*Ptr			= '\0';
 	}
 /*============================================================================*/
-/* Create a dummy variable in the section "s_string_init". This section holds
-the initialization information for all the static s_strings. If we do not create
-the dummy variable and no other static s_string exists, the section will not be
-created. */
-static const void __attribute__((section("s_string_init"),used)) *s_string_init_dummy	= (void*)0x123456789abcdef0;
+/* The linker defines these symbols with the bounds of section "s_string_init",
+where '_s_string_bss' records each empty static s_string. They are weak so that
+a program without any such string still links (both are then NULL). */
+extern const _s_string_bss_t __start_s_string_init[] __attribute__((weak));
+extern const _s_string_bss_t __stop_s_string_init[] __attribute__((weak));
+/*============================================================================*/
+/* This function is called before 'main' (and before constructors of the default
+priority) to give the empty static s_strings, which are all zeros in 'bss', their
+descriptor and counters. Only the first page of each string is touched. */
+__attribute__((constructor(101))) static void InitStaticStrings( void )
+	{
+	const _s_string_bss_t	*p;
+
+	for( p = __start_s_string_init; p < __stop_s_string_init; p++ )
+		_s_string_init( p->Str, p->MaxSize, 0 );
+	}
+/*============================================================================*/
+ssize_t _s_calcsize_x( ssize_t len )
+	{
+	return _s_calcsize( len ) + sizeof( s_string_ext_t ) + IndexCapacity( len ) * sizeof( uint32_t );
+	}
+/*============================================================================*/
+void _s_string_init_x( s_string_t *str, ssize_t len, int area )
+	{
+	s_string_ext_t	*Ext;
+
+	_s_string_init( str, len, area );
 
-/* This symbol will be created by the linker with the address to the start of
-section "s_string_init". If the section doesn't exist, this symbol will not be
-created, resulting in a linker error. */
-extern const void *__start_s_string_init;
+	/* Now the string has a header extension, so the characters are moved a few bytes further. */
+	str->Sizes		= 2;
 
-/* This symbol will be created by the linker with the address to the end of
-section "s_string_init". If the section doesn't exist, this symbol will not be
-created, resulting in a linker error. */
-extern const void *__stop_s_string_init;
+	Ext				= GetExt( str );
+	Ext->IndexCap	= IndexCapacity( len );
+	Ext->Index		= NULL;
+	Ext->Data		= NULL;
+	Ext->DataArea	= area;
+	Ext->FreeFn		= NULL;
+
+	*s_cstr( str )	= '\0';
+
+	/* An empty string has zero code points. */
+	Ext->CodePoints	= 0;
+	Ext->Valid		= EXT_CODEPOINTS;
+	Ext->Key		= 0;
+	Ext->KeyLen		= 0;
+	}
 /*============================================================================*/
-/* This function will be called before function 'main', to initialize all static
-s_string objects. */
+s_string_t *_s_lazy_init( uint8_t *guard, ssize_t len )
+	{
+	s_string_t	*Str	= (s_string_t*)( guard + 1 );
+	uint8_t		Expected= 0;
 
-#include <stdio.h>
+	/* We won the race, we are the ones that must initialize the string... */
+	if( __atomic_compare_exchange_n( guard, &Expected, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE ))
+		{
+		/* ...it lives in 'bss', and the counters may be narrower than the room reserved for them. */
+		_s_string_init( Str, len, 0 );
+		__atomic_store_n( guard, 2, __ATOMIC_RELEASE );
+		return Str;
+		}
+
+	/* Another thread is initializing the string, it will not take long. */
+	while( __atomic_load_n( guard, __ATOMIC_ACQUIRE ) != 2 )
+		sched_yield();
 
-__attribute__((constructor)) void __s_string_global_init( void )
+	return Str;
+	}
+/*============================================================================*/
+size_t s_stats_snapshot( s_stats_t *stats, size_t count )
 	{
-	const void	**p;
+#if			defined S_STRING_STATS
+	const stats_block_t	*Block;
+	size_t				i;
+
+	if( stats == NULL )
+		return STATS_COUNT;
 
-	for( p = &__start_s_string_init; p < &__stop_s_string_init; p++ )
+	if( count > STATS_COUNT )
+		count	= STATS_COUNT;
+
+	for( i = 0; i < count; i++ )
 		{
-		uint64_t	Temp	=(uint64_t)*p;
-		uint64_t	Length	= Temp >> 8;
+		stats[i].Name			= StatsNames[i];
+		stats[i].Calls			= 0;
+		stats[i].Bytes			= 0;
+		stats[i].Truncations	= 0;
+		stats[i].Allocations	= 0;
+		}
 
-		switch( (uint8_t)Temp )
+	for( Block = (const stats_block_t*)FirstBlock( &StatsRegistry ); Block != NULL; Block = (const stats_block_t*)Block->Header.Next )
+		for( i = 0; i < count; i++ )
 			{
-			default:
-				break;
-			case 0x21:
-				Length	= Length > ( 1uLL <<  8 ) - 2 ? ( 1uLL <<  8 ) - 2 : Length;
-			case 0x23:
-				Length	= Length > ( 1uLL << 16 ) - 2 ? ( 1uLL << 16 ) - 2 : Length;
-			case 0x25:
-				{
-				Length	= Length > ( 1uLL << 32 ) - 2 ? ( 1uLL << 32 ) - 2 : Length;
-				s_string_t	*Str	= (s_string_t*)*++p;
-				_s_string_init( Str, Length, 0 );
-				s_strcpy_c( Str, *++p );
-				break;
-				}
-			case 0x22:
-				Length	= Length > ( 1uLL <<  8 ) - 2 ? ( 1uLL <<  8 ) - 2 : Length;
-			case 0x24:
-				Length	= Length > ( 1uLL << 16 ) - 2 ? ( 1uLL << 16 ) - 2 : Length;
-			case 0x26:
+			stats[i].Calls		   += __atomic_load_n( &Block->Counters[i][COUNTER_CALLS], __ATOMIC_RELAXED );
+			stats[i].Bytes		   += __atomic_load_n( &Block->Counters[i][COUNTER_BYTES], __ATOMIC_RELAXED );
+			stats[i].Truncations   += __atomic_load_n( &Block->Counters[i][COUNTER_TRUNCATIONS], __ATOMIC_RELAXED );
+			stats[i].Allocations   += __atomic_load_n( &Block->Counters[i][COUNTER_ALLOCATIONS], __ATOMIC_RELAXED );
+			}
+
+	return STATS_COUNT;
+#else	/*	defined S_STRING_STATS */
+	(void)stats;
+	(void)count;
+
+	return 0;
+#endif	/*	defined S_STRING_STATS */
+	}
+/*============================================================================*/
+void s_stats_reset( void )
+	{
+#if			defined S_STRING_STATS
+	stats_block_t	*Block;
+	size_t			i, j;
+
+	for( Block = (stats_block_t*)FirstBlock( &StatsRegistry ); Block != NULL; Block = (stats_block_t*)Block->Header.Next )
+		for( i = 0; i < STATS_COUNT; i++ )
+			for( j = 0; j < COUNTER_COUNT; j++ )
+				__atomic_store_n( &Block->Counters[i][j], 0, __ATOMIC_RELAXED );
+#endif	/*	defined S_STRING_STATS */
+	}
+/*============================================================================*/
+const s_allocator_t *s_set_allocator( const s_allocator_t *alloc )
+	{
+	const s_allocator_t	*Previous;
+
+	Previous	= __atomic_exchange_n( &GlobalAllocator, alloc != NULL ? alloc : &LibcAllocator, __ATOMIC_ACQ_REL );
+
+	return Previous != &LibcAllocator ? Previous : NULL;
+	}
+/*============================================================================*/
+const s_allocator_t *s_set_thread_allocator( const s_allocator_t *alloc )
+	{
+	const s_allocator_t	*Previous	= ThreadAllocator;
+
+	ThreadAllocator	= alloc;
+
+	return Previous;
+	}
+/*============================================================================*/
+const s_allocator_t *s_get_allocator( void )
+	{
+	return GetAllocator( NULL );
+	}
+/*============================================================================*/
+void s_trace_set_period( int period )
+	{
+#if			defined S_STRING_TRACE
+	__atomic_store_n( &TracePeriod, period > 0 ? period : 0, __ATOMIC_RELAXED );
+#else	/*	defined S_STRING_TRACE */
+	(void)period;
+#endif	/*	defined S_STRING_TRACE */
+	}
+/*============================================================================*/
+#if			defined S_STRING_TRACE
+/* Returns the time (in nanoseconds) below which is the fraction 'Fraction' of
+   the 'Total' calls of the histogram 'Buckets', rounded up to the end of its
+   bucket. */
+static double TracePercentile( const uint64_t Buckets[TRACE_BUCKETS], uint64_t Total, double Fraction, double NsPerTick )
+	{
+	uint64_t	Count	= 0;
+	int			i;
+
+	for( i = 0; i < TRACE_BUCKETS - 1; i++ )
+		if(( Count += Buckets[i] ) >= Fraction * Total )
+			break;
+
+	return TraceBucketEnd( i ) * NsPerTick;
+	}
+#endif	/*	defined S_STRING_TRACE */
+/*============================================================================*/
+int s_trace_dump( int fd, int format )
+	{
+#if			defined S_STRING_TRACE
+	static const char	*const ClassNames[TRACE_CLASSES]	= { "0-15", "16-63", "64-255", "256-1023", "1K-4K", "4K-16K", "16K-64K", "64K+" };
+	static const double	Fractions[]	= { 0.5, 0.9, 0.99, 0.999 };
+	const trace_block_t	*Block;
+	s_writer_t			*Writer;
+	uint64_t			Buckets[TRACE_BUCKETS], Total, Ticks, Ns;
+	double				NsPerTick, Percentiles[4];
+	char				Line[256];
+	int					Function, Class, i, Len, First = 1;
+
+	if( format != S_TRACE_TEXT && format != S_TRACE_JSON )
+		return -1;
+
+	pthread_once( &TraceRegistry.Once, InitTrace );
+
+	/* The ratio between ticks and nanoseconds is measured over the whole
+	   time that tracing has been running, at least 10 ms. */
+	while(( Ns = TraceNs() - TraceOriginNs ) < 10000000 )
+		usleep( 1000 );
+	Ticks		= TraceTicks() - TraceOriginTicks;
+	NsPerTick	= Ticks > 0 ? (double)Ns / Ticks : 1.0;
+
+	if(( Writer = s_writer_open( fd, 1 << 16 )) == NULL )
+		return -1;
+
+	if( format == S_TRACE_TEXT )
+		s_writer_put_v( Writer, s_view_c( "function        size        samples       p50_ns       p90_ns       p99_ns     p99.9_ns\n" ));
+	else
+		s_writer_put_v( Writer, s_view_c( "[" ));
+
+	for( Function = 0; Function < TRACE_COUNT; Function++ )
+		for( Class = 0; Class < TRACE_CLASSES; Class++ )
+			{
+			memset( Buckets, 0, sizeof Buckets );
+
+			for( Block = (const trace_block_t*)FirstBlock( &TraceRegistry ); Block != NULL; Block = (const trace_block_t*)Block->Header.Next )
+				for( i = 0; i < TRACE_BUCKETS; i++ )
+					Buckets[i]	   += __atomic_load_n( &Block->Buckets[Function][Class][i], __ATOMIC_RELAXED );
+
+			for( Total = 0, i = 0; i < TRACE_BUCKETS; i++ )
+				Total  += Buckets[i];
+
+			if( Total == 0 )
+				continue;
+
+			for( i = 0; i < 4; i++ )
+				Percentiles[i]	= TracePercentile( Buckets, Total, Fractions[i], NsPerTick );
+
+			if( format == S_TRACE_TEXT )
 				{
-				Length	= Length > ( 1uLL << 32 ) - 2 ? ( 1uLL << 32 ) - 2 : Length;
-				s_string_t	*Str	= (s_string_t*)*++p;
-				_s_string_init( Str, Length, 0 );
-				s_strcpy_c( Str, "" );
-				break;
+				snprintf( Line, sizeof Line, "%-15s %-9s %10llu %12.0f %12.0f %12.0f %12.0f\n", TraceNames[Function], ClassNames[Class],
+						  (unsigned long long)Total, Percentiles[0], Percentiles[1], Percentiles[2], Percentiles[3] );
+				s_writer_put_v( Writer, s_view_c( Line ));
+				continue;
 				}
-			case 0x31:
-				Length	= Length > ( 1uLL <<  8 ) - 2 ? ( 1uLL <<  8 ) - 2 : Length;
-			case 0x33:
-				Length	= Length > ( 1uLL << 16 ) - 2 ? ( 1uLL << 16 ) - 2 : Length;
-			case 0x35:
-				{
-				Length	= Length > ( 1uLL << 32 ) - 2 ? ( 1uLL << 32 ) - 2 : Length;
-				s_string_t	*Str	= (s_string_t*)*++p;
-				_s_string_init( Str, Length, 0 );
-				s_strcpy_c( Str, *++p );
-				Str->Writable	= 0;
-				break;
-				}
+
+			snprintf( Line, sizeof Line, "%s\n{\"function\":\"%s\",\"size\":\"%s\",\"samples\":%llu,\"p50_ns\":%.0f,\"p90_ns\":%.0f,\"p99_ns\":%.0f,\"p999_ns\":%.0f,\"buckets\":[",
+					  First ? "" : ",", TraceNames[Function], ClassNames[Class], (unsigned long long)Total, Percentiles[0], Percentiles[1], Percentiles[2], Percentiles[3] );
+			s_writer_put_v( Writer, s_view_c( Line ));
+			First	= 0;
+
+			/* Only the buckets with samples, as pairs of upper bound and count. */
+			for( Len = 0, i = 0; i < TRACE_BUCKETS; i++ )
+				if( Buckets[i] != 0 )
+					{
+					snprintf( Line, sizeof Line, "%s[%.1f,%llu]", Len++ > 0 ? "," : "", TraceBucketEnd( i ) * NsPerTick, (unsigned long long)Buckets[i] );
+					s_writer_put_v( Writer, s_view_c( Line ));
+					}
+
+			s_writer_put_v( Writer, s_view_c( "]}" ));
 			}
-		}
-	printf( "\n" );
+
+	if( format == S_TRACE_JSON )
+		s_writer_put_v( Writer, s_view_c( "\n]\n" ));
+
+	return s_writer_close( Writer );
+#else	/*	defined S_STRING_TRACE */
+	(void)fd;
+	(void)format;
+
+	return -1;
+#endif	/*	defined S_STRING_TRACE */
+	}
+/*============================================================================*/
+void s_trace_reset( void )
+	{
+#if			defined S_STRING_TRACE
+	trace_block_t	*Block;
+	int				Function, Class, i;
+
+	for( Block = (trace_block_t*)FirstBlock( &TraceRegistry ); Block != NULL; Block = (trace_block_t*)Block->Header.Next )
+		for( Function = 0; Function < TRACE_COUNT; Function++ )
+			for( Class = 0; Class < TRACE_CLASSES; Class++ )
+				for( i = 0; i < TRACE_BUCKETS; i++ )
+					__atomic_store_n( &Block->Buckets[Function][Class][i], 0, __ATOMIC_RELAXED );
+#endif	/*	defined S_STRING_TRACE */
+	}
+/*============================================================================*/
+void s_parallel_set_threads( int nthreads )
+	{
+	if( nthreads <= 0 )
+		nthreads	= sysconf( _SC_NPROCESSORS_ONLN );
+
+	__atomic_store_n( &Pool.Threads, ssmax( 1, ssmin( nthreads, PARALLEL_MAX_THREADS )), __ATOMIC_RELAXED );
+	}
+/*============================================================================*/
+void s_parallel_set_threshold( size_t bytes )
+	{
+	__atomic_store_n( &Pool.Threshold, bytes, __ATOMIC_RELAXED );
 	}
 /*============================================================================*/
@@ -27,6 +27,7 @@
 #define __S_STRING_H__
 /*============================================================================*/
 #include <stdint.h>
+#include <stdarg.h>
 /*=========================================================================*//**
 \brief          A data type to represent the s_string objects. It is an opaque
 				data type, so the user's code cannot access its internals
@@ -34,6 +35,16 @@
 *//*==========================================================================*/
 typedef struct s_string s_string_t;
 /*=========================================================================*//**
+\brief  		A read-only view of a run of characters, not necessarily NUL
+				terminated, that may be part of an s_string or of any other
+				buffer. A view doesn't own the characters, they must outlive it.
+*//*==========================================================================*/
+typedef struct s_view
+	{
+	const char	*Ptr;	/**< Pointer to the first character. */
+	ssize_t		Len;	/**< Number of characters. */
+	} s_view_t;
+/*=========================================================================*//**
 \brief          Creates on the stack (auto/local variable) an s_string object
 				capable of holding up to \a maxsize characters. Can only be used
 				inside a function. The resulting s_string starts empty.
@@ -57,6 +68,79 @@ typedef struct s_string s_string_t;
                                                             s_string_t * const name = (s_string_t*)_##name##_buffer; _s_string_init(name,maxsize,1); \
                                                             s_strcpy_c(name,src)
 /*=========================================================================*//**
+\brief          The same as \a auto_s_string, but the s_string has a header
+				extension where information about its contents (e.g. the
+				number of UTF-8 code points) is cached between changes.
+\param name     Name of the variable.
+\param maxsize  Maximum number of characters that the object will be able to
+				hold.
+*//*==========================================================================*/
+#define auto_s_string_x( name, maxsize )                    uint8_t _##name##_buffer[_s_calcsize_x(maxsize)]; \
+                                                            s_string_t * const name = (s_string_t*)_##name##_buffer; _s_string_init_x(name,maxsize,1)
+/*=========================================================================*//**
+\brief          The same as \a auto_s_string_c, but the s_string has a header
+				extension where information about its contents is cached.
+\param	name    Name of the variable.
+\param	maxsize Maximum number of characters that the object will be able to
+				store.
+\param	src		A C-string (null terminated array of characters) that will be
+				the initial value of the s_string.
+*//*==========================================================================*/
+#define auto_s_string_xc( name, maxsize, src )              uint8_t _##name##_buffer[_s_calcsize_x(maxsize)]; \
+                                                            s_string_t * const name = (s_string_t*)_##name##_buffer; _s_string_init_x(name,maxsize,1); \
+                                                            s_strcpy_c(name,src)
+/*=========================================================================*//**
+\brief          Defines \a var, an s_string object fully initialized at compile
+				time, so it needs no initialization at run time and lives in
+				the 'data' (or 'rodata', if \a qual has 'const') segment. The
+				descriptor, the counters (little-endian) and the characters are
+				laid out as the library expects. These macros are not intended
+				to be used directly by the programmer's code.
+\param qual     The storage class and qualifiers of the object.
+\param var      The name of the object.
+\param desc     The descriptor byte (writable, data area, width of the
+				counters, two counters).
+\param maxsize  The maximum number of characters that the object will be able to
+				store.
+\param src      The initial value, which must be a string literal.
+*//*==========================================================================*/
+#define _s_string_tiny( qual, var, desc, maxsize, src )      _Static_assert(( maxsize ) <= 254 && sizeof( src ) - 1 <= ( maxsize ), "s_string too long" ); \
+                                                            qual struct { uint8_t Descriptor; uint8_t Counters[2]; char Chars[( maxsize ) + 1]; } \
+                                                            var = { desc, { _S_LE8( maxsize ), _S_LE8( sizeof( src ) - 1 ) }, src }
+#define _s_string_small( qual, var, desc, maxsize, src )     _Static_assert(( maxsize ) <= 65534 && sizeof( src ) - 1 <= ( maxsize ), "s_string too long" ); \
+                                                            qual struct { uint8_t Descriptor; uint8_t Counters[4]; char Chars[( maxsize ) + 1]; } \
+                                                            var = { desc, { _S_LE16( maxsize ), _S_LE16( sizeof( src ) - 1 ) }, src }
+#define _s_string_large( qual, var, desc, maxsize, src )     _Static_assert(( maxsize ) <= 4294967294u && sizeof( src ) - 1 <= ( maxsize ), "s_string too long" ); \
+                                                            qual struct { uint8_t Descriptor; uint8_t Counters[8]; char Chars[( maxsize ) + 1]; } \
+                                                            var = { desc, { _S_LE32( maxsize ), _S_LE32( sizeof( src ) - 1 ) }, src }
+#define _S_LE8( v )                                         (uint8_t)( v )
+#define _S_LE16( v )                                        (uint8_t)(( v ) >> 0 ), (uint8_t)(( v ) >> 8 )
+#define _S_LE32( v )                                        (uint8_t)(( v ) >> 0 ), (uint8_t)(( v ) >> 8 ), (uint8_t)(( v ) >> 16 ), (uint8_t)(( v ) >> 24 )
+/*=========================================================================*//**
+\brief          The record that \a _s_string_bss leaves in section
+				"s_string_init" for each empty static s_string. This type is
+				not intended to be used directly by the programmer's code.
+*//*==========================================================================*/
+typedef struct
+	{
+	void	*Str;
+	size_t	MaxSize;
+	} _s_string_bss_t;
+/*=========================================================================*//**
+\brief          Defines \a var, a zero-filled (and so placed in 'bss') s_string
+				object, and records it in section "s_string_init". A
+				constructor writes the descriptor and the counters before \a
+				main is called, so an empty string takes no room in the
+				executable however large it is. This macro is not intended to
+				be used directly by the programmer's code.
+\param var      The name of the object.
+\param counters The number of bytes reserved for the counters.
+\param maxsize  The maximum number of characters that the object will be able to
+				store.
+*//*==========================================================================*/
+#define _s_string_bss( var, counters, maxsize )             static struct { uint8_t Descriptor; uint8_t Counters[counters]; char Chars[( maxsize ) + 1]; } var; \
+                                                            static const _s_string_bss_t __attribute__((section("s_string_init"),used)) var##_init = { &var, maxsize }
+/*=========================================================================*//**
 \brief          Creates a static (static local or file scope variable) s_string
 				object capable of holding up to \a maxsize characters. \a
 				maxsize can be at most 254 characters. The resulting string
@@ -65,9 +149,9 @@ typedef struct s_string s_string_t;
 \param	maxsize The maximum number of characters that the object will be able to
 				store.
 *//*==========================================================================*/
-#define static_s_string_tiny( name, maxsize )               static uint8_t _##name##_buffer[1+1+1+maxsize+1]; \
-                                                            static s_string_t * const name = (s_string_t*)_##name##_buffer; \
-                                                            static const void * __attribute__((section("s_string_init"),used)) _##name##_init[]   = { (void*)(( maxsize << 8 ) | 0x22 ), _##name##_buffer };
+#define static_s_string_tiny( name, maxsize )               _Static_assert(( maxsize ) <= 254, "s_string too long" ); \
+                                                            _s_string_bss( _##name##_buffer, 2, maxsize ); \
+                                                            static s_string_t * const name = (s_string_t*)&_##name##_buffer
 /*=========================================================================*//**
 \brief          Creates a static (static local or file scope variable) s_string
 				object capable of holding up to \a maxsize characters. \a
@@ -76,12 +160,11 @@ typedef struct s_string s_string_t;
 \param	name    The name of the variable.
 \param	maxsize The maximum number of characters that the object will be able to
 				store.
-\param	src		A C-string (null terminated array of characters) that will be
-				the initial value of the s_string.
+\param	src		A string literal that will be the initial value of the
+				s_string.
 *//*==========================================================================*/
-#define static_s_string_tiny_c( name, maxsize, src )        static uint8_t _##name##_buffer[1+1+1+maxsize+1]; \
-                                                            static s_string_t * const name = (s_string_t*)_##name##_buffer; \
-                                                            static const void * __attribute__((section("s_string_init"),used)) _##name##_init[]   = { (void*)(( maxsize << 8 ) | 0x21 ), _##name##_buffer, src };
+#define static_s_string_tiny_c( name, maxsize, src )        _s_string_tiny( static, _##name##_buffer, 0x21, maxsize, src ); \
+                                                            static s_string_t * const name = (s_string_t*)&_##name##_buffer
 /*=========================================================================*//**
 \brief          Creates a static (static local or file scope variable) s_string
 				object capable of holding up to \a maxsize characters. \a
@@ -90,12 +173,11 @@ typedef struct s_string s_string_t;
 \param	name    The name of the variable.
 \param	maxsize The maximum number of characters that the object will be able to
 				store.
-\param	src		A C-string (null terminated array of characters) that will be
-				the initial value of the s_string.
+\param	src		A string literal that will be the initial value of the
+				s_string.
 *//*==========================================================================*/
-#define static_const_s_string_tiny_c( name, maxsize, src )  static uint8_t _##name##_buffer[1+1+1+maxsize+1]; \
-                                                            static const s_string_t * const name = (s_string_t*)_##name##_buffer; \
-                                                            static const void * __attribute__((section("s_string_init"),used)) _##name##_init[]   = { (void*)(( maxsize << 8 ) | 0x31 ), _##name##_buffer, src };
+#define static_const_s_string_tiny_c( name, maxsize, src )  _s_string_tiny( static const, _##name##_buffer, 0x20, maxsize, src ); \
+                                                            static const s_string_t * const name = (const s_string_t*)&_##name##_buffer
 /*=========================================================================*//**
 \brief          Creates a static (static local or file scope variable) s_string
 				object capable of holding up to \a maxsize characters. \a
@@ -105,9 +187,9 @@ typedef struct s_string s_string_t;
 \param	maxsize The maximum number of characters that the object will be able to
 				store.
 *//*==========================================================================*/
-#define static_s_string_small( name, maxsize )              static uint8_t _##name##_buffer[1+2+2+maxsize+1]; \
-                                                            static s_string_t * const name = (s_string_t*)_##name##_buffer; \
-                                                            static const void * __attribute__((section("s_string_init"),used)) _##name##_init[]   = { (void*)(( maxsize << 8 ) | 0x24 ), _##name##_buffer };
+#define static_s_string_small( name, maxsize )              _Static_assert(( maxsize ) <= 65534, "s_string too long" ); \
+                                                            _s_string_bss( _##name##_buffer, 4, maxsize ); \
+                                                            static s_string_t * const name = (s_string_t*)&_##name##_buffer
 /*=========================================================================*//**
 \brief          Creates a static (static local or file scope variable) s_string
 				object capable of holding up to \a maxsize characters. \a
@@ -116,12 +198,11 @@ typedef struct s_string s_string_t;
 \param	name    The name of the variable.
 \param	maxsize The maximum number of characters that the object will be able to
 				store.
-\param	src		A C-string (null terminated array of characters) that will be
-				the initial value of the s_string.
+\param	src		A string literal that will be the initial value of the
+				s_string.
 *//*==========================================================================*/
-#define static_s_string_small_c( name, maxsize, src )       static uint8_t _##name##_buffer[1+2+2+maxsize+1]; \
-                                                            static s_string_t * const name = (s_string_t*)_##name##_buffer; \
-                                                            static const void * __attribute__((section("s_string_init"),used)) _##name##_init[]   = { (void*)(( maxsize << 8 ) | 0x23 ), _##name##_buffer, src };
+#define static_s_string_small_c( name, maxsize, src )       _s_string_small( static, _##name##_buffer, 0x29, maxsize, src ); \
+                                                            static s_string_t * const name = (s_string_t*)&_##name##_buffer
 /*=========================================================================*//**
 \brief          Creates a static (static local or file scope variable) s_string
 				object capable of holding up to \a maxsize characters. \a
@@ -130,12 +211,11 @@ typedef struct s_string s_string_t;
 \param	name    The name of the variable.
 \param	maxsize The maximum number of characters that the object will be able to
 				store.
-\param	src		A C-string (null terminated array of characters) that will be
-				the initial value of the s_string.
+\param	src		A string literal that will be the initial value of the
+				s_string.
 *//*==========================================================================*/
-#define static_const_s_string_small_c( name, maxsize, src ) static uint8_t _##name##_buffer[1+2+2+maxsize+1]; \
-                                                            static const s_string_t * const name = (s_string_t*)_##name##_buffer; \
-                                                            static const void * __attribute__((section("s_string_init"),used)) _##name##_init[]   = { (void*)(( maxsize << 8 ) | 0x33 ), _##name##_buffer, src };
+#define static_const_s_string_small_c( name, maxsize, src ) _s_string_small( static const, _##name##_buffer, 0x28, maxsize, src ); \
+                                                            static const s_string_t * const name = (const s_string_t*)&_##name##_buffer
 /*=========================================================================*//**
 \brief          Creates a static (static local or file scope variable) s_string
 				object capable of holding up to \a maxsize characters. \a
@@ -145,9 +225,9 @@ typedef struct s_string s_string_t;
 \param	maxsize The maximum number of characters that the object will be able to
 				store.
 *//*==========================================================================*/
-#define static_s_string_large( name, maxsize )              static uint8_t _##name##_buffer[1+4+4+maxsize+1]; \
-                                                            static s_string_t * const name = (s_string_t*)_##name##_buffer; \
-                                                            static const void * __attribute__((section("s_string_init"),used)) _##name##_init[]   = { (void*)(( maxsize << 8 ) | 0x26 ), _##name##_buffer };
+#define static_s_string_large( name, maxsize )              _Static_assert(( maxsize ) <= 4294967294u, "s_string too long" ); \
+                                                            _s_string_bss( _##name##_buffer, 8, maxsize ); \
+                                                            static s_string_t * const name = (s_string_t*)&_##name##_buffer
 /*=========================================================================*//**
 \brief          Creates a static (static local or file scope variable) s_string
 				object capable of holding up to \a maxsize characters. \a
@@ -157,9 +237,8 @@ typedef struct s_string s_string_t;
 \param	maxsize The maximum number of characters that the object will be able to
 				store.
 *//*==========================================================================*/
-#define static_s_string_large_c( name, maxsize, src )       static uint8_t _##name##_buffer[1+4+4+maxsize+1]; \
-                                                            static s_string_t * const name = (s_string_t*)_##name##_buffer; \
-                                                            static const void * __attribute__((section("s_string_init"),used)) _##name##_init[]   = { (void*)(( maxsize << 8 ) | 0x25 ), _##name##_buffer, src };
+#define static_s_string_large_c( name, maxsize, src )       _s_string_large( static, _##name##_buffer, 0x31, maxsize, src ); \
+                                                            static s_string_t * const name = (s_string_t*)&_##name##_buffer
 /*=========================================================================*//**
 \brief          Creates a static (static local or file scope variable) s_string
 				object capable of holding up to \a maxsize characters. \a
@@ -169,9 +248,56 @@ typedef struct s_string s_string_t;
 \param	maxsize The maximum number of characters that the object will be able to
 				store.
 *//*==========================================================================*/
-#define static_const_s_string_large_c( name, maxsize, src ) static uint8_t _##name##_buffer[1+4+4+maxsize+1]; \
-                                                            static const s_string_t * const name = (s_string_t*)_##name##_buffer; \
-                                                            static const void * __attribute__((section("s_string_init"),used)) _##name##_init[]   = { (void*)(( maxsize << 8 ) | 0x35 ), _##name##_buffer, src };
+#define static_const_s_string_large_c( name, maxsize, src ) _s_string_large( static const, _##name##_buffer, 0x30, maxsize, src ); \
+                                                            static const s_string_t * const name = (const s_string_t*)&_##name##_buffer
+/*=========================================================================*//**
+\brief          Defines \a var, a zero-filled (and so placed in 'bss') s_string
+				object preceded by a guard byte. Nothing is written to it until
+				the first access through \a s_lazy, so the pages of a string
+				that is never used are never touched. While the guard is clear
+				the all-zero descriptor reads as an empty read-only string.
+				This macro is not intended to be used directly by the
+				programmer's code.
+\param var      The name of the object.
+\param maxsize  The maximum number of characters that the object will be able to
+				store.
+*//*==========================================================================*/
+#define _s_string_lazy( var, maxsize )                      static struct { uint8_t Guard; uint8_t Descriptor; uint8_t Counters[8]; char Chars[( maxsize ) + 1]; } var
+/*=========================================================================*//**
+\brief          Creates a static (static local or file scope variable) s_string
+				object capable of holding up to \a maxsize characters, which
+				is initialized only when it is first used. \a maxsize can be at
+				most 65534 characters. The string must always be accessed as
+				\a s_lazy( \a name ), and it starts empty.
+\param	name    The name of the variable.
+\param	maxsize The maximum number of characters that the object will be able to
+				store.
+*//*==========================================================================*/
+#define static_lazy_s_string_small( name, maxsize )         _Static_assert(( maxsize ) <= 65534, "s_string too long" ); \
+                                                            _s_string_lazy( _##name##_lazy, maxsize )
+/*=========================================================================*//**
+\brief          Creates a static (static local or file scope variable) s_string
+				object capable of holding up to \a maxsize characters, which
+				is initialized only when it is first used. \a maxsize can be at
+				most 4294967294 characters. The string must always be accessed
+				as \a s_lazy( \a name ), and it starts empty.
+\param	name    The name of the variable.
+\param	maxsize The maximum number of characters that the object will be able to
+				store.
+*//*==========================================================================*/
+#define static_lazy_s_string_large( name, maxsize )         _Static_assert(( maxsize ) <= 4294967294u, "s_string too long" ); \
+                                                            _s_string_lazy( _##name##_lazy, maxsize )
+/*=========================================================================*//**
+\brief          Returns a pointer to the lazy s_string \a name, created with
+				\a static_lazy_s_string_small or \a static_lazy_s_string_large,
+				initializing it if this is the first access. After the first
+				access the cost is a single load and compare. It is safe to
+				use from several threads at once.
+\param	name    The name of the variable.
+*//*==========================================================================*/
+#define s_lazy( name )                                      ( __atomic_load_n( &_##name##_lazy.Guard, __ATOMIC_ACQUIRE ) == 2 ? \
+                                                            (s_string_t*)&_##name##_lazy.Descriptor : \
+                                                            _s_lazy_init( &_##name##_lazy.Guard, sizeof( _##name##_lazy.Chars ) - 1 ))
 /*=========================================================================*//**
 \brief          Creates a global file scope s_string object capable of holding
                 up to \a maxsize characters. \a maxsize can be at most 254
@@ -180,12 +306,11 @@ typedef struct s_string s_string_t;
 \param	name    The name of the variable.
 \param	maxsize The maximum number of characters that the object will be able to
 				store.
-\param	src		A C-string (null terminated array of characters) that will be
-				the initial value of the s_string.
+\param	src		A string literal that will be the initial value of the
+				s_string.
 *//*==========================================================================*/
-#define global_s_string_tiny_c( name, maxsize, src )        static uint8_t _##name##_buffer[1+1+1+maxsize+1]; \
-                                                            s_string_t * const name = (s_string_t*)_##name##_buffer; \
-                                                            static void * __attribute__((section("s_string_init"),used)) _##name##_init[]   = { (void*)(( maxsize << 8 ) | 0x21 ), _##name##_buffer, src };
+#define global_s_string_tiny_c( name, maxsize, src )        _s_string_tiny( static, _##name##_buffer, 0x21, maxsize, src ); \
+                                                            s_string_t * const name = (s_string_t*)&_##name##_buffer
 /*=========================================================================*//**
 \brief          Creates a global file scope s_string object capable of holding
                 up to \a maxsize characters. \a maxsize can be at most 254
@@ -194,9 +319,9 @@ typedef struct s_string s_string_t;
 \param	maxsize The maximum number of characters that the object will be able to
 				store.
 *//*==========================================================================*/
-#define global_s_string_tiny( name, maxsize )               static uint8_t _##name##_buffer[1+1+1+maxsize+1]; \
-                                                            s_string_t * const name = (s_string_t*)_##name##_buffer; \
-                                                            static void * __attribute__((section("s_string_init"),used)) _##name##_init[]   = { (void*)(( maxsize << 8 ) | 0x22 ), _##name##_buffer };
+#define global_s_string_tiny( name, maxsize )               _Static_assert(( maxsize ) <= 254, "s_string too long" ); \
+                                                            _s_string_bss( _##name##_buffer, 2, maxsize ); \
+                                                            s_string_t * const name = (s_string_t*)&_##name##_buffer
 /*=========================================================================*//**
 \brief          Creates a global file scope s_string object capable of holding
                 up to \a maxsize characters. \a maxsize can be at most 65534
@@ -205,12 +330,11 @@ typedef struct s_string s_string_t;
 \param	name    The name of the variable.
 \param	maxsize The maximum number of characters that the object will be able to
 				store.
-\param	src		A C-string (null terminated array of characters) that will be
-				the initial value of the s_string.
+\param	src		A string literal that will be the initial value of the
+				s_string.
 *//*==========================================================================*/
-#define global_s_string_small_c( name, maxsize, src )       static uint8_t _##name##_buffer[1+2+2+maxsize+1]; \
-                                                            s_string_t * const name = (s_string_t*)_##name##_buffer; \
-                                                            static void * __attribute__((section("s_string_init"))) _##name##_init[]   = { (void*)(( maxsize << 8 ) | 0x23 ), _##name##_buffer, src };
+#define global_s_string_small_c( name, maxsize, src )       _s_string_small( static, _##name##_buffer, 0x29, maxsize, src ); \
+                                                            s_string_t * const name = (s_string_t*)&_##name##_buffer
 /*=========================================================================*//**
 \brief          Creates a global file scope s_string object capable of holding
                 up to \a maxsize characters. \a maxsize can be at most 65534
@@ -219,9 +343,9 @@ typedef struct s_string s_string_t;
 \param	maxsize The maximum number of characters that the object will be able to
 				store.
 *//*==========================================================================*/
-#define global_s_string_small( name, maxsize )              static uint8_t _##name##_buffer[1+2+2+maxsize+1]; \
-                                                            s_string_t * const name = (s_string_t*)_##name##_buffer; \
-                                                            static void * __attribute__((section("s_string_init"))) _##name##_init[]   = { (void*)(( maxsize << 8 ) | 0x24 ), _##name##_buffer };
+#define global_s_string_small( name, maxsize )              _Static_assert(( maxsize ) <= 65534, "s_string too long" ); \
+                                                            _s_string_bss( _##name##_buffer, 4, maxsize ); \
+                                                            s_string_t * const name = (s_string_t*)&_##name##_buffer
 /*=========================================================================*//**
 \brief          Creates a global file scope s_string object capable of holding
                 up to \a maxsize characters. \a maxsize can be at most
@@ -231,9 +355,8 @@ typedef struct s_string s_string_t;
 \param	maxsize The maximum number of characters that the object will be able to
 				store.
 *//*==========================================================================*/
-#define global_s_string_large_c( name, maxsize, src )       static uint8_t _##name##_buffer[1+4+4+maxsize+1]; \
-                                                            s_string_t * const name = (s_string_t*)_##name##_buffer; \
-                                                            static void * __attribute__((section("s_string_init"))) _##name##_init[]   = { (void*)(( maxsize << 8 ) | 0x25 ), _##name##_buffer, src };
+#define global_s_string_large_c( name, maxsize, src )       _s_string_large( static, _##name##_buffer, 0x31, maxsize, src ); \
+                                                            s_string_t * const name = (s_string_t*)&_##name##_buffer
 /*=========================================================================*//**
 \brief          Creates a global file scope s_string object capable of holding
                 up to \a maxsize characters. \a maxsize can be at most
@@ -242,9 +365,9 @@ typedef struct s_string s_string_t;
 \param	maxsize The maximum number of characters that the object will be able to
 				store.
 *//*==========================================================================*/
-#define global_s_string_large( name, maxsize )              static uint8_t _##name##_buffer[1+4+4+maxsize+1]; \
-                                                            s_string_t * const name = (s_string_t*)_##name##_buffer; \
-                                                            static void * __attribute__((section("s_string_init"))) _##name##_init[]   = { (void*)(( maxsize << 8 ) | 0x26 ), _##name##_buffer };
+#define global_s_string_large( name, maxsize )              _Static_assert(( maxsize ) <= 4294967294u, "s_string too long" ); \
+                                                            _s_string_bss( _##name##_buffer, 8, maxsize ); \
+                                                            s_string_t * const name = (s_string_t*)&_##name##_buffer
 /*=========================================================================*//**
 \brief          Creates a structure field of type s_string capable of holding
                 up to \a maxsize characters. \a maxsize can be at most 65534
@@ -311,6 +434,38 @@ ssize_t      _s_calcsize    ( ssize_t len );
 *//*==========================================================================*/
 void         _s_string_init (       s_string_t * restrict str, ssize_t len, int area );
 /*=========================================================================*//**
+\brief          The same as \a _s_calcsize, for an s_string with a header
+				extension. This function is not intended to be called directly
+				by the programmer's code.
+\param len      The maximum number of characters that the object will be able to
+				store.
+\returns        The number of bytes required to hold the s_string object.
+*//*==========================================================================*/
+ssize_t      _s_calcsize_x  ( ssize_t len );
+/*=========================================================================*//**
+\brief          The same as \a _s_string_init, for an s_string with a header
+				extension. This function is not intended to be called directly
+				by the programmer's code.
+\param str      Pointer to the s_string to be initialized.
+\param len      The maximum number of characters that the object will be able to
+				store.
+\param area     The memory area in what the string will be created.
+*//*==========================================================================*/
+void         _s_string_init_x(      s_string_t * restrict str, ssize_t len, int area );
+/*=========================================================================*//**
+\brief          Initializes the lazy s_string that follows the byte \a guard,
+				unless another thread already did or is doing it, in which case
+				it waits for that thread to finish. This function is not
+				intended to be called directly by the programmer's code, \a
+				s_lazy calls it on the first access.
+\param guard    Pointer to the guard byte (0 = not initialized, 1 = being
+				initialized, 2 = ready).
+\param len      The maximum number of characters that the object will be able to
+				store.
+\returns        Pointer to the s_string.
+*//*==========================================================================*/
+s_string_t  *_s_lazy_init   ( uint8_t *guard, ssize_t len );
+/*=========================================================================*//**
 \brief          Returns non-zero if the s_string \a str cannot be changed.
 \param str      Pointer to the s_string.
 \returns        Zero if the s_string can be changed, a positive value if it
@@ -432,6 +587,61 @@ ssize_t      s_strstr_c     ( const s_string_t * restrict str, ssize_t start, co
 *//*==========================================================================*/
 ssize_t		 c_strstr_s		( const char	   * restrict str,				  const s_string_t * restrict src, ssize_t start );
 /*=========================================================================*//**
+\brief          The same as \a s_strstr (for the whole \a needle), but the
+				search is split among the threads of the pool (see
+				\a s_parallel_set_threads), for very long strings. The result
+				is the same: the lowest index where \a needle is found. The
+				threads stop as soon as a match is found before the part they
+				are searching.
+\param str      Pointer to the s_string that will be scanned to find
+				\a needle.
+\param start	The index at which the search is to begin in \a str.
+\param needle	Pointer to the s_string that will be looked for.
+\param nthreads	The maximum number of threads, including the calling one, or
+				zero for all the threads of the pool. Strings below the
+				threshold (see \a s_parallel_set_threshold) are searched by
+				the calling thread alone.
+\returns        The index of the start of first occurrence of \a needle if
+				found, or -1 if \a needle is not present in the string.
+*//*==========================================================================*/
+ssize_t      s_strstr_par   ( const s_string_t * restrict str, ssize_t start, const s_string_t * restrict needle, int nthreads );
+/*=========================================================================*//**
+\brief          Counts the occurrences of the character \a c in the s_string
+				\a str, from the position \a start to the end.
+\param str      Pointer to the s_string that will be scanned.
+\param start	The index at which the count is to begin.
+\param c        The character to be counted.
+\returns        The number of occurrences of \a c, or -1 if \a str is NULL
+				or \a start is outside of \a str.
+*//*==========================================================================*/
+ssize_t      s_strcount_chr ( const s_string_t * restrict str, ssize_t start, int c );
+/*=========================================================================*//**
+\brief          Counts the non-overlapping occurrences of the s_string
+				\a needle in the s_string \a str, from the position \a start
+				to the end, in a single pass.
+\param str      Pointer to the s_string that will be scanned.
+\param start	The index at which the count is to begin.
+\param needle	Pointer to the s_string that will be counted. An empty
+				\a needle is never found.
+\returns        The number of occurrences of \a needle, or -1 in case of
+				error.
+*//*==========================================================================*/
+ssize_t      s_strcount     ( const s_string_t * restrict str, ssize_t start, const s_string_t * restrict needle );
+/*=========================================================================*//**
+\brief          Finds all the non-overlapping occurrences of the s_string
+				\a needle in the s_string \a str, in a single pass.
+\param str      Pointer to the s_string that will be scanned.
+\param needle	Pointer to the s_string that will be looked for. An empty
+				\a needle is never found.
+\param out_idx	Array that receives the indexes of the first \a max
+				occurrences, in increasing order. May be NULL if \a max is
+				zero.
+\param max		The number of elements of \a out_idx.
+\returns        The total number of occurrences, which may be greater than
+				\a max, or -1 in case of error.
+*//*==========================================================================*/
+ssize_t      s_findall      ( const s_string_t * restrict str, const s_string_t * restrict needle, ssize_t out_idx[], size_t max );
+/*=========================================================================*//**
 \brief          Finds the first occurrence of sub-string \a src (s_string) in
 				the s_string \a str starting from the position \a start towards
 				the end of \a str (forward search), ignoring the case of the
@@ -701,6 +911,21 @@ int          s_strlcpy_c    (       s_string_t * restrict dst, const char
 *//*==========================================================================*/
 int          s_strcmp       ( const s_string_t * restrict dst, ssize_t dststart, const s_string_t * restrict src, ssize_t srcstart );
 /*=========================================================================*//**
+\brief  		Returns the first 8 characters of an s_string as a big-endian
+				integer, padded with zeros. Comparing the keys of two strings
+				as unsigned integers compares their first 8 characters as
+				memcmp does (the order of \a s_sort), so in that order only
+				the strings with equal keys need to be compared in full. It is
+				not the order of \a s_strcmp, which compares the characters
+				as 'char' and so differs for those above 0x7f wherever 'char'
+				is signed. The strings with a header extension (see
+				\a s_strdup_x) cache their key until they are changed, and
+				\a s_strcmp uses it when both strings have one.
+\param	str		Pointer to the s_string.
+\returns		The key, zero for a NULL pointer or an empty string.
+*//*==========================================================================*/
+uint64_t     s_strkey       ( const s_string_t *str );
+/*=========================================================================*//**
 \brief  		Compares the s_string \a dst with the C-string \a src character
 				by character.
 \param	dst		The first string to be compared.
@@ -964,7 +1189,7 @@ s_string_t	*s_strtok_mc	( const s_string_t * restrict str, ssize_t * restrict st
 				to the new s_string.
 \returns		A pointer to a new, dynamically allocated s_string object that
 				contains a copy of the character sequence from the s_string \a
-				src. The new object must be freed with 'free' when not in use
+				src. The new object must be freed with \a s_free when not in use
 				anymore.
 *//*==========================================================================*/
 s_string_t  *s_extract_me   ( const s_string_t * restrict src, ssize_t start, ssize_t end );
@@ -979,7 +1204,7 @@ s_string_t  *s_extract_me   ( const s_string_t * restrict src, ssize_t start, ss
 				to the new s_string.
 \returns		A pointer to a new, dynamically allocated s_string object that
 				contains a copy of the character sequence from the C-string \a
-				src. The new object must be freed with 'free' when not in use
+				src. The new object must be freed with \a s_free when not in use
 				anymore.
 *//*==========================================================================*/
 s_string_t  *s_extract_mec  ( const char * restrict src, ssize_t start, ssize_t end );
@@ -994,7 +1219,7 @@ s_string_t  *s_extract_mec  ( const char * restrict src, ssize_t start, ssize_t
 				copied to the new s_string.
 \returns		A pointer to a new, dynamically allocated s_string object that
 				contains a copy of the character sequence from the s_string \a
-				src. The new object must be freed with 'free' when not in use
+				src. The new object must be freed with \a s_free when not in use
 				anymore.
 *//*==========================================================================*/
 s_string_t  *s_extract_ml   ( const s_string_t * restrict src, ssize_t start, ssize_t len );
@@ -1009,7 +1234,7 @@ s_string_t  *s_extract_ml   ( const s_string_t * restrict src, ssize_t start, ss
 				copied to the new s_string.
 \returns		A pointer to a new, dynamically allocated s_string object that
 				contains a copy of the character sequence from the C-string \a
-				src. The new object must be freed with 'free' when not in use
+				src. The new object must be freed with \a s_free when not in use
 				anymore.
 *//*==========================================================================*/
 s_string_t  *s_extract_mlc  ( const char       * restrict src, ssize_t start, ssize_t len );
@@ -1277,7 +1502,7 @@ ssize_t      s_insert_lc	 (       s_string_t * restrict dst, ssize_t dststart, c
 \param start
 \returns		A pointer to a new, dynamically allocated s_string object that
 				contains a copy of the characters from the s_string \a src. The
-				new object must be freed with 'free' when not in use anymore.
+				new object must be freed with \a s_free when not in use anymore.
 *//*==========================================================================*/
 s_string_t  *s_strdup       ( const s_string_t * restrict src, ssize_t start );
 /*=========================================================================*//**
@@ -1286,10 +1511,29 @@ s_string_t  *s_strdup       ( const s_string_t * restrict src, ssize_t start );
 \param	src		Pointer to the s_string that will be duplicated.
 \returns		A pointer to a new, dynamically allocated s_string object that
 				contains a copy of the characters from the C-string \a src. The
-				new object must be freed with 'free' when not in use anymore.
+				new object must be freed with \a s_free when not in use anymore.
 *//*==========================================================================*/
 s_string_t  *s_strdup_c     ( const char       * restrict src );
 /*=========================================================================*//**
+\brief  		The same as \a s_strdup, but the new s_string has a header
+				extension where information about its contents is cached. An
+				empty source results in an empty s_string.
+\param	src		Pointer to the s_string that will be duplicated.
+\param	start	Position of the first character to be copied.
+\returns		A pointer to the new s_string, that must be freed with \a s_free
+				when not in use anymore, or NULL in case of error.
+*//*==========================================================================*/
+s_string_t  *s_strdup_x     ( const s_string_t * restrict src, ssize_t start );
+/*=========================================================================*//**
+\brief  		The same as \a s_strdup_c, but the new s_string has a header
+				extension where information about its contents is cached. An
+				empty or NULL source results in an empty s_string.
+\param	src		Pointer to the C-string that will be duplicated.
+\returns		A pointer to the new s_string, that must be freed with \a s_free
+				when not in use anymore, or NULL in case of error.
+*//*==========================================================================*/
+s_string_t  *s_strdup_xc    ( const char       * restrict src );
+/*=========================================================================*//**
 \brief  		Creates in the heap a dynamically allocated s_string object
 				capable of holding at most the minimum between \a len and the
 				length of \a src, and copies that amount of characters from \a
@@ -1300,7 +1544,7 @@ s_string_t  *s_strdup_c     ( const char       * restrict src );
 				able to hold.
 \returns		A pointer to a new, dynamically allocated s_string object that
 				contains a copy of the characters from the s_string \a src. The
-				new object must be freed with 'free' when not in use anymore.
+				new object must be freed with \a s_free when not in use anymore.
 *//*==========================================================================*/
 s_string_t  *s_strldup      ( const s_string_t * restrict src, ssize_t start, ssize_t len );
 /*=========================================================================*//**
@@ -1314,7 +1558,7 @@ s_string_t  *s_strldup      ( const s_string_t * restrict src, ssize_t start, ss
 				able to hold.
 \returns		A pointer to a new, dynamically allocated s_string object that
 				contains a copy of the characters from the s_string \a src. The
-				new object must be freed with 'free' when not in use anymore.
+				new object must be freed with \a s_free when not in use anymore.
 *//*==========================================================================*/
 s_string_t  *s_strldup_c    ( const char       * restrict src, ssize_t len );
 /*=========================================================================*//**
@@ -1327,7 +1571,7 @@ s_string_t  *s_strldup_c    ( const char       * restrict src, ssize_t len );
 				able to hold.
 \returns		A pointer to a new, dynamically allocated s_string object that
 				contains a copy of the characters from the s_string \a src. The
-				new object must be freed with 'free' when not in use anymore.
+				new object must be freed with \a s_free when not in use anymore.
 *//*==========================================================================*/
 s_string_t  *s_strndup      ( const s_string_t * restrict src, ssize_t start, ssize_t len );
 /*=========================================================================*//**
@@ -1340,9 +1584,942 @@ s_string_t  *s_strndup      ( const s_string_t * restrict src, ssize_t start, ss
 				able to hold.
 \returns		A pointer to a new, dynamically allocated s_string object that
 				contains a copy of the characters from the s_string \a src. The
-				new object must be freed with 'free' when not in use anymore.
+				new object must be freed with \a s_free when not in use anymore.
 *//*==========================================================================*/
 s_string_t  *s_strndup_c    ( const char       * restrict src, ssize_t len );
+/*=========================================================================*//**
+\brief  		Formats the arguments according to \a format (with the same
+				syntax of 'printf') writing the result directly into the
+				s_string \a dst, replacing its previous contents. The result is
+				truncated at the maximum length of \a dst. The integer, character
+				and string conversions are done by the library itself, without
+				going through the C library's formatting machinery.
+\param	dst		Pointer to the s_string that will receive the formatted text.
+\param	format	A C-string with the format specification.
+\returns		The new length of \a dst or a negative value in case of error.
+*//*==========================================================================*/
+ssize_t      s_sprintf       (       s_string_t * restrict dst, const char * restrict format, ... ) __attribute__((format(printf,2,3)));
+/*=========================================================================*//**
+\brief  		The same as \a s_sprintf, but takes the arguments from the
+				variable argument list \a ap.
+\param	dst		Pointer to the s_string that will receive the formatted text.
+\param	format	A C-string with the format specification.
+\param	ap		The list of arguments to be formatted.
+\returns		The new length of \a dst or a negative value in case of error.
+*//*==========================================================================*/
+ssize_t      s_vsprintf      (       s_string_t * restrict dst, const char * restrict format, va_list ap ) __attribute__((format(printf,2,0)));
+/*=========================================================================*//**
+\brief  		Formats the arguments according to \a format (with the same
+				syntax of 'printf') appending the result directly at the end of
+				the s_string \a dst. The result is truncated at the maximum
+				length of \a dst.
+\param	dst		Pointer to the s_string that will receive the formatted text.
+\param	format	A C-string with the format specification.
+\returns		The new length of \a dst or a negative value in case of error.
+*//*==========================================================================*/
+ssize_t      s_catprintf     (       s_string_t * restrict dst, const char * restrict format, ... ) __attribute__((format(printf,2,3)));
+/*=========================================================================*//**
+\brief  		The same as \a s_catprintf, but takes the arguments from the
+				variable argument list \a ap.
+\param	dst		Pointer to the s_string that will receive the formatted text.
+\param	format	A C-string with the format specification.
+\param	ap		The list of arguments to be formatted.
+\returns		The new length of \a dst or a negative value in case of error.
+*//*==========================================================================*/
+ssize_t      s_vcatprintf    (       s_string_t * restrict dst, const char * restrict format, va_list ap ) __attribute__((format(printf,2,0)));
+/*=========================================================================*//**
+\brief  		Appends the decimal representation of the signed integer \a
+				value to the end of the s_string \a dst. The digits are written
+				directly into \a dst, two at a time.
+\param	dst		Pointer to the s_string that will receive the number.
+\param	value	The value to be appended.
+\returns		The new length of \a dst or a negative value in case of error
+				or if there is not enough room in \a dst for the whole number,
+				in which case \a dst is not changed.
+*//*==========================================================================*/
+ssize_t      s_append_i64    (       s_string_t * restrict dst, int64_t value );
+/*=========================================================================*//**
+\brief  		Appends the decimal representation of the unsigned integer \a
+				value to the end of the s_string \a dst. The digits are written
+				directly into \a dst, two at a time.
+\param	dst		Pointer to the s_string that will receive the number.
+\param	value	The value to be appended.
+\returns		The new length of \a dst or a negative value in case of error
+				or if there is not enough room in \a dst for the whole number,
+				in which case \a dst is not changed.
+*//*==========================================================================*/
+ssize_t      s_append_u64    (       s_string_t * restrict dst, uint64_t value );
+/*=========================================================================*//**
+\brief  		Appends the hexadecimal representation (with lower case digits
+				and without any prefix) of \a value to the end of the s_string
+				\a dst.
+\param	dst		Pointer to the s_string that will receive the number.
+\param	value	The value to be appended.
+\param	mindigits The minimum number of digits to be generated, the number is
+				padded with zeros at the left if needed. At most 16.
+\returns		The new length of \a dst or a negative value in case of error
+				or if there is not enough room in \a dst for the whole number,
+				in which case \a dst is not changed.
+*//*==========================================================================*/
+ssize_t      s_append_x64    (       s_string_t * restrict dst, uint64_t value, int mindigits );
+/*=========================================================================*//**
+\brief  		The same as \a s_append_x64, but with upper case digits.
+\param	dst		Pointer to the s_string that will receive the number.
+\param	value	The value to be appended.
+\param	mindigits The minimum number of digits to be generated, the number is
+				padded with zeros at the left if needed. At most 16.
+\returns		The new length of \a dst or a negative value in case of error
+				or if there is not enough room in \a dst for the whole number,
+				in which case \a dst is not changed.
+*//*==========================================================================*/
+ssize_t      s_append_X64    (       s_string_t * restrict dst, uint64_t value, int mindigits );
+/*=========================================================================*//**
+\brief  		Appends to the end of the s_string \a dst the shortest decimal
+				representation of \a value that converts back to exactly the
+				same double. Numbers with a decimal exponent from -4 to 15 are
+				written in fixed notation, the others in scientific notation
+				(e.g. "0.1", "1234.5", "1e+16", "5e-324", "-inf", "nan").
+\param	dst		Pointer to the s_string that will receive the number.
+\param	value	The value to be appended.
+\returns		The new length of \a dst or a negative value in case of error
+				or if there is not enough room in \a dst for the whole number,
+				in which case \a dst is not changed.
+*//*==========================================================================*/
+ssize_t      s_append_f64    (       s_string_t * restrict dst, double value );
+/*=========================================================================*//**
+\brief  		Creates a view of up to \a len characters of the s_string
+				\a str, beginning at \a start (negative values count from the
+				end of the string). The view is only valid while \a str is not
+				changed.
+\param	str		Pointer to the s_string.
+\param	start	Position of the first character of the view.
+\param	len		Maximum number of characters of the view.
+\returns		The view, which is empty if \a str is NULL or \a start is past
+				the end of the string.
+*//*==========================================================================*/
+s_view_t     s_view          ( const s_string_t * restrict str, ssize_t start, ssize_t len );
+/*=========================================================================*//**
+\brief  		Creates a view of the NUL terminated C string \a src.
+\param	src		Pointer to the C string.
+\returns		The view, which is empty if \a src is NULL.
+*//*==========================================================================*/
+s_view_t     s_view_c        ( const char * restrict src );
+/*=========================================================================*//**
+\brief  		Parses a signed decimal integer (with an optional '+' or '-'
+				sign) at the beginning of the view \a view. Never reads past
+				the end of the view and doesn't need a NUL terminator. Leading
+				white space is not skipped.
+\param	view	The characters to be parsed.
+\param	value	Pointer to the variable that will receive the value (may be
+				NULL). Left unchanged if there is no number.
+\returns		The number of characters consumed, zero if there is no number
+				at the beginning of the view or -1 if the number is out of
+				range, in which case \a value receives INT64_MIN or INT64_MAX.
+*//*==========================================================================*/
+ssize_t      s_parse_i64_v   ( s_view_t view, int64_t * restrict value );
+/*=========================================================================*//**
+\brief  		The same as \a s_parse_i64_v, but for unsigned integers (only
+				an optional '+' sign is accepted). Out of range values set
+				\a value to UINT64_MAX.
+\param	view	The characters to be parsed.
+\param	value	Pointer to the variable that will receive the value (may be
+				NULL).
+\returns		The number of characters consumed, zero if there is no number
+				or -1 if the number is out of range.
+*//*==========================================================================*/
+ssize_t      s_parse_u64_v   ( s_view_t view, uint64_t * restrict value );
+/*=========================================================================*//**
+\brief  		Parses a decimal floating point number (the same syntax as
+				'strtod', except hexadecimal floats and leading white space)
+				at the beginning of the view \a view, correctly rounded.
+				Never reads past the end of the view.
+\param	view	The characters to be parsed.
+\param	value	Pointer to the variable that will receive the value (may be
+				NULL). Left unchanged if there is no number.
+\returns		The number of characters consumed, zero if there is no number
+				at the beginning of the view or a negative value in case of
+				error.
+*//*==========================================================================*/
+ssize_t      s_parse_f64_v   ( s_view_t view, double * restrict value );
+/*=========================================================================*//**
+\brief  		Parses a signed decimal integer from the s_string \a str,
+				looking at most at \a len characters from \a start on.
+\param	str		Pointer to the s_string.
+\param	start	Position of the first character to be parsed (negative
+				values count from the end of the string).
+\param	len		Maximum number of characters to be parsed.
+\param	value	Pointer to the variable that will receive the value (may be
+				NULL).
+\returns		The same as \a s_parse_i64_v.
+*//*==========================================================================*/
+ssize_t      s_parse_i64     ( const s_string_t * restrict str, ssize_t start, ssize_t len, int64_t * restrict value );
+/*=========================================================================*//**
+\brief  		Parses an unsigned decimal integer from the s_string \a str,
+				looking at most at \a len characters from \a start on.
+\param	str		Pointer to the s_string.
+\param	start	Position of the first character to be parsed (negative
+				values count from the end of the string).
+\param	len		Maximum number of characters to be parsed.
+\param	value	Pointer to the variable that will receive the value (may be
+				NULL).
+\returns		The same as \a s_parse_u64_v.
+*//*==========================================================================*/
+ssize_t      s_parse_u64     ( const s_string_t * restrict str, ssize_t start, ssize_t len, uint64_t * restrict value );
+/*=========================================================================*//**
+\brief  		Parses a decimal floating point number from the s_string
+				\a str, looking at most at \a len characters from \a start on.
+\param	str		Pointer to the s_string.
+\param	start	Position of the first character to be parsed (negative
+				values count from the end of the string).
+\param	len		Maximum number of characters to be parsed.
+\param	value	Pointer to the variable that will receive the value (may be
+				NULL).
+\returns		The same as \a s_parse_f64_v.
+*//*==========================================================================*/
+ssize_t      s_parse_f64     ( const s_string_t * restrict str, ssize_t start, ssize_t len, double * restrict value );
+/*=========================================================================*//**
+\brief  		Appends the \a n s_strings of the array \a parts, separated by
+				the s_string \a sep, to the end of the s_string \a dst. The
+				lengths are added and the capacity of \a dst is checked only
+				once, so it is faster than a sequence of calls to \a s_strcat.
+\param	dst		Pointer to the destination s_string.
+\param	sep		Pointer to the separator s_string (NULL for no separator).
+\param	n		Number of elements of \a parts.
+\param	parts	Array of pointers to the s_strings to be appended. NULL
+				elements are taken as empty strings.
+\returns		The new length of \a dst or a negative value in case of error
+				or if there is not enough room in \a dst for the whole result,
+				in which case \a dst is not changed.
+*//*==========================================================================*/
+ssize_t      s_join          (       s_string_t * restrict dst, const s_string_t * restrict sep, size_t n, const s_string_t * const parts[] );
+/*=========================================================================*//**
+\brief  		The same as \a s_join, without a separator.
+\param	dst		Pointer to the destination s_string.
+\param	n		Number of elements of \a parts.
+\param	parts	Array of pointers to the s_strings to be appended.
+\returns		The new length of \a dst or a negative value in case of error
+				or if there is not enough room in \a dst for the whole result,
+				in which case \a dst is not changed.
+*//*==========================================================================*/
+ssize_t      s_concat        (       s_string_t * restrict dst, size_t n, const s_string_t * const parts[] );
+/*=========================================================================*//**
+\brief  		Creates in the heap a dynamically allocated s_string with the
+				\a n s_strings of the array \a parts separated by the s_string
+				\a sep. The new s_string has exactly the length of the result.
+\param	sep		Pointer to the separator s_string (NULL for no separator).
+\param	n		Number of elements of \a parts.
+\param	parts	Array of pointers to the s_strings to be joined. NULL elements
+				are taken as empty strings.
+\returns		A pointer to the new s_string, that must be freed with \a s_free
+				when not in use anymore, or NULL in case of error.
+*//*==========================================================================*/
+s_string_t  *s_join_m        ( const s_string_t * restrict sep, size_t n, const s_string_t * const parts[] );
+/*=========================================================================*//**
+\brief  		The same as \a s_join_m, without a separator.
+\param	n		Number of elements of \a parts.
+\param	parts	Array of pointers to the s_strings to be concatenated.
+\returns		A pointer to the new s_string, that must be freed with \a s_free
+				when not in use anymore, or NULL in case of error.
+*//*==========================================================================*/
+s_string_t  *s_concat_m      ( size_t n, const s_string_t * const parts[] );
+/*=========================================================================*//**
+\brief  		Checks whether the characters of the view \a view are valid
+				UTF-8 (RFC 3629: no overlong forms, no surrogates and no code
+				points above U+10FFFF). Uses SIMD instructions when the
+				processor supports them.
+\param	view	The characters to be checked.
+\returns		Non-zero if the characters are valid UTF-8 (an empty view is
+				valid), zero otherwise.
+*//*==========================================================================*/
+int          s_utf8_validate_v( s_view_t view );
+/*=========================================================================*//**
+\brief  		Checks whether the s_string \a str is valid UTF-8. If \a str
+				has a header extension, the result is cached until the string
+				is changed.
+\param	str		Pointer to the s_string.
+\returns		Non-zero if the string is valid UTF-8, zero otherwise.
+*//*==========================================================================*/
+int          s_utf8_validate ( const s_string_t * restrict str );
+/*=========================================================================*//**
+\brief  		Counts the UTF-8 code points of the view \a view.
+\param	view	The characters to be counted.
+\returns		The number of code points or -1 if the characters are not
+				valid UTF-8.
+*//*==========================================================================*/
+ssize_t      s_utf8_len_v    ( s_view_t view );
+/*=========================================================================*//**
+\brief  		Counts the UTF-8 code points of the s_string \a str. If \a str
+				has a header extension (see \a s_strdup_x and
+				\a auto_s_string_x), the result is cached, so repeated calls
+				are free until the string is changed.
+\param	str		Pointer to the s_string.
+\returns		The number of code points or -1 if the string is not valid
+				UTF-8.
+*//*==========================================================================*/
+ssize_t      s_utf8_len      ( const s_string_t * restrict str );
+/*=========================================================================*//**
+\brief  		Returns the position (in bytes) of a code point of the UTF-8
+				s_string \a str. If \a str has a header extension and is long
+				enough, an index of the code points is built on the first
+				call, and kept until the string is changed, making any later
+				call O(1).
+\param	str		Pointer to the s_string.
+\param	index	The number of the code point, from zero (negative values count
+				from the end of the string). The code point right after the
+				last one is also accepted, its position is the length of the
+				string.
+\returns		The position of the first byte of the code point or -1 if the
+				string is not valid UTF-8 or \a index is out of range.
+*//*==========================================================================*/
+ssize_t      s_utf8_offset   ( const s_string_t * restrict str, ssize_t index );
+/*=========================================================================*//**
+\brief  		Returns a code point of the UTF-8 s_string \a str, using the
+				same index as \a s_utf8_offset.
+\param	str		Pointer to the s_string.
+\param	index	The number of the code point, from zero (negative values count
+				from the end of the string).
+\returns		The value of the code point or -1 if the string is not valid
+				UTF-8 or \a index is out of range.
+*//*==========================================================================*/
+int32_t      s_utf8_at       ( const s_string_t * restrict str, ssize_t index );
+/*=========================================================================*//**
+\brief  		A buffered reader of lines from a file descriptor. It is an
+				opaque data type, created with \a s_reader_open.
+*//*==========================================================================*/
+typedef struct s_reader s_reader_t;
+/*=========================================================================*//**
+\brief  		Creates a buffered line reader for the file descriptor \a fd.
+				The file descriptor is not closed by \a s_reader_close.
+\param	fd		The file descriptor to be read.
+\param	bufsize	The initial size of the read buffer, or zero for the default
+				(1 MiB). The buffer grows if a line doesn't fit in it.
+\returns		A pointer to the new reader or NULL in case of error.
+*//*==========================================================================*/
+s_reader_t  *s_reader_open   ( int fd, size_t bufsize );
+/*=========================================================================*//**
+\brief  		Destroys a reader created with \a s_reader_open.
+\param	reader	Pointer to the reader.
+*//*==========================================================================*/
+void         s_reader_close  ( s_reader_t *reader );
+/*=========================================================================*//**
+\brief  		Reads the next line from \a reader, without copying it. The
+				line doesn't include the '\\n' and is not NUL terminated.
+\param	reader	Pointer to the reader.
+\param	line	Pointer to the view that will receive the line (may be NULL).
+				The view is only valid until the next call for \a reader.
+\returns		The length of the line, -1 at the end of the file or -2 in
+				case of error.
+*//*==========================================================================*/
+ssize_t      s_getline_v     ( s_reader_t * restrict reader, s_view_t * restrict line );
+/*=========================================================================*//**
+\brief  		Reads the next line from \a reader and copies it (without the
+				'\\n') to the s_string \a dst. If the line is longer than the
+				maximum length of \a dst, only its beginning is copied.
+\param	reader	Pointer to the reader.
+\param	dst		Pointer to the s_string that will receive the line.
+\returns		The length of the line (which may be greater than the length
+				of \a dst), -1 at the end of the file or -2 in case of error,
+				including a NULL or read-only \a dst, in which case no line is
+				read.
+*//*==========================================================================*/
+ssize_t      s_getline       ( s_reader_t * restrict reader, s_string_t * restrict dst );
+/*=========================================================================*//**
+\brief  		Access patterns for \a s_mmap_file and \a s_mmap_advise, which
+				are passed to 'madvise'.
+*//*==========================================================================*/
+#define	S_ACCESS_NORMAL		0	/**< No special treatment. */
+#define	S_ACCESS_SEQUENTIAL	1	/**< Read ahead aggressively, pages can be dropped after being read. */
+#define	S_ACCESS_RANDOM		2	/**< Don't read ahead. */
+#define	S_ACCESS_WILLNEED	3	/**< Start reading the whole file now. */
+#define	S_ACCESS_DONTNEED	4	/**< The pages will not be needed soon. */
+/*=========================================================================*//**
+\brief  		Creates a read-only s_string with the contents of the file
+				\a path, mapped in memory instead of read. The characters are
+				only loaded from the file when accessed, and all the functions
+				that read s_strings work on it without copying anything. It is
+				always NUL terminated, even if the file is not.
+\param	path	The name of the file.
+\param	access	The expected access pattern, one of the S_ACCESS_xxx values.
+\returns		A pointer to the new s_string, that must be freed with
+				\a s_free, or NULL in case of error.
+*//*==========================================================================*/
+s_string_t  *s_mmap_file     ( const char * restrict path, int access );
+/*=========================================================================*//**
+\brief  		Changes the expected access pattern of an s_string created with
+				\a s_mmap_file.
+\param	str		Pointer to the s_string.
+\param	access	The expected access pattern, one of the S_ACCESS_xxx values.
+\returns		Zero if successful or a negative value in case of error (for
+				instance, \a str is not memory mapped).
+*//*==========================================================================*/
+int          s_mmap_advise   ( const s_string_t * restrict str, int access );
+/*=========================================================================*//**
+\brief  		Creates an s_string that uses the buffer \a buf for its
+				characters, without copying them. The s_string is writable and
+				can grow up to \a cap - 1 characters (one byte is kept for the
+				NUL terminator, which is written at \a buf[\a len]). The buffer
+				belongs to the s_string from now on and is released by
+				\a s_free with \a free_fn.
+\param	buf		Pointer to the buffer.
+\param	len		The number of characters already in the buffer.
+\param	cap		The size of the buffer, in bytes. Must be greater than \a len.
+\param	free_fn	The function that will release the buffer (e.g. 'free'), or
+				NULL if it must not be released.
+\returns		A pointer to the new s_string, that must be freed with
+				\a s_free, or NULL in case of error.
+*//*==========================================================================*/
+s_string_t  *s_adopt         ( char *buf, size_t len, size_t cap, void (*free_fn)( void * ));
+/*=========================================================================*//**
+\brief  		Creates a read-only s_string that uses the \a len characters at
+				\a buf, without copying them. \a buf[\a len] must be a NUL
+				character (as in any C-string), because the functions of the
+				library may read the terminator: a run of characters in the
+				middle of a bigger buffer (a slice of a network buffer, for
+				instance) is refused, it must be handled through an s_view_t
+				and the '_v' functions instead. The buffer must outlive the
+				s_string and is not released by \a s_free. Only the header is
+				allocated, and the code point index only if some UTF-8 function
+				needs it.
+\param	buf		Pointer to the characters.
+\param	len		The number of characters.
+\returns		A pointer to the new s_string, that must be freed with
+				\a s_free, or NULL in case of error.
+*//*==========================================================================*/
+s_string_t  *s_wrap_const    ( const char *buf, size_t len );
+/*=========================================================================*//**
+\brief  		Destroys an s_string created in the heap, releasing also its
+				characters if they are not inside the s_string (a memory mapped
+				file or a buffer adopted with \a s_adopt). Does nothing for
+				the s_strings in the stack or in static memory.
+\param	str		Pointer to the s_string.
+*//*==========================================================================*/
+void         s_free          ( s_string_t *str );
+/*=========================================================================*//**
+\brief  		A memory allocator. Everything the library creates in the heap
+				is allocated and released through one: the one passed to the
+				functions ending in 'a' or, if it is NULL, the one installed for
+				the calling thread with \a s_set_thread_allocator or, if there
+				is none, the global one installed with \a s_set_allocator. The
+				default is the C library ('malloc', 'realloc' and 'free').
+				The s_strings created with any other allocator remember it,
+				and \a s_free releases them with it. The allocator must
+				outlive everything it allocated.
+*//*==========================================================================*/
+typedef struct
+	{
+	void	*(*Alloc)	( void *context, size_t size );				/**< Like 'malloc'. */
+	void	*(*Realloc)	( void *context, void *ptr, size_t size );	/**< Like 'realloc'. */
+	void	 (*Free)	( void *context, void *ptr );				/**< Like 'free', never called with NULL. */
+	void	*Context;												/**< Passed as the first argument of the three functions. */
+	} s_allocator_t;
+/*=========================================================================*//**
+\brief  		Installs the global allocator, used by the threads that don't
+				have their own. It must be installed before any allocation
+				that it will release.
+\param	alloc	Pointer to the allocator, or NULL for the C library.
+\returns		The previous global allocator, or NULL if it was the C library.
+*//*==========================================================================*/
+const s_allocator_t	*s_set_allocator		( const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		Installs the allocator of the calling thread, used instead of
+				the global one (for instance, a pool for the current request).
+\param	alloc	Pointer to the allocator, or NULL to use the global one.
+\returns		The previous allocator of the thread, or NULL if it had none.
+*//*==========================================================================*/
+const s_allocator_t	*s_set_thread_allocator	( const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		Returns the allocator used by the calling thread when none is
+				passed explicitly.
+*//*==========================================================================*/
+const s_allocator_t	*s_get_allocator		( void );
+/*=========================================================================*//**
+\brief  		The same as \a s_free, for an s_string that the program
+				allocated itself in the heap with \a alloc (NULL for the C
+				library). The s_strings created by the library are always
+				released with the allocator that created them, whatever \a
+				alloc is.
+*//*==========================================================================*/
+void         s_free_a        ( s_string_t *str, const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		The same as \a s_join_m, but the new s_string is allocated with
+				\a alloc (NULL for the allocator in use).
+*//*==========================================================================*/
+s_string_t  *s_join_ma      ( const s_string_t * restrict sep, size_t n, const s_string_t * const parts[], const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		The same as \a s_concat_m, but the new s_string is allocated with
+				\a alloc (NULL for the allocator in use).
+*//*==========================================================================*/
+s_string_t  *s_concat_ma    ( size_t n, const s_string_t * const parts[], const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		The same as \a s_strdup, but the new s_string is allocated with
+				\a alloc (NULL for the allocator in use).
+*//*==========================================================================*/
+s_string_t  *s_strdup_a     ( const s_string_t * restrict src, ssize_t start, const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		The same as \a s_strdup_c, but the new s_string is allocated with
+				\a alloc (NULL for the allocator in use).
+*//*==========================================================================*/
+s_string_t  *s_strdup_ca    ( const char       * restrict src, const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		The same as \a s_strdup_x, but the new s_string is allocated with
+				\a alloc (NULL for the allocator in use).
+*//*==========================================================================*/
+s_string_t  *s_strdup_xa    ( const s_string_t * restrict src, ssize_t start, const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		The same as \a s_strdup_xc, but the new s_string is allocated with
+				\a alloc (NULL for the allocator in use).
+*//*==========================================================================*/
+s_string_t  *s_strdup_xca   ( const char       * restrict src, const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		The same as \a s_strldup, but the new s_string is allocated with
+				\a alloc (NULL for the allocator in use).
+*//*==========================================================================*/
+s_string_t  *s_strldup_a    ( const s_string_t * restrict src, ssize_t start, ssize_t len, const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		The same as \a s_strldup_c, but the new s_string is allocated with
+				\a alloc (NULL for the allocator in use).
+*//*==========================================================================*/
+s_string_t  *s_strldup_ca   ( const char       * restrict src, ssize_t len, const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		The same as \a s_strndup, but the new s_string is allocated with
+				\a alloc (NULL for the allocator in use).
+*//*==========================================================================*/
+s_string_t  *s_strndup_a    ( const s_string_t * restrict src, ssize_t start, ssize_t len, const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		The same as \a s_strndup_c, but the new s_string is allocated with
+				\a alloc (NULL for the allocator in use).
+*//*==========================================================================*/
+s_string_t  *s_strndup_ca   ( const char       * restrict src, ssize_t len, const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		The same as \a s_strtok_m, but the new s_string is allocated with
+				\a alloc (NULL for the allocator in use).
+*//*==========================================================================*/
+s_string_t  *s_strtok_ma    ( const s_string_t * restrict str, ssize_t * restrict start, const s_string_t * restrict delim, ssize_t delimstart, const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		The same as \a s_strtok_mc, but the new s_string is allocated with
+				\a alloc (NULL for the allocator in use).
+*//*==========================================================================*/
+s_string_t  *s_strtok_mca   ( const s_string_t * restrict str, ssize_t * restrict start, const char * restrict delim, const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		The same as \a s_extract_me, but the new s_string is allocated with
+				\a alloc (NULL for the allocator in use).
+*//*==========================================================================*/
+s_string_t  *s_extract_mea  ( const s_string_t * restrict src, ssize_t start, ssize_t end, const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		The same as \a s_extract_mec, but the new s_string is allocated with
+				\a alloc (NULL for the allocator in use).
+*//*==========================================================================*/
+s_string_t  *s_extract_meca ( const char       * restrict src, ssize_t start, ssize_t end, const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		The same as \a s_extract_ml, but the new s_string is allocated with
+				\a alloc (NULL for the allocator in use).
+*//*==========================================================================*/
+s_string_t  *s_extract_mla  ( const s_string_t * restrict src, ssize_t start, ssize_t len, const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		The same as \a s_extract_mlc, but the new s_string is allocated with
+				\a alloc (NULL for the allocator in use).
+*//*==========================================================================*/
+s_string_t  *s_extract_mlca ( const char       * restrict src, ssize_t start, ssize_t len, const s_allocator_t *alloc );
+/*=========================================================================*//**
+\brief  		Writes the characters of the s_string \a str to the file
+				descriptor \a fd, without looking for the NUL terminator.
+				Partial writes are continued until everything is written.
+\param	fd		The file descriptor.
+\param	str		Pointer to the s_string.
+\returns		The number of characters written or a negative value in case
+				of error.
+*//*==========================================================================*/
+ssize_t      s_write         ( int fd, const s_string_t * restrict str );
+/*=========================================================================*//**
+\brief  		Writes the \a n s_strings of the array \a strs to the file
+				descriptor \a fd, with a single 'writev' system call for each
+				batch of up to 64 strings.
+\param	fd		The file descriptor.
+\param	n		Number of elements of \a strs.
+\param	strs	Array of pointers to the s_strings (NULL elements are taken as
+				empty strings).
+\returns		The number of characters written or a negative value in case
+				of error.
+*//*==========================================================================*/
+ssize_t      s_writev        ( int fd, size_t n, const s_string_t * const strs[] );
+/*=========================================================================*//**
+\brief  		A buffered writer to a file descriptor, that gathers many small
+				s_strings into a single system call. It is an opaque data type,
+				created with \a s_writer_open.
+*//*==========================================================================*/
+typedef struct s_writer s_writer_t;
+/*=========================================================================*//**
+\brief  		Creates a buffered writer for the file descriptor \a fd. The
+				file descriptor is not closed by \a s_writer_close.
+\param	fd		The file descriptor to be written.
+\param	bufsize	The size of the buffer, or zero for the default (64 KiB).
+				The characters are written when the buffer is full.
+\returns		A pointer to the new writer or NULL in case of error.
+*//*==========================================================================*/
+s_writer_t  *s_writer_open   ( int fd, size_t bufsize );
+/*=========================================================================*//**
+\brief  		Appends the characters of the s_string \a str to the buffer of
+				\a writer. If they don't fit, they are written together with
+				the buffer. In case of error the characters that were not
+				written stay in the buffer, and those of \a str are not
+				consumed (unless the error happened after some of them were
+				written).
+\param	writer	Pointer to the writer.
+\param	str		Pointer to the s_string.
+\returns		The number of characters of \a str or a negative value in case
+				of error.
+*//*==========================================================================*/
+ssize_t      s_writer_put    ( s_writer_t * restrict writer, const s_string_t * restrict str );
+/*=========================================================================*//**
+\brief  		The same as \a s_writer_put, for the characters of a view.
+\param	writer	Pointer to the writer.
+\param	view	The characters to be written.
+\returns		The number of characters of \a view or a negative value in case
+				of error.
+*//*==========================================================================*/
+ssize_t      s_writer_put_v  ( s_writer_t * restrict writer, s_view_t view );
+/*=========================================================================*//**
+\brief  		Writes everything in the buffer of \a writer. In case of error
+				the characters that were not written stay in the buffer, so the
+				call can be repeated.
+\param	writer	Pointer to the writer.
+\returns		The number of characters written or a negative value in case
+				of error.
+*//*==========================================================================*/
+ssize_t      s_writer_flush  ( s_writer_t * restrict writer );
+/*=========================================================================*//**
+\brief  		Writes everything in the buffer of \a writer and destroys it.
+\param	writer	Pointer to the writer.
+\returns		Zero if successful or a negative value if the last write
+				failed.
+*//*==========================================================================*/
+int          s_writer_close  ( s_writer_t *writer );
+/*=========================================================================*//**
+\brief  		A vector of strings stored one after the other in a single
+				buffer, with an array of offsets (the layout of Apache Arrow)
+				and an array with the first 8 characters of each string. It
+				needs four allocations (the three arrays and the vector)
+				instead of one for each string, and scanning its strings is
+				cache friendly. The strings are not
+				NUL terminated, they are accessed as views with
+				\a s_strvec_at. It is an opaque data type, created with
+				\a s_strvec_new.
+*//*==========================================================================*/
+typedef struct s_strvec s_strvec_t;
+/*=========================================================================*//**
+\brief  		Creates an empty vector of strings. Both arrays grow as needed.
+\param	count	The initial capacity in strings, or zero for the default.
+\param	bytes	The initial capacity in characters, or zero for the default.
+\returns		A pointer to the new vector, that must be freed with
+				\a s_strvec_free, or NULL in case of error.
+*//*==========================================================================*/
+s_strvec_t  *s_strvec_new        ( size_t count, size_t bytes );
+/*=========================================================================*//**
+\brief  		Destroys a vector of strings. The views of its strings are no
+				longer valid.
+\param	vec		Pointer to the vector.
+*//*==========================================================================*/
+void         s_strvec_free       ( s_strvec_t *vec );
+/*=========================================================================*//**
+\brief  		Removes all the strings of a vector, keeping its memory.
+\param	vec		Pointer to the vector.
+*//*==========================================================================*/
+void         s_strvec_clear      ( s_strvec_t *vec );
+/*=========================================================================*//**
+\brief  		Returns the number of strings in the vector \a vec.
+*//*==========================================================================*/
+ssize_t      s_strvec_count      ( const s_strvec_t *vec );
+/*=========================================================================*//**
+\brief  		Appends a copy of the characters of the view \a view to the
+				vector \a vec. The views returned by \a s_strvec_at before
+				may no longer be valid.
+\param	vec		Pointer to the vector.
+\param	view	The characters to be appended.
+\returns		The index of the new string or a negative value in case of
+				error.
+*//*==========================================================================*/
+ssize_t      s_strvec_append_v   ( s_strvec_t * restrict vec, s_view_t view );
+/*=========================================================================*//**
+\brief  		The same as \a s_strvec_append_v, for an s_string.
+*//*==========================================================================*/
+ssize_t      s_strvec_append     ( s_strvec_t * restrict vec, const s_string_t * restrict str );
+/*=========================================================================*//**
+\brief  		The same as \a s_strvec_append_v, for a C-string.
+*//*==========================================================================*/
+ssize_t      s_strvec_append_c   ( s_strvec_t * restrict vec, const char * restrict str );
+/*=========================================================================*//**
+\brief  		Returns a view of a string of a vector, valid until the vector
+				is changed.
+\param	vec		Pointer to the vector.
+\param	index	The index of the string (if negative, counting from the end).
+\returns		The view of the string, with a NULL pointer if \a index is out
+				of range.
+*//*==========================================================================*/
+s_view_t     s_strvec_at         ( const s_strvec_t *vec, ssize_t index );
+/*=========================================================================*//**
+\brief  		Appends to the vector \a vec all the tokens of the s_string
+				\a str, as found by \a s_strtok, in a single call.
+\param	vec		Pointer to the vector.
+\param	str		Pointer to the s_string to be split.
+\param	delim	Pointer to the s_string with the set of delimiters.
+\param	delimstart	Position of the first delimiter in \a delim.
+\returns		The number of tokens appended or a negative value in case of
+				error.
+*//*==========================================================================*/
+ssize_t      s_strvec_tok        ( s_strvec_t * restrict vec, const s_string_t * restrict str, const s_string_t * restrict delim, ssize_t delimstart );
+/*=========================================================================*//**
+\brief  		The same as \a s_strvec_tok, with the delimiters in a
+				C-string.
+*//*==========================================================================*/
+ssize_t      s_strvec_tok_c      ( s_strvec_t * restrict vec, const s_string_t * restrict str, const char * restrict delim );
+/*=========================================================================*//**
+\brief  		Creates a vector with copies of the \a n s_strings of the
+				array \a parts.
+\param	n		Number of elements of \a parts.
+\param	parts	Array of pointers to the s_strings. NULL elements are taken as
+				empty strings.
+\returns		A pointer to the new vector, that must be freed with
+				\a s_strvec_free, or NULL in case of error.
+*//*==========================================================================*/
+s_strvec_t  *s_strvec_from       ( size_t n, const s_string_t * const parts[] );
+/*=========================================================================*//**
+\brief  		Creates in the heap an s_string with a copy of a string of a
+				vector.
+\param	vec		Pointer to the vector.
+\param	index	The index of the string (if negative, counting from the end).
+\returns		A pointer to the new s_string, that must be freed with
+				\a s_free, or NULL in case of error.
+*//*==========================================================================*/
+s_string_t  *s_strvec_get_m      ( const s_strvec_t *vec, ssize_t index );
+/*=========================================================================*//**
+\brief  		Finds the first string of a vector equal to a key. The lengths
+				and the first 8 characters of the strings are compared first,
+				several at a time, and only the strings that pass both are
+				compared in full.
+\param	vec		Pointer to the vector.
+\param	key		View of the key.
+\returns		The index of the first string equal to \a key or -1 if there
+				is none or in case of error.
+*//*==========================================================================*/
+ssize_t      s_strvec_find_v     ( const s_strvec_t *vec, s_view_t key );
+/*=========================================================================*//**
+\brief  		The same as \a s_strvec_find_v, with the key in an s_string.
+*//*==========================================================================*/
+ssize_t      s_strvec_find       ( const s_strvec_t *vec, const s_string_t *key );
+/*=========================================================================*//**
+\brief  		Marks all the strings of a vector equal to a key, in the same
+				way as \a s_strvec_find_v.
+\param	vec		Pointer to the vector.
+\param	key		View of the key.
+\param	mask	Array of at least (\a s_strvec_count + 63) / 64 words, where
+				the bit i % 64 of the word i / 64 is set if the string i is
+				equal to \a key and cleared if not.
+\returns		The number of strings equal to \a key or a negative value in
+				case of error.
+*//*==========================================================================*/
+ssize_t      s_strvec_eq_mask_v  ( const s_strvec_t * restrict vec, s_view_t key, uint64_t * restrict mask );
+/*=========================================================================*//**
+\brief  		The same as \a s_strvec_eq_mask_v, with the key in an
+				s_string.
+*//*==========================================================================*/
+ssize_t      s_strvec_eq_mask    ( const s_strvec_t * restrict vec, const s_string_t * restrict key, uint64_t * restrict mask );
+/*=========================================================================*//**
+\brief  		Options of \a s_sort, that can be combined.
+*//*==========================================================================*/
+#define	S_SORT_ICASE	1	/**< Compare the characters converted to uppercase, as \a s_stricmp. */
+#define	S_SORT_STABLE	2	/**< Keep the equal strings in their original order. */
+/*=========================================================================*//**
+\brief  		Sorts an array of s_strings in ascending order, comparing their
+				characters as unsigned, as memcmp, and putting a string before
+				the longer ones that begin with it. This is the order of
+				\a s_strkey, not the one of \a s_strcmp, which differs for the
+				characters above 0x7f wherever 'char' is signed. The strings
+				are sorted by 8 characters at a time, with a multikey
+				quicksort, and the large arrays are first split by their first
+				character and the parts sorted in parallel.
+\param	strs	Array of pointers to the s_strings, which is sorted in place.
+				NULL elements are taken as empty strings.
+\param	n		Number of elements of \a strs.
+\param	flags	Zero or a combination of \a S_SORT_ICASE and
+				\a S_SORT_STABLE.
+\returns		Zero if successful or a negative value in case of error, with
+				\a strs unchanged.
+*//*==========================================================================*/
+int          s_sort              ( s_string_t *strs[], size_t n, int flags );
+/*=========================================================================*//**
+\brief  		A hash map from strings to pointers, with open addressing. The
+				slots are probed 16 at a time by comparing their control bytes
+				(7 bits of the hash of their keys) with SSE2, and each slot
+				holds the full hash and the length of its key, so the keys are
+				read only to confirm a match. It is an opaque data type,
+				created with \a s_map_new.
+*//*==========================================================================*/
+typedef struct s_map s_map_t;
+/*=========================================================================*//**
+\brief  		Options of \a s_map_new.
+*//*==========================================================================*/
+#define	S_MAP_ICASE		1	/**< The keys that differ only in the case of their ASCII letters are the same key. */
+/*=========================================================================*//**
+\brief  		Creates an empty map. It grows as needed.
+\param	count	The number of keys it must hold before growing, or zero for the
+				default.
+\param	flags	Zero or \a S_MAP_ICASE.
+\returns		A pointer to the new map, that must be freed with
+				\a s_map_free, or NULL in case of error.
+*//*==========================================================================*/
+s_map_t     *s_map_new           ( size_t count, int flags );
+/*=========================================================================*//**
+\brief  		Destroys a map and its copies of the keys. The values are not
+				freed, see \a s_map_next.
+\param	map		Pointer to the map.
+*//*==========================================================================*/
+void         s_map_free          ( s_map_t *map );
+/*=========================================================================*//**
+\brief  		Returns the number of keys in the map \a map.
+*//*==========================================================================*/
+ssize_t      s_map_count         ( const s_map_t *map );
+/*=========================================================================*//**
+\brief  		Associates a value with a key, adding a copy of the key to the
+				map if it is not there yet.
+\param	map		Pointer to the map.
+\param	key		View of the key.
+\param	value	The value, replacing the previous one of the key, if any.
+\returns		1 if the key was added, 0 if it was already in the map or a
+				negative value in case of error.
+*//*==========================================================================*/
+int          s_map_set_v         ( s_map_t * restrict map, s_view_t key, void *value );
+/*=========================================================================*//**
+\brief  		The same as \a s_map_set_v, with the key in an s_string.
+*//*==========================================================================*/
+int          s_map_set           ( s_map_t * restrict map, const s_string_t * restrict key, void *value );
+/*=========================================================================*//**
+\brief  		The same as \a s_map_set_v, with the key in a C-string.
+*//*==========================================================================*/
+int          s_map_set_c         ( s_map_t * restrict map, const char * restrict key, void *value );
+/*=========================================================================*//**
+\brief  		Looks up a key in a map.
+\param	map		Pointer to the map.
+\param	key		View of the key.
+\param	value	Where to store the value of the key if it is found, or NULL.
+\returns		1 if the key was found, 0 if not or a negative value in case
+				of error.
+*//*==========================================================================*/
+int          s_map_get_v         ( const s_map_t * restrict map, s_view_t key, void **value );
+/*=========================================================================*//**
+\brief  		The same as \a s_map_get_v, with the key in an s_string.
+*//*==========================================================================*/
+int          s_map_get           ( const s_map_t * restrict map, const s_string_t * restrict key, void **value );
+/*=========================================================================*//**
+\brief  		The same as \a s_map_get_v, with the key in a C-string.
+*//*==========================================================================*/
+int          s_map_get_c         ( const s_map_t * restrict map, const char * restrict key, void **value );
+/*=========================================================================*//**
+\brief  		Removes a key and its value from a map.
+\param	map		Pointer to the map.
+\param	key		View of the key.
+\returns		1 if the key was removed, 0 if it was not in the map or a
+				negative value in case of error.
+*//*==========================================================================*/
+int          s_map_del_v         ( s_map_t * restrict map, s_view_t key );
+/*=========================================================================*//**
+\brief  		The same as \a s_map_del_v, with the key in an s_string.
+*//*==========================================================================*/
+int          s_map_del           ( s_map_t * restrict map, const s_string_t * restrict key );
+/*=========================================================================*//**
+\brief  		The same as \a s_map_del_v, with the key in a C-string.
+*//*==========================================================================*/
+int          s_map_del_c         ( s_map_t * restrict map, const char * restrict key );
+/*=========================================================================*//**
+\brief  		Iterates over the keys of a map, in no particular order. The
+				map must not be changed while iterating.
+\param	map		Pointer to the map.
+\param	pos		Zero for the first key, or the value returned by the
+				previous call.
+\param	key		Where to store a view of the key (valid until the key is
+				removed), or NULL.
+\param	value	Where to store the value of the key, or NULL.
+\returns		The position to pass to the next call, or -1 if there are no
+				more keys.
+*//*==========================================================================*/
+ssize_t      s_map_next          ( const s_map_t * restrict map, ssize_t pos, s_view_t * restrict key, void **value );
+/*=========================================================================*//**
+\brief  		The counters of one function of the library, as returned by
+				\a s_stats_snapshot.
+*//*==========================================================================*/
+typedef struct
+	{
+	const char	*Name;			/**< The name of the function. */
+	uint64_t	Calls;			/**< How many times it was called, including the calls made by the library itself. */
+	uint64_t	Bytes;			/**< Characters copied to the destination, read or written. */
+	uint64_t	Truncations;	/**< How many times the result didn't fit in the destination and was cut. */
+	uint64_t	Allocations;	/**< How many blocks of memory it allocated. */
+	} s_stats_t;
+/*=========================================================================*//**
+\brief  		Adds up the counters of all the threads, for each function of
+				the library. The counters exist only if the library was
+				compiled with \a S_STRING_STATS defined. The trivial functions,
+				like \a s_strlen, are not counted.
+\param	stats	Pointer to an array that will receive the counters of the
+				functions, or NULL to only get how many there are.
+\param	count	The number of elements of \a stats.
+\returns		The number of functions with counters, which may be greater
+				than \a count, or zero if the library was compiled without
+				them.
+*//*==========================================================================*/
+size_t       s_stats_snapshot( s_stats_t *stats, size_t count );
+/*=========================================================================*//**
+\brief  		Zeroes the counters of all the threads. The calls made by
+				other threads while the counters are being zeroed may be
+				lost.
+*//*==========================================================================*/
+void         s_stats_reset   ( void );
+/*=========================================================================*//**
+\brief  		Formats of \a s_trace_dump.
+*//*==========================================================================*/
+#define	S_TRACE_TEXT	0	/**< A table, one line per function and size of the input. */
+#define	S_TRACE_JSON	1	/**< An array of objects, with the percentiles and the non-empty buckets of the histograms. */
+/*=========================================================================*//**
+\brief  		Changes how often the calls to the search, comparison,
+				tokenizing and copy functions are timed, if the library was
+				compiled with \a S_STRING_TRACE defined. Each thread times one
+				of every \a period calls (64 by default, or the value of
+				\a S_TRACE_PERIOD when the library was compiled).
+\param	period	The sampling period, or zero to stop timing.
+*//*==========================================================================*/
+void         s_trace_set_period( int period );
+/*=========================================================================*//**
+\brief  		Writes the latency histograms of all the threads to the file
+				descriptor \a fd, one for each traced function and size class
+				of its input (0-15 characters, 16-63, 64-255... 64K and more),
+				with their 50, 90, 99 and 99.9 percentiles in nanoseconds.
+\param	fd		The file descriptor.
+\param	format	\a S_TRACE_TEXT or \a S_TRACE_JSON.
+\returns		Zero if successful or a negative value in case of error, or if
+				the library was compiled without \a S_STRING_TRACE.
+*//*==========================================================================*/
+int          s_trace_dump    ( int fd, int format );
+/*=========================================================================*//**
+\brief  		Empties the latency histograms of all the threads.
+*//*==========================================================================*/
+void         s_trace_reset   ( void );
+/*=========================================================================*//**
+\brief  		Sets the number of threads used by the parallel functions of
+				the library (like \a s_strstr_par), including the calling one.
+				The threads are shared by all of them, and are started the
+				first time they are needed. By default there is one for each
+				processor.
+\param	nthreads	The number of threads (at most 64), 1 to do everything on the
+				calling thread, or zero for one for each processor.
+*//*==========================================================================*/
+void         s_parallel_set_threads  ( int nthreads );
+/*=========================================================================*//**
+\brief  		Sets the size of the data (usually the length of the string)
+				below which the parallel functions don't split their work, since
+				starting it on other threads would cost more than what it
+				saves. The default is 1 MB.
+\param	bytes	The new threshold.
+*//*==========================================================================*/
+void         s_parallel_set_threshold( size_t bytes );
 /*============================================================================*/
 #endif  /*  !defined __S_STRING_H__ */
 /*============================================================================*/